@@ -1,7 +1,6 @@
 ﻿namespace RJCP.Core.Text.Format
 {
     using System;
-    using System.Text;
 
     // The code was then adapted to be pure C# and to fit in with existing code (so we don't
     // have a complete one-to-one, back porting changes from Mono to here is a manual task).
@@ -19,7 +18,10 @@
     //
     // While I've tried to keep the methods as similar as possible, diff tools aren't able to compare
     // this file with NumberFormatter.cs, thus requiring a manual diff.
-    internal sealed class DoubleFormatter
+    //
+    // The formatter is a structure on the stack for the conversion of one value, so that formatting doesn't
+    // allocate. It writes the digits directly into the FormatWriter.
+    internal ref struct DoubleFormatter
     {
         public const int SingleDefPrecision = 7;
         public const int DoubleDefPrecision = 15;
@@ -32,8 +34,8 @@
         private const int DoubleBitsExponentMask = 0x7ff;
         private const long DoubleBitsMantissaMask = 0xfffffffffffff;
 
-        private readonly FormatSpecifier _formatSpecifier;
-        private readonly StringBuilder _sbuf;
+        private readonly FormatField _formatSpecifier;
+        private readonly FormatWriter _sbuf;
         private readonly bool _specifierIsUpper;
         private readonly int _precision;
         private readonly char _specifier;
@@ -55,8 +57,9 @@
 
         // Parse the given format and initialize the following fields:
         //   _isCustomFormat, _specifierIsUpper, _specifier & _precision.
-        public DoubleFormatter(StringBuilder sb, FormatSpecifier format)
+        public DoubleFormatter(FormatWriter sb, in FormatField format)
         {
+            this = default;
             _sbuf = sb;
             _precision = format.Precision;
 
@@ -466,8 +469,9 @@
             if (start >= end)
                 return;
 
-            int i = end - start;
-            char[] cbuf = new char[i];
+            // The digits are written from the end of the reserved characters.
+            int i = _sbuf.Reserve(end - start) + end - start;
+            char[] cbuf = _sbuf.Buffer;
 
             end += _offset;
             start += _offset;
@@ -512,10 +516,7 @@
                     cbuf[--i] = (char)('0' | (v >>= 4) & 0xf);
                     goto case 1;
                 case 1:
-                    if (next == end) {
-                        _sbuf.Append(cbuf);
-                        return;
-                    }
+                    if (next == end) return;
                     continue;
                 }
             }
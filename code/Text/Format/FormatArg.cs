@@ -0,0 +1,97 @@
+﻿namespace RJCP.Core.Text.Format
+{
+    using System;
+
+    // An argument of SPrintF, without boxing. The type of the argument is kept, as the formatters accept different
+    // types and a float is formatted with less precision than a double. Integers are held as a long, sign extended
+    // for the signed types and zero extended for the unsigned types, and floating point values as the bits of a
+    // double.
+    internal readonly struct FormatArg
+    {
+        private readonly long _bits;
+        private readonly object _object;
+
+        private FormatArg(FormatArgKind kind, long bits, object value)
+        {
+            Kind = kind;
+            _bits = bits;
+            _object = value;
+        }
+
+        public FormatArgKind Kind { get; }
+
+        public bool IsInteger
+        {
+            get { return Kind is >= FormatArgKind.Bool and <= FormatArgKind.UInt64; }
+        }
+
+        public long Integer { get { return _bits; } }
+
+        public double Double { get { return BitConverter.Int64BitsToDouble(_bits); } }
+
+        public string String { get { return _object as string; } }
+
+        public static FormatArg FromBool(bool value) { return new FormatArg(FormatArgKind.Bool, value ? -1 : 0, null); }
+
+        public static FormatArg FromChar(char value) { return new FormatArg(FormatArgKind.Char, value, null); }
+
+        public static FormatArg FromSByte(sbyte value) { return new FormatArg(FormatArgKind.SByte, value, null); }
+
+        public static FormatArg FromByte(byte value) { return new FormatArg(FormatArgKind.Byte, value, null); }
+
+        public static FormatArg FromInt16(short value) { return new FormatArg(FormatArgKind.Int16, value, null); }
+
+        public static FormatArg FromUInt16(ushort value) { return new FormatArg(FormatArgKind.UInt16, value, null); }
+
+        public static FormatArg FromInt32(int value) { return new FormatArg(FormatArgKind.Int32, value, null); }
+
+        public static FormatArg FromUInt32(uint value) { return new FormatArg(FormatArgKind.UInt32, value, null); }
+
+        public static FormatArg FromInt64(long value) { return new FormatArg(FormatArgKind.Int64, value, null); }
+
+        public static FormatArg FromUInt64(ulong value) { return new FormatArg(FormatArgKind.UInt64, unchecked((long)value), null); }
+
+        public static FormatArg FromSingle(float value)
+        {
+            return new FormatArg(FormatArgKind.Single, BitConverter.DoubleToInt64Bits(value), null);
+        }
+
+        public static FormatArg FromDouble(double value)
+        {
+            return new FormatArg(FormatArgKind.Double, BitConverter.DoubleToInt64Bits(value), null);
+        }
+
+        public static FormatArg FromDecimal(decimal value)
+        {
+            return new FormatArg(FormatArgKind.Decimal, BitConverter.DoubleToInt64Bits((double)value), null);
+        }
+
+        public static FormatArg FromString(string value)
+        {
+            if (value is null) return default;
+            return new FormatArg(FormatArgKind.String, 0, value);
+        }
+
+        public static FormatArg FromObject(object value)
+        {
+            switch (value) {
+            case null: return default;
+            case int vInt: return FromInt32(vInt);
+            case double vDouble: return FromDouble(vDouble);
+            case string vString: return new FormatArg(FormatArgKind.String, 0, vString);
+            case long vLong: return FromInt64(vLong);
+            case uint vuInt: return FromUInt32(vuInt);
+            case ulong vuLong: return FromUInt64(vuLong);
+            case float vFloat: return FromSingle(vFloat);
+            case char vChar: return FromChar(vChar);
+            case bool vBool: return FromBool(vBool);
+            case short vShort: return FromInt16(vShort);
+            case ushort vuShort: return FromUInt16(vuShort);
+            case sbyte vsByte: return FromSByte(vsByte);
+            case byte vByte: return FromByte(vByte);
+            case decimal vDec: return FromDecimal(vDec);
+            default: return new FormatArg(FormatArgKind.Object, 0, value);
+            }
+        }
+    }
+}
@@ -0,0 +1,52 @@
+﻿namespace RJCP.Core.Text.Format
+{
+    using System;
+
+    // Converts a generic argument to a FormatArg. The conversion is chosen once for each type, so an argument of a
+    // known value type isn't boxed and its type isn't tested on each call. Other types are converted as an object.
+    internal static class FormatArgConverter<T>
+    {
+        public static readonly Func<T, FormatArg> Convert = GetConverter();
+
+        // An array that converts to object[], which is the array of a call with params object[].
+        public static readonly bool IsArgumentArray = typeof(object[]).IsAssignableFrom(typeof(T));
+
+        private static Func<T, FormatArg> GetConverter()
+        {
+            Type type = typeof(T);
+            Delegate converter;
+            if (type == typeof(int)) {
+                converter = new Func<int, FormatArg>(FormatArg.FromInt32);
+            } else if (type == typeof(double)) {
+                converter = new Func<double, FormatArg>(FormatArg.FromDouble);
+            } else if (type == typeof(string)) {
+                converter = new Func<string, FormatArg>(FormatArg.FromString);
+            } else if (type == typeof(long)) {
+                converter = new Func<long, FormatArg>(FormatArg.FromInt64);
+            } else if (type == typeof(uint)) {
+                converter = new Func<uint, FormatArg>(FormatArg.FromUInt32);
+            } else if (type == typeof(ulong)) {
+                converter = new Func<ulong, FormatArg>(FormatArg.FromUInt64);
+            } else if (type == typeof(float)) {
+                converter = new Func<float, FormatArg>(FormatArg.FromSingle);
+            } else if (type == typeof(char)) {
+                converter = new Func<char, FormatArg>(FormatArg.FromChar);
+            } else if (type == typeof(bool)) {
+                converter = new Func<bool, FormatArg>(FormatArg.FromBool);
+            } else if (type == typeof(short)) {
+                converter = new Func<short, FormatArg>(FormatArg.FromInt16);
+            } else if (type == typeof(ushort)) {
+                converter = new Func<ushort, FormatArg>(FormatArg.FromUInt16);
+            } else if (type == typeof(sbyte)) {
+                converter = new Func<sbyte, FormatArg>(FormatArg.FromSByte);
+            } else if (type == typeof(byte)) {
+                converter = new Func<byte, FormatArg>(FormatArg.FromByte);
+            } else if (type == typeof(decimal)) {
+                converter = new Func<decimal, FormatArg>(FormatArg.FromDecimal);
+            } else {
+                return value => FormatArg.FromObject(value);
+            }
+            return (Func<T, FormatArg>)converter;
+        }
+    }
+}
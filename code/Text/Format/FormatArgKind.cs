@@ -0,0 +1,85 @@
+﻿namespace RJCP.Core.Text.Format
+{
+    internal enum FormatArgKind
+    {
+        /// <summary>
+        /// The argument is <see langword="null"/>.
+        /// </summary>
+        Null,
+
+        /// <summary>
+        /// A <see cref="bool"/>, which is -1 if <see langword="true"/> and 0 if <see langword="false"/>.
+        /// </summary>
+        Bool,
+
+        /// <summary>
+        /// A <see cref="char"/>.
+        /// </summary>
+        Char,
+
+        /// <summary>
+        /// A <see cref="sbyte"/>.
+        /// </summary>
+        SByte,
+
+        /// <summary>
+        /// A <see cref="byte"/>.
+        /// </summary>
+        Byte,
+
+        /// <summary>
+        /// A <see cref="short"/>.
+        /// </summary>
+        Int16,
+
+        /// <summary>
+        /// A <see cref="ushort"/>.
+        /// </summary>
+        UInt16,
+
+        /// <summary>
+        /// An <see cref="int"/>.
+        /// </summary>
+        Int32,
+
+        /// <summary>
+        /// A <see cref="uint"/>.
+        /// </summary>
+        UInt32,
+
+        /// <summary>
+        /// A <see cref="long"/>.
+        /// </summary>
+        Int64,
+
+        /// <summary>
+        /// A <see cref="ulong"/>.
+        /// </summary>
+        UInt64,
+
+        /// <summary>
+        /// A <see cref="float"/>.
+        /// </summary>
+        Single,
+
+        /// <summary>
+        /// A <see cref="double"/>.
+        /// </summary>
+        Double,
+
+        /// <summary>
+        /// A <see cref="decimal"/>, which is converted to a <see cref="double"/>.
+        /// </summary>
+        Decimal,
+
+        /// <summary>
+        /// A <see cref="string"/>.
+        /// </summary>
+        String,
+
+        /// <summary>
+        /// Any other object.
+        /// </summary>
+        Object
+    }
+}
@@ -0,0 +1,148 @@
+﻿namespace RJCP.Core.Text.Format
+{
+    // The arguments of a call to SPrintF. They are either the array of a call with params object[], which is
+    // converted as each argument is read, or up to eight arguments of a generic call, which are already converted
+    // and are held in the structure so that the call doesn't allocate. It's passed by reference to the formatters.
+    internal readonly struct FormatArguments
+    {
+        private readonly object[] _values;
+        private readonly FormatArg _arg0;
+        private readonly FormatArg _arg1;
+        private readonly FormatArg _arg2;
+        private readonly FormatArg _arg3;
+        private readonly FormatArg _arg4;
+        private readonly FormatArg _arg5;
+        private readonly FormatArg _arg6;
+        private readonly FormatArg _arg7;
+
+        public FormatArguments(object[] values)
+        {
+            _values = values;
+            _arg0 = default;
+            _arg1 = default;
+            _arg2 = default;
+            _arg3 = default;
+            _arg4 = default;
+            _arg5 = default;
+            _arg6 = default;
+            _arg7 = default;
+            Count = values is null ? 0 : values.Length;
+        }
+
+        public FormatArguments(int count, FormatArg arg0, FormatArg arg1 = default, FormatArg arg2 = default,
+            FormatArg arg3 = default, FormatArg arg4 = default, FormatArg arg5 = default, FormatArg arg6 = default,
+            FormatArg arg7 = default)
+        {
+            _values = null;
+            _arg0 = arg0;
+            _arg1 = arg1;
+            _arg2 = arg2;
+            _arg3 = arg3;
+            _arg4 = arg4;
+            _arg5 = arg5;
+            _arg6 = arg6;
+            _arg7 = arg7;
+            Count = count;
+        }
+
+        // The arguments of the generic overloads, which all forward to one of these.
+        public static FormatArguments Create<T1>(T1 arg1)
+        {
+            // An array of a reference type was the array of arguments before there were generic overloads.
+            if (FormatArgConverter<T1>.IsArgumentArray) return new FormatArguments((object[])(object)arg1);
+
+            return new FormatArguments(1,
+                FormatArgConverter<T1>.Convert(arg1));
+        }
+
+        public static FormatArguments Create<T1, T2>(T1 arg1, T2 arg2)
+        {
+            return new FormatArguments(2,
+                FormatArgConverter<T1>.Convert(arg1),
+                FormatArgConverter<T2>.Convert(arg2));
+        }
+
+        public static FormatArguments Create<T1, T2, T3>(T1 arg1, T2 arg2, T3 arg3)
+        {
+            return new FormatArguments(3,
+                FormatArgConverter<T1>.Convert(arg1),
+                FormatArgConverter<T2>.Convert(arg2),
+                FormatArgConverter<T3>.Convert(arg3));
+        }
+
+        public static FormatArguments Create<T1, T2, T3, T4>(T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return new FormatArguments(4,
+                FormatArgConverter<T1>.Convert(arg1),
+                FormatArgConverter<T2>.Convert(arg2),
+                FormatArgConverter<T3>.Convert(arg3),
+                FormatArgConverter<T4>.Convert(arg4));
+        }
+
+        public static FormatArguments Create<T1, T2, T3, T4, T5>(T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return new FormatArguments(5,
+                FormatArgConverter<T1>.Convert(arg1),
+                FormatArgConverter<T2>.Convert(arg2),
+                FormatArgConverter<T3>.Convert(arg3),
+                FormatArgConverter<T4>.Convert(arg4),
+                FormatArgConverter<T5>.Convert(arg5));
+        }
+
+        public static FormatArguments Create<T1, T2, T3, T4, T5, T6>(T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return new FormatArguments(6,
+                FormatArgConverter<T1>.Convert(arg1),
+                FormatArgConverter<T2>.Convert(arg2),
+                FormatArgConverter<T3>.Convert(arg3),
+                FormatArgConverter<T4>.Convert(arg4),
+                FormatArgConverter<T5>.Convert(arg5),
+                FormatArgConverter<T6>.Convert(arg6));
+        }
+
+        public static FormatArguments Create<T1, T2, T3, T4, T5, T6, T7>(T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return new FormatArguments(7,
+                FormatArgConverter<T1>.Convert(arg1),
+                FormatArgConverter<T2>.Convert(arg2),
+                FormatArgConverter<T3>.Convert(arg3),
+                FormatArgConverter<T4>.Convert(arg4),
+                FormatArgConverter<T5>.Convert(arg5),
+                FormatArgConverter<T6>.Convert(arg6),
+                FormatArgConverter<T7>.Convert(arg7));
+        }
+
+        public static FormatArguments Create<T1, T2, T3, T4, T5, T6, T7, T8>(T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return new FormatArguments(8,
+                FormatArgConverter<T1>.Convert(arg1),
+                FormatArgConverter<T2>.Convert(arg2),
+                FormatArgConverter<T3>.Convert(arg3),
+                FormatArgConverter<T4>.Convert(arg4),
+                FormatArgConverter<T5>.Convert(arg5),
+                FormatArgConverter<T6>.Convert(arg6),
+                FormatArgConverter<T7>.Convert(arg7),
+                FormatArgConverter<T8>.Convert(arg8));
+        }
+
+        public int Count { get; }
+
+        public FormatArg this[int index]
+        {
+            get
+            {
+                if (_values is not null) return FormatArg.FromObject(_values[index]);
+                switch (index) {
+                case 0: return _arg0;
+                case 1: return _arg1;
+                case 2: return _arg2;
+                case 3: return _arg3;
+                case 4: return _arg4;
+                case 5: return _arg5;
+                case 6: return _arg6;
+                default: return _arg7;
+                }
+            }
+        }
+    }
+}
@@ -1,50 +1,48 @@
 ﻿namespace RJCP.Core.Text.Format
 {
     using System;
-    using System.Text;
 
     internal sealed class FormatCharType : IFormatType
     {
-        public void Convert(StringBuilder str, FormatSpecifier formatSpecifier, ref int currentArg, object[] values)
+        public void Convert(FormatWriter str, in FormatField formatSpecifier, ref int currentArg, in FormatArguments values)
         {
-            try {
-                int c = GetChar(values[currentArg]);
-                currentArg++;
-                if (formatSpecifier.Width == -1) formatSpecifier.Width = 1;
-                if (formatSpecifier.Width > 1) {
-                    if (formatSpecifier.FormatFlags.Flag(FormatFlags.LeftJustify)) {
-                        str.Append((char)c);
-                        str.Append(' ', formatSpecifier.Width - 1);
-                    } else {
-                        str.Append(' ', formatSpecifier.Width - 1);
-                        str.Append((char)c);
-                    }
-                    return;
-                }
-                unchecked {
-                    // If the 'int' input doesn't fit within a char, then coerce it and chop of extra bits as done in C.
+            int c = GetChar(values[currentArg]);
+            currentArg++;
+            int width = formatSpecifier.Width == -1 ? 1 : formatSpecifier.Width;
+            if (width > 1) {
+                if (formatSpecifier.FormatFlags.Flag(FormatFlags.LeftJustify)) {
+                    str.Append((char)c);
+                    str.Append(' ', width - 1);
+                } else {
+                    str.Append(' ', width - 1);
                     str.Append((char)c);
                 }
-            } catch (InvalidCastException e) {
-                string message = string.Format("Couldn't convert argument {0} type {1} to a char",
-                    currentArg + 1, values[currentArg].GetType());
-                throw new FormatException(message, e);
+                return;
+            }
+            unchecked {
+                // If the 'int' input doesn't fit within a char, then coerce it and chop of extra bits as done in C.
+                str.Append((char)c);
             }
         }
 
-        private static int GetChar(object value)
+        private static int GetChar(FormatArg value)
         {
             unchecked {
-                if (value is char vChar) return vChar;
-                if (value is sbyte vsByte) return (byte)vsByte;
-                if (value is byte vByte) return vByte;
-                if (value is short vShort) return vShort;
-                if (value is ushort vuShort) return (short)vuShort;
-                if (value is int vInt) return (short)vInt;
-                if (value is uint vuInt) return (short)vuInt;
-                if (value is long vLong) return (short)vLong;
-                if (value is ulong vuLong) return (short)vuLong;
-                if (value is string vString && vString.Length > 0) return vString[0];
+                switch (value.Kind) {
+                case FormatArgKind.Char: return (char)value.Integer;
+                case FormatArgKind.SByte: return (byte)value.Integer;
+                case FormatArgKind.Byte:
+                case FormatArgKind.Int16:
+                case FormatArgKind.UInt16:
+                case FormatArgKind.Int32:
+                case FormatArgKind.UInt32:
+                case FormatArgKind.Int64:
+                case FormatArgKind.UInt64:
+                    return (short)value.Integer;
+                case FormatArgKind.String:
+                    if (value.String.Length > 0) return value.String[0];
+                    break;
+                }
                 throw new FormatException("Parameter doesn't map to an integer");
             }
         }
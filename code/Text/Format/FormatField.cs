@@ -0,0 +1,35 @@
+﻿namespace RJCP.Core.Text.Format
+{
+    using System.Globalization;
+
+    // A format specifier with the width and precision given as an argument (e.g. %*.*f) resolved for one call. The
+    // parsed specifier is shared by all calls with the same format, so it can't hold the values of a call, and this
+    // is passed to the formatters instead of a copy on the heap.
+    internal readonly struct FormatField
+    {
+        public FormatField(FormatSpecifier formatSpecifier)
+            : this(formatSpecifier, formatSpecifier.Width, formatSpecifier.Precision, formatSpecifier.FormatFlags) { }
+
+        public FormatField(FormatSpecifier formatSpecifier, int width, int precision, FormatFlags formatFlags)
+        {
+            FormatFlags = formatFlags;
+            Width = width;
+            Precision = precision;
+            Length = formatSpecifier.Length;
+            Specifier = formatSpecifier.Specifier;
+            NumberFormatInfo = formatSpecifier.NumberFormatInfo;
+        }
+
+        public FormatFlags FormatFlags { get; }
+
+        public int Width { get; }
+
+        public int Precision { get; }
+
+        public string Length { get; }
+
+        public char Specifier { get; }
+
+        public NumberFormatInfo NumberFormatInfo { get; }
+    }
+}
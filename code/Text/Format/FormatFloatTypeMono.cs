@@ -2,15 +2,15 @@
 {
     using System;
     using System.Globalization;
-    using System.Text;
 
     internal sealed class FormatFloatTypeMono : IFormatType
     {
-        public void Convert(StringBuilder str, FormatSpecifier formatSpecifier, ref int currentArg, object[] values)
+        public void Convert(FormatWriter str, in FormatField formatSpecifier, ref int currentArg, in FormatArguments values)
         {
-            double value = GetDouble(values[currentArg]);
+            FormatArg arg = values[currentArg];
+            double value = GetDouble(arg);
 
-            if (values[currentArg] is double) {
+            if (arg.Kind == FormatArgKind.Double) {
                 DoubleToString(str, formatSpecifier, value);
             } else {
                 FloatToString(str, formatSpecifier, (float)value);
@@ -18,37 +18,35 @@
             currentArg++;
         }
 
-        private static double GetDoubleBool(bool value) { return value ? -1 : 0; }
-
-        private static double GetDouble(object value)
+        private static double GetDouble(FormatArg value)
         {
-            if (value is double vDouble) return vDouble;
-            if (value is float vFloat) return vFloat;
-            if (value is int vInt) return vInt;
-            if (value is long vLong) return vLong;
-            if (value is decimal vDec) return (double)vDec;
-            if (value is bool vBool) return GetDoubleBool(vBool);
-            if (value is short vShort) return vShort;
-            if (value is byte vByte) return vByte;
-            if (value is char vChar) return vChar;
-            if (value is uint vuInt) return vuInt;
-            if (value is ulong vuLong) return vuLong;
-            if (value is ushort vuShort) return vuShort;
-            if (value is sbyte vsByte) return vsByte;
-            if (value is string vString && vString.Length > 0) {
-                if (double.TryParse(vString, NumberStyles.Any, CultureInfo.InvariantCulture, out double vsDouble))
+            switch (value.Kind) {
+            case FormatArgKind.Double:
+            case FormatArgKind.Single:
+            case FormatArgKind.Decimal:
+                return value.Double;
+            case FormatArgKind.UInt64:
+                return unchecked((ulong)value.Integer);
+            case FormatArgKind.String:
+                if (value.String.Length > 0 &&
+                    double.TryParse(value.String, NumberStyles.Any, CultureInfo.InvariantCulture, out double vsDouble))
                     return vsDouble;
+                break;
+            default:
+                // A bool is -1 if true.
+                if (value.IsInteger) return value.Integer;
+                break;
             }
             throw new FormatException("Parameter doesn't map to a double");
         }
 
-        public static void FloatToString(StringBuilder str, FormatSpecifier format, float value)
+        public static void FloatToString(FormatWriter str, in FormatField format, float value)
         {
             DoubleFormatter inst = new(str, format);
             inst.ToString(value, DoubleFormatter.SingleDefPrecision);
         }
 
-        public static void DoubleToString(StringBuilder str, FormatSpecifier format, double value)
+        public static void DoubleToString(FormatWriter str, in FormatField format, double value)
         {
             DoubleFormatter inst = new(str, format);
             inst.ToString(value, DoubleFormatter.DoubleDefPrecision);
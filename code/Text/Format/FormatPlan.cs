@@ -0,0 +1,130 @@
+﻿namespace RJCP.Core.Text.Format
+{
+    using System;
+    using System.Collections.Generic;
+
+    // A format string parsed into its literal segments and format specifiers. It is immutable, so it can be cached
+    // and shared between threads, and formatting with it doesn't parse the format string again.
+    internal sealed class FormatPlan
+    {
+        private static readonly FormatType FormatTypes = new();
+
+        private readonly struct Segment
+        {
+            public Segment(int start, int length, FormatSpecifier formatSpecifier)
+            {
+                Start = start;
+                Length = length;
+                FormatSpecifier = formatSpecifier;
+            }
+
+            // The literal text of the format string, if there is no format specifier.
+            public int Start { get; }
+
+            public int Length { get; }
+
+            public FormatSpecifier FormatSpecifier { get; }
+        }
+
+        private readonly string _format;
+        private readonly Segment[] _segments;
+
+        private FormatPlan(string format, Segment[] segments)
+        {
+            _format = format;
+            _segments = segments;
+        }
+
+        public IEnumerable<FormatSpecifier> FormatSpecifiers
+        {
+            get
+            {
+                foreach (Segment segment in _segments) {
+                    if (segment.FormatSpecifier is not null) yield return segment.FormatSpecifier;
+                }
+            }
+        }
+
+        public static FormatPlan Parse(string format)
+        {
+            return Parse(format, false);
+        }
+
+        // If strict, an invalid format specifier is an error, instead of being copied verbatim.
+        public static FormatPlan Parse(string format, bool strict)
+        {
+            List<Segment> segments = new();
+
+            int charPos = 0;
+            while (charPos < format.Length) {
+                int nextCharPos = GetNextFormatChar(format, charPos);
+                if (nextCharPos == -1) {
+                    // No more special characters seen.
+                    AddLiteral(segments, charPos, format.Length - charPos);
+                    break;
+                }
+                AddLiteral(segments, charPos, nextCharPos - charPos);
+                charPos = nextCharPos;
+
+                FormatSpecifier formatSpecifier = FormatSpecifier.Parse(format, ref nextCharPos);
+                if (formatSpecifier is null) {
+                    if (strict) {
+                        string message = string.Format("Invalid format specifier at position {0}", charPos);
+                        throw new FormatException(message);
+                    }
+
+                    // The format specifier is invalid, so copy it verbatim.
+                    AddLiteral(segments, charPos, nextCharPos - charPos);
+                } else {
+                    segments.Add(new Segment(charPos, nextCharPos - charPos, formatSpecifier));
+                }
+                charPos = nextCharPos;
+            }
+            return new FormatPlan(format, segments.ToArray());
+        }
+
+        private static void AddLiteral(List<Segment> segments, int start, int length)
+        {
+            if (length == 0) return;
+
+            // Join with the previous literal, e.g. the text after an invalid format specifier.
+            int last = segments.Count - 1;
+            if (last >= 0 && segments[last].FormatSpecifier is null) {
+                segments[last] = new Segment(segments[last].Start, segments[last].Length + length, null);
+                return;
+            }
+            segments.Add(new Segment(start, length, null));
+        }
+
+        /// <summary>
+        /// Looks through a format string and returns the position of the next interesting character.
+        /// </summary>
+        /// <param name="format">The format specifier to look through.</param>
+        /// <param name="position">The position in the format specifier to start looking from.</param>
+        /// <returns>A position in the format specifier for the next interesting character, otherwise -1 if none found.</returns>
+        private static int GetNextFormatChar(string format, int position)
+        {
+            if (position >= format.Length) return -1;
+            return format.IndexOf('%', position);
+        }
+
+        public void Format(FormatWriter writer, object[] values)
+        {
+            Format(writer, new FormatArguments(values));
+        }
+
+        public void Format(FormatWriter writer, in FormatArguments values)
+        {
+            int currentArg = 0;
+            foreach (Segment segment in _segments) {
+                if (segment.FormatSpecifier is null) {
+                    writer.Append(_format, segment.Start, segment.Length);
+                } else {
+                    // Read the input parameters and convert it.
+                    FormatTypes.Convert(writer, segment.FormatSpecifier, ref currentArg, values);
+                }
+                writer.FlushPart();
+            }
+        }
+    }
+}
@@ -0,0 +1,35 @@
+﻿namespace RJCP.Core.Text.Format
+{
+    using System;
+    using System.Collections.Concurrent;
+    using System.Threading;
+
+    // A thread safe cache of the parsed format strings. The number of entries is bounded: when the cache is full, it
+    // is emptied and fills again with the formats in use, so a stream of formats that are used only once can't grow
+    // it without limit.
+    internal sealed class FormatPlanCache
+    {
+        private readonly ConcurrentDictionary<string, FormatPlan> _plans = new(StringComparer.Ordinal);
+        private readonly int _capacity;
+        private int _count;
+
+        public FormatPlanCache(int capacity)
+        {
+            _capacity = capacity;
+        }
+
+        public FormatPlan GetPlan(string format)
+        {
+            if (_plans.TryGetValue(format, out FormatPlan plan)) return plan;
+
+            // Another thread may parse the same format at the same time, the plans are equivalent.
+            plan = FormatPlan.Parse(format);
+            if (_plans.TryAdd(format, plan) && Interlocked.Increment(ref _count) > _capacity) {
+                // The count is approximate while other threads add, which is good enough for a bound.
+                _plans.Clear();
+                Interlocked.Exchange(ref _count, 0);
+            }
+            return plan;
+        }
+    }
+}
@@ -12,23 +12,23 @@
             NumberFormatInfo = CultureInfo.InvariantCulture.NumberFormat;
         }
 
-        public int ArgumentLength { get; set; }
+        public int ArgumentLength { get; private set; }
 
-        public FormatFlags FormatFlags { get; set; }
+        public FormatFlags FormatFlags { get; private set; }
 
-        public bool WidthAsArg { get; set; }
+        public bool WidthAsArg { get; private set; }
 
-        public int Width { get; set; }
+        public int Width { get; private set; }
 
-        public bool PrecisionAsArg { get; set; }
+        public bool PrecisionAsArg { get; private set; }
 
-        public int Precision { get; set; }
+        public int Precision { get; private set; }
 
-        public string Length { get; set; }
+        public string Length { get; private set; }
 
-        public char Specifier { get; set; }
+        public char Specifier { get; private set; }
 
-        public NumberFormatInfo NumberFormatInfo { get; set; }
+        public NumberFormatInfo NumberFormatInfo { get; private set; }
 
         public static FormatSpecifier Parse(string format, ref int position)
         {
@@ -97,6 +97,7 @@
             if (format[position] != '.') return;
             position++;
 
+            if (position >= format.Length) throw new FormatException("Incomplete format specifier");
             if (format[position] == '*') {
                 formatSpecifier.PrecisionAsArg = true;
                 position++;
@@ -1,31 +1,31 @@
 ﻿namespace RJCP.Core.Text.Format
 {
     using System;
-    using System.Text;
 
     internal sealed class FormatStringType : IFormatType
     {
-        public void Convert(StringBuilder str, FormatSpecifier formatSpecifier, ref int currentArg, object[] values)
+        public void Convert(FormatWriter str, in FormatField formatSpecifier, ref int currentArg, in FormatArguments values)
         {
-            try {
-                string s = (string)values[currentArg] ?? string.Empty;
-                currentArg++;
-                if (formatSpecifier.Width == -1) formatSpecifier.Width = 0;
-                if (formatSpecifier.Width > s.Length) {
-                    if (formatSpecifier.FormatFlags.Flag(FormatFlags.LeftJustify)) {
-                        str.Append(s);
-                        str.Append(' ', formatSpecifier.Width - s.Length);
-                    } else {
-                        str.Append(' ', formatSpecifier.Width - s.Length);
-                        str.Append(s);
-                    }
-                    return;
-                }
-                str.Append(s);
-            } catch (InvalidCastException e) {
+            FormatArg arg = values[currentArg];
+            if (arg.Kind is not FormatArgKind.String and not FormatArgKind.Null) {
                 string message = string.Format("Couldn't convert argument {0} to a string", currentArg);
-                throw new FormatException(message, e);
+                throw new FormatException(message);
+            }
+
+            string s = arg.String ?? string.Empty;
+            currentArg++;
+            int width = formatSpecifier.Width == -1 ? 0 : formatSpecifier.Width;
+            if (width > s.Length) {
+                if (formatSpecifier.FormatFlags.Flag(FormatFlags.LeftJustify)) {
+                    str.Append(s);
+                    str.Append(' ', width - s.Length);
+                } else {
+                    str.Append(' ', width - s.Length);
+                    str.Append(s);
+                }
+                return;
             }
+            str.Append(s);
         }
     }
 }
@@ -1,9 +1,8 @@
 ﻿namespace RJCP.Core.Text.Format
 {
     using System;
-    using System.Text;
 
-    internal sealed class FormatType : IFormatType
+    internal sealed class FormatType
     {
         private static readonly IFormatType FormatInteger = new FormatIntegerType();
         private static readonly IFormatType FormatUnsignedInteger = new FormatUnsignedIntegerType();
@@ -11,34 +10,11 @@
         private static readonly IFormatType FormatString = new FormatStringType();
         private static readonly IFormatType FormatDouble = new FormatFloatTypeMono();
 
-        public void Convert(StringBuilder str, FormatSpecifier formatSpecifier, ref int currentArg, object[] values)
+        public void Convert(FormatWriter str, FormatSpecifier formatSpecifier, ref int currentArg, in FormatArguments values)
         {
-            if (formatSpecifier.WidthAsArg) {
-                if (currentArg >= values.Length) throw new FormatException("Insufficient number of arguments in list");
-                if (values[currentArg] is not int) {
-                    string message = string.Format("Argument {0} must be an integer type when specifying the width", currentArg);
-                    throw new FormatException(message);
-                }
-                formatSpecifier.Width = (int)values[currentArg];
-                if (formatSpecifier.Width < 0) {
-                    formatSpecifier.Width = -formatSpecifier.Width;
-                    formatSpecifier.FormatFlags |= FormatFlags.LeftJustify;
-                }
-                currentArg++;
-            }
-            if (formatSpecifier.PrecisionAsArg) {
-                if (currentArg >= values.Length) throw new FormatException("Insufficient number of arguments in list");
-                if (values[currentArg] is not int) {
-                    string message = string.Format("Argument {0} must be an integer type when specifying the precision", currentArg);
-                    throw new FormatException(message);
-                }
-                formatSpecifier.Precision = (int)values[currentArg];
-                if (formatSpecifier.Precision < 0) {
-                    formatSpecifier.Precision = -1;
-                    formatSpecifier.PrecisionAsArg = false;
-                }
-                currentArg++;
-            }
+            FormatField field = formatSpecifier.WidthAsArg || formatSpecifier.PrecisionAsArg ?
+                GetArguments(formatSpecifier, ref currentArg, values) :
+                new FormatField(formatSpecifier);
 
             // Handle all specifiers that don't need an argument.
             switch (formatSpecifier.Specifier) {
@@ -50,38 +26,38 @@
             }
 
             // Handle all specifiers that need an argument.
-            if (values is null || currentArg >= values.Length) throw new FormatException("Insufficient number of arguments in list");
+            if (currentArg >= values.Count) throw new FormatException("Insufficient number of arguments in list");
             switch (formatSpecifier.Specifier) {
             case 'd':
             case 'i':
-                FormatInteger.Convert(str, formatSpecifier, ref currentArg, values);
+                FormatInteger.Convert(str, field, ref currentArg, values);
                 return;
             case 'o':
             case 'u':
             case 'x':
             case 'X':
-                FormatUnsignedInteger.Convert(str, formatSpecifier, ref currentArg, values);
+                FormatUnsignedInteger.Convert(str, field, ref currentArg, values);
                 return;
             case 'f':
             case 'F':
-                FormatDouble.Convert(str, formatSpecifier, ref currentArg, values);
+                FormatDouble.Convert(str, field, ref currentArg, values);
                 return;
             case 'e':
             case 'E':
-                FormatDouble.Convert(str, formatSpecifier, ref currentArg, values);
+                FormatDouble.Convert(str, field, ref currentArg, values);
                 return;
             case 'g':
             case 'G':
-                FormatDouble.Convert(str, formatSpecifier, ref currentArg, values);
+                FormatDouble.Convert(str, field, ref currentArg, values);
                 return;
             case 'a':
             case 'A':
                 break;
             case 'c':
-                FormatChar.Convert(str, formatSpecifier, ref currentArg, values);
+                FormatChar.Convert(str, field, ref currentArg, values);
                 return;
             case 's':
-                FormatString.Convert(str, formatSpecifier, ref currentArg, values);
+                FormatString.Convert(str, field, ref currentArg, values);
                 return;
             case 'p':
                 break;
@@ -91,5 +67,39 @@
 
             throw new NotImplementedException();
         }
+
+        private static FormatField GetArguments(FormatSpecifier formatSpecifier, ref int currentArg, in FormatArguments values)
+        {
+            int width = formatSpecifier.Width;
+            int precision = formatSpecifier.Precision;
+            FormatFlags formatFlags = formatSpecifier.FormatFlags;
+
+            if (formatSpecifier.WidthAsArg) {
+                if (currentArg >= values.Count) throw new FormatException("Insufficient number of arguments in list");
+                FormatArg arg = values[currentArg];
+                if (arg.Kind != FormatArgKind.Int32) {
+                    string message = string.Format("Argument {0} must be an integer type when specifying the width", currentArg);
+                    throw new FormatException(message);
+                }
+                width = (int)arg.Integer;
+                if (width < 0) {
+                    width = -width;
+                    formatFlags |= FormatFlags.LeftJustify;
+                }
+                currentArg++;
+            }
+            if (formatSpecifier.PrecisionAsArg) {
+                if (currentArg >= values.Count) throw new FormatException("Insufficient number of arguments in list");
+                FormatArg arg = values[currentArg];
+                if (arg.Kind != FormatArgKind.Int32) {
+                    string message = string.Format("Argument {0} must be an integer type when specifying the precision", currentArg);
+                    throw new FormatException(message);
+                }
+                precision = (int)arg.Integer;
+                if (precision < 0) precision = -1;
+                currentArg++;
+            }
+            return new FormatField(formatSpecifier, width, precision, formatFlags);
+        }
     }
 }
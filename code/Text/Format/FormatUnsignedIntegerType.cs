@@ -5,85 +5,53 @@ namespace RJCP.Core.Text.Format
 {
     using System;
     using System.Globalization;
-    using System.Text;
 
     internal sealed class FormatUnsignedIntegerType : IFormatType
     {
-        public void Convert(StringBuilder str, FormatSpecifier formatSpecifier, ref int currentArg, object[] values)
+        public void Convert(FormatWriter str, in FormatField formatSpecifier, ref int currentArg, in FormatArguments values)
         {
-            try {
-                ulong value = 0;
-                if (formatSpecifier.Length is null || formatSpecifier.Length.Equals("l")) {
-                    value = GetULongUInt(values[currentArg]);
-                } else if (formatSpecifier.Length.Equals("hh")) {
-                    value = GetULongByte(values[currentArg]);
-                } else if (formatSpecifier.Length.Equals("h")) {
-                    value = GetULongUShort(values[currentArg]);
-                } else if (formatSpecifier.Length.Equals("ll") || formatSpecifier.Length.Equals("z") ||
-                    formatSpecifier.Length.Equals("t") || formatSpecifier.Length.Equals("j")) {
-                    value = GetULong(values[currentArg]);
-                } else {
-                    value = GetULongUInt(values[currentArg]);
-                }
-                currentArg++;
-                UlongToString(str, formatSpecifier, value);
-            } catch (InvalidCastException e) {
-                string message = string.Format("Couldn't convert argument {0} to an integer", currentArg);
-                throw new FormatException(message, e);
+            ulong value = 0;
+            if (formatSpecifier.Length is null || formatSpecifier.Length.Equals("l")) {
+                value = GetULongUInt(values[currentArg]);
+            } else if (formatSpecifier.Length.Equals("hh")) {
+                value = GetULongByte(values[currentArg]);
+            } else if (formatSpecifier.Length.Equals("h")) {
+                value = GetULongUShort(values[currentArg]);
+            } else if (formatSpecifier.Length.Equals("ll") || formatSpecifier.Length.Equals("z") ||
+                formatSpecifier.Length.Equals("t") || formatSpecifier.Length.Equals("j")) {
+                value = GetULong(values[currentArg]);
+            } else {
+                value = GetULongUInt(values[currentArg]);
             }
+            currentArg++;
+            UlongToString(str, formatSpecifier, value);
         }
 
-        private static uint GetULongUInt(object arg) { return unchecked((uint)(GetULong(arg) & 0xFFFFFFFF)); }
+        private static uint GetULongUInt(FormatArg arg) { return unchecked((uint)(GetULong(arg) & 0xFFFFFFFF)); }
 
-        private static byte GetULongByte(object arg) { return unchecked((byte)(GetULong(arg) & 0xFF)); }
+        private static byte GetULongByte(FormatArg arg) { return unchecked((byte)(GetULong(arg) & 0xFF)); }
 
-        private static ushort GetULongUShort(object arg) { return unchecked((ushort)(GetULong(arg) & 0xFFFF)); }
+        private static ushort GetULongUShort(FormatArg arg) { return unchecked((ushort)(GetULong(arg) & 0xFFFF)); }
 
-        private static ulong GetULongBool(bool value) { return value ? unchecked((ulong)-1) : 0; }
-
-        private static ulong GetULong(object value)
+        private static ulong GetULong(FormatArg value)
         {
-            unchecked {
-                if (value is int vInt) return (ulong)vInt;
-                if (value is long vLong) return (ulong)vLong;
-                if (value is bool vBool) return GetULongBool(vBool);
-                if (value is short vShort) return (ulong)vShort;
-                if (value is char vChar) return vChar;
-                if (value is sbyte vsByte) return (ulong)vsByte;
-                if (value is byte vByte) return vByte;
-                if (value is uint vuInt) return vuInt;
-                if (value is ulong vuLong) return vuLong;
-                if (value is ushort vuShort) return vuShort;
-                if (value is string vString && vString.Length > 0) {
-                    if (ulong.TryParse(vString, NumberStyles.Integer, CultureInfo.InvariantCulture, out ulong vsuLong))
-                        return vsuLong;
-                }
-                throw new FormatException("Parameter doesn't map to an unsigned integer");
+            // Signed values are sign extended, and a bool is all bits set if true.
+            if (value.IsInteger) return unchecked((ulong)value.Integer);
+            if (value.Kind == FormatArgKind.String && value.String.Length > 0) {
+                if (ulong.TryParse(value.String, NumberStyles.Integer, CultureInfo.InvariantCulture, out ulong vsuLong))
+                    return vsuLong;
             }
+            throw new FormatException("Parameter doesn't map to an unsigned integer");
         }
 
-        private static readonly char[] BaseDigitsLower = new[] {
-                '0', '1', '2', '3', '4', '5', '6', '7',
-                '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
-            };
-
-        private static readonly char[] BaseDigitsUpper = new[] {
-                '0', '1', '2', '3', '4', '5', '6', '7',
-                '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
-            };
-
-        private static void UlongToString(StringBuilder str, FormatSpecifier formatSpecifier, ulong value)
+        private static void UlongToString(FormatWriter str, in FormatField formatSpecifier, ulong value)
         {
             int alternative = 0;
-            ulong baseNumber;
-            char[] baseDigits;
             int sign = 0;
             int digits = 0;
 
             switch (formatSpecifier.Specifier) {
             case 'x':
-                baseNumber = 16;
-                baseDigits = BaseDigitsLower;
                 // Sign and Blank are ignored
                 if (value != 0) {
                     // Strange, that GCC only displays 0x if the value isn't zero.
@@ -94,8 +62,6 @@ namespace RJCP.Core.Text.Format
                 }
                 break;
             case 'X':
-                baseNumber = 16;
-                baseDigits = BaseDigitsUpper;
                 // Sign and Blank are ignored
                 if (value != 0) {
                     if (formatSpecifier.FormatFlags.Flag(FormatFlags.Alternative)) alternative = 2;
@@ -105,8 +71,6 @@ namespace RJCP.Core.Text.Format
                 }
                 break;
             case 'o':
-                baseNumber = 8;
-                baseDigits = BaseDigitsLower;
                 // Sign and Blank are ignored
                 if (value != 0) {
                     // Strange, that GCC only displays 0x if the value isn't zero.
@@ -117,8 +81,6 @@ namespace RJCP.Core.Text.Format
                 }
                 break;
             case 'u':
-                baseNumber = 10;
-                baseDigits = BaseDigitsLower;
 #if SHOW_ULONG_SIGN
                 // In GCC, these options appear to be ignored, and so is commented out.
                 if (formatSpecifier.FormatFlags.Flag(FormatFlags.ShowSign)) {
@@ -175,14 +137,13 @@ namespace RJCP.Core.Text.Format
             if (zeroes > 0) str.Append('0', zeroes);
 
             if (digits > 0) {
-                char[] rawnum = new char[digits];
-                ulong tValue = value;
-                for (int i = digits; i > 0; --i) {
-                    int digit = (int)(tValue % baseNumber);
-                    tValue /= baseNumber;
-                    rawnum[i - 1] = baseDigits[digit];
+                int end = str.Reserve(digits) + digits;
+                switch (formatSpecifier.Specifier) {
+                case 'x': Numbers.WriteHexDigits(str.Buffer, end, value, digits, false); break;
+                case 'X': Numbers.WriteHexDigits(str.Buffer, end, value, digits, true); break;
+                case 'o': Numbers.WriteOctalDigits(str.Buffer, end, value, digits); break;
+                default: Numbers.WriteDigits(str.Buffer, end, value); break;
                 }
-                str.Append(rawnum);
             }
 
             if (padding > 0 && formatSpecifier.FormatFlags.Flag(FormatFlags.LeftJustify)) {
@@ -0,0 +1,268 @@
+﻿namespace RJCP.Core.Text.Format
+{
+    using System;
+    using System.IO;
+    using System.Text;
+
+#if NET6_0_OR_GREATER
+    using System.Buffers;
+    using System.Text.Unicode;
+#endif
+
+    // The characters written by the formatters, in a buffer that grows as needed. Formatting doesn't allocate once a
+    // thread has a buffer that is large enough: Acquire() returns the buffer of the thread, and Release() keeps it for
+    // the next call. A nested Acquire() before the Release() gets a new buffer, so the formatters can't overwrite the
+    // result of the caller.
+    internal sealed class FormatWriter
+    {
+        private const int DefaultCapacity = 256;
+
+        // Larger buffers aren't kept, so that formatting a large string once doesn't hold the memory.
+        private const int MaxCachedCapacity = 4096;
+
+        // A result written to a target is flushed in parts of about this length, so the buffer stays small enough
+        // to be kept.
+        private const int FlushLength = 2048;
+
+        [ThreadStatic]
+        private static FormatWriter CachedInstance;
+
+        private char[] _buffer;
+        private int _length;
+
+        // The bytes encoded to write to a stream, allocated when first needed.
+        private byte[] _encoded;
+
+        // When there is a target, the characters are written to it in parts as they're formatted, so that a long
+        // result isn't held in the buffer. The number of characters, or bytes for a stream, already written to the
+        // target is counted.
+        private TextWriter _targetWriter;
+        private Stream _targetStream;
+        private Encoding _targetEncoding;
+        private int _flushed;
+
+#if NET6_0_OR_GREATER
+        // The buffer is rented from the shared pool, and is returned by Return().
+        private bool _rented;
+#endif
+
+        // A writer that isn't the buffer of a thread, for a result that is kept after the call.
+        public FormatWriter(int capacity)
+        {
+            _buffer = new char[capacity];
+        }
+
+        public static FormatWriter Acquire()
+        {
+            FormatWriter writer = CachedInstance;
+            if (writer is null) return new FormatWriter(DefaultCapacity);
+
+            CachedInstance = null;
+            writer._length = 0;
+            return writer;
+        }
+
+        public static void Release(FormatWriter writer)
+        {
+            writer._targetWriter = null;
+            writer._targetStream = null;
+            writer._targetEncoding = null;
+            if (writer._buffer.Length > MaxCachedCapacity) return;
+            if (writer._encoded is not null && writer._encoded.Length > MaxCachedCapacity * 4) writer._encoded = null;
+            CachedInstance = writer;
+        }
+
+#if NET6_0_OR_GREATER
+        // A writer with a buffer rented from the shared pool, for a large result that is kept until it's copied,
+        // such as a chunk of a batch. The buffer is given back with Return(), after which the writer is empty and
+        // can't be used.
+        public static FormatWriter Rent(int capacity)
+        {
+            return new FormatWriter(ArrayPool<char>.Shared.Rent(capacity), true);
+        }
+
+        private FormatWriter(char[] buffer, bool rented)
+        {
+            _buffer = buffer;
+            _rented = rented;
+        }
+
+        public void Return()
+        {
+            if (!_rented) return;
+            ArrayPool<char>.Shared.Return(_buffer);
+            _buffer = Array.Empty<char>();
+            _length = 0;
+            _rented = false;
+        }
+#endif
+
+        // The characters written are the first Length characters of the buffer. The buffer changes when it grows.
+        public char[] Buffer { get { return _buffer; } }
+
+        public int Length { get { return _length; } }
+
+        public void Clear()
+        {
+            _length = 0;
+        }
+
+        public void Append(char value)
+        {
+            if (_length == _buffer.Length) Grow(1);
+            _buffer[_length++] = value;
+        }
+
+        public void Append(char value, int repeatCount)
+        {
+            if (repeatCount <= 0) return;
+            int start = Reserve(repeatCount);
+            for (int i = 0; i < repeatCount; i++) {
+                _buffer[start + i] = value;
+            }
+        }
+
+        public void Append(string value)
+        {
+            if (value is null) return;
+            Append(value, 0, value.Length);
+        }
+
+        public void Append(string value, int startIndex, int count)
+        {
+            int start = Reserve(count);
+            value.CopyTo(startIndex, _buffer, start, count);
+        }
+
+        // Adds count characters at the end, which the caller writes at the position returned in Buffer.
+        public int Reserve(int count)
+        {
+            if (_buffer.Length - _length < count) Grow(count);
+            int start = _length;
+            _length += count;
+            return start;
+        }
+
+        private void Grow(int count)
+        {
+            int capacity = Math.Max(_buffer.Length * 2, _length + count);
+#if NET6_0_OR_GREATER
+            if (_rented) {
+                char[] rented = ArrayPool<char>.Shared.Rent(capacity);
+                Array.Copy(_buffer, rented, _length);
+                ArrayPool<char>.Shared.Return(_buffer);
+                _buffer = rented;
+                return;
+            }
+#endif
+            char[] buffer = new char[capacity];
+            Array.Copy(_buffer, buffer, _length);
+            _buffer = buffer;
+        }
+
+        public void SetTarget(TextWriter writer)
+        {
+            _targetWriter = writer;
+            _flushed = 0;
+        }
+
+        // The characters are encoded in parts, each on its own, so no preamble is written.
+        public void SetTarget(Stream stream, Encoding encoding)
+        {
+            _targetStream = stream;
+            _targetEncoding = encoding;
+            _flushed = 0;
+        }
+
+        // Called between the parts of a result, writes the characters so far to the target once there are enough.
+        public void FlushPart()
+        {
+            if (_length < FlushLength) return;
+            if (_targetWriter is null && _targetStream is null) return;
+
+            // A pair of surrogates isn't split, so that it's encoded as one character.
+            int length = _length;
+            if (char.IsHighSurrogate(_buffer[length - 1])) length--;
+            Flush(length);
+        }
+
+        // Writes the rest of the result to the target, and returns the number of characters, or bytes for a stream,
+        // written for the result.
+        public int Flush()
+        {
+            Flush(_length);
+            return _flushed;
+        }
+
+        private void Flush(int length)
+        {
+            if (_targetWriter is not null) {
+                _targetWriter.Write(_buffer, 0, length);
+                _flushed += length;
+            } else {
+                int maxCount = _targetEncoding.GetMaxByteCount(length);
+                if (_encoded is null || _encoded.Length < maxCount) {
+                    _encoded = new byte[Math.Max(maxCount, DefaultCapacity)];
+                }
+                int count = _targetEncoding.GetBytes(_buffer, 0, length, _encoded, 0);
+                _targetStream.Write(_encoded, 0, count);
+                _flushed += count;
+            }
+
+            _length -= length;
+            if (_length > 0) Array.Copy(_buffer, length, _buffer, 0, _length);
+        }
+
+#if NET6_0_OR_GREATER
+        public ReadOnlySpan<char> AsSpan(int start, int length)
+        {
+            return new ReadOnlySpan<char>(_buffer, start, length);
+        }
+
+        // Copies all characters written, or nothing if the destination is too small.
+        public bool TryCopyTo(Span<char> destination, out int charsWritten)
+        {
+            if (!AsSpan(0, _length).TryCopyTo(destination)) {
+                charsWritten = 0;
+                return false;
+            }
+            charsWritten = _length;
+            return true;
+        }
+
+        public int CopyTo(IBufferWriter<char> writer)
+        {
+            if (_length == 0) return 0;
+            AsSpan(0, _length).CopyTo(writer.GetSpan(_length));
+            writer.Advance(_length);
+            return _length;
+        }
+
+        // Encodes all characters written as UTF-8, or nothing if the destination is too small. A lone surrogate is
+        // replaced, as for Encoding.UTF8.
+        public bool TryCopyToUtf8(Span<byte> destination, out int bytesWritten)
+        {
+            OperationStatus status = Utf8.FromUtf16(AsSpan(0, _length), destination, out _, out bytesWritten);
+            if (status != OperationStatus.Done) {
+                bytesWritten = 0;
+                return false;
+            }
+            return true;
+        }
+
+        public int CopyToUtf8(IBufferWriter<byte> writer)
+        {
+            if (_length == 0) return 0;
+            ReadOnlySpan<char> chars = AsSpan(0, _length);
+            int count = Encoding.UTF8.GetBytes(chars, writer.GetSpan(Encoding.UTF8.GetByteCount(chars)));
+            writer.Advance(count);
+            return count;
+        }
+#endif
+
+        public override string ToString()
+        {
+            return new string(_buffer, 0, _length);
+        }
+    }
+}
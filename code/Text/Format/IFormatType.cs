@@ -1,9 +1,7 @@
 ﻿namespace RJCP.Core.Text.Format
 {
-    using System.Text;
-
     internal interface IFormatType
     {
-        void Convert(StringBuilder str, FormatSpecifier formatSpecifier, ref int currentArg, object[] values);
+        void Convert(FormatWriter str, in FormatField formatSpecifier, ref int currentArg, in FormatArguments values);
     }
 }
@@ -1,28 +1,19 @@
 ﻿namespace RJCP.Core.Text.Format
 {
+#if NET6_0_OR_GREATER
+    using System.Numerics;
+#endif
+#if NET8_0_OR_GREATER
+    using System;
+    using System.Buffers.Binary;
+    using System.Runtime.InteropServices;
+    using System.Runtime.Intrinsics;
+    using System.Runtime.Intrinsics.Arm;
+    using System.Runtime.Intrinsics.X86;
+#endif
+
     internal static class Numbers
     {
-        private static readonly long[] LongPowerOfTenNegative = new long[] {
-            -10,                                 //  2
-            -100,                                //  3
-            -1000,                               //  4
-            -10000,                              //  5
-            -100000,                             //  6
-            -1000000,                            //  7
-            -10000000,                           //  8
-            -100000000,                          //  9
-            -1000000000,                         // 10
-            -10000000000,                        // 11
-            -100000000000,                       // 12
-            -1000000000000,                      // 13
-            -10000000000000,                     // 14
-            -100000000000000,                    // 15
-            -1000000000000000,                   // 16
-            -10000000000000000,                  // 17
-            -100000000000000000,                 // 18
-            -1000000000000000000,                // 19 digits
-        };
-
         private static readonly long[] LongPowerOfTenPositive = new long[] {
             10,                                  //  2
             100,                                 //  3
@@ -44,7 +35,8 @@
             1000000000000000000,                 // 19 digits (long)
         };
 
-        private static readonly ulong[] ULongPowerOfTenPositive = new ulong[] {
+        private static readonly ulong[] ULongPowerOfTen = new ulong[] {
+            1,                                   //  1
             10,                                  //  2
             100,                                 //  3
             1000,                                //  4
@@ -66,67 +58,175 @@
             10000000000000000000                 // 20 digits (ulong)
         };
 
+        // The digits of 00 to 99, two characters each, to write the digits of a number two at a time.
+        private static readonly char[] DigitPairs =
+            ("00010203040506070809" +
+             "10111213141516171819" +
+             "20212223242526272829" +
+             "30313233343536373839" +
+             "40414243444546474849" +
+             "50515253545556575859" +
+             "60616263646566676869" +
+             "70717273747576777879" +
+             "80818283848586878889" +
+             "90919293949596979899").ToCharArray();
+
+        // The hexadecimal digits of the bytes 00 to FF, two characters each, to write a byte at a time.
+        private static readonly char[] HexPairsLower = GetHexPairs("0123456789abcdef");
+        private static readonly char[] HexPairsUpper = GetHexPairs("0123456789ABCDEF");
+
+        // The octal digits of 00 to 77, two characters each, to write six bits at a time.
+        private static readonly char[] OctalPairs = GetHexPairs("01234567");
+
+#if NET8_0_OR_GREATER
+        // The hexadecimal digits as ASCII, indexed by a nibble in a shuffle.
+        private static readonly Vector128<byte> HexDigitsLower = Vector128.Create("0123456789abcdef"u8);
+        private static readonly Vector128<byte> HexDigitsUpper = Vector128.Create("0123456789ABCDEF"u8);
+#endif
+
+        private static char[] GetHexPairs(string digits)
+        {
+            int radix = digits.Length;
+            char[] pairs = new char[radix * radix * 2];
+            for (int i = 0; i < radix * radix; i++) {
+                pairs[i * 2] = digits[i / radix];
+                pairs[i * 2 + 1] = digits[i % radix];
+            }
+            return pairs;
+        }
+
         public static int CountDigits(long value)
         {
-            // Bisect through the arrays looking for the length of the number in digits
-            if (value >= 0) {
-                int lower = 0; int upper = LongPowerOfTenPositive.Length - 1;
-                while (true) {
-                    int mid = (lower + upper) >> 1;
-                    if (value < LongPowerOfTenPositive[mid]) {
-                        if (mid == 0) return 1;
-                        upper = mid - 1;
-                    } else if (mid < LongPowerOfTenPositive.Length - 1 && value >= LongPowerOfTenPositive[mid + 1]) {
-                        lower = mid + 1;
-                    } else {
-                        return mid + 2;
-                    }
-                }
+            // The magnitude of long.MinValue is representable as an unsigned long.
+            return CountDigits(value < 0 ? unchecked((ulong)-value) : (ulong)value);
+        }
+
+        public static int CountDigits(ulong value)
+        {
+            // The number of bits times log10(2), with 1233 / 4096 as an approximation, is the number of digits less
+            // one, or for values from the power of ten to the next power of two, the number of digits. Zero is
+            // counted as one, which has the same number of digits.
+            value |= 1;
+            int bits = 64 - LeadingZeroCount(value);
+            int digits = (bits * 1233) >> 12;
+            if (value < ULongPowerOfTen[digits]) return digits;
+            return digits + 1;
+        }
+
+        public static int CountBitDigits(ulong value, int bitsPerDigit)
+        {
+            // Zero also needs one character.
+            int firstBitPos = 64 - LeadingZeroCount(value | 1);
+            return firstBitPos / bitsPerDigit + (firstBitPos % bitsPerDigit == 0 ? 0 : 1);
+        }
+
+        private static int LeadingZeroCount(ulong value)
+        {
+#if NET6_0_OR_GREATER
+            return BitOperations.LeadingZeroCount(value);
+#else
+            if (value == 0) return 64;
+            int zeroes = 0;
+            if (value <= 0x00000000FFFFFFFF) { zeroes += 32; value <<= 32; }
+            if (value <= 0x0000FFFFFFFFFFFF) { zeroes += 16; value <<= 16; }
+            if (value <= 0x00FFFFFFFFFFFFFF) { zeroes += 8; value <<= 8; }
+            if (value <= 0x0FFFFFFFFFFFFFFF) { zeroes += 4; value <<= 4; }
+            if (value <= 0x3FFFFFFFFFFFFFFF) { zeroes += 2; value <<= 2; }
+            if (value <= 0x7FFFFFFFFFFFFFFF) { zeroes += 1; }
+            return zeroes;
+#endif
+        }
+
+        // Writes the decimal digits of the value into the buffer, ending before the position end. The caller
+        // reserves the number of digits from CountDigits. Zero is written as one digit.
+        public static void WriteDigits(char[] buffer, int end, ulong value)
+        {
+            // Divide with 64-bit arithmetic only while the value needs it.
+            while (value > uint.MaxValue) {
+                ulong quotient = value / 100;
+                int pair = (int)(value - quotient * 100) << 1;
+                buffer[--end] = DigitPairs[pair + 1];
+                buffer[--end] = DigitPairs[pair];
+                value = quotient;
+            }
+
+            uint small = (uint)value;
+            while (small >= 100) {
+                uint quotient = small / 100;
+                int pair = (int)(small - quotient * 100) << 1;
+                buffer[--end] = DigitPairs[pair + 1];
+                buffer[--end] = DigitPairs[pair];
+                small = quotient;
+            }
+
+            if (small >= 10) {
+                int pair = (int)small << 1;
+                buffer[--end] = DigitPairs[pair + 1];
+                buffer[end - 1] = DigitPairs[pair];
             } else {
-                int lower = 0; int upper = LongPowerOfTenNegative.Length - 1;
-                while (true) {
-                    int mid = (lower + upper) >> 1;
-                    if (value > LongPowerOfTenNegative[mid]) {
-                        if (mid == 0) return 1;
-                        upper = mid - 1;
-                    } else if (mid < LongPowerOfTenNegative.Length - 1 && value <= LongPowerOfTenNegative[mid + 1]) {
-                        lower = mid + 1;
-                    } else {
-                        return mid + 2;
-                    }
-                }
+                buffer[end - 1] = (char)('0' + small);
             }
         }
 
-        public static int CountDigits(ulong value)
+        // Writes the hexadecimal digits of the value into the buffer, ending before the position end. The caller
+        // reserves the number of digits from CountBitDigits with four bits per digit.
+        public static void WriteHexDigits(char[] buffer, int end, ulong value, int digits, bool upper)
         {
-            // Bisect through the arrays looking for the length of the number in digits
-            int lower = 0; int upper = LongPowerOfTenPositive.Length - 1;
-            while (true) {
-                int mid = (lower + upper) >> 1;
-                if (value < ULongPowerOfTenPositive[mid]) {
-                    if (mid == 0) return 1;
-                    upper = mid - 1;
-                } else if (mid < LongPowerOfTenPositive.Length - 1 && value >= ULongPowerOfTenPositive[mid + 1]) {
-                    lower = mid + 1;
-                } else {
-                    return mid + 2;
-                }
+#if NET8_0_OR_GREATER
+            // A value of more than 32 bits is converted in one step, instead of a loop of five to eight bytes.
+            if (digits > 8 && BitConverter.IsLittleEndian && (Ssse3.IsSupported || AdvSimd.Arm64.IsSupported)) {
+                WriteHexDigitsVector(buffer, end, value, digits, upper);
+                return;
             }
+#endif
+            char[] pairs = upper ? HexPairsUpper : HexPairsLower;
+            int start = end - digits;
+            while (end - start >= 2) {
+                int pair = (int)(value & 0xFF) << 1;
+                buffer[--end] = pairs[pair + 1];
+                buffer[--end] = pairs[pair];
+                value >>= 8;
+            }
+
+            // An odd number of digits leaves one nibble, which is the second digit of its pair.
+            if (end > start) buffer[start] = pairs[((int)value << 1) + 1];
         }
 
-        public static int CountBitDigits(ulong value, int bitsPerDigit)
+#if NET8_0_OR_GREATER
+        private static void WriteHexDigitsVector(char[] buffer, int end, ulong value, int digits, bool upper)
         {
-            if (value == 0) return 1;  // zero also needs one character
-            int firstBitPos = 64;
-            if (value <= 0x00000000FFFFFFFF) { firstBitPos -= 32; value <<= 32; }
-            if (value <= 0x0000FFFFFFFFFFFF) { firstBitPos -= 16; value <<= 16; }
-            if (value <= 0x00FFFFFFFFFFFFFF) { firstBitPos -= 8; value <<= 8; }
-            if (value <= 0x0FFFFFFFFFFFFFFF) { firstBitPos -= 4; value <<= 4; }
-            if (value <= 0x3FFFFFFFFFFFFFFF) { firstBitPos -= 2; value <<= 2; }
-            if (value <= 0x7FFFFFFFFFFFFFFF) { firstBitPos -= 1; }
+            // The bytes of the value, most significant first, are widened to two bytes, the upper nibble in the
+            // first and the lower nibble in the second. These are the indices of the digits in the shuffle.
+            Vector128<ushort> bytes = Vector128.WidenLower(
+                Vector128.CreateScalarUnsafe(BinaryPrimitives.ReverseEndianness(value)).AsByte());
+            Vector128<byte> nibbles = (Vector128.ShiftRightLogical(bytes, 4) |
+                Vector128.ShiftLeft(bytes & Vector128.Create((ushort)0x0F), 8)).AsByte();
 
-            return firstBitPos / bitsPerDigit + (firstBitPos % bitsPerDigit == 0 ? 0 : 1);
+            Vector128<byte> table = upper ? HexDigitsUpper : HexDigitsLower;
+            Vector128<byte> ascii = Ssse3.IsSupported ?
+                Ssse3.Shuffle(table, nibbles) :
+                AdvSimd.Arm64.VectorTableLookup(table, nibbles);
+
+            Span<ushort> hex = stackalloc ushort[16];
+            Vector128.WidenLower(ascii).CopyTo(hex);
+            Vector128.WidenUpper(ascii).CopyTo(hex.Slice(8));
+            MemoryMarshal.Cast<ushort, char>(hex).Slice(16 - digits).CopyTo(buffer.AsSpan(end - digits, digits));
+        }
+#endif
+
+        // Writes the octal digits of the value into the buffer, ending before the position end. The caller
+        // reserves the number of digits from CountBitDigits with three bits per digit.
+        public static void WriteOctalDigits(char[] buffer, int end, ulong value, int digits)
+        {
+            int start = end - digits;
+            while (end - start >= 2) {
+                int pair = (int)(value & 0x3F) << 1;
+                buffer[--end] = OctalPairs[pair + 1];
+                buffer[--end] = OctalPairs[pair];
+                value >>= 6;
+            }
+
+            if (end > start) buffer[start] = OctalPairs[((int)value << 1) + 1];
         }
 
         public static long GetTenPowerOf(int i)
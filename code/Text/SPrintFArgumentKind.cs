@@ -0,0 +1,48 @@
+﻿namespace RJCP.Core.Text
+{
+    /// <summary>
+    /// The kind of an argument that a <see cref="SPrintFFormat"/> expects.
+    /// </summary>
+#if SPRINTF_GENERATOR
+    // The source generator compiles this file to parse the format, but must not export the type.
+    internal enum SPrintFArgumentKind
+#else
+    public enum SPrintFArgumentKind
+#endif
+    {
+        /// <summary>
+        /// The field width, given by <c>*</c>, as an <see cref="int"/>.
+        /// </summary>
+        Width,
+
+        /// <summary>
+        /// The precision, given by <c>.*</c>, as an <see cref="int"/>.
+        /// </summary>
+        Precision,
+
+        /// <summary>
+        /// A signed integer for the specifiers <c>d</c> and <c>i</c>.
+        /// </summary>
+        Integer,
+
+        /// <summary>
+        /// An unsigned integer for the specifiers <c>u</c>, <c>o</c>, <c>x</c> and <c>X</c>.
+        /// </summary>
+        UnsignedInteger,
+
+        /// <summary>
+        /// A floating point value for the specifiers <c>f</c>, <c>F</c>, <c>e</c>, <c>E</c>, <c>g</c> and <c>G</c>.
+        /// </summary>
+        FloatingPoint,
+
+        /// <summary>
+        /// A character for the specifier <c>c</c>.
+        /// </summary>
+        Char,
+
+        /// <summary>
+        /// A string for the specifier <c>s</c>.
+        /// </summary>
+        String
+    }
+}
@@ -0,0 +1,42 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+
+    /// <summary>
+    /// Implements a partial method that formats its parameters with a constant C format string.
+    /// </summary>
+    /// <remarks>
+    /// <para>The method must be a partial method declaration that returns a <see cref="string"/>, with a parameter
+    /// for each argument of the format. The source generator of the package implements the method, for example:</para>
+    /// <code language="csharp"><![CDATA[
+    /// [SPrintF("%-8s %6.2f")]
+    /// private static partial string FormatLine(string name, double value);
+    /// ]]></code>
+    /// <para>The format is parsed when building, and an invalid format, a wrong number of parameters, or a parameter
+    /// that can't be formatted with its format specifier is reported as a compiler diagnostic. The method formats
+    /// with a <see cref="SPrintFFormat"/> that is compiled once. The result is the same as for
+    /// <see cref="SPrintFFormat.Format(object[])"/>.</para>
+    /// <para>The parameters aren't boxed if there are at most eight, as there are generic overloads of
+    /// <see cref="SPrintFFormat.Format{T1, T2, T3, T4, T5, T6, T7, T8}"/> up to eight arguments. A method with
+    /// more parameters formats them as an array of objects, which boxes them, and is a warning
+    /// (<c>SPRINTF005</c>).</para>
+    /// </remarks>
+    [AttributeUsage(AttributeTargets.Method, AllowMultiple = false, Inherited = false)]
+    public sealed class SPrintFAttribute : Attribute
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="SPrintFAttribute"/> class.
+        /// </summary>
+        /// <param name="format">The formatting string as per the C style <c>printf</c> function family.</param>
+        public SPrintFAttribute(string format)
+        {
+            Format = format;
+        }
+
+        /// <summary>
+        /// Gets the format string.
+        /// </summary>
+        /// <value>The format string.</value>
+        public string Format { get; }
+    }
+}
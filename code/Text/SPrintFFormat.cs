@@ -0,0 +1,845 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Collections.ObjectModel;
+    using System.IO;
+    using System.Text;
+    using Format;
+
+#if NET6_0_OR_GREATER
+    using System.Buffers;
+    using System.Runtime.ExceptionServices;
+    using System.Threading.Tasks;
+#endif
+
+    /// <summary>
+    /// A C format string that is parsed and validated once, to format many times.
+    /// </summary>
+    /// <remarks>
+    /// <para>The format is the same as for <see cref="StringUtilities.SPrintF(string, object[])"/>. Where
+    /// <see cref="StringUtilities.SPrintF(string, object[])"/> copies an invalid format specifier to the output,
+    /// <see cref="Compile(string)"/> rejects the format, so that an invalid format is found when it is loaded, and not
+    /// when it is first used.</para>
+    /// <para>An instance is immutable and can be used from multiple threads.</para>
+    /// </remarks>
+    public sealed class SPrintFFormat
+    {
+#if NET6_0_OR_GREATER
+        // A batch is copied to the buffer writer when this many characters are formatted, so that the buffer of
+        // the thread stays small enough to be kept.
+        private const int BatchFlushLength = 2048;
+
+        // The number of values formatted by each task of a parallel batch.
+        private const int BatchChunkLength = 16384;
+#endif
+
+        private readonly FormatPlan _plan;
+
+        private SPrintFFormat(string format, FormatPlan plan, IList<SPrintFArgumentKind> argumentKinds)
+        {
+            FormatString = format;
+            _plan = plan;
+            ArgumentKinds = new ReadOnlyCollection<SPrintFArgumentKind>(argumentKinds);
+        }
+
+        /// <summary>
+        /// Parses and validates a C format string.
+        /// </summary>
+        /// <param name="format">The formatting string as per the C style <c>printf</c> function family.</param>
+        /// <returns>The compiled format.</returns>
+        /// <exception cref="ArgumentNullException"><paramref name="format"/> may not be <see langword="null"/>.</exception>
+        /// <exception cref="FormatException">
+        /// The format has an invalid format specifier, or a specifier that isn't supported (<c>a</c>, <c>A</c>,
+        /// <c>p</c> and <c>n</c>).
+        /// </exception>
+        public static SPrintFFormat Compile(string format)
+        {
+            ThrowHelper.ThrowIfNull(format);
+
+            FormatPlan plan = FormatPlan.Parse(format, true);
+            List<SPrintFArgumentKind> argumentKinds = new();
+            foreach (FormatSpecifier formatSpecifier in plan.FormatSpecifiers) {
+                if (formatSpecifier.WidthAsArg) argumentKinds.Add(SPrintFArgumentKind.Width);
+                if (formatSpecifier.PrecisionAsArg) argumentKinds.Add(SPrintFArgumentKind.Precision);
+
+                switch (formatSpecifier.Specifier) {
+                case '%':
+                    if (formatSpecifier.ArgumentLength != 2)
+                        throw new FormatException("Literal character % doesn't support any formatting");
+                    break;
+                case 'd':
+                case 'i':
+                    argumentKinds.Add(SPrintFArgumentKind.Integer);
+                    break;
+                case 'o':
+                case 'u':
+                case 'x':
+                case 'X':
+                    argumentKinds.Add(SPrintFArgumentKind.UnsignedInteger);
+                    break;
+                case 'f':
+                case 'F':
+                case 'e':
+                case 'E':
+                case 'g':
+                case 'G':
+                    argumentKinds.Add(SPrintFArgumentKind.FloatingPoint);
+                    break;
+                case 'c':
+                    argumentKinds.Add(SPrintFArgumentKind.Char);
+                    break;
+                case 's':
+                    argumentKinds.Add(SPrintFArgumentKind.String);
+                    break;
+                default:
+                    string message = string.Format("The format specifier '{0}' is not supported", formatSpecifier.Specifier);
+                    throw new FormatException(message);
+                }
+            }
+            return new SPrintFFormat(format, plan, argumentKinds);
+        }
+
+#if NET6_0_OR_GREATER
+        /// <summary>
+        /// Parses and validates a C format string that is encoded as UTF-8.
+        /// </summary>
+        /// <param name="utf8Format">The formatting string as per the C style <c>printf</c> function family.</param>
+        /// <returns>The compiled format.</returns>
+        /// <exception cref="FormatException">
+        /// The format has an invalid format specifier, or a specifier that isn't supported (<c>a</c>, <c>A</c>,
+        /// <c>p</c> and <c>n</c>).
+        /// </exception>
+        /// <remarks>
+        /// The format is decoded once, so that a format from a UTF-8 source, such as a configuration file, can be
+        /// used with <see cref="TryFormatUtf8(Span{byte}, out int, object[])"/> and
+        /// <see cref="AppendUtf8To(IBufferWriter{byte}, object[])"/> without converting on each call.
+        /// </remarks>
+        public static SPrintFFormat CompileUtf8(ReadOnlySpan<byte> utf8Format)
+        {
+            return Compile(Encoding.UTF8.GetString(utf8Format));
+        }
+#endif
+
+        /// <summary>
+        /// Gets the format string that was compiled.
+        /// </summary>
+        /// <value>The format string.</value>
+        public string FormatString { get; }
+
+        /// <summary>
+        /// Gets the number of arguments that the format expects.
+        /// </summary>
+        /// <value>The number of arguments, including the arguments for the width and precision.</value>
+        public int ArgumentCount { get { return ArgumentKinds.Count; } }
+
+        /// <summary>
+        /// Gets the kinds of the arguments that the format expects, in order.
+        /// </summary>
+        /// <value>The kinds of the arguments.</value>
+        public ReadOnlyCollection<SPrintFArgumentKind> ArgumentKinds { get; }
+
+        /// <summary>
+        /// Formats the values.
+        /// </summary>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>A formatted string.</returns>
+        /// <exception cref="FormatException">There was an error converting the parameters.</exception>
+        /// <remarks>The generic overloads with up to eight arguments don't box them.</remarks>
+        public string Format(params object[] values)
+        {
+            return Format(new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="Format(object[])"/>
+        public string Format<T1>(T1 arg1)
+        {
+            return Format(FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="Format(object[])"/>
+        public string Format<T1, T2>(T1 arg1, T2 arg2)
+        {
+            return Format(FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="Format(object[])"/>
+        public string Format<T1, T2, T3>(T1 arg1, T2 arg2, T3 arg3)
+        {
+            return Format(FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="Format(object[])"/>
+        public string Format<T1, T2, T3, T4>(T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return Format(FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="Format(object[])"/>
+        public string Format<T1, T2, T3, T4, T5>(T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return Format(FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="Format(object[])"/>
+        public string Format<T1, T2, T3, T4, T5, T6>(T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return Format(FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="Format(object[])"/>
+        public string Format<T1, T2, T3, T4, T5, T6, T7>(T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return Format(FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="Format(object[])"/>
+        public string Format<T1, T2, T3, T4, T5, T6, T7, T8>(T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return Format(FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private string Format(in FormatArguments values)
+        {
+            FormatWriter writer = FormatWriter.Acquire();
+            try {
+                _plan.Format(writer, values);
+                return writer.ToString();
+            } finally {
+                FormatWriter.Release(writer);
+            }
+        }
+
+        /// <summary>
+        /// Formats the values and appends the result to a <see cref="StringBuilder"/>.
+        /// </summary>
+        /// <param name="sb">The string builder to append to.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <exception cref="ArgumentNullException"><paramref name="sb"/> may not be <see langword="null"/>.</exception>
+        /// <exception cref="FormatException">There was an error converting the parameters.</exception>
+        public void AppendTo(StringBuilder sb, params object[] values)
+        {
+            ThrowHelper.ThrowIfNull(sb);
+
+            FormatWriter writer = FormatWriter.Acquire();
+            try {
+                _plan.Format(writer, values);
+                sb.Append(writer.Buffer, 0, writer.Length);
+            } finally {
+                FormatWriter.Release(writer);
+            }
+        }
+
+        /// <summary>
+        /// Formats the values and writes the result to a text writer.
+        /// </summary>
+        /// <param name="writer">The text writer to write to.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>The number of characters written.</returns>
+        /// <exception cref="ArgumentNullException"><paramref name="writer"/> may not be <see langword="null"/>.</exception>
+        /// <exception cref="FormatException">There was an error converting the parameters.</exception>
+        /// <remarks>
+        /// The result is as for <see cref="StringUtilities.FPrintF(TextWriter, string, object[])"/>. No string is
+        /// allocated, and a long result is written in parts as it's formatted. The generic overloads with up to eight
+        /// arguments don't box them.
+        /// </remarks>
+        public int WriteTo(TextWriter writer, params object[] values)
+        {
+            return WriteTo(writer, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="WriteTo(TextWriter, object[])"/>
+        public int WriteTo<T1>(TextWriter writer, T1 arg1)
+        {
+            return WriteTo(writer, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="WriteTo(TextWriter, object[])"/>
+        public int WriteTo<T1, T2>(TextWriter writer, T1 arg1, T2 arg2)
+        {
+            return WriteTo(writer, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="WriteTo(TextWriter, object[])"/>
+        public int WriteTo<T1, T2, T3>(TextWriter writer, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return WriteTo(writer, FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="WriteTo(TextWriter, object[])"/>
+        public int WriteTo<T1, T2, T3, T4>(TextWriter writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return WriteTo(writer, FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="WriteTo(TextWriter, object[])"/>
+        public int WriteTo<T1, T2, T3, T4, T5>(TextWriter writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return WriteTo(writer, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="WriteTo(TextWriter, object[])"/>
+        public int WriteTo<T1, T2, T3, T4, T5, T6>(TextWriter writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return WriteTo(writer, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="WriteTo(TextWriter, object[])"/>
+        public int WriteTo<T1, T2, T3, T4, T5, T6, T7>(TextWriter writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return WriteTo(writer, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="WriteTo(TextWriter, object[])"/>
+        public int WriteTo<T1, T2, T3, T4, T5, T6, T7, T8>(TextWriter writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return WriteTo(writer, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private int WriteTo(TextWriter writer, in FormatArguments values)
+        {
+            ThrowHelper.ThrowIfNull(writer);
+
+            FormatWriter formatWriter = FormatWriter.Acquire();
+            try {
+                formatWriter.SetTarget(writer);
+                _plan.Format(formatWriter, values);
+                return formatWriter.Flush();
+            } finally {
+                FormatWriter.Release(formatWriter);
+            }
+        }
+
+        /// <summary>
+        /// Formats the values and writes the result to a stream.
+        /// </summary>
+        /// <param name="stream">The stream to write to.</param>
+        /// <param name="encoding">The encoding of the result written to the <paramref name="stream"/>.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>The number of bytes written.</returns>
+        /// <exception cref="ArgumentNullException">
+        /// <paramref name="stream"/> or <paramref name="encoding"/> may not be <see langword="null"/>.
+        /// </exception>
+        /// <exception cref="FormatException">There was an error converting the parameters.</exception>
+        /// <remarks>
+        /// The result is as for <see cref="StringUtilities.FPrintF(Stream, Encoding, string, object[])"/>, and a long
+        /// result is written in parts as it's formatted. The generic overloads with up to eight arguments don't box
+        /// them.
+        /// </remarks>
+        public int WriteTo(Stream stream, Encoding encoding, params object[] values)
+        {
+            return WriteTo(stream, encoding, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="WriteTo(Stream, Encoding, object[])"/>
+        public int WriteTo<T1>(Stream stream, Encoding encoding, T1 arg1)
+        {
+            return WriteTo(stream, encoding, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="WriteTo(Stream, Encoding, object[])"/>
+        public int WriteTo<T1, T2>(Stream stream, Encoding encoding, T1 arg1, T2 arg2)
+        {
+            return WriteTo(stream, encoding, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="WriteTo(Stream, Encoding, object[])"/>
+        public int WriteTo<T1, T2, T3>(Stream stream, Encoding encoding, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return WriteTo(stream, encoding, FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="WriteTo(Stream, Encoding, object[])"/>
+        public int WriteTo<T1, T2, T3, T4>(Stream stream, Encoding encoding, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return WriteTo(stream, encoding, FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="WriteTo(Stream, Encoding, object[])"/>
+        public int WriteTo<T1, T2, T3, T4, T5>(Stream stream, Encoding encoding, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return WriteTo(stream, encoding, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="WriteTo(Stream, Encoding, object[])"/>
+        public int WriteTo<T1, T2, T3, T4, T5, T6>(Stream stream, Encoding encoding, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return WriteTo(stream, encoding, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="WriteTo(Stream, Encoding, object[])"/>
+        public int WriteTo<T1, T2, T3, T4, T5, T6, T7>(Stream stream, Encoding encoding, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return WriteTo(stream, encoding, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="WriteTo(Stream, Encoding, object[])"/>
+        public int WriteTo<T1, T2, T3, T4, T5, T6, T7, T8>(Stream stream, Encoding encoding, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return WriteTo(stream, encoding, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private int WriteTo(Stream stream, Encoding encoding, in FormatArguments values)
+        {
+            ThrowHelper.ThrowIfNull(stream);
+            ThrowHelper.ThrowIfNull(encoding);
+
+            FormatWriter formatWriter = FormatWriter.Acquire();
+            try {
+                formatWriter.SetTarget(stream, encoding);
+                _plan.Format(formatWriter, values);
+                return formatWriter.Flush();
+            } finally {
+                FormatWriter.Release(formatWriter);
+            }
+        }
+
+#if NET6_0_OR_GREATER
+        /// <summary>
+        /// Formats the values and appends the result to a buffer writer.
+        /// </summary>
+        /// <param name="writer">The buffer writer to append to.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>The number of characters written.</returns>
+        /// <exception cref="ArgumentNullException"><paramref name="writer"/> may not be <see langword="null"/>.</exception>
+        /// <exception cref="FormatException">There was an error converting the parameters.</exception>
+        /// <remarks>
+        /// Nothing is written to the <paramref name="writer"/> if there is an error. The generic overloads with up to eight arguments don't box them.
+        /// </remarks>
+        public int AppendTo(IBufferWriter<char> writer, params object[] values)
+        {
+            return AppendTo(writer, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="AppendTo(IBufferWriter{char}, object[])"/>
+        public int AppendTo<T1>(IBufferWriter<char> writer, T1 arg1)
+        {
+            return AppendTo(writer, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="AppendTo(IBufferWriter{char}, object[])"/>
+        public int AppendTo<T1, T2>(IBufferWriter<char> writer, T1 arg1, T2 arg2)
+        {
+            return AppendTo(writer, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="AppendTo(IBufferWriter{char}, object[])"/>
+        public int AppendTo<T1, T2, T3>(IBufferWriter<char> writer, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return AppendTo(writer, FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="AppendTo(IBufferWriter{char}, object[])"/>
+        public int AppendTo<T1, T2, T3, T4>(IBufferWriter<char> writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return AppendTo(writer, FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="AppendTo(IBufferWriter{char}, object[])"/>
+        public int AppendTo<T1, T2, T3, T4, T5>(IBufferWriter<char> writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return AppendTo(writer, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="AppendTo(IBufferWriter{char}, object[])"/>
+        public int AppendTo<T1, T2, T3, T4, T5, T6>(IBufferWriter<char> writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return AppendTo(writer, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="AppendTo(IBufferWriter{char}, object[])"/>
+        public int AppendTo<T1, T2, T3, T4, T5, T6, T7>(IBufferWriter<char> writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return AppendTo(writer, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="AppendTo(IBufferWriter{char}, object[])"/>
+        public int AppendTo<T1, T2, T3, T4, T5, T6, T7, T8>(IBufferWriter<char> writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return AppendTo(writer, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private int AppendTo(IBufferWriter<char> writer, in FormatArguments values)
+        {
+            ThrowHelper.ThrowIfNull(writer);
+
+            FormatWriter formatWriter = FormatWriter.Acquire();
+            try {
+                _plan.Format(formatWriter, values);
+                return formatWriter.CopyTo(writer);
+            } finally {
+                FormatWriter.Release(formatWriter);
+            }
+        }
+
+        /// <summary>
+        /// Tries to format the values into a buffer.
+        /// </summary>
+        /// <param name="destination">The buffer to write the result to.</param>
+        /// <param name="charsWritten">The number of characters written to <paramref name="destination"/>.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>
+        /// <see langword="true"/> if the result was written, <see langword="false"/> if <paramref name="destination"/>
+        /// is too small, in which case <paramref name="charsWritten"/> is zero.
+        /// </returns>
+        /// <exception cref="FormatException">There was an error converting the parameters.</exception>
+        /// <remarks>
+        /// No memory is allocated, other than for the arguments. The generic overloads don't box the arguments, so
+        /// they don't allocate at all.
+        /// </remarks>
+        public bool TryFormat(Span<char> destination, out int charsWritten, params object[] values)
+        {
+            return TryFormat(destination, out charsWritten, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="TryFormat(Span{char}, out int, object[])"/>
+        public bool TryFormat<T1>(Span<char> destination, out int charsWritten, T1 arg1)
+        {
+            return TryFormat(destination, out charsWritten, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="TryFormat(Span{char}, out int, object[])"/>
+        public bool TryFormat<T1, T2>(Span<char> destination, out int charsWritten, T1 arg1, T2 arg2)
+        {
+            return TryFormat(destination, out charsWritten, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="TryFormat(Span{char}, out int, object[])"/>
+        public bool TryFormat<T1, T2, T3>(Span<char> destination, out int charsWritten, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return TryFormat(destination, out charsWritten, FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="TryFormat(Span{char}, out int, object[])"/>
+        public bool TryFormat<T1, T2, T3, T4>(Span<char> destination, out int charsWritten, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return TryFormat(destination, out charsWritten, FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="TryFormat(Span{char}, out int, object[])"/>
+        public bool TryFormat<T1, T2, T3, T4, T5>(Span<char> destination, out int charsWritten, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return TryFormat(destination, out charsWritten, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="TryFormat(Span{char}, out int, object[])"/>
+        public bool TryFormat<T1, T2, T3, T4, T5, T6>(Span<char> destination, out int charsWritten, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return TryFormat(destination, out charsWritten, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="TryFormat(Span{char}, out int, object[])"/>
+        public bool TryFormat<T1, T2, T3, T4, T5, T6, T7>(Span<char> destination, out int charsWritten, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return TryFormat(destination, out charsWritten, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="TryFormat(Span{char}, out int, object[])"/>
+        public bool TryFormat<T1, T2, T3, T4, T5, T6, T7, T8>(Span<char> destination, out int charsWritten, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return TryFormat(destination, out charsWritten, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private bool TryFormat(Span<char> destination, out int charsWritten, in FormatArguments values)
+        {
+            FormatWriter writer = FormatWriter.Acquire();
+            try {
+                _plan.Format(writer, values);
+                return writer.TryCopyTo(destination, out charsWritten);
+            } finally {
+                FormatWriter.Release(writer);
+            }
+        }
+
+        /// <summary>
+        /// Formats the values and appends the result to a buffer writer, encoded as UTF-8.
+        /// </summary>
+        /// <param name="writer">The buffer writer to append to.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>The number of bytes written.</returns>
+        /// <exception cref="ArgumentNullException"><paramref name="writer"/> may not be <see langword="null"/>.</exception>
+        /// <exception cref="FormatException">There was an error converting the parameters.</exception>
+        /// <remarks>
+        /// Nothing is written to the <paramref name="writer"/> if there is an error. The generic overloads with up to eight arguments don't box them.
+        /// </remarks>
+        public int AppendUtf8To(IBufferWriter<byte> writer, params object[] values)
+        {
+            return AppendUtf8To(writer, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="AppendUtf8To(IBufferWriter{byte}, object[])"/>
+        public int AppendUtf8To<T1>(IBufferWriter<byte> writer, T1 arg1)
+        {
+            return AppendUtf8To(writer, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="AppendUtf8To(IBufferWriter{byte}, object[])"/>
+        public int AppendUtf8To<T1, T2>(IBufferWriter<byte> writer, T1 arg1, T2 arg2)
+        {
+            return AppendUtf8To(writer, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="AppendUtf8To(IBufferWriter{byte}, object[])"/>
+        public int AppendUtf8To<T1, T2, T3>(IBufferWriter<byte> writer, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return AppendUtf8To(writer, FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="AppendUtf8To(IBufferWriter{byte}, object[])"/>
+        public int AppendUtf8To<T1, T2, T3, T4>(IBufferWriter<byte> writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return AppendUtf8To(writer, FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="AppendUtf8To(IBufferWriter{byte}, object[])"/>
+        public int AppendUtf8To<T1, T2, T3, T4, T5>(IBufferWriter<byte> writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return AppendUtf8To(writer, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="AppendUtf8To(IBufferWriter{byte}, object[])"/>
+        public int AppendUtf8To<T1, T2, T3, T4, T5, T6>(IBufferWriter<byte> writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return AppendUtf8To(writer, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="AppendUtf8To(IBufferWriter{byte}, object[])"/>
+        public int AppendUtf8To<T1, T2, T3, T4, T5, T6, T7>(IBufferWriter<byte> writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return AppendUtf8To(writer, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="AppendUtf8To(IBufferWriter{byte}, object[])"/>
+        public int AppendUtf8To<T1, T2, T3, T4, T5, T6, T7, T8>(IBufferWriter<byte> writer, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return AppendUtf8To(writer, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private int AppendUtf8To(IBufferWriter<byte> writer, in FormatArguments values)
+        {
+            ThrowHelper.ThrowIfNull(writer);
+
+            FormatWriter formatWriter = FormatWriter.Acquire();
+            try {
+                _plan.Format(formatWriter, values);
+                return formatWriter.CopyToUtf8(writer);
+            } finally {
+                FormatWriter.Release(formatWriter);
+            }
+        }
+
+        /// <summary>
+        /// Tries to format the values into a buffer, encoded as UTF-8.
+        /// </summary>
+        /// <param name="utf8Destination">The buffer to write the UTF-8 encoded result to.</param>
+        /// <param name="bytesWritten">The number of bytes written to <paramref name="utf8Destination"/>.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>
+        /// <see langword="true"/> if the result was written, <see langword="false"/> if
+        /// <paramref name="utf8Destination"/> is too small, in which case <paramref name="bytesWritten"/> is zero.
+        /// </returns>
+        /// <exception cref="FormatException">There was an error converting the parameters.</exception>
+        /// <remarks>
+        /// No memory is allocated, other than for the arguments. The generic overloads don't box the arguments, so
+        /// they don't allocate at all.
+        /// </remarks>
+        public bool TryFormatUtf8(Span<byte> utf8Destination, out int bytesWritten, params object[] values)
+        {
+            return TryFormatUtf8(utf8Destination, out bytesWritten, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="TryFormatUtf8(Span{byte}, out int, object[])"/>
+        public bool TryFormatUtf8<T1>(Span<byte> utf8Destination, out int bytesWritten, T1 arg1)
+        {
+            return TryFormatUtf8(utf8Destination, out bytesWritten, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="TryFormatUtf8(Span{byte}, out int, object[])"/>
+        public bool TryFormatUtf8<T1, T2>(Span<byte> utf8Destination, out int bytesWritten, T1 arg1, T2 arg2)
+        {
+            return TryFormatUtf8(utf8Destination, out bytesWritten, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="TryFormatUtf8(Span{byte}, out int, object[])"/>
+        public bool TryFormatUtf8<T1, T2, T3>(Span<byte> utf8Destination, out int bytesWritten, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return TryFormatUtf8(utf8Destination, out bytesWritten, FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="TryFormatUtf8(Span{byte}, out int, object[])"/>
+        public bool TryFormatUtf8<T1, T2, T3, T4>(Span<byte> utf8Destination, out int bytesWritten, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return TryFormatUtf8(utf8Destination, out bytesWritten, FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="TryFormatUtf8(Span{byte}, out int, object[])"/>
+        public bool TryFormatUtf8<T1, T2, T3, T4, T5>(Span<byte> utf8Destination, out int bytesWritten, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return TryFormatUtf8(utf8Destination, out bytesWritten, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="TryFormatUtf8(Span{byte}, out int, object[])"/>
+        public bool TryFormatUtf8<T1, T2, T3, T4, T5, T6>(Span<byte> utf8Destination, out int bytesWritten, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return TryFormatUtf8(utf8Destination, out bytesWritten, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="TryFormatUtf8(Span{byte}, out int, object[])"/>
+        public bool TryFormatUtf8<T1, T2, T3, T4, T5, T6, T7>(Span<byte> utf8Destination, out int bytesWritten, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return TryFormatUtf8(utf8Destination, out bytesWritten, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="TryFormatUtf8(Span{byte}, out int, object[])"/>
+        public bool TryFormatUtf8<T1, T2, T3, T4, T5, T6, T7, T8>(Span<byte> utf8Destination, out int bytesWritten, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return TryFormatUtf8(utf8Destination, out bytesWritten, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private bool TryFormatUtf8(Span<byte> utf8Destination, out int bytesWritten, in FormatArguments values)
+        {
+            FormatWriter writer = FormatWriter.Acquire();
+            try {
+                _plan.Format(writer, values);
+                return writer.TryCopyToUtf8(utf8Destination, out bytesWritten);
+            } finally {
+                FormatWriter.Release(writer);
+            }
+        }
+
+        /// <summary>
+        /// Formats each value with this format and appends the results to a buffer writer.
+        /// </summary>
+        /// <typeparam name="T">The type of the values.</typeparam>
+        /// <param name="writer">The buffer writer to append to.</param>
+        /// <param name="values">The values to format, each as the only argument of the format.</param>
+        /// <param name="separator">
+        /// The string written between two results, such as <c>","</c> or a new line. May be <see langword="null"/>.
+        /// </param>
+        /// <returns>The number of characters written.</returns>
+        /// <exception cref="ArgumentNullException"><paramref name="writer"/> may not be <see langword="null"/>.</exception>
+        /// <exception cref="FormatException">
+        /// The format doesn't have exactly one argument, or there was an error converting a value.
+        /// </exception>
+        /// <remarks>
+        /// The values aren't boxed and the format is applied to each value in one loop, which is faster than a call
+        /// for each value. The results are copied to the <paramref name="writer"/> while formatting, so if there is
+        /// an error converting a value, the results of the values before it may have been written.
+        /// </remarks>
+        public long AppendBatchTo<T>(IBufferWriter<char> writer, ReadOnlySpan<T> values, string separator)
+        {
+            ThrowHelper.ThrowIfNull(writer);
+            CheckBatchFormat();
+
+            FormatWriter formatWriter = FormatWriter.Acquire();
+            try {
+                return FormatBatch(formatWriter, values, separator, false, writer);
+            } finally {
+                FormatWriter.Release(formatWriter);
+            }
+        }
+
+        /// <summary>
+        /// Formats each value with this format and appends the results to a buffer writer, optionally in parallel.
+        /// </summary>
+        /// <typeparam name="T">The type of the values.</typeparam>
+        /// <param name="writer">The buffer writer to append to.</param>
+        /// <param name="values">The values to format, each as the only argument of the format.</param>
+        /// <param name="separator">
+        /// The string written between two results, such as <c>","</c> or a new line. May be <see langword="null"/>.
+        /// </param>
+        /// <param name="parallel">
+        /// If <see langword="true"/>, a large number of values is formatted in chunks on the thread pool.
+        /// </param>
+        /// <returns>The number of characters written.</returns>
+        /// <exception cref="ArgumentNullException"><paramref name="writer"/> may not be <see langword="null"/>.</exception>
+        /// <exception cref="FormatException">
+        /// The format doesn't have exactly one argument, or there was an error converting a value.
+        /// </exception>
+        /// <remarks>
+        /// The result is the same as for <see cref="AppendBatchTo{T}(IBufferWriter{char}, ReadOnlySpan{T}, string)"/>.
+        /// In parallel, the chunks are formatted in rounds of one chunk for each processor, and the results of a
+        /// round are appended in order, so that only one round is held in memory.
+        /// </remarks>
+        public long AppendBatchTo<T>(IBufferWriter<char> writer, ReadOnlyMemory<T> values, string separator, bool parallel)
+        {
+            if (!parallel || values.Length <= BatchChunkLength)
+                return AppendBatchTo(writer, values.Span, separator);
+
+            ThrowHelper.ThrowIfNull(writer);
+            CheckBatchFormat();
+
+            // The buffers of the chunks are rented, as they're large, and are returned after the last round is
+            // appended.
+            FormatWriter[] results = new FormatWriter[Environment.ProcessorCount];
+            long written = 0;
+            int roundLength = results.Length * BatchChunkLength;
+            try {
+                for (int roundStart = 0; roundStart < values.Length; roundStart += roundLength) {
+                    int start = roundStart;
+                    int chunks = (Math.Min(roundLength, values.Length - start) + BatchChunkLength - 1) / BatchChunkLength;
+                    try {
+                        Parallel.For(0, chunks, chunk => {
+                            int chunkStart = start + chunk * BatchChunkLength;
+                            int chunkLength = Math.Min(BatchChunkLength, values.Length - chunkStart);
+                            FormatWriter result = results[chunk] ??= FormatWriter.Rent(BatchChunkLength * 8);
+                            result.Clear();
+                            FormatBatch(result, values.Span.Slice(chunkStart, chunkLength), separator, chunkStart > 0, null);
+                        });
+                    } catch (AggregateException e) {
+                        ExceptionDispatchInfo.Capture(e.InnerExceptions[0]).Throw();
+                        throw;
+                    }
+
+                    for (int chunk = 0; chunk < chunks; chunk++) {
+                        written += results[chunk].CopyTo(writer);
+                    }
+                }
+            } finally {
+                foreach (FormatWriter result in results) {
+                    result?.Return();
+                }
+            }
+            return written;
+        }
+
+        private void CheckBatchFormat()
+        {
+            if (ArgumentKinds.Count != 1)
+                throw new FormatException("The format for a batch must have exactly one argument");
+        }
+
+        // Formats the values into the formatWriter. If there is a writer, the result is copied to it when it's long
+        // and at the end, and the number of characters copied is returned.
+        private long FormatBatch<T>(FormatWriter formatWriter, ReadOnlySpan<T> values, string separator,
+            bool separatorFirst, IBufferWriter<char> writer)
+        {
+            long written = 0;
+            for (int i = 0; i < values.Length; i++) {
+                if (separatorFirst || i > 0) formatWriter.Append(separator);
+                _plan.Format(formatWriter, new FormatArguments(1, FormatArgConverter<T>.Convert(values[i])));
+
+                if (writer is not null && formatWriter.Length >= BatchFlushLength) {
+                    written += formatWriter.CopyTo(writer);
+                    formatWriter.Clear();
+                }
+            }
+
+            if (writer is not null) {
+                written += formatWriter.CopyTo(writer);
+                formatWriter.Clear();
+            }
+            return written;
+        }
+#endif
+
+        /// <summary>
+        /// Returns the format string.
+        /// </summary>
+        /// <returns>The format string that was compiled.</returns>
+        public override string ToString()
+        {
+            return FormatString;
+        }
+    }
+}
@@ -0,0 +1,186 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using System.IO;
+    using System.Text;
+    using Format;
+
+    public static partial class StringUtilities
+    {
+        /// <summary>
+        /// Format a string based on the C-Standard and write it to a text writer.
+        /// </summary>
+        /// <param name="writer">The text writer to write the result to.</param>
+        /// <param name="format">The formatting string as per the C style <c>printf</c> function family.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>The number of characters written.</returns>
+        /// <exception cref="ArgumentNullException">
+        /// <paramref name="writer"/> or <paramref name="format"/> may not be <see langword="null"/>.
+        /// </exception>
+        /// <exception cref="FormatException">There was a fatal error parsing the string and/or the parameters.</exception>
+        /// <remarks>
+        /// The format is as for <see cref="SPrintF(string, object[])"/>. The result is written from the buffer it's
+        /// formatted in, which is reused by each thread, so that no string is allocated. A long result is written in
+        /// parts as it's formatted, so that it isn't held in memory, and if there is an error, the parts before the
+        /// error may already be written. The generic overloads with up to eight arguments don't box them.
+        /// </remarks>
+        public static int FPrintF(TextWriter writer, string format, params object[] values)
+        {
+            return FormatTo(writer, format, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="FPrintF(TextWriter, string, object[])"/>
+        public static int FPrintF<T1>(TextWriter writer, string format, T1 arg1)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="FPrintF(TextWriter, string, object[])"/>
+        public static int FPrintF<T1, T2>(TextWriter writer, string format, T1 arg1, T2 arg2)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="FPrintF(TextWriter, string, object[])"/>
+        public static int FPrintF<T1, T2, T3>(TextWriter writer, string format, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="FPrintF(TextWriter, string, object[])"/>
+        public static int FPrintF<T1, T2, T3, T4>(TextWriter writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="FPrintF(TextWriter, string, object[])"/>
+        public static int FPrintF<T1, T2, T3, T4, T5>(TextWriter writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="FPrintF(TextWriter, string, object[])"/>
+        public static int FPrintF<T1, T2, T3, T4, T5, T6>(TextWriter writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="FPrintF(TextWriter, string, object[])"/>
+        public static int FPrintF<T1, T2, T3, T4, T5, T6, T7>(TextWriter writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="FPrintF(TextWriter, string, object[])"/>
+        public static int FPrintF<T1, T2, T3, T4, T5, T6, T7, T8>(TextWriter writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private static int FormatTo(TextWriter writer, string format, in FormatArguments values)
+        {
+            ThrowHelper.ThrowIfNull(writer);
+            ThrowHelper.ThrowIfNull(format);
+
+            FormatWriter formatWriter = FormatWriter.Acquire();
+            try {
+                formatWriter.SetTarget(writer);
+                FormatPlans.GetPlan(format).Format(formatWriter, values);
+                return formatWriter.Flush();
+            } finally {
+                FormatWriter.Release(formatWriter);
+            }
+        }
+
+        /// <summary>
+        /// Format a string based on the C-Standard and write it to a stream.
+        /// </summary>
+        /// <param name="stream">The stream to write the result to.</param>
+        /// <param name="encoding">The encoding of the result written to the <paramref name="stream"/>.</param>
+        /// <param name="format">The formatting string as per the C style <c>printf</c> function family.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>The number of bytes written.</returns>
+        /// <exception cref="ArgumentNullException">
+        /// <paramref name="stream"/>, <paramref name="encoding"/> or <paramref name="format"/> may not be
+        /// <see langword="null"/>.
+        /// </exception>
+        /// <exception cref="FormatException">There was a fatal error parsing the string and/or the parameters.</exception>
+        /// <remarks>
+        /// <para>The format is as for <see cref="SPrintF(string, object[])"/>. The result is encoded from the buffer
+        /// it's formatted in into a buffer of bytes, both reused by each thread, and written to the
+        /// <paramref name="stream"/>. A long result is written in parts as it's formatted, so that it isn't held in
+        /// memory, and if there is an error, the parts before the error may already be written.</para>
+        /// <para>Each part is encoded on its own, and the preamble of the <paramref name="encoding"/>, such as the
+        /// byte order mark, isn't written. A pair of surrogates is never split between parts. The generic overloads
+        /// with up to eight arguments don't box them.</para>
+        /// </remarks>
+        public static int FPrintF(Stream stream, Encoding encoding, string format, params object[] values)
+        {
+            return FormatTo(stream, encoding, format, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="FPrintF(Stream, Encoding, string, object[])"/>
+        public static int FPrintF<T1>(Stream stream, Encoding encoding, string format, T1 arg1)
+        {
+            return FormatTo(stream, encoding, format, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="FPrintF(Stream, Encoding, string, object[])"/>
+        public static int FPrintF<T1, T2>(Stream stream, Encoding encoding, string format, T1 arg1, T2 arg2)
+        {
+            return FormatTo(stream, encoding, format, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="FPrintF(Stream, Encoding, string, object[])"/>
+        public static int FPrintF<T1, T2, T3>(Stream stream, Encoding encoding, string format, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return FormatTo(stream, encoding, format, FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="FPrintF(Stream, Encoding, string, object[])"/>
+        public static int FPrintF<T1, T2, T3, T4>(Stream stream, Encoding encoding, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return FormatTo(stream, encoding, format, FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="FPrintF(Stream, Encoding, string, object[])"/>
+        public static int FPrintF<T1, T2, T3, T4, T5>(Stream stream, Encoding encoding, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return FormatTo(stream, encoding, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="FPrintF(Stream, Encoding, string, object[])"/>
+        public static int FPrintF<T1, T2, T3, T4, T5, T6>(Stream stream, Encoding encoding, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return FormatTo(stream, encoding, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="FPrintF(Stream, Encoding, string, object[])"/>
+        public static int FPrintF<T1, T2, T3, T4, T5, T6, T7>(Stream stream, Encoding encoding, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return FormatTo(stream, encoding, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="FPrintF(Stream, Encoding, string, object[])"/>
+        public static int FPrintF<T1, T2, T3, T4, T5, T6, T7, T8>(Stream stream, Encoding encoding, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return FormatTo(stream, encoding, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private static int FormatTo(Stream stream, Encoding encoding, string format, in FormatArguments values)
+        {
+            ThrowHelper.ThrowIfNull(stream);
+            ThrowHelper.ThrowIfNull(encoding);
+            ThrowHelper.ThrowIfNull(format);
+
+            FormatWriter formatWriter = FormatWriter.Acquire();
+            try {
+                formatWriter.SetTarget(stream, encoding);
+                FormatPlans.GetPlan(format).Format(formatWriter, values);
+                return formatWriter.Flush();
+            } finally {
+                FormatWriter.Release(formatWriter);
+            }
+        }
+    }
+}
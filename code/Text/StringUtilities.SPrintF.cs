@@ -1,15 +1,21 @@
 ﻿namespace RJCP.Core.Text
 {
     using System;
-    using System.Text;
     using Format;
 
+#if NET6_0_OR_GREATER
+    using System.Buffers;
+#endif
+
     /// <summary>
     /// Collection of string utilities
     /// </summary>
     public static partial class StringUtilities
     {
-        private static readonly FormatType FormatTypes = new();
+        // The number of format strings that are kept parsed. Applications usually have a few hundred constant formats.
+        private const int FormatPlanCacheSize = 1024;
+
+        private static readonly FormatPlanCache FormatPlans = new(FormatPlanCacheSize);
 
         /// <summary>
         /// Format a string based on the C-Standard.
@@ -151,64 +157,655 @@
         /// <item>IEEE-754 %e: 123456.789. SPrintF (double/float) = ~41ms/47ms. string.Format = ~33ms/35ms.</item>
         /// <item>IEEE-754 %g: 123456.789. SPrintF (double/float) = ~45ms/48ms. string.Format = ~32ms/33ms.</item>
         /// </list>
+        /// <para>The generic overloads with up to eight arguments don't box them.</para>
         /// </remarks>
         public static string SPrintF(string format, params object[] values)
+        {
+            return Format(format, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="SPrintF(string, object[])"/>
+        public static string SPrintF<T1>(string format, T1 arg1)
+        {
+            return Format(format, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="SPrintF(string, object[])"/>
+        public static string SPrintF<T1, T2>(string format, T1 arg1, T2 arg2)
+        {
+            return Format(format, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="SPrintF(string, object[])"/>
+        public static string SPrintF<T1, T2, T3>(string format, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return Format(format, FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="SPrintF(string, object[])"/>
+        public static string SPrintF<T1, T2, T3, T4>(string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return Format(format, FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="SPrintF(string, object[])"/>
+        public static string SPrintF<T1, T2, T3, T4, T5>(string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return Format(format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="SPrintF(string, object[])"/>
+        public static string SPrintF<T1, T2, T3, T4, T5, T6>(string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return Format(format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="SPrintF(string, object[])"/>
+        public static string SPrintF<T1, T2, T3, T4, T5, T6, T7>(string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return Format(format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="SPrintF(string, object[])"/>
+        public static string SPrintF<T1, T2, T3, T4, T5, T6, T7, T8>(string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return Format(format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private static string Format(string format, in FormatArguments values)
         {
             ThrowHelper.ThrowIfNull(format);
 
-            StringBuilder sb = new();
-
-            int charPos = 0;
-            int nextCharPos = 0;
-            int currentArg = 0;
-            while (charPos < format.Length) {
-                charPos = nextCharPos;
-                nextCharPos = GetNextFormatChar(format, charPos);
-                if (nextCharPos == -1) {
-                    // No more special characters seen.
-#if NETFRAMEWORK
-                    sb.Append(format.Substring(charPos));
-#else
-                    sb.Append(format.AsSpan(charPos));
-#endif
-                    return sb.ToString();
-                }
-                if (nextCharPos > charPos) {
-#if NETFRAMEWORK
-                    sb.Append(format.Substring(charPos, nextCharPos - charPos));
-#else
-                    sb.Append(format.AsSpan(charPos, nextCharPos - charPos));
-#endif
-                    charPos = nextCharPos;
+            FormatWriter writer = FormatWriter.Acquire();
+            try {
+                FormatPlans.GetPlan(format).Format(writer, values);
+                return writer.ToString();
+            } finally {
+                FormatWriter.Release(writer);
+            }
+        }
+
+        /// <summary>
+        /// Format a string based on the C-Standard into a buffer, truncating the result if it doesn't fit.
+        /// </summary>
+        /// <param name="buffer">The buffer to write the result to.</param>
+        /// <param name="format">The formatting string as per the C style <c>printf</c> function family.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>
+        /// The length of the complete result, without the terminating null character. If this is the length of the
+        /// <paramref name="buffer"/> or more, the result was truncated.
+        /// </returns>
+        /// <exception cref="ArgumentNullException">
+        /// <paramref name="buffer"/> or <paramref name="format"/> may not be <see langword="null"/>.
+        /// </exception>
+        /// <exception cref="FormatException">There was a fatal error parsing the string and/or the parameters.</exception>
+        /// <remarks>
+        /// As the C function <c>snprintf</c>, at most the length of the <paramref name="buffer"/> less one characters
+        /// are written, followed by a null character. Nothing is written if the <paramref name="buffer"/> is empty,
+        /// so that the length needed can be found first. The format is as for <see cref="SPrintF(string, object[])"/>.
+        /// The generic overloads with up to eight arguments don't box them.
+        /// </remarks>
+        public static int SNPrintF(char[] buffer, string format, params object[] values)
+        {
+            return FormatTo(buffer, format, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="SNPrintF(char[], string, object[])"/>
+        public static int SNPrintF<T1>(char[] buffer, string format, T1 arg1)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="SNPrintF(char[], string, object[])"/>
+        public static int SNPrintF<T1, T2>(char[] buffer, string format, T1 arg1, T2 arg2)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="SNPrintF(char[], string, object[])"/>
+        public static int SNPrintF<T1, T2, T3>(char[] buffer, string format, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="SNPrintF(char[], string, object[])"/>
+        public static int SNPrintF<T1, T2, T3, T4>(char[] buffer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="SNPrintF(char[], string, object[])"/>
+        public static int SNPrintF<T1, T2, T3, T4, T5>(char[] buffer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="SNPrintF(char[], string, object[])"/>
+        public static int SNPrintF<T1, T2, T3, T4, T5, T6>(char[] buffer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="SNPrintF(char[], string, object[])"/>
+        public static int SNPrintF<T1, T2, T3, T4, T5, T6, T7>(char[] buffer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="SNPrintF(char[], string, object[])"/>
+        public static int SNPrintF<T1, T2, T3, T4, T5, T6, T7, T8>(char[] buffer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private static int FormatTo(char[] buffer, string format, in FormatArguments values)
+        {
+            ThrowHelper.ThrowIfNull(buffer);
+            ThrowHelper.ThrowIfNull(format);
+
+            FormatWriter writer = FormatWriter.Acquire();
+            try {
+                FormatPlans.GetPlan(format).Format(writer, values);
+                if (buffer.Length > 0) {
+                    int count = Math.Min(writer.Length, buffer.Length - 1);
+                    Array.Copy(writer.Buffer, buffer, count);
+                    buffer[count] = '\0';
                 }
+                return writer.Length;
+            } finally {
+                FormatWriter.Release(writer);
+            }
+        }
 
-                FormatSpecifier formatSpecifier = FormatSpecifier.Parse(format, ref nextCharPos);
-                if (formatSpecifier is null) {
-                    // The format specifier is invalid, so copy it verbatim.
-#if NETFRAMEWORK
-                    sb.Append(format.Substring(charPos, nextCharPos - charPos));
-#else
-                    sb.Append(format.AsSpan(charPos, nextCharPos - charPos));
-#endif
-                    continue;
+#if NET6_0_OR_GREATER
+        /// <summary>
+        /// Format a string based on the C-Standard into a buffer, truncating the result if it doesn't fit.
+        /// </summary>
+        /// <param name="buffer">The buffer to write the result to.</param>
+        /// <param name="format">The formatting string as per the C style <c>printf</c> function family.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>
+        /// The length of the complete result, without the terminating null character. If this is the length of the
+        /// <paramref name="buffer"/> or more, the result was truncated.
+        /// </returns>
+        /// <exception cref="ArgumentNullException"><paramref name="format"/> may not be <see langword="null"/>.</exception>
+        /// <exception cref="FormatException">There was a fatal error parsing the string and/or the parameters.</exception>
+        /// <remarks>
+        /// As the C function <c>snprintf</c>, at most the length of the <paramref name="buffer"/> less one characters
+        /// are written, followed by a null character. Nothing is written if the <paramref name="buffer"/> is empty,
+        /// so that the length needed can be found first. The format is as for <see cref="SPrintF(string, object[])"/>.
+        /// The generic overloads with up to eight arguments don't box them.
+        /// </remarks>
+        public static int SNPrintF(Span<char> buffer, string format, params object[] values)
+        {
+            return FormatTo(buffer, format, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="SNPrintF(Span{char}, string, object[])"/>
+        public static int SNPrintF<T1>(Span<char> buffer, string format, T1 arg1)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="SNPrintF(Span{char}, string, object[])"/>
+        public static int SNPrintF<T1, T2>(Span<char> buffer, string format, T1 arg1, T2 arg2)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="SNPrintF(Span{char}, string, object[])"/>
+        public static int SNPrintF<T1, T2, T3>(Span<char> buffer, string format, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="SNPrintF(Span{char}, string, object[])"/>
+        public static int SNPrintF<T1, T2, T3, T4>(Span<char> buffer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="SNPrintF(Span{char}, string, object[])"/>
+        public static int SNPrintF<T1, T2, T3, T4, T5>(Span<char> buffer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="SNPrintF(Span{char}, string, object[])"/>
+        public static int SNPrintF<T1, T2, T3, T4, T5, T6>(Span<char> buffer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="SNPrintF(Span{char}, string, object[])"/>
+        public static int SNPrintF<T1, T2, T3, T4, T5, T6, T7>(Span<char> buffer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="SNPrintF(Span{char}, string, object[])"/>
+        public static int SNPrintF<T1, T2, T3, T4, T5, T6, T7, T8>(Span<char> buffer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return FormatTo(buffer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private static int FormatTo(Span<char> buffer, string format, in FormatArguments values)
+        {
+            ThrowHelper.ThrowIfNull(format);
+
+            FormatWriter writer = FormatWriter.Acquire();
+            try {
+                FormatPlans.GetPlan(format).Format(writer, values);
+                if (buffer.Length > 0) {
+                    int count = Math.Min(writer.Length, buffer.Length - 1);
+                    writer.AsSpan(0, count).CopyTo(buffer);
+                    buffer[count] = '\0';
                 }
+                return writer.Length;
+            } finally {
+                FormatWriter.Release(writer);
+            }
+        }
+
+        /// <summary>
+        /// Tries to format a string based on the C-Standard into a buffer.
+        /// </summary>
+        /// <param name="destination">The buffer to write the result to.</param>
+        /// <param name="charsWritten">The number of characters written to <paramref name="destination"/>.</param>
+        /// <param name="format">The formatting string as per the C style <c>printf</c> function family.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>
+        /// <see langword="true"/> if the result was written, <see langword="false"/> if <paramref name="destination"/>
+        /// is too small, in which case <paramref name="charsWritten"/> is zero.
+        /// </returns>
+        /// <exception cref="ArgumentNullException"><paramref name="format"/> may not be <see langword="null"/>.</exception>
+        /// <exception cref="FormatException">There was a fatal error parsing the string and/or the parameters.</exception>
+        /// <remarks>
+        /// Unlike <see cref="SNPrintF(Span{char}, string, object[])"/>, the result isn't terminated with a null
+        /// character. The format is as for <see cref="SPrintF(string, object[])"/>. No memory is allocated, other than
+        /// for the arguments. The generic overloads don't box the arguments, so they don't allocate at all.
+        /// </remarks>
+        public static bool TrySPrintF(Span<char> destination, out int charsWritten, string format, params object[] values)
+        {
+            return TryFormatTo(destination, out charsWritten, format, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="TrySPrintF(Span{char}, out int, string, object[])"/>
+        public static bool TrySPrintF<T1>(Span<char> destination, out int charsWritten, string format, T1 arg1)
+        {
+            return TryFormatTo(destination, out charsWritten, format, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="TrySPrintF(Span{char}, out int, string, object[])"/>
+        public static bool TrySPrintF<T1, T2>(Span<char> destination, out int charsWritten, string format, T1 arg1, T2 arg2)
+        {
+            return TryFormatTo(destination, out charsWritten, format, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="TrySPrintF(Span{char}, out int, string, object[])"/>
+        public static bool TrySPrintF<T1, T2, T3>(Span<char> destination, out int charsWritten, string format, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return TryFormatTo(destination, out charsWritten, format, FormatArguments.Create(arg1, arg2, arg3));
+        }
 
-                // Read the input parameters and convert it.
-                FormatTypes.Convert(sb, formatSpecifier, ref currentArg, values);
+        /// <inheritdoc cref="TrySPrintF(Span{char}, out int, string, object[])"/>
+        public static bool TrySPrintF<T1, T2, T3, T4>(Span<char> destination, out int charsWritten, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return TryFormatTo(destination, out charsWritten, format, FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="TrySPrintF(Span{char}, out int, string, object[])"/>
+        public static bool TrySPrintF<T1, T2, T3, T4, T5>(Span<char> destination, out int charsWritten, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return TryFormatTo(destination, out charsWritten, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="TrySPrintF(Span{char}, out int, string, object[])"/>
+        public static bool TrySPrintF<T1, T2, T3, T4, T5, T6>(Span<char> destination, out int charsWritten, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return TryFormatTo(destination, out charsWritten, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="TrySPrintF(Span{char}, out int, string, object[])"/>
+        public static bool TrySPrintF<T1, T2, T3, T4, T5, T6, T7>(Span<char> destination, out int charsWritten, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return TryFormatTo(destination, out charsWritten, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="TrySPrintF(Span{char}, out int, string, object[])"/>
+        public static bool TrySPrintF<T1, T2, T3, T4, T5, T6, T7, T8>(Span<char> destination, out int charsWritten, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return TryFormatTo(destination, out charsWritten, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private static bool TryFormatTo(Span<char> destination, out int charsWritten, string format, in FormatArguments values)
+        {
+            ThrowHelper.ThrowIfNull(format);
+
+            FormatWriter writer = FormatWriter.Acquire();
+            try {
+                FormatPlans.GetPlan(format).Format(writer, values);
+                return writer.TryCopyTo(destination, out charsWritten);
+            } finally {
+                FormatWriter.Release(writer);
+            }
+        }
+
+        /// <summary>
+        /// Format a string based on the C-Standard to a buffer writer.
+        /// </summary>
+        /// <param name="writer">The buffer writer to write the result to.</param>
+        /// <param name="format">The formatting string as per the C style <c>printf</c> function family.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>The number of characters written.</returns>
+        /// <exception cref="ArgumentNullException">
+        /// <paramref name="writer"/> or <paramref name="format"/> may not be <see langword="null"/>.
+        /// </exception>
+        /// <exception cref="FormatException">There was a fatal error parsing the string and/or the parameters.</exception>
+        /// <remarks>
+        /// The format is as for <see cref="SPrintF(string, object[])"/>. Nothing is written to the
+        /// <paramref name="writer"/> if there is an error. The generic overloads with up to eight arguments don't box them.
+        /// </remarks>
+        public static int SPrintF(IBufferWriter<char> writer, string format, params object[] values)
+        {
+            return FormatTo(writer, format, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="SPrintF(IBufferWriter{char}, string, object[])"/>
+        public static int SPrintF<T1>(IBufferWriter<char> writer, string format, T1 arg1)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="SPrintF(IBufferWriter{char}, string, object[])"/>
+        public static int SPrintF<T1, T2>(IBufferWriter<char> writer, string format, T1 arg1, T2 arg2)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="SPrintF(IBufferWriter{char}, string, object[])"/>
+        public static int SPrintF<T1, T2, T3>(IBufferWriter<char> writer, string format, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="SPrintF(IBufferWriter{char}, string, object[])"/>
+        public static int SPrintF<T1, T2, T3, T4>(IBufferWriter<char> writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="SPrintF(IBufferWriter{char}, string, object[])"/>
+        public static int SPrintF<T1, T2, T3, T4, T5>(IBufferWriter<char> writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="SPrintF(IBufferWriter{char}, string, object[])"/>
+        public static int SPrintF<T1, T2, T3, T4, T5, T6>(IBufferWriter<char> writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="SPrintF(IBufferWriter{char}, string, object[])"/>
+        public static int SPrintF<T1, T2, T3, T4, T5, T6, T7>(IBufferWriter<char> writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="SPrintF(IBufferWriter{char}, string, object[])"/>
+        public static int SPrintF<T1, T2, T3, T4, T5, T6, T7, T8>(IBufferWriter<char> writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return FormatTo(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private static int FormatTo(IBufferWriter<char> writer, string format, in FormatArguments values)
+        {
+            ThrowHelper.ThrowIfNull(writer);
+            ThrowHelper.ThrowIfNull(format);
+
+            FormatWriter formatWriter = FormatWriter.Acquire();
+            try {
+                FormatPlans.GetPlan(format).Format(formatWriter, values);
+                return formatWriter.CopyTo(writer);
+            } finally {
+                FormatWriter.Release(formatWriter);
             }
-            return sb.ToString();
         }
 
         /// <summary>
-        /// Looks through a format string and returns the position of the next interesting character.
+        /// Tries to format a string based on the C-Standard into a buffer, encoded as UTF-8.
         /// </summary>
-        /// <param name="format">The format specifier to look through.</param>
-        /// <param name="position">The position in the format specifier to start looking from.</param>
-        /// <returns>A position in the format specifier for the next interesting character, otherwise -1 if none found.</returns>
-        private static int GetNextFormatChar(string format, int position)
+        /// <param name="utf8Destination">The buffer to write the UTF-8 encoded result to.</param>
+        /// <param name="bytesWritten">The number of bytes written to <paramref name="utf8Destination"/>.</param>
+        /// <param name="format">The formatting string as per the C style <c>printf</c> function family.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>
+        /// <see langword="true"/> if the result was written, <see langword="false"/> if
+        /// <paramref name="utf8Destination"/> is too small, in which case <paramref name="bytesWritten"/> is zero.
+        /// </returns>
+        /// <exception cref="ArgumentNullException"><paramref name="format"/> may not be <see langword="null"/>.</exception>
+        /// <exception cref="FormatException">There was a fatal error parsing the string and/or the parameters.</exception>
+        /// <remarks>
+        /// The format is as for <see cref="SPrintF(string, object[])"/>. The result is formatted as UTF-16 in the
+        /// buffer of the thread, and then encoded into <paramref name="utf8Destination"/>, so that no string is
+        /// allocated to be encoded afterwards. A lone surrogate is encoded as the replacement character U+FFFD.
+        /// The generic overloads with up to eight arguments don't box them.
+        /// </remarks>
+        public static bool TrySPrintFUtf8(Span<byte> utf8Destination, out int bytesWritten, string format, params object[] values)
+        {
+            return TryFormatUtf8To(utf8Destination, out bytesWritten, format, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="TrySPrintFUtf8(Span{byte}, out int, string, object[])"/>
+        public static bool TrySPrintFUtf8<T1>(Span<byte> utf8Destination, out int bytesWritten, string format, T1 arg1)
+        {
+            return TryFormatUtf8To(utf8Destination, out bytesWritten, format, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="TrySPrintFUtf8(Span{byte}, out int, string, object[])"/>
+        public static bool TrySPrintFUtf8<T1, T2>(Span<byte> utf8Destination, out int bytesWritten, string format, T1 arg1, T2 arg2)
+        {
+            return TryFormatUtf8To(utf8Destination, out bytesWritten, format, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="TrySPrintFUtf8(Span{byte}, out int, string, object[])"/>
+        public static bool TrySPrintFUtf8<T1, T2, T3>(Span<byte> utf8Destination, out int bytesWritten, string format, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return TryFormatUtf8To(utf8Destination, out bytesWritten, format, FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="TrySPrintFUtf8(Span{byte}, out int, string, object[])"/>
+        public static bool TrySPrintFUtf8<T1, T2, T3, T4>(Span<byte> utf8Destination, out int bytesWritten, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
         {
-            if (position >= format.Length) return -1;
-            return format.IndexOf('%', position);
+            return TryFormatUtf8To(utf8Destination, out bytesWritten, format, FormatArguments.Create(arg1, arg2, arg3, arg4));
         }
+
+        /// <inheritdoc cref="TrySPrintFUtf8(Span{byte}, out int, string, object[])"/>
+        public static bool TrySPrintFUtf8<T1, T2, T3, T4, T5>(Span<byte> utf8Destination, out int bytesWritten, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return TryFormatUtf8To(utf8Destination, out bytesWritten, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="TrySPrintFUtf8(Span{byte}, out int, string, object[])"/>
+        public static bool TrySPrintFUtf8<T1, T2, T3, T4, T5, T6>(Span<byte> utf8Destination, out int bytesWritten, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return TryFormatUtf8To(utf8Destination, out bytesWritten, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="TrySPrintFUtf8(Span{byte}, out int, string, object[])"/>
+        public static bool TrySPrintFUtf8<T1, T2, T3, T4, T5, T6, T7>(Span<byte> utf8Destination, out int bytesWritten, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return TryFormatUtf8To(utf8Destination, out bytesWritten, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="TrySPrintFUtf8(Span{byte}, out int, string, object[])"/>
+        public static bool TrySPrintFUtf8<T1, T2, T3, T4, T5, T6, T7, T8>(Span<byte> utf8Destination, out int bytesWritten, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return TryFormatUtf8To(utf8Destination, out bytesWritten, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private static bool TryFormatUtf8To(Span<byte> utf8Destination, out int bytesWritten, string format, in FormatArguments values)
+        {
+            ThrowHelper.ThrowIfNull(format);
+
+            FormatWriter writer = FormatWriter.Acquire();
+            try {
+                FormatPlans.GetPlan(format).Format(writer, values);
+                return writer.TryCopyToUtf8(utf8Destination, out bytesWritten);
+            } finally {
+                FormatWriter.Release(writer);
+            }
+        }
+
+        /// <summary>
+        /// Format a string based on the C-Standard to a buffer writer, encoded as UTF-8.
+        /// </summary>
+        /// <param name="writer">The buffer writer to write the UTF-8 encoded result to.</param>
+        /// <param name="format">The formatting string as per the C style <c>printf</c> function family.</param>
+        /// <param name="values">The list of objects as given in the format string.</param>
+        /// <returns>The number of bytes written.</returns>
+        /// <exception cref="ArgumentNullException">
+        /// <paramref name="writer"/> or <paramref name="format"/> may not be <see langword="null"/>.
+        /// </exception>
+        /// <exception cref="FormatException">There was a fatal error parsing the string and/or the parameters.</exception>
+        /// <remarks>
+        /// The format is as for <see cref="SPrintF(string, object[])"/>. Nothing is written to the
+        /// <paramref name="writer"/> if there is an error. A lone surrogate is encoded as the replacement character
+        /// U+FFFD. The generic overloads with up to eight arguments don't box them.
+        /// </remarks>
+        public static int SPrintFUtf8(IBufferWriter<byte> writer, string format, params object[] values)
+        {
+            return FormatUtf8To(writer, format, new FormatArguments(values));
+        }
+
+        /// <inheritdoc cref="SPrintFUtf8(IBufferWriter{byte}, string, object[])"/>
+        public static int SPrintFUtf8<T1>(IBufferWriter<byte> writer, string format, T1 arg1)
+        {
+            return FormatUtf8To(writer, format, FormatArguments.Create(arg1));
+        }
+
+        /// <inheritdoc cref="SPrintFUtf8(IBufferWriter{byte}, string, object[])"/>
+        public static int SPrintFUtf8<T1, T2>(IBufferWriter<byte> writer, string format, T1 arg1, T2 arg2)
+        {
+            return FormatUtf8To(writer, format, FormatArguments.Create(arg1, arg2));
+        }
+
+        /// <inheritdoc cref="SPrintFUtf8(IBufferWriter{byte}, string, object[])"/>
+        public static int SPrintFUtf8<T1, T2, T3>(IBufferWriter<byte> writer, string format, T1 arg1, T2 arg2, T3 arg3)
+        {
+            return FormatUtf8To(writer, format, FormatArguments.Create(arg1, arg2, arg3));
+        }
+
+        /// <inheritdoc cref="SPrintFUtf8(IBufferWriter{byte}, string, object[])"/>
+        public static int SPrintFUtf8<T1, T2, T3, T4>(IBufferWriter<byte> writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4)
+        {
+            return FormatUtf8To(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4));
+        }
+
+        /// <inheritdoc cref="SPrintFUtf8(IBufferWriter{byte}, string, object[])"/>
+        public static int SPrintFUtf8<T1, T2, T3, T4, T5>(IBufferWriter<byte> writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5)
+        {
+            return FormatUtf8To(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5));
+        }
+
+        /// <inheritdoc cref="SPrintFUtf8(IBufferWriter{byte}, string, object[])"/>
+        public static int SPrintFUtf8<T1, T2, T3, T4, T5, T6>(IBufferWriter<byte> writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6)
+        {
+            return FormatUtf8To(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6));
+        }
+
+        /// <inheritdoc cref="SPrintFUtf8(IBufferWriter{byte}, string, object[])"/>
+        public static int SPrintFUtf8<T1, T2, T3, T4, T5, T6, T7>(IBufferWriter<byte> writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7)
+        {
+            return FormatUtf8To(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7));
+        }
+
+        /// <inheritdoc cref="SPrintFUtf8(IBufferWriter{byte}, string, object[])"/>
+        public static int SPrintFUtf8<T1, T2, T3, T4, T5, T6, T7, T8>(IBufferWriter<byte> writer, string format, T1 arg1, T2 arg2, T3 arg3, T4 arg4, T5 arg5, T6 arg6, T7 arg7, T8 arg8)
+        {
+            return FormatUtf8To(writer, format, FormatArguments.Create(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8));
+        }
+
+        private static int FormatUtf8To(IBufferWriter<byte> writer, string format, in FormatArguments values)
+        {
+            ThrowHelper.ThrowIfNull(writer);
+            ThrowHelper.ThrowIfNull(format);
+
+            FormatWriter formatWriter = FormatWriter.Acquire();
+            try {
+                FormatPlans.GetPlan(format).Format(formatWriter, values);
+                return formatWriter.CopyToUtf8(writer);
+            } finally {
+                FormatWriter.Release(formatWriter);
+            }
+        }
+
+        /// <summary>
+        /// Formats each value of an array based on the C-Standard and writes the results to a buffer writer.
+        /// </summary>
+        /// <typeparam name="T">The type of the values.</typeparam>
+        /// <param name="writer">The buffer writer to write the results to.</param>
+        /// <param name="format">
+        /// The formatting string as per the C style <c>printf</c> function family, with exactly one argument.
+        /// </param>
+        /// <param name="values">The values to format.</param>
+        /// <param name="separator">
+        /// The string written between two results, such as <c>","</c> or a new line. May be <see langword="null"/>.
+        /// </param>
+        /// <returns>The number of characters written.</returns>
+        /// <exception cref="ArgumentNullException">
+        /// <paramref name="writer"/> or <paramref name="format"/> may not be <see langword="null"/>.
+        /// </exception>
+        /// <exception cref="FormatException">
+        /// The format is invalid, doesn't have exactly one argument, or there was an error converting a value.
+        /// </exception>
+        /// <remarks>
+        /// The format is compiled once with <see cref="SPrintFFormat.Compile(string)"/>, so an invalid format
+        /// specifier is an error, and the values are formatted with
+        /// <see cref="SPrintFFormat.AppendBatchTo{T}(IBufferWriter{char}, ReadOnlySpan{T}, string)"/>.
+        /// </remarks>
+        public static long SPrintFBatch<T>(IBufferWriter<char> writer, string format, ReadOnlySpan<T> values, string separator)
+        {
+            ThrowHelper.ThrowIfNull(writer);
+
+            return SPrintFFormat.Compile(format).AppendBatchTo(writer, values, separator);
+        }
+
+        /// <summary>
+        /// Formats each value of an array based on the C-Standard and writes the results to a buffer writer,
+        /// optionally in parallel.
+        /// </summary>
+        /// <typeparam name="T">The type of the values.</typeparam>
+        /// <param name="writer">The buffer writer to write the results to.</param>
+        /// <param name="format">
+        /// The formatting string as per the C style <c>printf</c> function family, with exactly one argument.
+        /// </param>
+        /// <param name="values">The values to format.</param>
+        /// <param name="separator">
+        /// The string written between two results, such as <c>","</c> or a new line. May be <see langword="null"/>.
+        /// </param>
+        /// <param name="parallel">
+        /// If <see langword="true"/>, a large number of values is formatted in chunks on the thread pool.
+        /// </param>
+        /// <returns>The number of characters written.</returns>
+        /// <exception cref="ArgumentNullException">
+        /// <paramref name="writer"/> or <paramref name="format"/> may not be <see langword="null"/>.
+        /// </exception>
+        /// <exception cref="FormatException">
+        /// The format is invalid, doesn't have exactly one argument, or there was an error converting a value.
+        /// </exception>
+        /// <remarks>
+        /// The values are formatted with
+        /// <see cref="SPrintFFormat.AppendBatchTo{T}(IBufferWriter{char}, ReadOnlyMemory{T}, string, bool)"/>. The
+        /// result is the same, if formatted in parallel or not.
+        /// </remarks>
+        public static long SPrintFBatch<T>(IBufferWriter<char> writer, string format, ReadOnlyMemory<T> values, string separator, bool parallel)
+        {
+            ThrowHelper.ThrowIfNull(writer);
+
+            return SPrintFFormat.Compile(format).AppendBatchTo(writer, values, separator, parallel);
+        }
+#endif
     }
 }
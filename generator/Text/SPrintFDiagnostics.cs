@@ -0,0 +1,39 @@
+﻿namespace RJCP.Core.Text
+{
+    using Microsoft.CodeAnalysis;
+
+    internal static class SPrintFDiagnostics
+    {
+        private const string Category = "RJCP.Core.Text";
+
+        public static readonly DiagnosticDescriptor InvalidMethod = new(
+            "SPRINTF001",
+            "Invalid SPrintF method",
+            "The method '{0}' must be a partial method declaration that returns string, isn't generic, and has no ref or out parameters",
+            Category, DiagnosticSeverity.Error, true);
+
+        public static readonly DiagnosticDescriptor InvalidFormat = new(
+            "SPRINTF002",
+            "Invalid SPrintF format",
+            "The format of '{0}' is invalid: {1}",
+            Category, DiagnosticSeverity.Error, true);
+
+        public static readonly DiagnosticDescriptor ArgumentCount = new(
+            "SPRINTF003",
+            "SPrintF argument count mismatch",
+            "The format of '{0}' needs {1} arguments, but the method has {2} parameters",
+            Category, DiagnosticSeverity.Error, true);
+
+        public static readonly DiagnosticDescriptor ArgumentType = new(
+            "SPRINTF004",
+            "SPrintF argument type mismatch",
+            "The parameter '{0}' of type '{1}' can't be formatted as {2} argument, and formatting throws a FormatException",
+            Category, DiagnosticSeverity.Warning, true);
+
+        public static readonly DiagnosticDescriptor BoxedArguments = new(
+            "SPRINTF005",
+            "SPrintF arguments are boxed",
+            "The method '{0}' has {1} parameters, and only up to {2} are formatted without boxing",
+            Category, DiagnosticSeverity.Warning, true);
+    }
+}
@@ -0,0 +1,371 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Collections.Immutable;
+    using System.Linq;
+    using System.Text;
+    using System.Threading;
+    using Format;
+    using Microsoft.CodeAnalysis;
+    using Microsoft.CodeAnalysis.CSharp;
+    using Microsoft.CodeAnalysis.CSharp.Syntax;
+
+    /// <summary>
+    /// Implements the partial methods that have the <c>SPrintFAttribute</c>.
+    /// </summary>
+    /// <remarks>
+    /// The format of the attribute is parsed and checked against the parameters of the method when building, and
+    /// errors are reported as compiler diagnostics. The method is implemented with a <c>SPrintFFormat</c> that is
+    /// compiled once, and formats the parameters with the generic overloads, so that they aren't boxed. There are
+    /// generic overloads for up to eight arguments, so a method with more parameters boxes them, which is reported
+    /// as information. A format without arguments is formatted when building, and the method returns the constant
+    /// result.
+    /// </remarks>
+    [Generator(LanguageNames.CSharp)]
+    public sealed class SPrintFGenerator : IIncrementalGenerator
+    {
+        private const string AttributeName = "RJCP.Core.Text.SPrintFAttribute";
+
+        // The most arguments of the generic SPrintFFormat.Format overloads.
+        private const int MaxGenericArguments = 8;
+
+        private static readonly SymbolDisplayFormat TypeFormat =
+            SymbolDisplayFormat.FullyQualifiedFormat.AddMiscellaneousOptions(
+                SymbolDisplayMiscellaneousOptions.IncludeNullableReferenceTypeModifier);
+
+        private sealed class GeneratedMethod : IEquatable<GeneratedMethod>
+        {
+            public GeneratedMethod(string hintName, string source, ImmutableArray<Diagnostic> diagnostics)
+            {
+                HintName = hintName;
+                Source = source;
+                Diagnostics = diagnostics;
+            }
+
+            // The name and source of the implementation, which are null if there is an error.
+            public string HintName { get; }
+
+            public string Source { get; }
+
+            public ImmutableArray<Diagnostic> Diagnostics { get; }
+
+            public bool Equals(GeneratedMethod other)
+            {
+                if (other is null) return false;
+                return HintName == other.HintName && Source == other.Source &&
+                    Diagnostics.SequenceEqual(other.Diagnostics);
+            }
+
+            public override bool Equals(object obj)
+            {
+                return Equals(obj as GeneratedMethod);
+            }
+
+            public override int GetHashCode()
+            {
+                return Source is null ? Diagnostics.Length : Source.GetHashCode();
+            }
+        }
+
+        /// <summary>
+        /// Registers the generator for the methods with the <c>SPrintFAttribute</c>.
+        /// </summary>
+        /// <param name="context">The context to register the generator with.</param>
+        public void Initialize(IncrementalGeneratorInitializationContext context)
+        {
+            IncrementalValuesProvider<GeneratedMethod> methods = context.SyntaxProvider.ForAttributeWithMetadataName(
+                AttributeName,
+                static (node, _) => node is MethodDeclarationSyntax,
+                static (attributeContext, token) => Generate(attributeContext, token));
+
+            context.RegisterSourceOutput(methods, static (output, method) => {
+                foreach (Diagnostic diagnostic in method.Diagnostics) {
+                    output.ReportDiagnostic(diagnostic);
+                }
+                if (method.Source is not null) output.AddSource(method.HintName, method.Source);
+            });
+        }
+
+        private static GeneratedMethod Generate(GeneratorAttributeSyntaxContext context, CancellationToken token)
+        {
+            IMethodSymbol method = (IMethodSymbol)context.TargetSymbol;
+            MethodDeclarationSyntax syntax = (MethodDeclarationSyntax)context.TargetNode;
+
+            if (!method.IsPartialDefinition || method.PartialImplementationPart is not null ||
+                method.IsGenericMethod || method.ReturnType.SpecialType != SpecialType.System_String ||
+                method.Parameters.Any(p => p.RefKind is RefKind.Ref or RefKind.Out)) {
+                return Error(Diagnostic.Create(SPrintFDiagnostics.InvalidMethod, syntax.Identifier.GetLocation(), method.Name));
+            }
+
+            AttributeData attribute = context.Attributes[0];
+            Location formatLocation = attribute.ApplicationSyntaxReference?.GetSyntax(token).GetLocation() ??
+                syntax.Identifier.GetLocation();
+            if (attribute.ConstructorArguments.Length != 1 || attribute.ConstructorArguments[0].Value is not string format) {
+                return Error(Diagnostic.Create(SPrintFDiagnostics.InvalidFormat, formatLocation, method.Name,
+                    "The format may not be null"));
+            }
+
+            int overload = method.ContainingType.GetMembers(method.Name).OfType<IMethodSymbol>().ToList().IndexOf(method);
+            string fieldName = string.Format("__SPrintFFormat_{0}_{1}", method.Name, overload);
+            string hintName = string.Format("{0}.{1}_{2}.g.cs",
+                GetHintName(method.ContainingType.ToDisplayString()), method.Name, overload);
+
+            // If the format is wrong, the method is still implemented, so that only the error of the format is
+            // reported, and not that the method has no implementation.
+            List<SPrintFArgumentKind> argumentKinds = new();
+            StringBuilder literal = new();
+            string message = ParseFormat(format, argumentKinds, literal);
+            if (message is not null) {
+                return new GeneratedMethod(hintName, GetSource(method, syntax, null, GetThrow(message)),
+                    ImmutableArray.Create(Diagnostic.Create(SPrintFDiagnostics.InvalidFormat, formatLocation, method.Name, message)));
+            }
+
+            if (argumentKinds.Count != method.Parameters.Length) {
+                Diagnostic diagnostic = Diagnostic.Create(SPrintFDiagnostics.ArgumentCount, formatLocation, method.Name,
+                    argumentKinds.Count, method.Parameters.Length);
+                return new GeneratedMethod(hintName, GetSource(method, syntax, null, GetThrow(diagnostic.GetMessage())),
+                    ImmutableArray.Create(diagnostic));
+            }
+
+            ImmutableArray<Diagnostic>.Builder diagnostics = ImmutableArray.CreateBuilder<Diagnostic>();
+            for (int i = 0; i < argumentKinds.Count; i++) {
+                IParameterSymbol parameter = method.Parameters[i];
+                if (!IsCompatible(argumentKinds[i], parameter.Type)) {
+                    Location location = parameter.Locations.FirstOrDefault() ?? syntax.Identifier.GetLocation();
+                    diagnostics.Add(Diagnostic.Create(SPrintFDiagnostics.ArgumentType, location, parameter.Name,
+                        parameter.Type.ToDisplayString(), GetKindName(argumentKinds[i])));
+                }
+            }
+
+            if (method.Parameters.Length > MaxGenericArguments) {
+                diagnostics.Add(Diagnostic.Create(SPrintFDiagnostics.BoxedArguments, syntax.Identifier.GetLocation(),
+                    method.Name, method.Parameters.Length, MaxGenericArguments));
+            }
+
+            string source;
+            if (argumentKinds.Count == 0) {
+                source = GetSource(method, syntax, null, "return " + SymbolDisplay.FormatLiteral(literal.ToString(), true));
+            } else {
+                string field = string.Format("private static readonly global::RJCP.Core.Text.SPrintFFormat {0} =\n" +
+                    "    global::RJCP.Core.Text.SPrintFFormat.Compile({1})", fieldName, SymbolDisplay.FormatLiteral(format, true));
+                string arguments = string.Join(", ", method.Parameters.Select(p => "@" + p.Name));
+                string body = method.Parameters.Length <= MaxGenericArguments ?
+                    string.Format("return {0}.Format({1})", fieldName, arguments) :
+                    string.Format("return {0}.Format(new object[] {{ {1} }})", fieldName, arguments);
+                source = GetSource(method, syntax, field, body);
+            }
+            return new GeneratedMethod(hintName, source, diagnostics.ToImmutable());
+        }
+
+        private static GeneratedMethod Error(Diagnostic diagnostic)
+        {
+            return new GeneratedMethod(null, null, ImmutableArray.Create(diagnostic));
+        }
+
+        // Parses the format as SPrintFFormat.Compile does, getting the arguments needed, and the result if there are
+        // no arguments. Returns the error message, or null if the format is valid.
+        private static string ParseFormat(string format, List<SPrintFArgumentKind> argumentKinds, StringBuilder literal)
+        {
+            int position = 0;
+            while (position < format.Length) {
+                int next = format.IndexOf('%', position);
+                if (next == -1) {
+                    literal.Append(format, position, format.Length - position);
+                    break;
+                }
+                literal.Append(format, position, next - position);
+
+                position = next;
+                FormatSpecifier formatSpecifier = FormatSpecifier.Parse(format, ref position);
+                if (formatSpecifier is null) return string.Format("Invalid format specifier at position {0}", next);
+
+                if (formatSpecifier.WidthAsArg) argumentKinds.Add(SPrintFArgumentKind.Width);
+                if (formatSpecifier.PrecisionAsArg) argumentKinds.Add(SPrintFArgumentKind.Precision);
+
+                switch (formatSpecifier.Specifier) {
+                case '%':
+                    if (formatSpecifier.ArgumentLength != 2) return "Literal character % doesn't support any formatting";
+                    literal.Append('%');
+                    break;
+                case 'd':
+                case 'i':
+                    argumentKinds.Add(SPrintFArgumentKind.Integer);
+                    break;
+                case 'o':
+                case 'u':
+                case 'x':
+                case 'X':
+                    argumentKinds.Add(SPrintFArgumentKind.UnsignedInteger);
+                    break;
+                case 'f':
+                case 'F':
+                case 'e':
+                case 'E':
+                case 'g':
+                case 'G':
+                    argumentKinds.Add(SPrintFArgumentKind.FloatingPoint);
+                    break;
+                case 'c':
+                    argumentKinds.Add(SPrintFArgumentKind.Char);
+                    break;
+                case 's':
+                    argumentKinds.Add(SPrintFArgumentKind.String);
+                    break;
+                default:
+                    return string.Format("The format specifier '{0}' is not supported", formatSpecifier.Specifier);
+                }
+            }
+            return null;
+        }
+
+        // Checks the types that the formatters accept. A type that is only known at run time, such as object, is
+        // accepted, as is a string, which is parsed for the numeric specifiers.
+        private static bool IsCompatible(SPrintFArgumentKind kind, ITypeSymbol type)
+        {
+            if (type is INamedTypeSymbol { OriginalDefinition.SpecialType: SpecialType.System_Nullable_T } nullable) {
+                type = nullable.TypeArguments[0];
+            }
+
+            if (type.TypeKind is TypeKind.TypeParameter or TypeKind.Interface or TypeKind.Dynamic or TypeKind.Error)
+                return true;
+
+            bool isIntegral = false;
+            bool isFloat = false;
+            switch (type.SpecialType) {
+            case SpecialType.System_Object:
+            case SpecialType.System_ValueType:
+                return true;
+            case SpecialType.System_String:
+                return kind is not SPrintFArgumentKind.Width and not SPrintFArgumentKind.Precision;
+            case SpecialType.System_Int32:
+                if (kind is SPrintFArgumentKind.Width or SPrintFArgumentKind.Precision) return true;
+                isIntegral = true;
+                break;
+            case SpecialType.System_SByte:
+            case SpecialType.System_Byte:
+            case SpecialType.System_Int16:
+            case SpecialType.System_UInt16:
+            case SpecialType.System_UInt32:
+            case SpecialType.System_Int64:
+            case SpecialType.System_UInt64:
+                isIntegral = true;
+                break;
+            case SpecialType.System_Single:
+            case SpecialType.System_Double:
+            case SpecialType.System_Decimal:
+                isFloat = true;
+                break;
+            }
+            bool isChar = type.SpecialType == SpecialType.System_Char;
+            bool isBool = type.SpecialType == SpecialType.System_Boolean;
+
+            switch (kind) {
+            case SPrintFArgumentKind.Integer:
+            case SPrintFArgumentKind.UnsignedInteger:
+                return isIntegral || isChar || isBool;
+            case SPrintFArgumentKind.FloatingPoint:
+                return isIntegral || isChar || isBool || isFloat;
+            case SPrintFArgumentKind.Char:
+                return isIntegral || isChar;
+            default:
+                return false;
+            }
+        }
+
+        private static string GetKindName(SPrintFArgumentKind kind)
+        {
+            switch (kind) {
+            case SPrintFArgumentKind.Width: return "a width";
+            case SPrintFArgumentKind.Precision: return "a precision";
+            case SPrintFArgumentKind.Integer: return "an integer";
+            case SPrintFArgumentKind.UnsignedInteger: return "an unsigned integer";
+            case SPrintFArgumentKind.FloatingPoint: return "a floating point";
+            case SPrintFArgumentKind.Char: return "a character";
+            default: return "a string";
+            }
+        }
+
+        private static string GetHintName(string name)
+        {
+            StringBuilder hintName = new(name.Length);
+            foreach (char c in name) {
+                hintName.Append(char.IsLetterOrDigit(c) || c == '.' ? c : '_');
+            }
+            return hintName.ToString();
+        }
+
+        private static string GetThrow(string message)
+        {
+            return "throw new global::System.FormatException(" + SymbolDisplay.FormatLiteral(message, true) + ")";
+        }
+
+        // Gets the source of the implementation of the method, with the statement of its body, and a field of its
+        // type, which may be null.
+        private static string GetSource(IMethodSymbol method, MethodDeclarationSyntax syntax, string field, string body)
+        {
+            StringBuilder source = new();
+            source.Append("// <auto-generated/>\n");
+            source.Append("#nullable enable annotations\n");
+            source.Append("#pragma warning disable\n\n");
+
+            string indent = string.Empty;
+            if (!method.ContainingNamespace.IsGlobalNamespace) {
+                source.Append("namespace ").Append(method.ContainingNamespace.ToDisplayString()).Append('\n');
+                source.Append("{\n");
+                indent = "    ";
+            }
+
+            List<INamedTypeSymbol> types = new();
+            for (INamedTypeSymbol type = method.ContainingType; type is not null; type = type.ContainingType) {
+                types.Insert(0, type);
+            }
+            foreach (INamedTypeSymbol type in types) {
+                source.Append(indent).Append("partial ").Append(GetTypeKeyword(type)).Append(' ').Append(type.Name);
+                if (type.TypeParameters.Length > 0) {
+                    source.Append('<').Append(string.Join(", ", type.TypeParameters.Select(t => t.Name))).Append('>');
+                }
+                source.Append('\n').Append(indent).Append("{\n");
+                indent += "    ";
+            }
+
+            if (field is not null) {
+                foreach (string line in field.Split('\n')) {
+                    source.Append(indent).Append(line).Append('\n');
+                }
+                source.Insert(source.Length - 1, ';').Append('\n');
+            }
+
+            source.Append(indent).Append(syntax.Modifiers.ToString()).Append(' ')
+                .Append(method.ReturnType.ToDisplayString(TypeFormat)).Append(' ').Append(method.Name).Append('(');
+            for (int i = 0; i < method.Parameters.Length; i++) {
+                IParameterSymbol parameter = method.Parameters[i];
+                if (i > 0) source.Append(", ");
+                if (i == 0 && method.IsExtensionMethod) source.Append("this ");
+                if (parameter.IsParams) source.Append("params ");
+                if (parameter.RefKind == RefKind.In) source.Append("in ");
+                source.Append(parameter.Type.ToDisplayString(TypeFormat)).Append(" @").Append(parameter.Name);
+            }
+            source.Append(")\n");
+            source.Append(indent).Append("{\n");
+            source.Append(indent).Append("    ").Append(body).Append(";\n");
+            source.Append(indent).Append("}\n");
+
+            while (indent.Length > 0) {
+                indent = indent.Substring(4);
+                source.Append(indent).Append("}\n");
+            }
+            return source.ToString();
+        }
+
+        private static string GetTypeKeyword(INamedTypeSymbol type)
+        {
+            if (type.IsRecord) return type.TypeKind == TypeKind.Struct ? "record struct" : "record";
+            switch (type.TypeKind) {
+            case TypeKind.Struct: return "struct";
+            case TypeKind.Interface: return "interface";
+            default: return "class";
+            }
+        }
+    }
+}
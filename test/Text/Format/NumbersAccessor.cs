@@ -13,6 +13,26 @@
             return (int)AccType.InvokeStatic(nameof(CountDigits), value);
         }
 
+        public static int CountDigits(ulong value)
+        {
+            return (int)AccType.InvokeStatic(nameof(CountDigits), value);
+        }
+
+        public static void WriteDigits(char[] buffer, int end, ulong value)
+        {
+            AccType.InvokeStatic(nameof(WriteDigits), buffer, end, value);
+        }
+
+        public static void WriteHexDigits(char[] buffer, int end, ulong value, int digits, bool upper)
+        {
+            AccType.InvokeStatic(nameof(WriteHexDigits), buffer, end, value, digits, upper);
+        }
+
+        public static void WriteOctalDigits(char[] buffer, int end, ulong value, int digits)
+        {
+            AccType.InvokeStatic(nameof(WriteOctalDigits), buffer, end, value, digits);
+        }
+
         public static int CountBitDigits(ulong value, int bitsPerDigit)
         {
             return (int)AccType.InvokeStatic(nameof(CountBitDigits), value, bitsPerDigit);
@@ -33,6 +33,92 @@
             }
         }
 
+        [Test]
+        public void CountDigitsULong()
+        {
+            Assert.That(NumbersAccessor.CountDigits(0UL), Is.EqualTo(1));
+            Assert.That(NumbersAccessor.CountDigits(1UL), Is.EqualTo(1));
+
+            ulong value = 1;
+            int digits = 2;
+            while (digits <= 20) {
+                value *= 10;
+                Assert.That(NumbersAccessor.CountDigits(value - 1), Is.EqualTo(digits - 1));
+                Assert.That(NumbersAccessor.CountDigits(value), Is.EqualTo(digits));
+                Assert.That(NumbersAccessor.CountDigits(value + 1), Is.EqualTo(digits));
+                digits++;
+            }
+            Assert.That(NumbersAccessor.CountDigits(ulong.MaxValue), Is.EqualTo(20));
+        }
+
+        [Test]
+        public void CountDigitsLongMinValue()
+        {
+            Assert.That(NumbersAccessor.CountDigits(long.MinValue), Is.EqualTo(19));
+        }
+
+        [TestCase(0UL, "0")]
+        [TestCase(7UL, "7")]
+        [TestCase(42UL, "42")]
+        [TestCase(100UL, "100")]
+        [TestCase(4294967295UL, "4294967295")]
+        [TestCase(4294967296UL, "4294967296")]
+        [TestCase(1234567890123456789UL, "1234567890123456789")]
+        [TestCase(ulong.MaxValue, "18446744073709551615")]
+        public void WriteDigits(ulong value, string expected)
+        {
+            char[] buffer = new char[24];
+            int end = 2 + expected.Length;
+            NumbersAccessor.WriteDigits(buffer, end, value);
+            Assert.That(new string(buffer, 2, expected.Length), Is.EqualTo(expected));
+            Assert.That(buffer[1], Is.EqualTo('\0'));
+            Assert.That(buffer[end], Is.EqualTo('\0'));
+        }
+
+        [TestCase(0UL, "0")]
+        [TestCase(0xAUL, "a")]
+        [TestCase(0xFFUL, "ff")]
+        [TestCase(0x123UL, "123")]
+        [TestCase(0xDEADBEEFUL, "deadbeef")]
+        [TestCase(0x1DEADBEEFUL, "1deadbeef")]
+        [TestCase(0x0123456789ABCDEFUL, "123456789abcdef")]
+        [TestCase(0xFEDCBA9876543210UL, "fedcba9876543210")]
+        [TestCase(ulong.MaxValue, "ffffffffffffffff")]
+        public void WriteHexDigits(ulong value, string expected)
+        {
+            int digits = NumbersAccessor.CountBitDigits(value, 4);
+            Assert.That(digits, Is.EqualTo(expected.Length));
+
+            char[] buffer = new char[24];
+            int end = 2 + expected.Length;
+            NumbersAccessor.WriteHexDigits(buffer, end, value, digits, false);
+            Assert.That(new string(buffer, 2, expected.Length), Is.EqualTo(expected));
+            Assert.That(buffer[1], Is.EqualTo('\0'));
+            Assert.That(buffer[end], Is.EqualTo('\0'));
+
+            NumbersAccessor.WriteHexDigits(buffer, end, value, digits, true);
+            Assert.That(new string(buffer, 2, expected.Length), Is.EqualTo(expected.ToUpperInvariant()));
+        }
+
+        [TestCase(0UL, "0")]
+        [TestCase(7UL, "7")]
+        [TestCase(8UL, "10")]
+        [TestCase(511UL, "777")]
+        [TestCase(2739133UL, "12345675")]
+        [TestCase(ulong.MaxValue, "1777777777777777777777")]
+        public void WriteOctalDigits(ulong value, string expected)
+        {
+            int digits = NumbersAccessor.CountBitDigits(value, 3);
+            Assert.That(digits, Is.EqualTo(expected.Length));
+
+            char[] buffer = new char[26];
+            int end = 2 + expected.Length;
+            NumbersAccessor.WriteOctalDigits(buffer, end, value, digits);
+            Assert.That(new string(buffer, 2, expected.Length), Is.EqualTo(expected));
+            Assert.That(buffer[1], Is.EqualTo('\0'));
+            Assert.That(buffer[end], Is.EqualTo('\0'));
+        }
+
         [Test]
         public void CountBitDigitsHex()
         {
@@ -0,0 +1,241 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using System.IO;
+    using System.Text;
+    using NUnit.Framework;
+
+#if NET6_0_OR_GREATER
+    using System.Buffers;
+#endif
+
+    [TestFixture]
+    public class SPrintFFormatTest
+    {
+        [Test]
+        public void CompileNull()
+        {
+            Assert.That(() => { _ = SPrintFFormat.Compile(null); }, Throws.TypeOf<ArgumentNullException>());
+        }
+
+        [Test]
+        public void CompileLiteral()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("No specifiers 100%%");
+            Assert.Multiple(() => {
+                Assert.That(format.FormatString, Is.EqualTo("No specifiers 100%%"));
+                Assert.That(format.ArgumentCount, Is.EqualTo(0));
+                Assert.That(format.Format(), Is.EqualTo("No specifiers 100%"));
+            });
+        }
+
+        [Test]
+        public void ArgumentKinds()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%d %u %x %*.*f %e %c %s %%");
+            Assert.That(format.ArgumentCount, Is.EqualTo(9));
+            Assert.That(format.ArgumentKinds, Is.EqualTo(new[] {
+                SPrintFArgumentKind.Integer,
+                SPrintFArgumentKind.UnsignedInteger,
+                SPrintFArgumentKind.UnsignedInteger,
+                SPrintFArgumentKind.Width,
+                SPrintFArgumentKind.Precision,
+                SPrintFArgumentKind.FloatingPoint,
+                SPrintFArgumentKind.FloatingPoint,
+                SPrintFArgumentKind.Char,
+                SPrintFArgumentKind.String
+            }));
+        }
+
+        [TestCase("%")]
+        [TestCase("value %")]
+        [TestCase("%5")]
+        [TestCase("%.")]
+        [TestCase("%y")]
+        [TestCase("%lll")]
+        [TestCase("handlerTransmitThread: 0x%02 , 0x%02")]
+        [TestCase("%5%")]
+        [TestCase("%a")]
+        [TestCase("%p")]
+        [TestCase("%n")]
+        public void CompileInvalid(string format)
+        {
+            Assert.That(() => { _ = SPrintFFormat.Compile(format); }, Throws.TypeOf<FormatException>());
+        }
+
+        [Test]
+        public void FormatSameAsSPrintF()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%s: %5d %-8.3f [%*c]");
+            Assert.Multiple(() => {
+                for (int i = -3; i < 3; i++) {
+                    Assert.That(format.Format("item", i, i / 3.0, i, 'x'),
+                        Is.EqualTo(StringUtilities.SPrintF("%s: %5d %-8.3f [%*c]", "item", i, i / 3.0, i, 'x')));
+                }
+            });
+        }
+
+        [Test]
+        public void FormatInsufficientArguments()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%d %d");
+            Assert.That(() => { _ = format.Format(1); }, Throws.TypeOf<FormatException>());
+        }
+
+        [Test]
+        public void AppendTo()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%02x");
+            StringBuilder sb = new();
+            for (int i = 0; i < 4; i++) {
+                format.AppendTo(sb, i * 85);
+            }
+            Assert.That(sb.ToString(), Is.EqualTo("0055aaff"));
+        }
+
+        [Test]
+        public void WriteToTextWriter()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%3d;");
+            using StringWriter writer = new();
+            for (int i = 0; i < 3; i++) {
+                Assert.That(format.WriteTo(writer, i * 50), Is.EqualTo(4));
+            }
+            Assert.That(writer.ToString(), Is.EqualTo("  0; 50;100;"));
+        }
+
+        [Test]
+        public void WriteToStream()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%s%c");
+            using MemoryStream stream = new();
+            Assert.That(format.WriteTo(stream, Encoding.UTF8, "\u20ac", '!'), Is.EqualTo(4));
+            Assert.That(stream.ToArray(), Is.EqualTo(new byte[] { 0xE2, 0x82, 0xAC, 0x21 }));
+        }
+
+        [Test]
+        public void WriteToStreamError()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%d %d");
+            using MemoryStream stream = new();
+            Assert.That(() => { _ = format.WriteTo(stream, Encoding.UTF8, 1); }, Throws.TypeOf<FormatException>());
+            Assert.That(stream.Length, Is.EqualTo(0));
+        }
+
+#if NET6_0_OR_GREATER
+        [Test]
+        public void AppendToBufferWriter()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%02x");
+            ArrayBufferWriter<char> writer = new();
+            for (int i = 0; i < 4; i++) {
+                Assert.That(format.AppendTo(writer, i * 85), Is.EqualTo(2));
+            }
+            Assert.That(writer.WrittenSpan.ToString(), Is.EqualTo("0055aaff"));
+        }
+
+        [Test]
+        public void TryFormat()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%s: %8.3e");
+            Span<char> buffer = stackalloc char[16];
+            Assert.That(format.TryFormat(buffer, out int charsWritten, "v", 1234.56), Is.True);
+            Assert.That(buffer[..charsWritten].ToString(), Is.EqualTo("v: 1.235e+03"));
+            Assert.That(format.TryFormat(buffer[..11], out charsWritten, "v", 1234.56), Is.False);
+            Assert.That(charsWritten, Is.EqualTo(0));
+        }
+
+        [Test]
+        public void TryFormatArguments()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%s=%d");
+            Span<char> buffer = stackalloc char[16];
+            Assert.That(format.TryFormat(buffer, out int charsWritten, new object[] { "v", 7 }), Is.True);
+            Assert.That(buffer[..charsWritten].ToString(), Is.EqualTo("v=7"));
+        }
+
+        [Test]
+        public void TryFormatGenericNoAllocation()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%s: %8.3e %5d");
+            char[] buffer = new char[32];
+            long allocated = StringUtilities_SNPrintFTest.AllocatedBytes(() => {
+                _ = format.TryFormat(buffer, out _, "v", 1234.56, 12);
+            });
+            Assert.That(allocated, Is.EqualTo(0));
+        }
+
+        [Test]
+        public void AppendToBufferWriterGenericNoAllocation()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%02x");
+            ArrayBufferWriter<char> writer = new(1024);
+            long allocated = StringUtilities_SNPrintFTest.AllocatedBytes(() => {
+                _ = format.AppendTo(writer, (byte)0xA5);
+            });
+            Assert.That(allocated, Is.EqualTo(0));
+            Assert.That(writer.WrittenSpan[..2].ToString(), Is.EqualTo("a5"));
+        }
+
+        [Test]
+        public void AppendUtf8ToBufferWriter()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%02X;");
+            ArrayBufferWriter<byte> writer = new();
+            for (int i = 0; i < 3; i++) {
+                Assert.That(format.AppendUtf8To(writer, i * 127), Is.EqualTo(3));
+            }
+            Assert.That(writer.WrittenSpan.ToArray(), Is.EqualTo(Encoding.ASCII.GetBytes("00;7F;FE;")));
+        }
+
+        [Test]
+        public void TryFormatUtf8()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%s: %8.3e");
+            Span<byte> buffer = stackalloc byte[16];
+            Assert.That(format.TryFormatUtf8(buffer, out int bytesWritten, "v", 1234.56), Is.True);
+            Assert.That(buffer[..bytesWritten].ToArray(), Is.EqualTo(Encoding.ASCII.GetBytes("v: 1.235e+03")));
+            Assert.That(format.TryFormatUtf8(buffer[..11], out bytesWritten, "v", 1234.56), Is.False);
+            Assert.That(bytesWritten, Is.EqualTo(0));
+        }
+
+        [Test]
+        public void TryFormatUtf8GenericNoAllocation()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%s: %8.3e %5d");
+            byte[] buffer = new byte[32];
+            long allocated = StringUtilities_SNPrintFTest.AllocatedBytes(() => {
+                _ = format.TryFormatUtf8(buffer, out _, "v", 1234.56, 12);
+            });
+            Assert.That(allocated, Is.EqualTo(0));
+            Assert.That(buffer[..18], Is.EqualTo(Encoding.ASCII.GetBytes("v: 1.235e+03    12")));
+        }
+
+        [Test]
+        public void AppendUtf8ToBufferWriterGenericNoAllocation()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%c%u");
+            ArrayBufferWriter<byte> writer = new(1024);
+            long allocated = StringUtilities_SNPrintFTest.AllocatedBytes(() => {
+                _ = format.AppendUtf8To(writer, 'x', 3u);
+            });
+            Assert.That(allocated, Is.EqualTo(0));
+            Assert.That(writer.WrittenSpan[..4].ToArray(), Is.EqualTo(Encoding.ASCII.GetBytes("x3x3")));
+        }
+
+        [Test]
+        public void CompileUtf8()
+        {
+            SPrintFFormat format = SPrintFFormat.CompileUtf8(new byte[] { 0x25, 0x64, 0x20, 0xC2, 0xB0, 0x43 });
+            Assert.That(format.FormatString, Is.EqualTo("%d \u00b0C"));
+            Assert.That(format.Format(21), Is.EqualTo("21 \u00b0C"));
+        }
+
+        [Test]
+        public void CompileUtf8Invalid()
+        {
+            Assert.That(() => { _ = SPrintFFormat.CompileUtf8(Encoding.ASCII.GetBytes("%p")); }, Throws.TypeOf<FormatException>());
+        }
+#endif
+    }
+}
@@ -0,0 +1,184 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using System.Collections.Immutable;
+    using System.IO;
+    using System.Linq;
+    using Microsoft.CodeAnalysis;
+    using Microsoft.CodeAnalysis.CSharp;
+    using NUnit.Framework;
+
+    [TestFixture]
+    public class SPrintFGeneratorDiagnosticsTest
+    {
+        private const string Header = "namespace Test\n{\n    using RJCP.Core.Text;\n\n    public static partial class Formats\n    {\n";
+        private const string Footer = "    }\n}\n";
+
+        private static readonly Lazy<MetadataReference[]> References = new(() => {
+            string assemblies = (string)AppContext.GetData("TRUSTED_PLATFORM_ASSEMBLIES");
+            return assemblies.Split(Path.PathSeparator)
+                .Append(typeof(SPrintFAttribute).Assembly.Location)
+                .Distinct()
+                .Select(path => (MetadataReference)MetadataReference.CreateFromFile(path))
+                .ToArray();
+        });
+
+        // Runs the generator over the methods, returning the diagnostics of the generator, and the errors of the
+        // compilation with the generated sources.
+        private static (ImmutableArray<Diagnostic> Generator, Diagnostic[] Errors) Generate(string source)
+        {
+            CSharpParseOptions parseOptions = new(LanguageVersion.CSharp10);
+            CSharpCompilation compilation = CSharpCompilation.Create("SPrintFGeneratorDiagnostics",
+                new[] { CSharpSyntaxTree.ParseText(source, parseOptions) },
+                References.Value,
+                new CSharpCompilationOptions(OutputKind.DynamicallyLinkedLibrary));
+
+            GeneratorDriver driver = CSharpGeneratorDriver.Create(
+                new[] { new SPrintFGenerator().AsSourceGenerator() }, parseOptions: parseOptions);
+            driver.RunGeneratorsAndUpdateCompilation(compilation, out Compilation output, out ImmutableArray<Diagnostic> diagnostics);
+            Diagnostic[] errors = output.GetDiagnostics()
+                .Where(d => d.Severity == DiagnosticSeverity.Error).ToArray();
+            return (diagnostics, errors);
+        }
+
+        private static void AssertDiagnostic(Diagnostic diagnostic, string id, DiagnosticSeverity severity,
+            string source, string location)
+        {
+            Assert.Multiple(() => {
+                Assert.That(diagnostic.Id, Is.EqualTo(id));
+                Assert.That(diagnostic.Severity, Is.EqualTo(severity));
+                Assert.That(diagnostic.Location.SourceSpan.Start, Is.EqualTo(source.IndexOf(location, StringComparison.Ordinal)));
+                Assert.That(diagnostic.Location.SourceSpan.Length, Is.EqualTo(location.Length));
+            });
+        }
+
+        [Test]
+        public void Valid()
+        {
+            string source = Header +
+                "        [SPrintF(\"%d: %-8s %.3f\")]\n" +
+                "        public static partial string Format(int a, string b, double c);\n" +
+                Footer;
+
+            (ImmutableArray<Diagnostic> diagnostics, Diagnostic[] errors) = Generate(source);
+            Assert.That(diagnostics, Is.Empty);
+            Assert.That(errors, Is.Empty);
+        }
+
+        [TestCase("public static partial int NotString(int value);", "NotString")]
+        [TestCase("public static partial string Generic<T>(T value);", "Generic")]
+        [TestCase("public static partial string Ref(ref int value);", "Ref")]
+        [TestCase("public static partial string Out(out int value);", "Out")]
+        public void InvalidMethod(string declaration, string name)
+        {
+            string source = Header +
+                "        [SPrintF(\"%d\")]\n" +
+                "        " + declaration + "\n" +
+                Footer;
+
+            (ImmutableArray<Diagnostic> diagnostics, _) = Generate(source);
+            Assert.That(diagnostics.Length, Is.EqualTo(1));
+            AssertDiagnostic(diagnostics[0], "SPRINTF001", DiagnosticSeverity.Error, source, name);
+        }
+
+        [TestCase("%")]
+        [TestCase("%p")]
+        [TestCase("%5%")]
+        [TestCase("%d %n")]
+        public void InvalidFormat(string format)
+        {
+            string attribute = "SPrintF(\"" + format + "\")";
+            string source = Header +
+                "        [" + attribute + "]\n" +
+                "        public static partial string Format(int value);\n" +
+                Footer;
+
+            (ImmutableArray<Diagnostic> diagnostics, Diagnostic[] errors) = Generate(source);
+            Assert.That(diagnostics.Length, Is.EqualTo(1));
+            AssertDiagnostic(diagnostics[0], "SPRINTF002", DiagnosticSeverity.Error, source, attribute);
+
+            // The method is still implemented, so that there is only the error of the format.
+            Assert.That(errors, Is.Empty);
+        }
+
+        [Test]
+        public void NullFormat()
+        {
+            string attribute = "SPrintF(null)";
+            string source = Header +
+                "        [" + attribute + "]\n" +
+                "        public static partial string Format(int value);\n" +
+                Footer;
+
+            (ImmutableArray<Diagnostic> diagnostics, _) = Generate(source);
+            Assert.That(diagnostics.Length, Is.EqualTo(1));
+            AssertDiagnostic(diagnostics[0], "SPRINTF002", DiagnosticSeverity.Error, source, attribute);
+        }
+
+        [TestCase("%d %d", "int a")]
+        [TestCase("%d", "int a, int b")]
+        [TestCase("%*.*f", "int w, double d")]
+        public void ArgumentCount(string format, string parameters)
+        {
+            string attribute = "SPrintF(\"" + format + "\")";
+            string source = Header +
+                "        [" + attribute + "]\n" +
+                "        public static partial string Format(" + parameters + ");\n" +
+                Footer;
+
+            (ImmutableArray<Diagnostic> diagnostics, Diagnostic[] errors) = Generate(source);
+            Assert.That(diagnostics.Length, Is.EqualTo(1));
+            AssertDiagnostic(diagnostics[0], "SPRINTF003", DiagnosticSeverity.Error, source, attribute);
+            Assert.That(errors, Is.Empty);
+        }
+
+        [Test]
+        public void ArgumentType()
+        {
+            string source = Header +
+                "        [SPrintF(\"%d %s %*d %c %f\")]\n" +
+                "        public static partial string Format(double dArg, int sArg, long width, int value, bool cArg, System.DateTime fArg);\n" +
+                Footer;
+
+            (ImmutableArray<Diagnostic> diagnostics, Diagnostic[] errors) = Generate(source);
+            Diagnostic[] ordered = diagnostics.OrderBy(d => d.Location.SourceSpan.Start).ToArray();
+            Assert.That(ordered.Length, Is.EqualTo(5));
+            AssertDiagnostic(ordered[0], "SPRINTF004", DiagnosticSeverity.Warning, source, "dArg");
+            AssertDiagnostic(ordered[1], "SPRINTF004", DiagnosticSeverity.Warning, source, "sArg");
+            AssertDiagnostic(ordered[2], "SPRINTF004", DiagnosticSeverity.Warning, source, "width");
+            AssertDiagnostic(ordered[3], "SPRINTF004", DiagnosticSeverity.Warning, source, "cArg");
+            AssertDiagnostic(ordered[4], "SPRINTF004", DiagnosticSeverity.Warning, source, "fArg");
+            Assert.That(errors, Is.Empty);
+        }
+
+        [Test]
+        public void ArgumentTypeCompatible()
+        {
+            string source = Header +
+                "        [SPrintF(\"%d %u %x %s %s %c %f %*.*e\")]\n" +
+                "        public static partial string Format(short a, ulong? b, byte c, string d, object e, char f, float g, int w, int p, decimal h);\n" +
+                Footer;
+
+            (ImmutableArray<Diagnostic> diagnostics, Diagnostic[] errors) = Generate(source);
+            Assert.That(diagnostics.Where(d => d.Id == "SPRINTF004"), Is.Empty);
+            Assert.That(errors, Is.Empty);
+        }
+
+        [Test]
+        public void BoxedArguments()
+        {
+            string source = Header +
+                "        [SPrintF(\"%d %d %d %d %d %d %d %d %d\")]\n" +
+                "        public static partial string Nine(int a, int b, int c, int d, int e, int f, int g, int h, int i);\n" +
+                "\n" +
+                "        [SPrintF(\"%d %d %d %d %d %d %d %d\")]\n" +
+                "        public static partial string Eight(int a, int b, int c, int d, int e, int f, int g, int h);\n" +
+                Footer;
+
+            (ImmutableArray<Diagnostic> diagnostics, Diagnostic[] errors) = Generate(source);
+            Assert.That(diagnostics.Length, Is.EqualTo(1));
+            AssertDiagnostic(diagnostics[0], "SPRINTF005", DiagnosticSeverity.Warning, source, "Nine");
+            Assert.That(errors, Is.Empty);
+        }
+    }
+}
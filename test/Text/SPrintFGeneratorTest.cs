@@ -0,0 +1,123 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using NUnit.Framework;
+
+    [TestFixture]
+    public partial class SPrintFGeneratorTest
+    {
+        [SPrintF("%d: %s")]
+        private static partial string FormatIntString(int value, string text);
+
+        [SPrintF("%-8s|%8.3f|%08X")]
+        private static partial string FormatColumns(string name, double value, uint flags);
+
+        [SPrintF("%*.*f")]
+        private static partial string FormatWidthPrecision(int width, int precision, double value);
+
+        // Tests the boxed arguments, which is warned about.
+#pragma warning disable SPRINTF005
+        [SPrintF("%d %u %x %c %s %.1f %g %5d %s")]
+        private static partial string FormatNine(int a, uint b, long c, char d, string e, double f, float g, short h, string i);
+#pragma warning restore SPRINTF005
+
+        [SPrintF("100%% constant")]
+        private static partial string FormatConstant();
+
+        [SPrintF("%d")]
+        private static partial string FormatObject(object value);
+
+        [SPrintF("[%s]")]
+        private static partial string FormatNullable(string value);
+
+        [SPrintF("%lld")]
+        private static partial string FormatNullableLong(long? value);
+
+        [SPrintF("%d")]
+        internal partial string FormatInstance(int value);
+
+        [SPrintF("%d-%d")]
+        private static partial string FormatOverload(int a, int b);
+
+        [SPrintF("%x")]
+        private static partial string FormatOverload(int a);
+
+        private static partial class Nested<T>
+        {
+            [SPrintF("<%s>")]
+            public static partial string Format(string value);
+        }
+
+        [Test]
+        public void IntString()
+        {
+            Assert.That(FormatIntString(42, "abc"), Is.EqualTo(StringUtilities.SPrintF("%d: %s", 42, "abc")));
+        }
+
+        [Test]
+        public void Columns()
+        {
+            Assert.That(FormatColumns("name", Math.PI, 0xBEEF), Is.EqualTo("name    |   3.142|0000BEEF"));
+        }
+
+        [Test]
+        public void WidthPrecision()
+        {
+            Assert.That(FormatWidthPrecision(8, 2, 2.5), Is.EqualTo("    2.50"));
+        }
+
+        [Test]
+        public void MoreThanEightArguments()
+        {
+            string expected = StringUtilities.SPrintF("%d %u %x %c %s %.1f %g %5d %s",
+                -1, 2u, 255L, 'c', "s", 0.3, 0.5f, (short)3, "t");
+            Assert.That(FormatNine(-1, 2u, 255L, 'c', "s", 0.3, 0.5f, 3, "t"), Is.EqualTo(expected));
+        }
+
+        [Test]
+        public void Constant()
+        {
+            Assert.That(FormatConstant(), Is.EqualTo("100% constant"));
+        }
+
+        [Test]
+        public void Object()
+        {
+            Assert.Multiple(() => {
+                Assert.That(FormatObject(12), Is.EqualTo("12"));
+                Assert.That(FormatObject("13"), Is.EqualTo("13"));
+                Assert.That(() => { _ = FormatObject(1.5); }, Throws.TypeOf<FormatException>());
+            });
+        }
+
+        [Test]
+        public void Nullable()
+        {
+            Assert.Multiple(() => {
+                Assert.That(FormatNullable(null), Is.EqualTo("[]"));
+                Assert.That(FormatNullableLong(-5), Is.EqualTo("-5"));
+            });
+        }
+
+        [Test]
+        public void Instance()
+        {
+            Assert.That(FormatInstance(7), Is.EqualTo("7"));
+        }
+
+        [Test]
+        public void Overload()
+        {
+            Assert.Multiple(() => {
+                Assert.That(FormatOverload(1, 2), Is.EqualTo("1-2"));
+                Assert.That(FormatOverload(255), Is.EqualTo("ff"));
+            });
+        }
+
+        [Test]
+        public void NestedGeneric()
+        {
+            Assert.That(Nested<int>.Format("x"), Is.EqualTo("<x>"));
+        }
+    }
+}
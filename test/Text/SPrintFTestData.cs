@@ -0,0 +1,77 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Globalization;
+    using System.IO;
+    using NUnit.Framework;
+    using RJCP.CodeQuality.NUnitExtensions;
+
+    /// <summary>
+    /// Reads the test cases of SPrintF from a data file in TestResources, as written by test/Text/sprintf with the
+    /// option --data.
+    /// </summary>
+    /// <remarks>
+    /// Each section of the file starts with a line <c>[Name]</c> and is the test cases of one fixture. Each test case
+    /// is one line with the tab separated fields format, argument kind (<c>Double</c> or <c>Single</c>), the raw bits
+    /// of the argument in hexadecimal and the expected result, and an optional note. Lines starting with <c>#</c> are
+    /// comments.
+    /// </remarks>
+    internal static class SPrintFTestData
+    {
+        public static IEnumerable<TestCaseData> Load(string fileName, string section)
+        {
+            string path = Path.Combine(Deploy.TestDirectory, "TestResources", fileName);
+            string header = "[" + section + "]";
+            bool found = false;
+            bool inSection = false;
+            int lineNumber = 0;
+
+            using (StreamReader reader = new(path)) {
+                string line;
+                while ((line = reader.ReadLine()) is not null) {
+                    lineNumber++;
+                    if (line.Length == 0 || line[0] == '#') continue;
+                    if (line[0] == '[') {
+                        inSection = line.Equals(header, StringComparison.Ordinal);
+                        found |= inSection;
+                        continue;
+                    }
+                    if (!inSection) continue;
+
+                    string[] fields = line.Split('\t');
+                    if (fields.Length < 4 || !fields[2].StartsWith("0x", StringComparison.Ordinal))
+                        throw new InvalidDataException($"{fileName}({lineNumber}): Invalid test case");
+
+                    ulong bits = ulong.Parse(fields[2].Substring(2), NumberStyles.AllowHexSpecifier, CultureInfo.InvariantCulture);
+                    object value;
+                    switch (fields[1]) {
+                    case "Double":
+                        value = UInt64ToDouble(bits);
+                        break;
+                    case "Single":
+                        value = UInt32ToFloat(unchecked((uint)bits));
+                        break;
+                    default:
+                        throw new InvalidDataException($"{fileName}({lineNumber}): Unknown argument kind {fields[1]}");
+                    }
+
+                    yield return new TestCaseData(fields[0], value, fields[3])
+                        .SetArgDisplayNames(fields[0], fields[2]);
+                }
+            }
+
+            if (!found) throw new InvalidDataException($"{fileName}: Section {header} not found");
+        }
+
+        private static unsafe double UInt64ToDouble(ulong value)
+        {
+            return *(double*)&value;
+        }
+
+        private static unsafe float UInt32ToFloat(uint value)
+        {
+            return *(float*)&value;
+        }
+    }
+}
@@ -0,0 +1,181 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using System.IO;
+    using System.Text;
+    using NUnit.Framework;
+
+    [TestFixture]
+    public class StringUtilities_FPrintFTest
+    {
+        [Test]
+        public void FPrintFTextWriter()
+        {
+            using StringWriter writer = new();
+            int first = StringUtilities.FPrintF(writer, "%-4s|", "ab");
+            int second = StringUtilities.FPrintF(writer, "%04x\n", 255);
+            Assert.Multiple(() => {
+                Assert.That(first, Is.EqualTo(5));
+                Assert.That(second, Is.EqualTo(5));
+                Assert.That(writer.ToString(), Is.EqualTo("ab  |00ff\n"));
+            });
+        }
+
+        [Test]
+        public void FPrintFTextWriterLong()
+        {
+            string value = new('x', 10000);
+            using StringWriter writer = new();
+            int length = StringUtilities.FPrintF(writer, "[%s]", value);
+            Assert.That(length, Is.EqualTo(10002));
+            Assert.That(writer.ToString(), Is.EqualTo("[" + value + "]"));
+        }
+
+        [Test]
+        public void FPrintFTextWriterParts()
+        {
+            // A long result is written in parts, as it's formatted.
+            string value = new('x', 1000);
+            using WriteCountingWriter writer = new();
+            int length = StringUtilities.FPrintF(writer, "%s%s%s%s%s", value, value, value, value, value);
+            Assert.Multiple(() => {
+                Assert.That(length, Is.EqualTo(5000));
+                Assert.That(writer.ToString(), Is.EqualTo(string.Concat(value, value, value, value, value)));
+                Assert.That(writer.Writes, Is.GreaterThan(1));
+            });
+        }
+
+        [Test]
+        public void FPrintFTextWriterGeneric()
+        {
+            using StringWriter writer = new();
+            int length = StringUtilities.FPrintF(writer, "%s %d %.2f %c %x %u %e %s", "a", 1, 0.5, 'b', 255, 7u, 1.5, "c");
+            Assert.That(length, Is.EqualTo(30));
+            Assert.That(writer.ToString(), Is.EqualTo("a 1 0.50 b ff 7 1.500000e+00 c"));
+        }
+
+        [Test]
+        public void FPrintFTextWriterError()
+        {
+            using StringWriter writer = new();
+            Assert.That(() => { _ = StringUtilities.FPrintF(writer, "abc %d"); }, Throws.TypeOf<FormatException>());
+            Assert.That(writer.ToString(), Is.Empty);
+        }
+
+        [Test]
+        public void FPrintFTextWriterNull()
+        {
+            Assert.That(() => { _ = StringUtilities.FPrintF((TextWriter)null, "%d", 1); }, Throws.TypeOf<ArgumentNullException>());
+        }
+
+        [Test]
+        public void FPrintFTextWriterNullFormat()
+        {
+            using StringWriter writer = new();
+            Assert.That(() => { _ = StringUtilities.FPrintF(writer, null, 1); }, Throws.TypeOf<ArgumentNullException>());
+        }
+
+        [Test]
+        public void FPrintFStreamUtf8()
+        {
+            using MemoryStream stream = new();
+            int first = StringUtilities.FPrintF(stream, Encoding.UTF8, "%s=", "\u00e4");
+            int second = StringUtilities.FPrintF(stream, Encoding.UTF8, "%.1f", 0.3);
+            Assert.Multiple(() => {
+                Assert.That(first, Is.EqualTo(3));
+                Assert.That(second, Is.EqualTo(3));
+                Assert.That(stream.ToArray(), Is.EqualTo(new byte[] { 0xC3, 0xA4, 0x3D, 0x30, 0x2E, 0x33 }));
+            });
+        }
+
+        [Test]
+        public void FPrintFStreamUnicode()
+        {
+            // No byte order mark is written.
+            using MemoryStream stream = new();
+            int length = StringUtilities.FPrintF(stream, Encoding.Unicode, "%d", 42);
+            Assert.That(length, Is.EqualTo(4));
+            Assert.That(stream.ToArray(), Is.EqualTo(new byte[] { 0x34, 0x00, 0x32, 0x00 }));
+        }
+
+        [Test]
+        public void FPrintFStreamLong()
+        {
+            string value = new('\u00e4', 5000);
+            using MemoryStream stream = new();
+            int length = StringUtilities.FPrintF(stream, Encoding.UTF8, "%s", value);
+            Assert.That(length, Is.EqualTo(10000));
+            Assert.That(Encoding.UTF8.GetString(stream.ToArray()), Is.EqualTo(value));
+
+            // The buffers are usable afterwards.
+            length = StringUtilities.FPrintF(stream, Encoding.UTF8, "%d", 1);
+            Assert.That(length, Is.EqualTo(1));
+            Assert.That(stream.Length, Is.EqualTo(10001));
+        }
+
+        [Test]
+        public void FPrintFStreamSurrogateParts()
+        {
+            // The first part would end with the high surrogate, which must be encoded with the low surrogate.
+            string first = new string('x', 2047) + "\uD83D";
+            using MemoryStream stream = new();
+            int length = StringUtilities.FPrintF(stream, Encoding.UTF8, "%s%s", first, "\uDE00");
+            byte[] expected = Encoding.UTF8.GetBytes(first + "\uDE00");
+            Assert.That(length, Is.EqualTo(expected.Length));
+            Assert.That(stream.ToArray(), Is.EqualTo(expected));
+        }
+
+        [Test]
+        public void FPrintFStreamGeneric()
+        {
+            using MemoryStream stream = new();
+            int length = StringUtilities.FPrintF(stream, Encoding.UTF8, "%s=%d", "\u00e4", 42);
+            Assert.That(length, Is.EqualTo(5));
+            Assert.That(stream.ToArray(), Is.EqualTo(new byte[] { 0xC3, 0xA4, 0x3D, 0x34, 0x32 }));
+        }
+
+        [Test]
+        public void FPrintFStreamError()
+        {
+            using MemoryStream stream = new();
+            Assert.That(() => { _ = StringUtilities.FPrintF(stream, Encoding.UTF8, "abc %d"); }, Throws.TypeOf<FormatException>());
+            Assert.That(stream.Length, Is.EqualTo(0));
+        }
+
+        [Test]
+        public void FPrintFStreamNull()
+        {
+            Assert.That(() => { _ = StringUtilities.FPrintF((Stream)null, Encoding.UTF8, "%d", 1); }, Throws.TypeOf<ArgumentNullException>());
+        }
+
+        [Test]
+        public void FPrintFStreamNullEncoding()
+        {
+            using MemoryStream stream = new();
+            Assert.That(() => { _ = StringUtilities.FPrintF(stream, null, "%d", 1); }, Throws.TypeOf<ArgumentNullException>());
+        }
+
+#if NET6_0_OR_GREATER
+        [Test]
+        public void FPrintFGenericNoAllocation()
+        {
+            long allocated = StringUtilities_SNPrintFTest.AllocatedBytes(() => {
+                _ = StringUtilities.FPrintF(TextWriter.Null, "%d %.3e %s", 42, Math.PI, "x");
+                _ = StringUtilities.FPrintF(Stream.Null, Encoding.UTF8, "%d %.3e %s", 42, Math.PI, "x");
+            });
+            Assert.That(allocated, Is.EqualTo(0));
+        }
+#endif
+
+        private sealed class WriteCountingWriter : StringWriter
+        {
+            public int Writes { get; private set; }
+
+            public override void Write(char[] buffer, int index, int count)
+            {
+                Writes++;
+                base.Write(buffer, index, count);
+            }
+        }
+    }
+}
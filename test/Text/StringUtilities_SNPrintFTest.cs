@@ -0,0 +1,366 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using NUnit.Framework;
+
+#if NET6_0_OR_GREATER
+    using System.Buffers;
+    using System.Text;
+#endif
+
+    [TestFixture]
+    public class StringUtilities_SNPrintFTest
+    {
+        [Test]
+        public void SNPrintF()
+        {
+            char[] buffer = new char[16];
+            int length = StringUtilities.SNPrintF(buffer, "%d-%s", 42, "abc");
+            Assert.Multiple(() => {
+                Assert.That(length, Is.EqualTo(6));
+                Assert.That(new string(buffer, 0, 7), Is.EqualTo("42-abc\0"));
+            });
+        }
+
+        [Test]
+        public void SNPrintFTruncated()
+        {
+            char[] buffer = new char[5];
+            int length = StringUtilities.SNPrintF(buffer, "%d-%s", 42, "abc");
+            Assert.Multiple(() => {
+                Assert.That(length, Is.EqualTo(6));
+                Assert.That(new string(buffer), Is.EqualTo("42-a\0"));
+            });
+        }
+
+        [Test]
+        public void SNPrintFExactLength()
+        {
+            // There must be space for the null character, as in C.
+            char[] buffer = new char[6];
+            int length = StringUtilities.SNPrintF(buffer, "%d-%s", 42, "abc");
+            Assert.Multiple(() => {
+                Assert.That(length, Is.EqualTo(6));
+                Assert.That(new string(buffer), Is.EqualTo("42-ab\0"));
+            });
+        }
+
+        [Test]
+        public void SNPrintFEmptyBuffer()
+        {
+            int length = StringUtilities.SNPrintF(Array.Empty<char>(), "%.3f", Math.PI);
+            Assert.That(length, Is.EqualTo(5));
+        }
+
+        [Test]
+        public void SNPrintFGeneric()
+        {
+            char[] buffer = new char[32];
+            int length = StringUtilities.SNPrintF(buffer, "%s %5.2f %e %c", "x", 0.3f, -2.5, 'y');
+            Assert.Multiple(() => {
+                Assert.That(length, Is.EqualTo(23));
+                Assert.That(new string(buffer, 0, 24), Is.EqualTo("x  0.30 -2.500000e+00 y\0"));
+            });
+        }
+
+        [Test]
+        public void SNPrintFGenericTruncated()
+        {
+            char[] buffer = new char[4];
+            int length = StringUtilities.SNPrintF(buffer, "%d", 123456);
+            Assert.Multiple(() => {
+                Assert.That(length, Is.EqualTo(6));
+                Assert.That(new string(buffer), Is.EqualTo("123\0"));
+            });
+        }
+
+        [Test]
+        public void SNPrintFNullBuffer()
+        {
+            Assert.That(() => { _ = StringUtilities.SNPrintF((char[])null, "%d", 1); }, Throws.TypeOf<ArgumentNullException>());
+        }
+
+        [Test]
+        public void SNPrintFNullFormat()
+        {
+            Assert.That(() => { _ = StringUtilities.SNPrintF(new char[4], null, 1); }, Throws.TypeOf<ArgumentNullException>());
+        }
+
+        [Test]
+        public void SPrintFLongResult()
+        {
+            // Longer than the buffer that formatting starts with.
+            string value = new('x', 5000);
+            Assert.Multiple(() => {
+                Assert.That(StringUtilities.SPrintF("[%s]", value), Is.EqualTo("[" + value + "]"));
+                Assert.That(StringUtilities.SPrintF("%-6000s|", value), Is.EqualTo(value + new string(' ', 1000) + "|"));
+                Assert.That(StringUtilities.SPrintF("%d", 1), Is.EqualTo("1"));
+            });
+        }
+
+        [Test]
+        public void SPrintFAfterError()
+        {
+            Assert.That(() => { _ = StringUtilities.SPrintF("abc %d %d", 1); }, Throws.TypeOf<FormatException>());
+            Assert.That(StringUtilities.SPrintF("%d", 2), Is.EqualTo("2"));
+        }
+
+#if NET6_0_OR_GREATER
+        [Test]
+        public void SNPrintFSpan()
+        {
+            Span<char> buffer = stackalloc char[5];
+            int length = StringUtilities.SNPrintF(buffer, "%d-%s", 42, "abc");
+            Assert.That(length, Is.EqualTo(6));
+            Assert.That(buffer.ToString(), Is.EqualTo("42-a\0"));
+        }
+
+        [Test]
+        public void SNPrintFSpanEmpty()
+        {
+            int length = StringUtilities.SNPrintF(Span<char>.Empty, "%5d", 1);
+            Assert.That(length, Is.EqualTo(5));
+        }
+
+        [Test]
+        public void TrySPrintF()
+        {
+            Span<char> buffer = stackalloc char[8];
+            bool result = StringUtilities.TrySPrintF(buffer, out int charsWritten, "%05.1f", 2.3);
+            Assert.That(result, Is.True);
+            Assert.That(charsWritten, Is.EqualTo(5));
+            Assert.That(buffer[..charsWritten].ToString(), Is.EqualTo("002.3"));
+        }
+
+        [Test]
+        public void TrySPrintFExactLength()
+        {
+            Span<char> buffer = stackalloc char[5];
+            bool result = StringUtilities.TrySPrintF(buffer, out int charsWritten, "%05.1f", 2.3);
+            Assert.That(result, Is.True);
+            Assert.That(charsWritten, Is.EqualTo(5));
+            Assert.That(buffer.ToString(), Is.EqualTo("002.3"));
+        }
+
+        [Test]
+        public void TrySPrintFTooSmall()
+        {
+            Span<char> buffer = stackalloc char[4];
+            buffer.Fill('-');
+            bool result = StringUtilities.TrySPrintF(buffer, out int charsWritten, "%05.1f", 2.3);
+            Assert.That(result, Is.False);
+            Assert.That(charsWritten, Is.EqualTo(0));
+            Assert.That(buffer.ToString(), Is.EqualTo("----"));
+        }
+
+        [Test]
+        public void SPrintFBufferWriter()
+        {
+            ArrayBufferWriter<char> writer = new();
+            int first = StringUtilities.SPrintF(writer, "%s=", "x");
+            int second = StringUtilities.SPrintF(writer, "%+d", 10);
+            Assert.Multiple(() => {
+                Assert.That(first, Is.EqualTo(2));
+                Assert.That(second, Is.EqualTo(3));
+                Assert.That(writer.WrittenSpan.ToString(), Is.EqualTo("x=+10"));
+            });
+        }
+
+        [Test]
+        public void SPrintFBufferWriterError()
+        {
+            ArrayBufferWriter<char> writer = new();
+            Assert.That(() => { _ = StringUtilities.SPrintF(writer, "abc %d"); }, Throws.TypeOf<FormatException>());
+            Assert.That(writer.WrittenCount, Is.EqualTo(0));
+        }
+
+        [Test]
+        public void SPrintFBufferWriterNull()
+        {
+            Assert.That(() => { _ = StringUtilities.SPrintF((IBufferWriter<char>)null, "%d", 1); }, Throws.TypeOf<ArgumentNullException>());
+        }
+
+        [Test]
+        public void SNPrintFSpanArguments()
+        {
+            Span<char> buffer = stackalloc char[8];
+            int length = StringUtilities.SNPrintF(buffer, "%d-%s", new object[] { 42, "abc" });
+            Assert.That(length, Is.EqualTo(6));
+            Assert.That(buffer[..length].ToString(), Is.EqualTo("42-abc"));
+        }
+
+        [Test]
+        public void TrySPrintFGeneric()
+        {
+            Span<char> buffer = stackalloc char[32];
+            bool result = StringUtilities.TrySPrintF(buffer, out int charsWritten, "%s %5.2f %e %c %u", "x", 0.3f, -2.5, 'y', 7u);
+            Assert.That(result, Is.True);
+            Assert.That(buffer[..charsWritten].ToString(), Is.EqualTo(StringUtilities.SPrintF("%s %5.2f %e %c %u", "x", 0.3f, -2.5, 'y', 7u)));
+        }
+
+        [Test]
+        public void TrySPrintFGenericNoAllocation()
+        {
+            char[] buffer = new char[64];
+            long allocated = AllocatedBytes(() => {
+                _ = StringUtilities.TrySPrintF(buffer, out _, "%d %.3e %s", 42, Math.PI, "x");
+            });
+            Assert.That(allocated, Is.EqualTo(0));
+        }
+
+        [Test]
+        public void SNPrintFSpanGenericNoAllocation()
+        {
+            char[] buffer = new char[64];
+            long allocated = AllocatedBytes(() => {
+                _ = StringUtilities.SNPrintF(buffer.AsSpan(), "%08x %f", 0xBEEFu, 123456.789);
+            });
+            Assert.That(allocated, Is.EqualTo(0));
+        }
+
+        [Test]
+        public void SPrintFBufferWriterGenericNoAllocation()
+        {
+            ArrayBufferWriter<char> writer = new(4096);
+            long allocated = AllocatedBytes(() => {
+                _ = StringUtilities.SPrintF(writer, "%g;", 0.125);
+            });
+            Assert.That(allocated, Is.EqualTo(0));
+            Assert.That(writer.WrittenSpan[..6].ToString(), Is.EqualTo("0.125;"));
+        }
+
+        [TestCase("%e")]
+        [TestCase("%f")]
+        [TestCase("%g")]
+        [TestCase("%.17e")]
+        public void SNPrintFFloatNoAllocation(string format)
+        {
+            char[] buffer = new char[64];
+            long allocated = AllocatedBytes(() => {
+                _ = StringUtilities.SNPrintF(buffer, format, 123456.789);
+                _ = StringUtilities.SNPrintF(buffer, format, 123456.789f);
+                _ = StringUtilities.TrySPrintF(buffer, out _, format, 1e-310);
+            });
+            Assert.That(allocated, Is.EqualTo(0));
+        }
+
+        [Test]
+        public void SNPrintFArgumentWidthPrecisionNoAllocation()
+        {
+            char[] buffer = new char[64];
+            long allocated = AllocatedBytes(() => {
+                _ = StringUtilities.SNPrintF(buffer, "%*.*f", 12, 3, 123456.789);
+                _ = StringUtilities.SNPrintF(buffer, "%*.*f", -12, 3, 123456.789f);
+                _ = StringUtilities.SNPrintF(buffer, "%.*e|%*d", 2, Math.PI, 6, 42);
+            });
+            Assert.That(allocated, Is.EqualTo(0));
+        }
+
+        [Test]
+        public void SNPrintFArgumentWidthPrecision()
+        {
+            char[] buffer = new char[64];
+            int length = StringUtilities.SNPrintF(buffer, "%*.*f|%.*e|%*d", -12, 3, 123456.789, 2, Math.PI, 6, 42);
+            Assert.That(new string(buffer, 0, length), Is.EqualTo("123456.789  |3.14e+00|    42"));
+        }
+
+        // Gets the bytes allocated by calling the action many times, after the first call that may initialize the
+        // caches.
+        internal static long AllocatedBytes(Action action)
+        {
+            action();
+            long start = GC.GetAllocatedBytesForCurrentThread();
+            for (int i = 0; i < 100; i++) {
+                action();
+            }
+            return GC.GetAllocatedBytesForCurrentThread() - start;
+        }
+
+        [Test]
+        public void TrySPrintFUtf8()
+        {
+            Span<byte> buffer = stackalloc byte[16];
+            bool result = StringUtilities.TrySPrintFUtf8(buffer, out int bytesWritten, "%s=%x", "\u00e4", 255);
+            Assert.That(result, Is.True);
+            Assert.That(bytesWritten, Is.EqualTo(5));
+            Assert.That(Encoding.UTF8.GetString(buffer[..bytesWritten]), Is.EqualTo("\u00e4=ff"));
+        }
+
+        [Test]
+        public void TrySPrintFUtf8TooSmall()
+        {
+            // Five characters, but six bytes.
+            Span<byte> buffer = stackalloc byte[5];
+            bool result = StringUtilities.TrySPrintFUtf8(buffer, out int bytesWritten, "%s=%x", "\u00e4", 4095);
+            Assert.That(result, Is.False);
+            Assert.That(bytesWritten, Is.EqualTo(0));
+        }
+
+        [Test]
+        public void TrySPrintFUtf8LoneSurrogate()
+        {
+            Span<byte> buffer = stackalloc byte[8];
+            bool result = StringUtilities.TrySPrintFUtf8(buffer, out int bytesWritten, "[%c]", '\ud800');
+            Assert.That(result, Is.True);
+            Assert.That(buffer[..bytesWritten].ToArray(), Is.EqualTo(new byte[] { 0x5B, 0xEF, 0xBF, 0xBD, 0x5D }));
+        }
+
+        [Test]
+        public void SPrintFUtf8BufferWriter()
+        {
+            ArrayBufferWriter<byte> writer = new();
+            int first = StringUtilities.SPrintFUtf8(writer, "%s=", "\u20ac");
+            int second = StringUtilities.SPrintFUtf8(writer, "%.2f\n", 1.5);
+            Assert.Multiple(() => {
+                Assert.That(first, Is.EqualTo(4));
+                Assert.That(second, Is.EqualTo(5));
+                Assert.That(Encoding.UTF8.GetString(writer.WrittenSpan), Is.EqualTo("\u20ac=1.50\n"));
+            });
+        }
+
+        [Test]
+        public void SPrintFUtf8BufferWriterError()
+        {
+            ArrayBufferWriter<byte> writer = new();
+            Assert.That(() => { _ = StringUtilities.SPrintFUtf8(writer, "abc %d"); }, Throws.TypeOf<FormatException>());
+            Assert.That(writer.WrittenCount, Is.EqualTo(0));
+        }
+
+        [Test]
+        public void TrySPrintFUtf8Arguments()
+        {
+            Span<byte> buffer = stackalloc byte[16];
+            bool result = StringUtilities.TrySPrintFUtf8(buffer, out int bytesWritten, "%s=%x", new object[] { "a", 255 });
+            Assert.That(result, Is.True);
+            Assert.That(Encoding.UTF8.GetString(buffer[..bytesWritten]), Is.EqualTo("a=ff"));
+        }
+
+        [Test]
+        public void TrySPrintFUtf8GenericNoAllocation()
+        {
+            byte[] buffer = new byte[64];
+            long allocated = AllocatedBytes(() => {
+                _ = StringUtilities.TrySPrintFUtf8(buffer, out _, "%d %.3e %s", 42, Math.PI, "\u00e4");
+            });
+            Assert.That(allocated, Is.EqualTo(0));
+        }
+
+        [Test]
+        public void SPrintFUtf8BufferWriterGenericNoAllocation()
+        {
+            ArrayBufferWriter<byte> writer = new(4096);
+            long allocated = AllocatedBytes(() => {
+                _ = StringUtilities.SPrintFUtf8(writer, "%04X;", (ushort)0xBEEF);
+            });
+            Assert.That(allocated, Is.EqualTo(0));
+            Assert.That(writer.WrittenSpan[..5].ToArray(), Is.EqualTo(Encoding.ASCII.GetBytes("BEEF;")));
+        }
+
+        [Test]
+        public void SPrintFUtf8BufferWriterNull()
+        {
+            Assert.That(() => { _ = StringUtilities.SPrintFUtf8(null, "%d", 1); }, Throws.TypeOf<ArgumentNullException>());
+        }
+#endif
+    }
+}
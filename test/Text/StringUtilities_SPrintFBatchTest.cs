@@ -0,0 +1,152 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using System.Buffers;
+    using System.Linq;
+    using NUnit.Framework;
+
+    [TestFixture]
+    public class StringUtilities_SPrintFBatchTest
+    {
+        private static string SPrintFEach<T>(string format, T[] values, string separator)
+        {
+            return string.Join(separator, values.Select(value => StringUtilities.SPrintF(format, value)));
+        }
+
+        [TestCase("%.6e")]
+        [TestCase("%12.4f")]
+        [TestCase("%g")]
+        public void BatchDouble(string format)
+        {
+            double[] values = new[] { 0.0, -1.5, Math.PI, 1e-300, 6.02214076e23, double.NaN, double.NegativeInfinity };
+            ArrayBufferWriter<char> writer = new();
+            long length = StringUtilities.SPrintFBatch<double>(writer, format, values, ",");
+
+            string expected = SPrintFEach(format, values, ",");
+            Assert.That(writer.WrittenSpan.ToString(), Is.EqualTo(expected));
+            Assert.That(length, Is.EqualTo(expected.Length));
+        }
+
+        [TestCase("%08x")]
+        [TestCase("%+d")]
+        [TestCase("[%-5lld]")]
+        public void BatchLong(string format)
+        {
+            long[] values = new[] { 0L, 1L, -1L, 255L, long.MaxValue, long.MinValue };
+            ArrayBufferWriter<char> writer = new();
+            long length = StringUtilities.SPrintFBatch<long>(writer, format, values, "\t");
+
+            string expected = SPrintFEach(format, values, "\t");
+            Assert.That(writer.WrittenSpan.ToString(), Is.EqualTo(expected));
+            Assert.That(length, Is.EqualTo(expected.Length));
+        }
+
+        [Test]
+        public void BatchNoSeparator()
+        {
+            ArrayBufferWriter<char> writer = new();
+            StringUtilities.SPrintFBatch<int>(writer, "%d;", new[] { 1, 2, 3 }, null);
+            Assert.That(writer.WrittenSpan.ToString(), Is.EqualTo("1;2;3;"));
+        }
+
+        [Test]
+        public void BatchEmpty()
+        {
+            ArrayBufferWriter<char> writer = new();
+            long length = StringUtilities.SPrintFBatch<int>(writer, "%d", Array.Empty<int>(), ",");
+            Assert.That(length, Is.EqualTo(0));
+            Assert.That(writer.WrittenCount, Is.EqualTo(0));
+        }
+
+        [Test]
+        public void BatchLarge()
+        {
+            // Longer than the buffer that is copied to the writer while formatting.
+            int[] values = Enumerable.Range(-5000, 10000).ToArray();
+            ArrayBufferWriter<char> writer = new();
+            long length = StringUtilities.SPrintFBatch<int>(writer, "%5d", values, "\n");
+
+            string expected = SPrintFEach("%5d", values, "\n");
+            Assert.That(writer.WrittenSpan.ToString(), Is.EqualTo(expected));
+            Assert.That(length, Is.EqualTo(expected.Length));
+        }
+
+        [TestCase(false)]
+        [TestCase(true)]
+        public void BatchParallel(bool parallel)
+        {
+            // Several chunks and more than one round, with a last chunk that isn't full.
+            double[] values = Enumerable.Range(0, 16384 * Environment.ProcessorCount * 2 + 1000)
+                .Select(i => i * 0.37 - 1000).ToArray();
+            ArrayBufferWriter<char> writer = new();
+            long length = StringUtilities.SPrintFBatch<double>(writer, "%.3f", values, ",", parallel);
+
+            string expected = SPrintFEach("%.3f", values, ",");
+            Assert.That(length, Is.EqualTo(expected.Length));
+            Assert.That(writer.WrittenSpan.ToString(), Is.EqualTo(expected));
+        }
+
+        [Test]
+        public void BatchParallelRepeated()
+        {
+            // The results are longer than the buffer rented for a chunk, which grows, and the second call gets the
+            // buffers returned by the first.
+            double[] values = Enumerable.Range(0, 16384 * 3).Select(i => i * 0.37 - 1000).ToArray();
+            string expected = SPrintFEach("%20.3f", values, ",");
+            for (int i = 0; i < 2; i++) {
+                ArrayBufferWriter<char> writer = new();
+                long length = StringUtilities.SPrintFBatch<double>(writer, "%20.3f", values, ",", true);
+                Assert.That(length, Is.EqualTo(expected.Length));
+                Assert.That(writer.WrittenSpan.ToString(), Is.EqualTo(expected));
+            }
+        }
+
+        [Test]
+        public void BatchParallelError()
+        {
+            object[] values = Enumerable.Range(0, 40000).Select(i => (object)i).ToArray();
+            values[30000] = "x";
+            ArrayBufferWriter<char> writer = new();
+            Assert.That(() => { _ = StringUtilities.SPrintFBatch<object>(writer, "%d", values, ",", true); },
+                Throws.TypeOf<FormatException>());
+        }
+
+        [TestCase("%d %d")]
+        [TestCase("%*d")]
+        [TestCase("abc")]
+        public void BatchArgumentCount(string format)
+        {
+            ArrayBufferWriter<char> writer = new();
+            Assert.That(() => { _ = StringUtilities.SPrintFBatch<int>(writer, format, new[] { 1, 2 }, ","); },
+                Throws.TypeOf<FormatException>());
+            Assert.That(writer.WrittenCount, Is.EqualTo(0));
+        }
+
+        [Test]
+        public void BatchNullWriter()
+        {
+            Assert.That(() => { _ = StringUtilities.SPrintFBatch<int>(null, "%d", new[] { 1 }, ","); },
+                Throws.TypeOf<ArgumentNullException>());
+        }
+
+        [Test]
+        public void BatchNullFormat()
+        {
+            ArrayBufferWriter<char> writer = new();
+            Assert.That(() => { _ = StringUtilities.SPrintFBatch<int>(writer, null, new[] { 1 }, ","); },
+                Throws.TypeOf<ArgumentNullException>());
+        }
+
+        [Test]
+        public void CompiledBatch()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%.2e");
+            ArrayBufferWriter<char> writer = new();
+            long first = format.AppendBatchTo<float>(writer, new[] { 1.0f, 2.0f }, " ");
+            long second = format.AppendBatchTo<float>(writer, new[] { 3.0f }, " ", true);
+            Assert.That(first, Is.EqualTo(17));
+            Assert.That(second, Is.EqualTo(8));
+            Assert.That(writer.WrittenSpan.ToString(), Is.EqualTo("1.00e+00 2.00e+003.00e+00"));
+        }
+    }
+}
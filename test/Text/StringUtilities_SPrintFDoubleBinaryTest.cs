@@ -0,0 +1,34 @@
+﻿namespace RJCP.Core.Text
+{
+    using System.Collections.Generic;
+    using NUnit.Framework;
+    using static StringUtilities;
+
+    [TestFixture]
+    [Parallelizable(ParallelScope.All)]
+    public class StringUtilities_SPrintFDoubleBinaryTest
+    {
+        private static IEnumerable<TestCaseData> DoubleBinaryCases()
+        {
+            return SPrintFTestData.Load("SPrintFBinary.txt", "DoubleBinary");
+        }
+
+        [TestCaseSource(nameof(DoubleBinaryCases))]
+        public void DoubleBinary(string format, object value, string expected)
+        {
+            Assert.That(SPrintF(format, value), Is.EqualTo(expected));
+        }
+
+        private static IEnumerable<TestCaseData> DoubleBinaryExhaustiveCases()
+        {
+            return SPrintFTestData.Load("SPrintFBinary.txt", "DoubleBinaryExhaustive");
+        }
+
+        [TestCaseSource(nameof(DoubleBinaryExhaustiveCases))]
+        [Explicit("Long running, DoubleBinary has a vector of each equivalence class")]
+        public void DoubleBinaryExhaustive(string format, object value, string expected)
+        {
+            Assert.That(SPrintF(format, value), Is.EqualTo(expected));
+        }
+    }
+}
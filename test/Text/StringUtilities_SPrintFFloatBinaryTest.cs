@@ -0,0 +1,34 @@
+﻿namespace RJCP.Core.Text
+{
+    using System.Collections.Generic;
+    using NUnit.Framework;
+    using static StringUtilities;
+
+    [TestFixture]
+    [Parallelizable(ParallelScope.All)]
+    public class StringUtilities_SPrintFFloatBinaryTest
+    {
+        private static IEnumerable<TestCaseData> FloatBinaryCases()
+        {
+            return SPrintFTestData.Load("SPrintFBinary.txt", "FloatBinary");
+        }
+
+        [TestCaseSource(nameof(FloatBinaryCases))]
+        public void FloatBinary(string format, object value, string expected)
+        {
+            Assert.That(SPrintF(format, value), Is.EqualTo(expected));
+        }
+
+        private static IEnumerable<TestCaseData> FloatBinaryExhaustiveCases()
+        {
+            return SPrintFTestData.Load("SPrintFBinary.txt", "FloatBinaryExhaustive");
+        }
+
+        [TestCaseSource(nameof(FloatBinaryExhaustiveCases))]
+        [Explicit("Long running, FloatBinary has a vector of each equivalence class")]
+        public void FloatBinaryExhaustive(string format, object value, string expected)
+        {
+            Assert.That(SPrintF(format, value), Is.EqualTo(expected));
+        }
+    }
+}
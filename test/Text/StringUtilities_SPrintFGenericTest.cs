@@ -0,0 +1,118 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Linq;
+    using System.Reflection;
+    using NUnit.Framework;
+
+    [TestFixture]
+    public class StringUtilities_SPrintFGenericTest
+    {
+        private static readonly string[] Formats = new[] {
+            "%d", "%lld", "%hhd", "%u", "%llx", "%o", "%c", "%f", "%g", "%5.2e", "%s"
+        };
+
+        private static readonly object[] Values = new object[] {
+            (sbyte)-5, (byte)200, (short)-300, (ushort)60000, -7, 4000000000u, -9000000000L, ulong.MaxValue,
+            1.1f, 2.75, 3.25m, true, false, 'A', "12", "x", string.Empty, DayOfWeek.Friday
+        };
+
+        private static IEnumerable<TestCaseData> FormatValues()
+        {
+            foreach (string format in Formats) {
+                foreach (object value in Values) {
+                    yield return new TestCaseData(format, value)
+                        .SetArgDisplayNames(format, value.GetType().Name + " " + value.ToString());
+                }
+            }
+        }
+
+        private static string SPrintFGeneric(string format, object value)
+        {
+            MethodInfo method = typeof(StringUtilities).GetMethods()
+                .Single(m => m.Name == nameof(StringUtilities.SPrintF) && m.IsGenericMethodDefinition &&
+                    m.GetGenericArguments().Length == 1 && m.GetParameters()[0].ParameterType == typeof(string))
+                .MakeGenericMethod(value.GetType());
+            try {
+                return (string)method.Invoke(null, new object[] { format, value });
+            } catch (TargetInvocationException e) {
+                throw e.InnerException;
+            }
+        }
+
+        [TestCaseSource(nameof(FormatValues))]
+        public void SameAsObject(string format, object value)
+        {
+            string expected;
+            try {
+                expected = StringUtilities.SPrintF(format, new object[] { value });
+            } catch (FormatException) {
+                Assert.That(() => { _ = SPrintFGeneric(format, value); }, Throws.TypeOf<FormatException>());
+                return;
+            }
+            Assert.That(SPrintFGeneric(format, value), Is.EqualTo(expected));
+        }
+
+        [Test]
+        public void EightArguments()
+        {
+            string result = StringUtilities.SPrintF("%d %u %x %c %s %.1f %g %5d", -1, 2u, 255L, 'c', "s", 0.3, 0.5f, 3);
+            Assert.That(result, Is.EqualTo("-1 2 ff c s 0.3 0.5     3"));
+        }
+
+        [Test]
+        public void WidthAndPrecision()
+        {
+            Assert.That(StringUtilities.SPrintF("%*.*f", 8, 3, Math.PI), Is.EqualTo("   3.142"));
+        }
+
+        [Test]
+        public void WidthNotInt()
+        {
+            Assert.That(() => { _ = StringUtilities.SPrintF("%*d", 8L, 1); }, Throws.TypeOf<FormatException>());
+        }
+
+        [Test]
+        public void SingleDefaultPrecision()
+        {
+            // A float is formatted as a float and not as a double.
+            Assert.Multiple(() => {
+                Assert.That(StringUtilities.SPrintF("%.10g", 0.1f), Is.EqualTo("0.100000001"));
+                Assert.That(StringUtilities.SPrintF("%.10g", 0.1), Is.EqualTo("0.1"));
+            });
+        }
+
+        [Test]
+        public void NullString()
+        {
+            Assert.That(StringUtilities.SPrintF("[%s]", (string)null), Is.EqualTo("[]"));
+        }
+
+        [Test]
+        public void NullObject()
+        {
+            Assert.That(() => { _ = StringUtilities.SPrintF("[%d]", (object)null); }, Throws.TypeOf<FormatException>());
+        }
+
+        [Test]
+        public void StringArrayIsArguments()
+        {
+            string[] values = new[] { "a", "b" };
+            Assert.That(StringUtilities.SPrintF("%s-%s", values), Is.EqualTo("a-b"));
+        }
+
+        [Test]
+        public void TooFewArguments()
+        {
+            Assert.That(() => { _ = StringUtilities.SPrintF("%d %d %d", 1, 2); }, Throws.TypeOf<FormatException>());
+        }
+
+        [Test]
+        public void CompiledFormat()
+        {
+            SPrintFFormat format = SPrintFFormat.Compile("%s=%5.1f (%d)");
+            Assert.That(format.Format("x", 2.5, 3), Is.EqualTo("x=  2.5 (3)"));
+        }
+    }
+}
@@ -158,6 +158,24 @@
             });
         }
 
+        [Test]
+        public void VarFieldWidthFormatReused()
+        {
+            // The format is parsed once, the width and precision given as arguments are only for the call.
+            Assert.Multiple(() => {
+                Assert.That(SPrintF("%*d|", -5, 1), Is.EqualTo("1    |"));
+                Assert.That(SPrintF("%*d|", 5, 1), Is.EqualTo("    1|"));
+                Assert.That(SPrintF("%*d|", -5, 1), Is.EqualTo("1    |"));
+
+                Assert.That(SPrintF("%.*f", 2, 3.14159), Is.EqualTo("3.14"));
+                Assert.That(SPrintF("%.*f", -1, 3.14159), Is.EqualTo("3.141590"));
+                Assert.That(SPrintF("%.*f", 2, 3.14159), Is.EqualTo("3.14"));
+
+                Assert.That(SPrintF("%*.*f|", -8, 1, 3.14159), Is.EqualTo("3.1     |"));
+                Assert.That(SPrintF("%*.*f|", 8, 1, 3.14159), Is.EqualTo("     3.1|"));
+            });
+        }
+
         [Test]
         public void String()
         {
@@ -506,12 +524,12 @@
                 Assert.That(SPrintF("%llu", (byte)127), Is.EqualTo("127"));
                 Assert.That(SPrintF("%llu", (byte)255), Is.EqualTo("255"));
                 Assert.That(SPrintF("%llu", (sbyte)127), Is.EqualTo("127"));
-                Assert.That(SPrintF("%llu", (sbyte)-1), Is.EqualTo("8446744073709551615"));
+                Assert.That(SPrintF("%llu", (sbyte)-1), Is.EqualTo("18446744073709551615"));
 
                 Assert.That(SPrintF("%llu", (short)127), Is.EqualTo("127"));
                 Assert.That(SPrintF("%llu", (short)255), Is.EqualTo("255"));
                 Assert.That(SPrintF("%llu", (short)32767), Is.EqualTo("32767"));
-                Assert.That(SPrintF("%llu", (short)-1), Is.EqualTo("8446744073709551615"));
+                Assert.That(SPrintF("%llu", (short)-1), Is.EqualTo("18446744073709551615"));
 
                 Assert.That(SPrintF("%llu", (ushort)127), Is.EqualTo("127"));
                 Assert.That(SPrintF("%llu", (ushort)255), Is.EqualTo("255"));
@@ -522,7 +540,7 @@
                 Assert.That(SPrintF("%llu", (int)255), Is.EqualTo("255"));
                 Assert.That(SPrintF("%llu", (int)32767), Is.EqualTo("32767"));
                 Assert.That(SPrintF("%llu", (int)131072), Is.EqualTo("131072"));
-                Assert.That(SPrintF("%llu", (int)-1), Is.EqualTo("8446744073709551615"));
+                Assert.That(SPrintF("%llu", (int)-1), Is.EqualTo("18446744073709551615"));
 
                 Assert.That(SPrintF("%llu", (uint)127), Is.EqualTo("127"));
                 Assert.That(SPrintF("%llu", (uint)255), Is.EqualTo("255"));
@@ -535,17 +553,17 @@
                 Assert.That(SPrintF("%llu", (long)32767), Is.EqualTo("32767"));
                 Assert.That(SPrintF("%llu", (long)131072), Is.EqualTo("131072"));
                 Assert.That(SPrintF("%llu", (long)0xFFFFFFFF), Is.EqualTo("4294967295"));
-                Assert.That(SPrintF("%llu", unchecked((long)0xFFFFFFFFFFFFFFFF)), Is.EqualTo("8446744073709551615"));
+                Assert.That(SPrintF("%llu", unchecked((long)0xFFFFFFFFFFFFFFFF)), Is.EqualTo("18446744073709551615"));
 
                 Assert.That(SPrintF("%llu", (ulong)127), Is.EqualTo("127"));
                 Assert.That(SPrintF("%llu", (ulong)255), Is.EqualTo("255"));
                 Assert.That(SPrintF("%llu", (ulong)32767), Is.EqualTo("32767"));
                 Assert.That(SPrintF("%llu", (ulong)131072), Is.EqualTo("131072"));
                 Assert.That(SPrintF("%llu", (ulong)0xFFFFFFFF), Is.EqualTo("4294967295"));
-                Assert.That(SPrintF("%llu", (ulong)0xFFFFFFFFFFFFFFFF), Is.EqualTo("8446744073709551615"));
+                Assert.That(SPrintF("%llu", (ulong)0xFFFFFFFFFFFFFFFF), Is.EqualTo("18446744073709551615"));
 
                 Assert.That(SPrintF("%llu", false), Is.EqualTo("0"));
-                Assert.That(SPrintF("%llu", true), Is.EqualTo("8446744073709551615"));
+                Assert.That(SPrintF("%llu", true), Is.EqualTo("18446744073709551615"));
             });
         }
 
@@ -958,4666 +976,6 @@
             });
         }
 
-        private static unsafe double UInt64ToDouble(ulong value)
-        {
-            return *(double*)&value;
-        }
-
-        [Test]
-        public void DoubleBinary()
-        {
-            Assert.Multiple(() => {
-                // Zero special case
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0000000000000000)), Is.EqualTo("0"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x8000000000000000)), Is.EqualTo("-0"));
-                // Subnormals have exponent with bias of zero
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0000000000000001)), Is.EqualTo("4.94065645841247e-324"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0000000000000002)), Is.EqualTo("9.88131291682493e-324"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0000000000000004)), Is.EqualTo("1.97626258336499e-323"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0000000000000008)), Is.EqualTo("3.95252516672997e-323"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0000000000000010)), Is.EqualTo("7.90505033345994e-323"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0000000000000100)), Is.EqualTo("1.26480805335359e-321"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0000000000001000)), Is.EqualTo("2.02369288536575e-320"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0000000000010000)), Is.EqualTo("3.23790861658519e-319"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0000000000100000)), Is.EqualTo("5.18065378653631e-318"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0000000001000000)), Is.EqualTo("8.2890460584581e-317"));   // GCC returns 8.28904605845809e-317
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0000000010000000)), Is.EqualTo("1.3262473693533e-315"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0000000100000000)), Is.EqualTo("2.12199579096527e-314"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0001000000000000)), Is.EqualTo("1.390671161567e-309"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x000fffffffffffff)), Is.EqualTo("2.2250738585072e-308"));
-                // All possible exponents
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0010000000000000)), Is.EqualTo("2.2250738585072e-308"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0020000000000000)), Is.EqualTo("4.4501477170144e-308"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0030000000000000)), Is.EqualTo("8.90029543402881e-308"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0040000000000000)), Is.EqualTo("1.78005908680576e-307"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0050000000000000)), Is.EqualTo("3.56011817361152e-307"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0060000000000000)), Is.EqualTo("7.12023634722304e-307"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0070000000000000)), Is.EqualTo("1.42404726944461e-306"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0080000000000000)), Is.EqualTo("2.84809453888922e-306"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0090000000000000)), Is.EqualTo("5.69618907777844e-306"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x00a0000000000000)), Is.EqualTo("1.13923781555569e-305"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x00b0000000000000)), Is.EqualTo("2.27847563111137e-305"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x00c0000000000000)), Is.EqualTo("4.55695126222275e-305"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x00d0000000000000)), Is.EqualTo("9.1139025244455e-305"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x00e0000000000000)), Is.EqualTo("1.8227805048891e-304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x00f0000000000000)), Is.EqualTo("3.6455610097782e-304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0100000000000000)), Is.EqualTo("7.2911220195564e-304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0110000000000000)), Is.EqualTo("1.45822440391128e-303"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0120000000000000)), Is.EqualTo("2.91644880782256e-303"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0130000000000000)), Is.EqualTo("5.83289761564512e-303"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0140000000000000)), Is.EqualTo("1.16657952312902e-302"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0150000000000000)), Is.EqualTo("2.33315904625805e-302"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0160000000000000)), Is.EqualTo("4.66631809251609e-302"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0170000000000000)), Is.EqualTo("9.33263618503219e-302"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0180000000000000)), Is.EqualTo("1.86652723700644e-301"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0190000000000000)), Is.EqualTo("3.73305447401288e-301"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x01a0000000000000)), Is.EqualTo("7.46610894802575e-301"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x01b0000000000000)), Is.EqualTo("1.49322178960515e-300"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x01c0000000000000)), Is.EqualTo("2.9864435792103e-300"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x01d0000000000000)), Is.EqualTo("5.9728871584206e-300"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x01e0000000000000)), Is.EqualTo("1.19457743168412e-299"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x01f0000000000000)), Is.EqualTo("2.38915486336824e-299"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0200000000000000)), Is.EqualTo("4.77830972673648e-299"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0210000000000000)), Is.EqualTo("9.55661945347296e-299"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0220000000000000)), Is.EqualTo("1.91132389069459e-298"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0230000000000000)), Is.EqualTo("3.82264778138918e-298"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0240000000000000)), Is.EqualTo("7.64529556277837e-298"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0250000000000000)), Is.EqualTo("1.52905911255567e-297"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0260000000000000)), Is.EqualTo("3.05811822511135e-297"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0270000000000000)), Is.EqualTo("6.1162364502227e-297"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0280000000000000)), Is.EqualTo("1.22324729004454e-296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0290000000000000)), Is.EqualTo("2.44649458008908e-296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x02a0000000000000)), Is.EqualTo("4.89298916017816e-296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x02b0000000000000)), Is.EqualTo("9.78597832035631e-296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x02c0000000000000)), Is.EqualTo("1.95719566407126e-295"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x02d0000000000000)), Is.EqualTo("3.91439132814253e-295"));  // GCC returns 3.91439132814252e-295
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x02e0000000000000)), Is.EqualTo("7.82878265628505e-295"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x02f0000000000000)), Is.EqualTo("1.56575653125701e-294"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0300000000000000)), Is.EqualTo("3.13151306251402e-294"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0310000000000000)), Is.EqualTo("6.26302612502804e-294"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0320000000000000)), Is.EqualTo("1.25260522500561e-293"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0330000000000000)), Is.EqualTo("2.50521045001122e-293"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0340000000000000)), Is.EqualTo("5.01042090002243e-293"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0350000000000000)), Is.EqualTo("1.00208418000449e-292"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0360000000000000)), Is.EqualTo("2.00416836000897e-292"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0370000000000000)), Is.EqualTo("4.00833672001795e-292"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0380000000000000)), Is.EqualTo("8.01667344003589e-292"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0390000000000000)), Is.EqualTo("1.60333468800718e-291"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x03a0000000000000)), Is.EqualTo("3.20666937601436e-291"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x03b0000000000000)), Is.EqualTo("6.41333875202871e-291"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x03c0000000000000)), Is.EqualTo("1.28266775040574e-290"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x03d0000000000000)), Is.EqualTo("2.56533550081149e-290"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x03e0000000000000)), Is.EqualTo("5.13067100162297e-290"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x03f0000000000000)), Is.EqualTo("1.02613420032459e-289"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0400000000000000)), Is.EqualTo("2.05226840064919e-289"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0410000000000000)), Is.EqualTo("4.10453680129838e-289"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0420000000000000)), Is.EqualTo("8.20907360259675e-289"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0430000000000000)), Is.EqualTo("1.64181472051935e-288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0440000000000000)), Is.EqualTo("3.2836294410387e-288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0450000000000000)), Is.EqualTo("6.5672588820774e-288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0460000000000000)), Is.EqualTo("1.31345177641548e-287"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0470000000000000)), Is.EqualTo("2.62690355283096e-287"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0480000000000000)), Is.EqualTo("5.25380710566192e-287"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0490000000000000)), Is.EqualTo("1.05076142113238e-286"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x04a0000000000000)), Is.EqualTo("2.10152284226477e-286"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x04b0000000000000)), Is.EqualTo("4.20304568452954e-286"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x04c0000000000000)), Is.EqualTo("8.40609136905907e-286"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x04d0000000000000)), Is.EqualTo("1.68121827381181e-285"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x04e0000000000000)), Is.EqualTo("3.36243654762363e-285"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x04f0000000000000)), Is.EqualTo("6.72487309524726e-285"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0500000000000000)), Is.EqualTo("1.34497461904945e-284"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0510000000000000)), Is.EqualTo("2.6899492380989e-284"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0520000000000000)), Is.EqualTo("5.37989847619781e-284"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0530000000000000)), Is.EqualTo("1.07597969523956e-283"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0540000000000000)), Is.EqualTo("2.15195939047912e-283"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0550000000000000)), Is.EqualTo("4.30391878095825e-283"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0560000000000000)), Is.EqualTo("8.60783756191649e-283"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0570000000000000)), Is.EqualTo("1.7215675123833e-282"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0580000000000000)), Is.EqualTo("3.4431350247666e-282"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0590000000000000)), Is.EqualTo("6.88627004953319e-282"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x05a0000000000000)), Is.EqualTo("1.37725400990664e-281"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x05b0000000000000)), Is.EqualTo("2.75450801981328e-281"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x05c0000000000000)), Is.EqualTo("5.50901603962656e-281"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x05d0000000000000)), Is.EqualTo("1.10180320792531e-280"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x05e0000000000000)), Is.EqualTo("2.20360641585062e-280"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x05f0000000000000)), Is.EqualTo("4.40721283170124e-280"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0600000000000000)), Is.EqualTo("8.81442566340249e-280"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0610000000000000)), Is.EqualTo("1.7628851326805e-279"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0620000000000000)), Is.EqualTo("3.525770265361e-279"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0630000000000000)), Is.EqualTo("7.05154053072199e-279"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0640000000000000)), Is.EqualTo("1.4103081061444e-278"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0650000000000000)), Is.EqualTo("2.8206162122888e-278"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0660000000000000)), Is.EqualTo("5.64123242457759e-278"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0670000000000000)), Is.EqualTo("1.12824648491552e-277"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0680000000000000)), Is.EqualTo("2.25649296983104e-277"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0690000000000000)), Is.EqualTo("4.51298593966207e-277"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x06a0000000000000)), Is.EqualTo("9.02597187932415e-277"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x06b0000000000000)), Is.EqualTo("1.80519437586483e-276"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x06c0000000000000)), Is.EqualTo("3.61038875172966e-276"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x06d0000000000000)), Is.EqualTo("7.22077750345932e-276"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x06e0000000000000)), Is.EqualTo("1.44415550069186e-275"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x06f0000000000000)), Is.EqualTo("2.88831100138373e-275"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0700000000000000)), Is.EqualTo("5.77662200276745e-275"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0710000000000000)), Is.EqualTo("1.15532440055349e-274"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0720000000000000)), Is.EqualTo("2.31064880110698e-274"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0730000000000000)), Is.EqualTo("4.62129760221396e-274"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0740000000000000)), Is.EqualTo("9.24259520442793e-274"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0750000000000000)), Is.EqualTo("1.84851904088559e-273"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0760000000000000)), Is.EqualTo("3.69703808177117e-273"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0770000000000000)), Is.EqualTo("7.39407616354234e-273"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0780000000000000)), Is.EqualTo("1.47881523270847e-272"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0790000000000000)), Is.EqualTo("2.95763046541694e-272"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x07a0000000000000)), Is.EqualTo("5.91526093083387e-272"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x07b0000000000000)), Is.EqualTo("1.18305218616677e-271"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x07c0000000000000)), Is.EqualTo("2.36610437233355e-271"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x07d0000000000000)), Is.EqualTo("4.7322087446671e-271"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x07e0000000000000)), Is.EqualTo("9.4644174893342e-271"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x07f0000000000000)), Is.EqualTo("1.89288349786684e-270"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0800000000000000)), Is.EqualTo("3.78576699573368e-270"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0810000000000000)), Is.EqualTo("7.57153399146736e-270"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0820000000000000)), Is.EqualTo("1.51430679829347e-269"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0830000000000000)), Is.EqualTo("3.02861359658694e-269"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0840000000000000)), Is.EqualTo("6.05722719317389e-269"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0850000000000000)), Is.EqualTo("1.21144543863478e-268"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0860000000000000)), Is.EqualTo("2.42289087726955e-268"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0870000000000000)), Is.EqualTo("4.84578175453911e-268"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0880000000000000)), Is.EqualTo("9.69156350907822e-268"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0890000000000000)), Is.EqualTo("1.93831270181564e-267"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x08a0000000000000)), Is.EqualTo("3.87662540363129e-267"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x08b0000000000000)), Is.EqualTo("7.75325080726257e-267"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x08c0000000000000)), Is.EqualTo("1.55065016145251e-266"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x08d0000000000000)), Is.EqualTo("3.10130032290503e-266"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x08e0000000000000)), Is.EqualTo("6.20260064581006e-266"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x08f0000000000000)), Is.EqualTo("1.24052012916201e-265"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0900000000000000)), Is.EqualTo("2.48104025832402e-265"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0910000000000000)), Is.EqualTo("4.96208051664805e-265"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0920000000000000)), Is.EqualTo("9.9241610332961e-265"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0930000000000000)), Is.EqualTo("1.98483220665922e-264"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0940000000000000)), Is.EqualTo("3.96966441331844e-264"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0950000000000000)), Is.EqualTo("7.93932882663688e-264"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0960000000000000)), Is.EqualTo("1.58786576532738e-263"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0970000000000000)), Is.EqualTo("3.17573153065475e-263"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0980000000000000)), Is.EqualTo("6.3514630613095e-263"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0990000000000000)), Is.EqualTo("1.2702926122619e-262"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x09a0000000000000)), Is.EqualTo("2.5405852245238e-262"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x09b0000000000000)), Is.EqualTo("5.0811704490476e-262"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x09c0000000000000)), Is.EqualTo("1.01623408980952e-261"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x09d0000000000000)), Is.EqualTo("2.03246817961904e-261"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x09e0000000000000)), Is.EqualTo("4.06493635923808e-261"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x09f0000000000000)), Is.EqualTo("8.12987271847616e-261"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a00000000000000)), Is.EqualTo("1.62597454369523e-260"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a10000000000000)), Is.EqualTo("3.25194908739046e-260"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a20000000000000)), Is.EqualTo("6.50389817478093e-260"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a30000000000000)), Is.EqualTo("1.30077963495619e-259"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a40000000000000)), Is.EqualTo("2.60155926991237e-259"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a50000000000000)), Is.EqualTo("5.20311853982474e-259"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a60000000000000)), Is.EqualTo("1.04062370796495e-258"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a70000000000000)), Is.EqualTo("2.0812474159299e-258"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a80000000000000)), Is.EqualTo("4.16249483185979e-258"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a90000000000000)), Is.EqualTo("8.32498966371959e-258"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0aa0000000000000)), Is.EqualTo("1.66499793274392e-257"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ab0000000000000)), Is.EqualTo("3.32999586548784e-257"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ac0000000000000)), Is.EqualTo("6.65999173097567e-257"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ad0000000000000)), Is.EqualTo("1.33199834619513e-256"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ae0000000000000)), Is.EqualTo("2.66399669239027e-256"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0af0000000000000)), Is.EqualTo("5.32799338478054e-256"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b00000000000000)), Is.EqualTo("1.06559867695611e-255"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b10000000000000)), Is.EqualTo("2.13119735391221e-255"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b20000000000000)), Is.EqualTo("4.26239470782443e-255"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b30000000000000)), Is.EqualTo("8.52478941564886e-255"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b40000000000000)), Is.EqualTo("1.70495788312977e-254"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b50000000000000)), Is.EqualTo("3.40991576625954e-254"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b60000000000000)), Is.EqualTo("6.81983153251909e-254"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b70000000000000)), Is.EqualTo("1.36396630650382e-253"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b80000000000000)), Is.EqualTo("2.72793261300764e-253"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b90000000000000)), Is.EqualTo("5.45586522601527e-253"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ba0000000000000)), Is.EqualTo("1.09117304520305e-252"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0bb0000000000000)), Is.EqualTo("2.18234609040611e-252"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0bc0000000000000)), Is.EqualTo("4.36469218081222e-252"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0bd0000000000000)), Is.EqualTo("8.72938436162443e-252"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0be0000000000000)), Is.EqualTo("1.74587687232489e-251"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0bf0000000000000)), Is.EqualTo("3.49175374464977e-251"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c00000000000000)), Is.EqualTo("6.98350748929955e-251"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c10000000000000)), Is.EqualTo("1.39670149785991e-250"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c20000000000000)), Is.EqualTo("2.79340299571982e-250"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c30000000000000)), Is.EqualTo("5.58680599143964e-250"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c40000000000000)), Is.EqualTo("1.11736119828793e-249"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c50000000000000)), Is.EqualTo("2.23472239657585e-249"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c60000000000000)), Is.EqualTo("4.46944479315171e-249"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c70000000000000)), Is.EqualTo("8.93888958630342e-249"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c80000000000000)), Is.EqualTo("1.78777791726068e-248"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c90000000000000)), Is.EqualTo("3.57555583452137e-248"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ca0000000000000)), Is.EqualTo("7.15111166904273e-248"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0cb0000000000000)), Is.EqualTo("1.43022233380855e-247"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0cc0000000000000)), Is.EqualTo("2.86044466761709e-247"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0cd0000000000000)), Is.EqualTo("5.72088933523419e-247"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ce0000000000000)), Is.EqualTo("1.14417786704684e-246"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0cf0000000000000)), Is.EqualTo("2.28835573409368e-246"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d00000000000000)), Is.EqualTo("4.57671146818735e-246"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d10000000000000)), Is.EqualTo("9.1534229363747e-246"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d20000000000000)), Is.EqualTo("1.83068458727494e-245"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d30000000000000)), Is.EqualTo("3.66136917454988e-245"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d40000000000000)), Is.EqualTo("7.32273834909976e-245"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d50000000000000)), Is.EqualTo("1.46454766981995e-244"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d60000000000000)), Is.EqualTo("2.9290953396399e-244"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d70000000000000)), Is.EqualTo("5.85819067927981e-244"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d80000000000000)), Is.EqualTo("1.17163813585596e-243"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d90000000000000)), Is.EqualTo("2.34327627171192e-243"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0da0000000000000)), Is.EqualTo("4.68655254342385e-243"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0db0000000000000)), Is.EqualTo("9.37310508684769e-243"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0dc0000000000000)), Is.EqualTo("1.87462101736954e-242"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0dd0000000000000)), Is.EqualTo("3.74924203473908e-242"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0de0000000000000)), Is.EqualTo("7.49848406947815e-242"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0df0000000000000)), Is.EqualTo("1.49969681389563e-241"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e00000000000000)), Is.EqualTo("2.99939362779126e-241"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e10000000000000)), Is.EqualTo("5.99878725558252e-241"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e20000000000000)), Is.EqualTo("1.1997574511165e-240"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e30000000000000)), Is.EqualTo("2.39951490223301e-240"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e40000000000000)), Is.EqualTo("4.79902980446602e-240"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e50000000000000)), Is.EqualTo("9.59805960893204e-240"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e60000000000000)), Is.EqualTo("1.91961192178641e-239"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e70000000000000)), Is.EqualTo("3.83922384357282e-239"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e80000000000000)), Is.EqualTo("7.67844768714563e-239"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e90000000000000)), Is.EqualTo("1.53568953742913e-238"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ea0000000000000)), Is.EqualTo("3.07137907485825e-238"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0eb0000000000000)), Is.EqualTo("6.1427581497165e-238"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ec0000000000000)), Is.EqualTo("1.2285516299433e-237"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ed0000000000000)), Is.EqualTo("2.4571032598866e-237"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ee0000000000000)), Is.EqualTo("4.9142065197732e-237"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ef0000000000000)), Is.EqualTo("9.82841303954641e-237"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f00000000000000)), Is.EqualTo("1.96568260790928e-236"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f10000000000000)), Is.EqualTo("3.93136521581856e-236"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f20000000000000)), Is.EqualTo("7.86273043163713e-236"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f30000000000000)), Is.EqualTo("1.57254608632743e-235"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f40000000000000)), Is.EqualTo("3.14509217265485e-235"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f50000000000000)), Is.EqualTo("6.2901843453097e-235"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f60000000000000)), Is.EqualTo("1.25803686906194e-234"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f70000000000000)), Is.EqualTo("2.51607373812388e-234"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f80000000000000)), Is.EqualTo("5.03214747624776e-234"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f90000000000000)), Is.EqualTo("1.00642949524955e-233"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0fa0000000000000)), Is.EqualTo("2.0128589904991e-233"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0fb0000000000000)), Is.EqualTo("4.02571798099821e-233"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0fc0000000000000)), Is.EqualTo("8.05143596199642e-233"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0fd0000000000000)), Is.EqualTo("1.61028719239928e-232"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0fe0000000000000)), Is.EqualTo("3.22057438479857e-232"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ff0000000000000)), Is.EqualTo("6.44114876959713e-232"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1000000000000000)), Is.EqualTo("1.28822975391943e-231"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1010000000000000)), Is.EqualTo("2.57645950783885e-231"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1020000000000000)), Is.EqualTo("5.15291901567771e-231"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1030000000000000)), Is.EqualTo("1.03058380313554e-230"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1040000000000000)), Is.EqualTo("2.06116760627108e-230"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1050000000000000)), Is.EqualTo("4.12233521254217e-230"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1060000000000000)), Is.EqualTo("8.24467042508433e-230"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1070000000000000)), Is.EqualTo("1.64893408501687e-229"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1080000000000000)), Is.EqualTo("3.29786817003373e-229"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1090000000000000)), Is.EqualTo("6.59573634006746e-229"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x10a0000000000000)), Is.EqualTo("1.31914726801349e-228"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x10b0000000000000)), Is.EqualTo("2.63829453602699e-228"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x10c0000000000000)), Is.EqualTo("5.27658907205397e-228"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x10d0000000000000)), Is.EqualTo("1.05531781441079e-227"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x10e0000000000000)), Is.EqualTo("2.11063562882159e-227"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x10f0000000000000)), Is.EqualTo("4.22127125764318e-227"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1100000000000000)), Is.EqualTo("8.44254251528635e-227"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1110000000000000)), Is.EqualTo("1.68850850305727e-226"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1120000000000000)), Is.EqualTo("3.37701700611454e-226"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1130000000000000)), Is.EqualTo("6.75403401222908e-226"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1140000000000000)), Is.EqualTo("1.35080680244582e-225"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1150000000000000)), Is.EqualTo("2.70161360489163e-225"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1160000000000000)), Is.EqualTo("5.40322720978327e-225"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1170000000000000)), Is.EqualTo("1.08064544195665e-224"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1180000000000000)), Is.EqualTo("2.16129088391331e-224"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1190000000000000)), Is.EqualTo("4.32258176782661e-224"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x11a0000000000000)), Is.EqualTo("8.64516353565323e-224"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x11b0000000000000)), Is.EqualTo("1.72903270713065e-223"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x11c0000000000000)), Is.EqualTo("3.45806541426129e-223"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x11d0000000000000)), Is.EqualTo("6.91613082852258e-223"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x11e0000000000000)), Is.EqualTo("1.38322616570452e-222"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x11f0000000000000)), Is.EqualTo("2.76645233140903e-222"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1200000000000000)), Is.EqualTo("5.53290466281807e-222"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1210000000000000)), Is.EqualTo("1.10658093256361e-221"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1220000000000000)), Is.EqualTo("2.21316186512723e-221"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1230000000000000)), Is.EqualTo("4.42632373025445e-221"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1240000000000000)), Is.EqualTo("8.8526474605089e-221"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1250000000000000)), Is.EqualTo("1.77052949210178e-220"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1260000000000000)), Is.EqualTo("3.54105898420356e-220"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1270000000000000)), Is.EqualTo("7.08211796840712e-220"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1280000000000000)), Is.EqualTo("1.41642359368142e-219"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1290000000000000)), Is.EqualTo("2.83284718736285e-219"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x12a0000000000000)), Is.EqualTo("5.6656943747257e-219"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x12b0000000000000)), Is.EqualTo("1.13313887494514e-218"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x12c0000000000000)), Is.EqualTo("2.26627774989028e-218"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x12d0000000000000)), Is.EqualTo("4.53255549978056e-218"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x12e0000000000000)), Is.EqualTo("9.06511099956112e-218"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x12f0000000000000)), Is.EqualTo("1.81302219991222e-217"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1300000000000000)), Is.EqualTo("3.62604439982445e-217"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1310000000000000)), Is.EqualTo("7.25208879964889e-217"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1320000000000000)), Is.EqualTo("1.45041775992978e-216"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1330000000000000)), Is.EqualTo("2.90083551985956e-216"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1340000000000000)), Is.EqualTo("5.80167103971912e-216"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1350000000000000)), Is.EqualTo("1.16033420794382e-215"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1360000000000000)), Is.EqualTo("2.32066841588765e-215"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1370000000000000)), Is.EqualTo("4.64133683177529e-215"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1380000000000000)), Is.EqualTo("9.28267366355059e-215"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1390000000000000)), Is.EqualTo("1.85653473271012e-214"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x13a0000000000000)), Is.EqualTo("3.71306946542023e-214"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x13b0000000000000)), Is.EqualTo("7.42613893084047e-214"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x13c0000000000000)), Is.EqualTo("1.48522778616809e-213"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x13d0000000000000)), Is.EqualTo("2.97045557233619e-213"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x13e0000000000000)), Is.EqualTo("5.94091114467237e-213"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x13f0000000000000)), Is.EqualTo("1.18818222893447e-212"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1400000000000000)), Is.EqualTo("2.37636445786895e-212"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1410000000000000)), Is.EqualTo("4.7527289157379e-212"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1420000000000000)), Is.EqualTo("9.5054578314758e-212"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1430000000000000)), Is.EqualTo("1.90109156629516e-211"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1440000000000000)), Is.EqualTo("3.80218313259032e-211"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1450000000000000)), Is.EqualTo("7.60436626518064e-211"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1460000000000000)), Is.EqualTo("1.52087325303613e-210"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1470000000000000)), Is.EqualTo("3.04174650607226e-210"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1480000000000000)), Is.EqualTo("6.08349301214451e-210"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1490000000000000)), Is.EqualTo("1.2166986024289e-209"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x14a0000000000000)), Is.EqualTo("2.4333972048578e-209"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x14b0000000000000)), Is.EqualTo("4.86679440971561e-209"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x14c0000000000000)), Is.EqualTo("9.73358881943122e-209"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x14d0000000000000)), Is.EqualTo("1.94671776388624e-208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x14e0000000000000)), Is.EqualTo("3.89343552777249e-208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x14f0000000000000)), Is.EqualTo("7.78687105554497e-208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1500000000000000)), Is.EqualTo("1.55737421110899e-207"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1510000000000000)), Is.EqualTo("3.11474842221799e-207"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1520000000000000)), Is.EqualTo("6.22949684443598e-207"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1530000000000000)), Is.EqualTo("1.2458993688872e-206"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1540000000000000)), Is.EqualTo("2.49179873777439e-206"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1550000000000000)), Is.EqualTo("4.98359747554878e-206"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1560000000000000)), Is.EqualTo("9.96719495109757e-206"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1570000000000000)), Is.EqualTo("1.99343899021951e-205"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1580000000000000)), Is.EqualTo("3.98687798043903e-205"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1590000000000000)), Is.EqualTo("7.97375596087805e-205"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x15a0000000000000)), Is.EqualTo("1.59475119217561e-204"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x15b0000000000000)), Is.EqualTo("3.18950238435122e-204"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x15c0000000000000)), Is.EqualTo("6.37900476870244e-204"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x15d0000000000000)), Is.EqualTo("1.27580095374049e-203"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x15e0000000000000)), Is.EqualTo("2.55160190748098e-203"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x15f0000000000000)), Is.EqualTo("5.10320381496195e-203"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1600000000000000)), Is.EqualTo("1.02064076299239e-202"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1610000000000000)), Is.EqualTo("2.04128152598478e-202"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1620000000000000)), Is.EqualTo("4.08256305196956e-202"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1630000000000000)), Is.EqualTo("8.16512610393913e-202"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1640000000000000)), Is.EqualTo("1.63302522078783e-201"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1650000000000000)), Is.EqualTo("3.26605044157565e-201"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1660000000000000)), Is.EqualTo("6.5321008831513e-201"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1670000000000000)), Is.EqualTo("1.30642017663026e-200"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1680000000000000)), Is.EqualTo("2.61284035326052e-200"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1690000000000000)), Is.EqualTo("5.22568070652104e-200"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x16a0000000000000)), Is.EqualTo("1.04513614130421e-199"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x16b0000000000000)), Is.EqualTo("2.09027228260842e-199"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x16c0000000000000)), Is.EqualTo("4.18054456521683e-199"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x16d0000000000000)), Is.EqualTo("8.36108913043367e-199"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x16e0000000000000)), Is.EqualTo("1.67221782608673e-198"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x16f0000000000000)), Is.EqualTo("3.34443565217347e-198"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1700000000000000)), Is.EqualTo("6.68887130434693e-198"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1710000000000000)), Is.EqualTo("1.33777426086939e-197"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1720000000000000)), Is.EqualTo("2.67554852173877e-197"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1730000000000000)), Is.EqualTo("5.35109704347755e-197"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1740000000000000)), Is.EqualTo("1.07021940869551e-196"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1750000000000000)), Is.EqualTo("2.14043881739102e-196"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1760000000000000)), Is.EqualTo("4.28087763478204e-196"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1770000000000000)), Is.EqualTo("8.56175526956407e-196"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1780000000000000)), Is.EqualTo("1.71235105391281e-195"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1790000000000000)), Is.EqualTo("3.42470210782563e-195"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x17a0000000000000)), Is.EqualTo("6.84940421565126e-195"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x17b0000000000000)), Is.EqualTo("1.36988084313025e-194"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x17c0000000000000)), Is.EqualTo("2.7397616862605e-194"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x17d0000000000000)), Is.EqualTo("5.47952337252101e-194"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x17e0000000000000)), Is.EqualTo("1.0959046745042e-193"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x17f0000000000000)), Is.EqualTo("2.1918093490084e-193"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1800000000000000)), Is.EqualTo("4.38361869801681e-193"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1810000000000000)), Is.EqualTo("8.76723739603361e-193"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1820000000000000)), Is.EqualTo("1.75344747920672e-192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1830000000000000)), Is.EqualTo("3.50689495841344e-192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1840000000000000)), Is.EqualTo("7.01378991682689e-192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1850000000000000)), Is.EqualTo("1.40275798336538e-191"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1860000000000000)), Is.EqualTo("2.80551596673076e-191"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1870000000000000)), Is.EqualTo("5.61103193346151e-191"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1880000000000000)), Is.EqualTo("1.1222063866923e-190"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1890000000000000)), Is.EqualTo("2.2444127733846e-190"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x18a0000000000000)), Is.EqualTo("4.48882554676921e-190"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x18b0000000000000)), Is.EqualTo("8.97765109353842e-190"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x18c0000000000000)), Is.EqualTo("1.79553021870768e-189"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x18d0000000000000)), Is.EqualTo("3.59106043741537e-189"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x18e0000000000000)), Is.EqualTo("7.18212087483074e-189"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x18f0000000000000)), Is.EqualTo("1.43642417496615e-188"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1900000000000000)), Is.EqualTo("2.87284834993229e-188"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1910000000000000)), Is.EqualTo("5.74569669986459e-188"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1920000000000000)), Is.EqualTo("1.14913933997292e-187"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1930000000000000)), Is.EqualTo("2.29827867994584e-187"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1940000000000000)), Is.EqualTo("4.59655735989167e-187"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1950000000000000)), Is.EqualTo("9.19311471978334e-187"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1960000000000000)), Is.EqualTo("1.83862294395667e-186"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1970000000000000)), Is.EqualTo("3.67724588791334e-186"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1980000000000000)), Is.EqualTo("7.35449177582667e-186"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1990000000000000)), Is.EqualTo("1.47089835516533e-185"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x19a0000000000000)), Is.EqualTo("2.94179671033067e-185"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x19b0000000000000)), Is.EqualTo("5.88359342066134e-185"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x19c0000000000000)), Is.EqualTo("1.17671868413227e-184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x19d0000000000000)), Is.EqualTo("2.35343736826454e-184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x19e0000000000000)), Is.EqualTo("4.70687473652907e-184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x19f0000000000000)), Is.EqualTo("9.41374947305814e-184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a00000000000000)), Is.EqualTo("1.88274989461163e-183"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a10000000000000)), Is.EqualTo("3.76549978922326e-183"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a20000000000000)), Is.EqualTo("7.53099957844651e-183"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a30000000000000)), Is.EqualTo("1.5061999156893e-182"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a40000000000000)), Is.EqualTo("3.01239983137861e-182"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a50000000000000)), Is.EqualTo("6.02479966275721e-182"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a60000000000000)), Is.EqualTo("1.20495993255144e-181"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a70000000000000)), Is.EqualTo("2.40991986510288e-181"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a80000000000000)), Is.EqualTo("4.81983973020577e-181"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a90000000000000)), Is.EqualTo("9.63967946041154e-181"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1aa0000000000000)), Is.EqualTo("1.92793589208231e-180"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ab0000000000000)), Is.EqualTo("3.85587178416461e-180"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ac0000000000000)), Is.EqualTo("7.71174356832923e-180"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ad0000000000000)), Is.EqualTo("1.54234871366585e-179"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ae0000000000000)), Is.EqualTo("3.08469742733169e-179"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1af0000000000000)), Is.EqualTo("6.16939485466338e-179"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b00000000000000)), Is.EqualTo("1.23387897093268e-178"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b10000000000000)), Is.EqualTo("2.46775794186535e-178"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b20000000000000)), Is.EqualTo("4.93551588373071e-178"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b30000000000000)), Is.EqualTo("9.87103176746141e-178"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b40000000000000)), Is.EqualTo("1.97420635349228e-177"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b50000000000000)), Is.EqualTo("3.94841270698457e-177"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b60000000000000)), Is.EqualTo("7.89682541396913e-177"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b70000000000000)), Is.EqualTo("1.57936508279383e-176"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b80000000000000)), Is.EqualTo("3.15873016558765e-176"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b90000000000000)), Is.EqualTo("6.3174603311753e-176"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ba0000000000000)), Is.EqualTo("1.26349206623506e-175"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1bb0000000000000)), Is.EqualTo("2.52698413247012e-175"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1bc0000000000000)), Is.EqualTo("5.05396826494024e-175"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1bd0000000000000)), Is.EqualTo("1.01079365298805e-174"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1be0000000000000)), Is.EqualTo("2.0215873059761e-174"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1bf0000000000000)), Is.EqualTo("4.04317461195219e-174"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c00000000000000)), Is.EqualTo("8.08634922390439e-174"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c10000000000000)), Is.EqualTo("1.61726984478088e-173"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c20000000000000)), Is.EqualTo("3.23453968956176e-173"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c30000000000000)), Is.EqualTo("6.46907937912351e-173"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c40000000000000)), Is.EqualTo("1.2938158758247e-172"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c50000000000000)), Is.EqualTo("2.5876317516494e-172"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c60000000000000)), Is.EqualTo("5.17526350329881e-172"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c70000000000000)), Is.EqualTo("1.03505270065976e-171"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c80000000000000)), Is.EqualTo("2.07010540131952e-171"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c90000000000000)), Is.EqualTo("4.14021080263905e-171"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ca0000000000000)), Is.EqualTo("8.2804216052781e-171"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1cb0000000000000)), Is.EqualTo("1.65608432105562e-170"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1cc0000000000000)), Is.EqualTo("3.31216864211124e-170"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1cd0000000000000)), Is.EqualTo("6.62433728422248e-170"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ce0000000000000)), Is.EqualTo("1.3248674568445e-169"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1cf0000000000000)), Is.EqualTo("2.64973491368899e-169"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d00000000000000)), Is.EqualTo("5.29946982737798e-169"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d10000000000000)), Is.EqualTo("1.0598939654756e-168"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d20000000000000)), Is.EqualTo("2.11978793095119e-168"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d30000000000000)), Is.EqualTo("4.23957586190238e-168"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d40000000000000)), Is.EqualTo("8.47915172380477e-168"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d50000000000000)), Is.EqualTo("1.69583034476095e-167"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d60000000000000)), Is.EqualTo("3.39166068952191e-167"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d70000000000000)), Is.EqualTo("6.78332137904382e-167"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d80000000000000)), Is.EqualTo("1.35666427580876e-166"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d90000000000000)), Is.EqualTo("2.71332855161753e-166"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1da0000000000000)), Is.EqualTo("5.42665710323505e-166"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1db0000000000000)), Is.EqualTo("1.08533142064701e-165"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1dc0000000000000)), Is.EqualTo("2.17066284129402e-165"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1dd0000000000000)), Is.EqualTo("4.34132568258804e-165"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1de0000000000000)), Is.EqualTo("8.68265136517608e-165"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1df0000000000000)), Is.EqualTo("1.73653027303522e-164"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e00000000000000)), Is.EqualTo("3.47306054607043e-164"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e10000000000000)), Is.EqualTo("6.94612109214087e-164"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e20000000000000)), Is.EqualTo("1.38922421842817e-163"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e30000000000000)), Is.EqualTo("2.77844843685635e-163"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e40000000000000)), Is.EqualTo("5.55689687371269e-163"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e50000000000000)), Is.EqualTo("1.11137937474254e-162"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e60000000000000)), Is.EqualTo("2.22275874948508e-162"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e70000000000000)), Is.EqualTo("4.44551749897016e-162"));  // GCC returns 4.44551749897015e-162
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e80000000000000)), Is.EqualTo("8.89103499794031e-162"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e90000000000000)), Is.EqualTo("1.77820699958806e-161"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ea0000000000000)), Is.EqualTo("3.55641399917612e-161"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1eb0000000000000)), Is.EqualTo("7.11282799835225e-161"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ec0000000000000)), Is.EqualTo("1.42256559967045e-160"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ed0000000000000)), Is.EqualTo("2.8451311993409e-160"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ee0000000000000)), Is.EqualTo("5.6902623986818e-160"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ef0000000000000)), Is.EqualTo("1.13805247973636e-159"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f00000000000000)), Is.EqualTo("2.27610495947272e-159"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f10000000000000)), Is.EqualTo("4.55220991894544e-159"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f20000000000000)), Is.EqualTo("9.10441983789088e-159"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f30000000000000)), Is.EqualTo("1.82088396757818e-158"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f40000000000000)), Is.EqualTo("3.64176793515635e-158"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f50000000000000)), Is.EqualTo("7.2835358703127e-158"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f60000000000000)), Is.EqualTo("1.45670717406254e-157"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f70000000000000)), Is.EqualTo("2.91341434812508e-157"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f80000000000000)), Is.EqualTo("5.82682869625016e-157"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f90000000000000)), Is.EqualTo("1.16536573925003e-156"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1fa0000000000000)), Is.EqualTo("2.33073147850006e-156"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1fb0000000000000)), Is.EqualTo("4.66146295700013e-156"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1fc0000000000000)), Is.EqualTo("9.32292591400026e-156"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1fd0000000000000)), Is.EqualTo("1.86458518280005e-155"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1fe0000000000000)), Is.EqualTo("3.7291703656001e-155"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ff0000000000000)), Is.EqualTo("7.45834073120021e-155"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2000000000000000)), Is.EqualTo("1.49166814624004e-154"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2010000000000000)), Is.EqualTo("2.98333629248008e-154"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2020000000000000)), Is.EqualTo("5.96667258496017e-154"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2030000000000000)), Is.EqualTo("1.19333451699203e-153"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2040000000000000)), Is.EqualTo("2.38666903398407e-153"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2050000000000000)), Is.EqualTo("4.77333806796813e-153"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2060000000000000)), Is.EqualTo("9.54667613593626e-153"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2070000000000000)), Is.EqualTo("1.90933522718725e-152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2080000000000000)), Is.EqualTo("3.81867045437451e-152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2090000000000000)), Is.EqualTo("7.63734090874901e-152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x20a0000000000000)), Is.EqualTo("1.5274681817498e-151"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x20b0000000000000)), Is.EqualTo("3.0549363634996e-151"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x20c0000000000000)), Is.EqualTo("6.10987272699921e-151"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x20d0000000000000)), Is.EqualTo("1.22197454539984e-150"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x20e0000000000000)), Is.EqualTo("2.44394909079968e-150"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x20f0000000000000)), Is.EqualTo("4.88789818159937e-150"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2100000000000000)), Is.EqualTo("9.77579636319874e-150"));  // GCC returns 9.77579636319873e-150
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2110000000000000)), Is.EqualTo("1.95515927263975e-149"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2120000000000000)), Is.EqualTo("3.91031854527949e-149"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2130000000000000)), Is.EqualTo("7.82063709055899e-149"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2140000000000000)), Is.EqualTo("1.5641274181118e-148"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2150000000000000)), Is.EqualTo("3.1282548362236e-148"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2160000000000000)), Is.EqualTo("6.25650967244719e-148"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2170000000000000)), Is.EqualTo("1.25130193448944e-147"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2180000000000000)), Is.EqualTo("2.50260386897888e-147"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2190000000000000)), Is.EqualTo("5.00520773795775e-147"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x21a0000000000000)), Is.EqualTo("1.00104154759155e-146"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x21b0000000000000)), Is.EqualTo("2.0020830951831e-146"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x21c0000000000000)), Is.EqualTo("4.0041661903662e-146"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x21d0000000000000)), Is.EqualTo("8.0083323807324e-146"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x21e0000000000000)), Is.EqualTo("1.60166647614648e-145"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x21f0000000000000)), Is.EqualTo("3.20333295229296e-145"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2200000000000000)), Is.EqualTo("6.40666590458592e-145"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2210000000000000)), Is.EqualTo("1.28133318091718e-144"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2220000000000000)), Is.EqualTo("2.56266636183437e-144"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2230000000000000)), Is.EqualTo("5.12533272366874e-144"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2240000000000000)), Is.EqualTo("1.02506654473375e-143"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2250000000000000)), Is.EqualTo("2.0501330894675e-143"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2260000000000000)), Is.EqualTo("4.10026617893499e-143"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2270000000000000)), Is.EqualTo("8.20053235786998e-143"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2280000000000000)), Is.EqualTo("1.640106471574e-142"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2290000000000000)), Is.EqualTo("3.28021294314799e-142"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x22a0000000000000)), Is.EqualTo("6.56042588629599e-142"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x22b0000000000000)), Is.EqualTo("1.3120851772592e-141"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x22c0000000000000)), Is.EqualTo("2.62417035451839e-141"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x22d0000000000000)), Is.EqualTo("5.24834070903679e-141"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x22e0000000000000)), Is.EqualTo("1.04966814180736e-140"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x22f0000000000000)), Is.EqualTo("2.09933628361472e-140"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2300000000000000)), Is.EqualTo("4.19867256722943e-140"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2310000000000000)), Is.EqualTo("8.39734513445886e-140"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2320000000000000)), Is.EqualTo("1.67946902689177e-139"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2330000000000000)), Is.EqualTo("3.35893805378354e-139"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2340000000000000)), Is.EqualTo("6.71787610756709e-139"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2350000000000000)), Is.EqualTo("1.34357522151342e-138"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2360000000000000)), Is.EqualTo("2.68715044302684e-138"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2370000000000000)), Is.EqualTo("5.37430088605367e-138"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2380000000000000)), Is.EqualTo("1.07486017721073e-137"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2390000000000000)), Is.EqualTo("2.14972035442147e-137"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x23a0000000000000)), Is.EqualTo("4.29944070884294e-137"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x23b0000000000000)), Is.EqualTo("8.59888141768587e-137"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x23c0000000000000)), Is.EqualTo("1.71977628353717e-136"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x23d0000000000000)), Is.EqualTo("3.43955256707435e-136"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x23e0000000000000)), Is.EqualTo("6.8791051341487e-136"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x23f0000000000000)), Is.EqualTo("1.37582102682974e-135"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2400000000000000)), Is.EqualTo("2.75164205365948e-135"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2410000000000000)), Is.EqualTo("5.50328410731896e-135"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2420000000000000)), Is.EqualTo("1.10065682146379e-134"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2430000000000000)), Is.EqualTo("2.20131364292758e-134"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2440000000000000)), Is.EqualTo("4.40262728585517e-134"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2450000000000000)), Is.EqualTo("8.80525457171033e-134"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2460000000000000)), Is.EqualTo("1.76105091434207e-133"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2470000000000000)), Is.EqualTo("3.52210182868413e-133"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2480000000000000)), Is.EqualTo("7.04420365736827e-133"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2490000000000000)), Is.EqualTo("1.40884073147365e-132"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x24a0000000000000)), Is.EqualTo("2.81768146294731e-132"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x24b0000000000000)), Is.EqualTo("5.63536292589461e-132"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x24c0000000000000)), Is.EqualTo("1.12707258517892e-131"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x24d0000000000000)), Is.EqualTo("2.25414517035785e-131"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x24e0000000000000)), Is.EqualTo("4.50829034071569e-131"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x24f0000000000000)), Is.EqualTo("9.01658068143138e-131"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2500000000000000)), Is.EqualTo("1.80331613628628e-130"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2510000000000000)), Is.EqualTo("3.60663227257255e-130"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2520000000000000)), Is.EqualTo("7.21326454514511e-130"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2530000000000000)), Is.EqualTo("1.44265290902902e-129"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2540000000000000)), Is.EqualTo("2.88530581805804e-129"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2550000000000000)), Is.EqualTo("5.77061163611608e-129"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2560000000000000)), Is.EqualTo("1.15412232722322e-128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2570000000000000)), Is.EqualTo("2.30824465444643e-128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2580000000000000)), Is.EqualTo("4.61648930889287e-128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2590000000000000)), Is.EqualTo("9.23297861778574e-128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x25a0000000000000)), Is.EqualTo("1.84659572355715e-127"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x25b0000000000000)), Is.EqualTo("3.69319144711429e-127"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x25c0000000000000)), Is.EqualTo("7.38638289422859e-127"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x25d0000000000000)), Is.EqualTo("1.47727657884572e-126"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x25e0000000000000)), Is.EqualTo("2.95455315769144e-126"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x25f0000000000000)), Is.EqualTo("5.90910631538287e-126"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2600000000000000)), Is.EqualTo("1.18182126307657e-125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2610000000000000)), Is.EqualTo("2.36364252615315e-125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2620000000000000)), Is.EqualTo("4.7272850523063e-125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2630000000000000)), Is.EqualTo("9.45457010461259e-125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2640000000000000)), Is.EqualTo("1.89091402092252e-124"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2650000000000000)), Is.EqualTo("3.78182804184504e-124"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2660000000000000)), Is.EqualTo("7.56365608369007e-124"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2670000000000000)), Is.EqualTo("1.51273121673802e-123"));  // GCC returns 1.51273121673801e-123
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2680000000000000)), Is.EqualTo("3.02546243347603e-123"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2690000000000000)), Is.EqualTo("6.05092486695206e-123"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x26a0000000000000)), Is.EqualTo("1.21018497339041e-122"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x26b0000000000000)), Is.EqualTo("2.42036994678082e-122"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x26c0000000000000)), Is.EqualTo("4.84073989356165e-122"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x26d0000000000000)), Is.EqualTo("9.6814797871233e-122"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x26e0000000000000)), Is.EqualTo("1.93629595742466e-121"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x26f0000000000000)), Is.EqualTo("3.87259191484932e-121"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2700000000000000)), Is.EqualTo("7.74518382969864e-121"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2710000000000000)), Is.EqualTo("1.54903676593973e-120"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2720000000000000)), Is.EqualTo("3.09807353187945e-120"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2730000000000000)), Is.EqualTo("6.19614706375891e-120"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2740000000000000)), Is.EqualTo("1.23922941275178e-119"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2750000000000000)), Is.EqualTo("2.47845882550356e-119"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2760000000000000)), Is.EqualTo("4.95691765100713e-119"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2770000000000000)), Is.EqualTo("9.91383530201425e-119"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2780000000000000)), Is.EqualTo("1.98276706040285e-118"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2790000000000000)), Is.EqualTo("3.9655341208057e-118"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x27a0000000000000)), Is.EqualTo("7.9310682416114e-118"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x27b0000000000000)), Is.EqualTo("1.58621364832228e-117"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x27c0000000000000)), Is.EqualTo("3.17242729664456e-117"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x27d0000000000000)), Is.EqualTo("6.34485459328912e-117"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x27e0000000000000)), Is.EqualTo("1.26897091865782e-116"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x27f0000000000000)), Is.EqualTo("2.53794183731565e-116"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2800000000000000)), Is.EqualTo("5.0758836746313e-116"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2810000000000000)), Is.EqualTo("1.01517673492626e-115"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2820000000000000)), Is.EqualTo("2.03035346985252e-115"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2830000000000000)), Is.EqualTo("4.06070693970504e-115"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2840000000000000)), Is.EqualTo("8.12141387941008e-115"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2850000000000000)), Is.EqualTo("1.62428277588202e-114"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2860000000000000)), Is.EqualTo("3.24856555176403e-114"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2870000000000000)), Is.EqualTo("6.49713110352806e-114"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2880000000000000)), Is.EqualTo("1.29942622070561e-113"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2890000000000000)), Is.EqualTo("2.59885244141122e-113"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x28a0000000000000)), Is.EqualTo("5.19770488282245e-113"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x28b0000000000000)), Is.EqualTo("1.03954097656449e-112"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x28c0000000000000)), Is.EqualTo("2.07908195312898e-112"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x28d0000000000000)), Is.EqualTo("4.15816390625796e-112"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x28e0000000000000)), Is.EqualTo("8.31632781251592e-112"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x28f0000000000000)), Is.EqualTo("1.66326556250318e-111"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2900000000000000)), Is.EqualTo("3.32653112500637e-111"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2910000000000000)), Is.EqualTo("6.65306225001274e-111"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2920000000000000)), Is.EqualTo("1.33061245000255e-110"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2930000000000000)), Is.EqualTo("2.66122490000509e-110"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2940000000000000)), Is.EqualTo("5.32244980001019e-110"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2950000000000000)), Is.EqualTo("1.06448996000204e-109"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2960000000000000)), Is.EqualTo("2.12897992000408e-109"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2970000000000000)), Is.EqualTo("4.25795984000815e-109"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2980000000000000)), Is.EqualTo("8.5159196800163e-109"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2990000000000000)), Is.EqualTo("1.70318393600326e-108"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x29a0000000000000)), Is.EqualTo("3.40636787200652e-108"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x29b0000000000000)), Is.EqualTo("6.81273574401304e-108"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x29c0000000000000)), Is.EqualTo("1.36254714880261e-107"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x29d0000000000000)), Is.EqualTo("2.72509429760522e-107"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x29e0000000000000)), Is.EqualTo("5.45018859521043e-107"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x29f0000000000000)), Is.EqualTo("1.09003771904209e-106"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a00000000000000)), Is.EqualTo("2.18007543808417e-106"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a10000000000000)), Is.EqualTo("4.36015087616835e-106"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a20000000000000)), Is.EqualTo("8.72030175233669e-106"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a30000000000000)), Is.EqualTo("1.74406035046734e-105"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a40000000000000)), Is.EqualTo("3.48812070093468e-105"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a50000000000000)), Is.EqualTo("6.97624140186935e-105"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a60000000000000)), Is.EqualTo("1.39524828037387e-104"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a70000000000000)), Is.EqualTo("2.79049656074774e-104"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a80000000000000)), Is.EqualTo("5.58099312149548e-104"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a90000000000000)), Is.EqualTo("1.1161986242991e-103"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2aa0000000000000)), Is.EqualTo("2.23239724859819e-103"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ab0000000000000)), Is.EqualTo("4.46479449719639e-103"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ac0000000000000)), Is.EqualTo("8.92958899439277e-103"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ad0000000000000)), Is.EqualTo("1.78591779887855e-102"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ae0000000000000)), Is.EqualTo("3.57183559775711e-102"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2af0000000000000)), Is.EqualTo("7.14367119551422e-102"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b00000000000000)), Is.EqualTo("1.42873423910284e-101"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b10000000000000)), Is.EqualTo("2.85746847820569e-101"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b20000000000000)), Is.EqualTo("5.71493695641137e-101"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b30000000000000)), Is.EqualTo("1.14298739128228e-100"));  // GCC returns 1.14298739128227e-100
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b40000000000000)), Is.EqualTo("2.28597478256455e-100"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b50000000000000)), Is.EqualTo("4.5719495651291e-100"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b60000000000000)), Is.EqualTo("9.1438991302582e-100"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b70000000000000)), Is.EqualTo("1.82877982605164e-99"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b80000000000000)), Is.EqualTo("3.65755965210328e-99"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b90000000000000)), Is.EqualTo("7.31511930420656e-99"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ba0000000000000)), Is.EqualTo("1.46302386084131e-98"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2bb0000000000000)), Is.EqualTo("2.92604772168262e-98"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2bc0000000000000)), Is.EqualTo("5.85209544336525e-98"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2bd0000000000000)), Is.EqualTo("1.17041908867305e-97"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2be0000000000000)), Is.EqualTo("2.3408381773461e-97"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2bf0000000000000)), Is.EqualTo("4.6816763546922e-97"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c00000000000000)), Is.EqualTo("9.3633527093844e-97"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c10000000000000)), Is.EqualTo("1.87267054187688e-96"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c20000000000000)), Is.EqualTo("3.74534108375376e-96"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c30000000000000)), Is.EqualTo("7.49068216750752e-96"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c40000000000000)), Is.EqualTo("1.4981364335015e-95"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c50000000000000)), Is.EqualTo("2.99627286700301e-95"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c60000000000000)), Is.EqualTo("5.99254573400601e-95"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c70000000000000)), Is.EqualTo("1.1985091468012e-94"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c80000000000000)), Is.EqualTo("2.39701829360241e-94"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c90000000000000)), Is.EqualTo("4.79403658720481e-94"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ca0000000000000)), Is.EqualTo("9.58807317440962e-94"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2cb0000000000000)), Is.EqualTo("1.91761463488192e-93"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2cc0000000000000)), Is.EqualTo("3.83522926976385e-93"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2cd0000000000000)), Is.EqualTo("7.6704585395277e-93"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ce0000000000000)), Is.EqualTo("1.53409170790554e-92"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2cf0000000000000)), Is.EqualTo("3.06818341581108e-92"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d00000000000000)), Is.EqualTo("6.13636683162216e-92"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d10000000000000)), Is.EqualTo("1.22727336632443e-91"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d20000000000000)), Is.EqualTo("2.45454673264886e-91"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d30000000000000)), Is.EqualTo("4.90909346529773e-91"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d40000000000000)), Is.EqualTo("9.81818693059545e-91"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d50000000000000)), Is.EqualTo("1.96363738611909e-90"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d60000000000000)), Is.EqualTo("3.92727477223818e-90"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d70000000000000)), Is.EqualTo("7.85454954447636e-90"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d80000000000000)), Is.EqualTo("1.57090990889527e-89"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d90000000000000)), Is.EqualTo("3.14181981779055e-89"));   // GCC returns 3.14181981779054e-89
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2da0000000000000)), Is.EqualTo("6.28363963558109e-89"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2db0000000000000)), Is.EqualTo("1.25672792711622e-88"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2dc0000000000000)), Is.EqualTo("2.51345585423244e-88"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2dd0000000000000)), Is.EqualTo("5.02691170846487e-88"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2de0000000000000)), Is.EqualTo("1.00538234169297e-87"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2df0000000000000)), Is.EqualTo("2.01076468338595e-87"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e00000000000000)), Is.EqualTo("4.0215293667719e-87"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e10000000000000)), Is.EqualTo("8.0430587335438e-87"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e20000000000000)), Is.EqualTo("1.60861174670876e-86"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e30000000000000)), Is.EqualTo("3.21722349341752e-86"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e40000000000000)), Is.EqualTo("6.43444698683504e-86"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e50000000000000)), Is.EqualTo("1.28688939736701e-85"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e60000000000000)), Is.EqualTo("2.57377879473401e-85"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e70000000000000)), Is.EqualTo("5.14755758946803e-85"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e80000000000000)), Is.EqualTo("1.02951151789361e-84"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e90000000000000)), Is.EqualTo("2.05902303578721e-84"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ea0000000000000)), Is.EqualTo("4.11804607157442e-84"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2eb0000000000000)), Is.EqualTo("8.23609214314885e-84"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ec0000000000000)), Is.EqualTo("1.64721842862977e-83"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ed0000000000000)), Is.EqualTo("3.29443685725954e-83"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ee0000000000000)), Is.EqualTo("6.58887371451908e-83"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ef0000000000000)), Is.EqualTo("1.31777474290382e-82"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f00000000000000)), Is.EqualTo("2.63554948580763e-82"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f10000000000000)), Is.EqualTo("5.27109897161526e-82"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f20000000000000)), Is.EqualTo("1.05421979432305e-81"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f30000000000000)), Is.EqualTo("2.1084395886461e-81"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f40000000000000)), Is.EqualTo("4.21687917729221e-81"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f50000000000000)), Is.EqualTo("8.43375835458442e-81"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f60000000000000)), Is.EqualTo("1.68675167091688e-80"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f70000000000000)), Is.EqualTo("3.37350334183377e-80"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f80000000000000)), Is.EqualTo("6.74700668366753e-80"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f90000000000000)), Is.EqualTo("1.34940133673351e-79"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2fa0000000000000)), Is.EqualTo("2.69880267346701e-79"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2fb0000000000000)), Is.EqualTo("5.39760534693403e-79"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2fc0000000000000)), Is.EqualTo("1.07952106938681e-78"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2fd0000000000000)), Is.EqualTo("2.15904213877361e-78"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2fe0000000000000)), Is.EqualTo("4.31808427754722e-78"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ff0000000000000)), Is.EqualTo("8.63616855509444e-78"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3000000000000000)), Is.EqualTo("1.72723371101889e-77"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3010000000000000)), Is.EqualTo("3.45446742203778e-77"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3020000000000000)), Is.EqualTo("6.90893484407556e-77"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3030000000000000)), Is.EqualTo("1.38178696881511e-76"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3040000000000000)), Is.EqualTo("2.76357393763022e-76"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3050000000000000)), Is.EqualTo("5.52714787526044e-76"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3060000000000000)), Is.EqualTo("1.10542957505209e-75"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3070000000000000)), Is.EqualTo("2.21085915010418e-75"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3080000000000000)), Is.EqualTo("4.42171830020836e-75"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3090000000000000)), Is.EqualTo("8.84343660041671e-75"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x30a0000000000000)), Is.EqualTo("1.76868732008334e-74"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x30b0000000000000)), Is.EqualTo("3.53737464016668e-74"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x30c0000000000000)), Is.EqualTo("7.07474928033337e-74"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x30d0000000000000)), Is.EqualTo("1.41494985606667e-73"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x30e0000000000000)), Is.EqualTo("2.82989971213335e-73"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x30f0000000000000)), Is.EqualTo("5.6597994242667e-73"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3100000000000000)), Is.EqualTo("1.13195988485334e-72"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3110000000000000)), Is.EqualTo("2.26391976970668e-72"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3120000000000000)), Is.EqualTo("4.52783953941336e-72"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3130000000000000)), Is.EqualTo("9.05567907882671e-72"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3140000000000000)), Is.EqualTo("1.81113581576534e-71"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3150000000000000)), Is.EqualTo("3.62227163153068e-71"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3160000000000000)), Is.EqualTo("7.24454326306137e-71"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3170000000000000)), Is.EqualTo("1.44890865261227e-70"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3180000000000000)), Is.EqualTo("2.89781730522455e-70"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3190000000000000)), Is.EqualTo("5.7956346104491e-70"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x31a0000000000000)), Is.EqualTo("1.15912692208982e-69"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x31b0000000000000)), Is.EqualTo("2.31825384417964e-69"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x31c0000000000000)), Is.EqualTo("4.63650768835928e-69"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x31d0000000000000)), Is.EqualTo("9.27301537671855e-69"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x31e0000000000000)), Is.EqualTo("1.85460307534371e-68"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x31f0000000000000)), Is.EqualTo("3.70920615068742e-68"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3200000000000000)), Is.EqualTo("7.41841230137484e-68"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3210000000000000)), Is.EqualTo("1.48368246027497e-67"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3220000000000000)), Is.EqualTo("2.96736492054994e-67"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3230000000000000)), Is.EqualTo("5.93472984109987e-67"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3240000000000000)), Is.EqualTo("1.18694596821997e-66"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3250000000000000)), Is.EqualTo("2.37389193643995e-66"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3260000000000000)), Is.EqualTo("4.7477838728799e-66"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3270000000000000)), Is.EqualTo("9.4955677457598e-66"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3280000000000000)), Is.EqualTo("1.89911354915196e-65"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3290000000000000)), Is.EqualTo("3.79822709830392e-65"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x32a0000000000000)), Is.EqualTo("7.59645419660784e-65"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x32b0000000000000)), Is.EqualTo("1.51929083932157e-64"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x32c0000000000000)), Is.EqualTo("3.03858167864314e-64"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x32d0000000000000)), Is.EqualTo("6.07716335728627e-64"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x32e0000000000000)), Is.EqualTo("1.21543267145725e-63"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x32f0000000000000)), Is.EqualTo("2.43086534291451e-63"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3300000000000000)), Is.EqualTo("4.86173068582902e-63"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3310000000000000)), Is.EqualTo("9.72346137165803e-63"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3320000000000000)), Is.EqualTo("1.94469227433161e-62"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3330000000000000)), Is.EqualTo("3.88938454866321e-62"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3340000000000000)), Is.EqualTo("7.77876909732643e-62"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3350000000000000)), Is.EqualTo("1.55575381946529e-61"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3360000000000000)), Is.EqualTo("3.11150763893057e-61"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3370000000000000)), Is.EqualTo("6.22301527786114e-61"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3380000000000000)), Is.EqualTo("1.24460305557223e-60"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3390000000000000)), Is.EqualTo("2.48920611114446e-60"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x33a0000000000000)), Is.EqualTo("4.97841222228891e-60"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x33b0000000000000)), Is.EqualTo("9.95682444457783e-60"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x33c0000000000000)), Is.EqualTo("1.99136488891557e-59"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x33d0000000000000)), Is.EqualTo("3.98272977783113e-59"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x33e0000000000000)), Is.EqualTo("7.96545955566226e-59"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x33f0000000000000)), Is.EqualTo("1.59309191113245e-58"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3400000000000000)), Is.EqualTo("3.1861838222649e-58"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3410000000000000)), Is.EqualTo("6.37236764452981e-58"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3420000000000000)), Is.EqualTo("1.27447352890596e-57"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3430000000000000)), Is.EqualTo("2.54894705781192e-57"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3440000000000000)), Is.EqualTo("5.09789411562385e-57"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3450000000000000)), Is.EqualTo("1.01957882312477e-56"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3460000000000000)), Is.EqualTo("2.03915764624954e-56"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3470000000000000)), Is.EqualTo("4.07831529249908e-56"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3480000000000000)), Is.EqualTo("8.15663058499816e-56"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3490000000000000)), Is.EqualTo("1.63132611699963e-55"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x34a0000000000000)), Is.EqualTo("3.26265223399926e-55"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x34b0000000000000)), Is.EqualTo("6.52530446799852e-55"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x34c0000000000000)), Is.EqualTo("1.3050608935997e-54"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x34d0000000000000)), Is.EqualTo("2.61012178719941e-54"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x34e0000000000000)), Is.EqualTo("5.22024357439882e-54"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x34f0000000000000)), Is.EqualTo("1.04404871487976e-53"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3500000000000000)), Is.EqualTo("2.08809742975953e-53"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3510000000000000)), Is.EqualTo("4.17619485951906e-53"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3520000000000000)), Is.EqualTo("8.35238971903811e-53"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3530000000000000)), Is.EqualTo("1.67047794380762e-52"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3540000000000000)), Is.EqualTo("3.34095588761524e-52"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3550000000000000)), Is.EqualTo("6.68191177523049e-52"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3560000000000000)), Is.EqualTo("1.3363823550461e-51"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3570000000000000)), Is.EqualTo("2.6727647100922e-51"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3580000000000000)), Is.EqualTo("5.34552942018439e-51"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3590000000000000)), Is.EqualTo("1.06910588403688e-50"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x35a0000000000000)), Is.EqualTo("2.13821176807376e-50"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x35b0000000000000)), Is.EqualTo("4.27642353614751e-50"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x35c0000000000000)), Is.EqualTo("8.55284707229503e-50"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x35d0000000000000)), Is.EqualTo("1.71056941445901e-49"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x35e0000000000000)), Is.EqualTo("3.42113882891801e-49"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x35f0000000000000)), Is.EqualTo("6.84227765783602e-49"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3600000000000000)), Is.EqualTo("1.3684555315672e-48"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3610000000000000)), Is.EqualTo("2.73691106313441e-48"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3620000000000000)), Is.EqualTo("5.47382212626882e-48"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3630000000000000)), Is.EqualTo("1.09476442525376e-47"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3640000000000000)), Is.EqualTo("2.18952885050753e-47"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3650000000000000)), Is.EqualTo("4.37905770101505e-47"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3660000000000000)), Is.EqualTo("8.75811540203011e-47"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3670000000000000)), Is.EqualTo("1.75162308040602e-46"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3680000000000000)), Is.EqualTo("3.50324616081204e-46"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3690000000000000)), Is.EqualTo("7.00649232162409e-46"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x36a0000000000000)), Is.EqualTo("1.40129846432482e-45"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x36b0000000000000)), Is.EqualTo("2.80259692864963e-45"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x36c0000000000000)), Is.EqualTo("5.60519385729927e-45"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x36d0000000000000)), Is.EqualTo("1.12103877145985e-44"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x36e0000000000000)), Is.EqualTo("2.24207754291971e-44"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x36f0000000000000)), Is.EqualTo("4.48415508583941e-44"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3700000000000000)), Is.EqualTo("8.96831017167883e-44"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3710000000000000)), Is.EqualTo("1.79366203433577e-43"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3720000000000000)), Is.EqualTo("3.58732406867153e-43"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3730000000000000)), Is.EqualTo("7.17464813734306e-43"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3740000000000000)), Is.EqualTo("1.43492962746861e-42"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3750000000000000)), Is.EqualTo("2.86985925493723e-42"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3760000000000000)), Is.EqualTo("5.73971850987445e-42"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3770000000000000)), Is.EqualTo("1.14794370197489e-41"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3780000000000000)), Is.EqualTo("2.29588740394978e-41"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3790000000000000)), Is.EqualTo("4.59177480789956e-41"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x37a0000000000000)), Is.EqualTo("9.18354961579912e-41"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x37b0000000000000)), Is.EqualTo("1.83670992315982e-40"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x37c0000000000000)), Is.EqualTo("3.67341984631965e-40"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x37d0000000000000)), Is.EqualTo("7.3468396926393e-40"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x37e0000000000000)), Is.EqualTo("1.46936793852786e-39"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x37f0000000000000)), Is.EqualTo("2.93873587705572e-39"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3800000000000000)), Is.EqualTo("5.87747175411144e-39"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3810000000000000)), Is.EqualTo("1.17549435082229e-38"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3820000000000000)), Is.EqualTo("2.35098870164458e-38"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3830000000000000)), Is.EqualTo("4.70197740328915e-38"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3840000000000000)), Is.EqualTo("9.4039548065783e-38"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3850000000000000)), Is.EqualTo("1.88079096131566e-37"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3860000000000000)), Is.EqualTo("3.76158192263132e-37"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3870000000000000)), Is.EqualTo("7.52316384526264e-37"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3880000000000000)), Is.EqualTo("1.50463276905253e-36"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3890000000000000)), Is.EqualTo("3.00926553810506e-36"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x38a0000000000000)), Is.EqualTo("6.01853107621011e-36"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x38b0000000000000)), Is.EqualTo("1.20370621524202e-35"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x38c0000000000000)), Is.EqualTo("2.40741243048404e-35"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x38d0000000000000)), Is.EqualTo("4.81482486096809e-35"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x38e0000000000000)), Is.EqualTo("9.62964972193618e-35"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x38f0000000000000)), Is.EqualTo("1.92592994438724e-34"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3900000000000000)), Is.EqualTo("3.85185988877447e-34"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3910000000000000)), Is.EqualTo("7.70371977754894e-34"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3920000000000000)), Is.EqualTo("1.54074395550979e-33"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3930000000000000)), Is.EqualTo("3.08148791101958e-33"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3940000000000000)), Is.EqualTo("6.16297582203915e-33"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3950000000000000)), Is.EqualTo("1.23259516440783e-32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3960000000000000)), Is.EqualTo("2.46519032881566e-32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3970000000000000)), Is.EqualTo("4.93038065763132e-32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3980000000000000)), Is.EqualTo("9.86076131526265e-32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3990000000000000)), Is.EqualTo("1.97215226305253e-31"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x39a0000000000000)), Is.EqualTo("3.94430452610506e-31"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x39b0000000000000)), Is.EqualTo("7.88860905221012e-31"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x39c0000000000000)), Is.EqualTo("1.57772181044202e-30"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x39d0000000000000)), Is.EqualTo("3.15544362088405e-30"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x39e0000000000000)), Is.EqualTo("6.31088724176809e-30"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x39f0000000000000)), Is.EqualTo("1.26217744835362e-29"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a00000000000000)), Is.EqualTo("2.52435489670724e-29"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a10000000000000)), Is.EqualTo("5.04870979341448e-29"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a20000000000000)), Is.EqualTo("1.0097419586829e-28"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a30000000000000)), Is.EqualTo("2.01948391736579e-28"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a40000000000000)), Is.EqualTo("4.03896783473158e-28"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a50000000000000)), Is.EqualTo("8.07793566946316e-28"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a60000000000000)), Is.EqualTo("1.61558713389263e-27"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a70000000000000)), Is.EqualTo("3.23117426778526e-27"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a80000000000000)), Is.EqualTo("6.46234853557053e-27"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a90000000000000)), Is.EqualTo("1.29246970711411e-26"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3aa0000000000000)), Is.EqualTo("2.58493941422821e-26"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ab0000000000000)), Is.EqualTo("5.16987882845642e-26"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ac0000000000000)), Is.EqualTo("1.03397576569128e-25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ad0000000000000)), Is.EqualTo("2.06795153138257e-25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ae0000000000000)), Is.EqualTo("4.13590306276514e-25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3af0000000000000)), Is.EqualTo("8.27180612553028e-25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b00000000000000)), Is.EqualTo("1.65436122510606e-24"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b10000000000000)), Is.EqualTo("3.30872245021211e-24"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b20000000000000)), Is.EqualTo("6.61744490042422e-24"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b30000000000000)), Is.EqualTo("1.32348898008484e-23"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b40000000000000)), Is.EqualTo("2.64697796016969e-23"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b50000000000000)), Is.EqualTo("5.29395592033938e-23"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b60000000000000)), Is.EqualTo("1.05879118406788e-22"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b70000000000000)), Is.EqualTo("2.11758236813575e-22"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b80000000000000)), Is.EqualTo("4.2351647362715e-22"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b90000000000000)), Is.EqualTo("8.470329472543e-22"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ba0000000000000)), Is.EqualTo("1.6940658945086e-21"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3bb0000000000000)), Is.EqualTo("3.3881317890172e-21"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3bc0000000000000)), Is.EqualTo("6.7762635780344e-21"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3bd0000000000000)), Is.EqualTo("1.35525271560688e-20"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3be0000000000000)), Is.EqualTo("2.71050543121376e-20"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3bf0000000000000)), Is.EqualTo("5.42101086242752e-20"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c00000000000000)), Is.EqualTo("1.0842021724855e-19"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c10000000000000)), Is.EqualTo("2.16840434497101e-19"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c20000000000000)), Is.EqualTo("4.33680868994202e-19"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c30000000000000)), Is.EqualTo("8.67361737988404e-19"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c40000000000000)), Is.EqualTo("1.73472347597681e-18"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c50000000000000)), Is.EqualTo("3.46944695195361e-18"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c60000000000000)), Is.EqualTo("6.93889390390723e-18"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c70000000000000)), Is.EqualTo("1.38777878078145e-17"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c80000000000000)), Is.EqualTo("2.77555756156289e-17"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c90000000000000)), Is.EqualTo("5.55111512312578e-17"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ca0000000000000)), Is.EqualTo("1.11022302462516e-16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3cb0000000000000)), Is.EqualTo("2.22044604925031e-16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3cc0000000000000)), Is.EqualTo("4.44089209850063e-16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3cd0000000000000)), Is.EqualTo("8.88178419700125e-16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ce0000000000000)), Is.EqualTo("1.77635683940025e-15"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3cf0000000000000)), Is.EqualTo("3.5527136788005e-15"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d00000000000000)), Is.EqualTo("7.105427357601e-15"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d10000000000000)), Is.EqualTo("1.4210854715202e-14"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d20000000000000)), Is.EqualTo("2.8421709430404e-14"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d30000000000000)), Is.EqualTo("5.6843418860808e-14"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d40000000000000)), Is.EqualTo("1.13686837721616e-13"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d50000000000000)), Is.EqualTo("2.27373675443232e-13"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d60000000000000)), Is.EqualTo("4.54747350886464e-13"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d70000000000000)), Is.EqualTo("9.09494701772928e-13"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d80000000000000)), Is.EqualTo("1.81898940354586e-12"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d90000000000000)), Is.EqualTo("3.63797880709171e-12"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3da0000000000000)), Is.EqualTo("7.27595761418343e-12"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3db0000000000000)), Is.EqualTo("1.45519152283669e-11"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3dc0000000000000)), Is.EqualTo("2.91038304567337e-11"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3dd0000000000000)), Is.EqualTo("5.82076609134674e-11"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3de0000000000000)), Is.EqualTo("1.16415321826935e-10"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3df0000000000000)), Is.EqualTo("2.3283064365387e-10"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e00000000000000)), Is.EqualTo("4.65661287307739e-10"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e10000000000000)), Is.EqualTo("9.31322574615479e-10"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e20000000000000)), Is.EqualTo("1.86264514923096e-09"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e30000000000000)), Is.EqualTo("3.72529029846191e-09"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e40000000000000)), Is.EqualTo("7.45058059692383e-09"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e50000000000000)), Is.EqualTo("1.49011611938477e-08"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e60000000000000)), Is.EqualTo("2.98023223876953e-08"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e70000000000000)), Is.EqualTo("5.96046447753906e-08"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e80000000000000)), Is.EqualTo("1.19209289550781e-07"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e90000000000000)), Is.EqualTo("2.38418579101563e-07"));   // GCC returns 2.38418579101562e-07
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ea0000000000000)), Is.EqualTo("4.76837158203125e-07"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3eb0000000000000)), Is.EqualTo("9.5367431640625e-07"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ec0000000000000)), Is.EqualTo("1.9073486328125e-06"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ed0000000000000)), Is.EqualTo("3.814697265625e-06"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ee0000000000000)), Is.EqualTo("7.62939453125e-06"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ef0000000000000)), Is.EqualTo("1.52587890625e-05"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f00000000000000)), Is.EqualTo("3.0517578125e-05"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f10000000000000)), Is.EqualTo("6.103515625e-05"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f20000000000000)), Is.EqualTo("0.0001220703125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f30000000000000)), Is.EqualTo("0.000244140625"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f40000000000000)), Is.EqualTo("0.00048828125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f50000000000000)), Is.EqualTo("0.0009765625"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f60000000000000)), Is.EqualTo("0.001953125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f70000000000000)), Is.EqualTo("0.00390625"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f80000000000000)), Is.EqualTo("0.0078125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f90000000000000)), Is.EqualTo("0.015625"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3fa0000000000000)), Is.EqualTo("0.03125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3fb0000000000000)), Is.EqualTo("0.0625"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3fc0000000000000)), Is.EqualTo("0.125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3fd0000000000000)), Is.EqualTo("0.25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3fe0000000000000)), Is.EqualTo("0.5"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ff0000000000000)), Is.EqualTo("1"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4000000000000000)), Is.EqualTo("2"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4010000000000000)), Is.EqualTo("4"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4020000000000000)), Is.EqualTo("8"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4030000000000000)), Is.EqualTo("16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4040000000000000)), Is.EqualTo("32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4050000000000000)), Is.EqualTo("64"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4060000000000000)), Is.EqualTo("128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4070000000000000)), Is.EqualTo("256"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4080000000000000)), Is.EqualTo("512"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4090000000000000)), Is.EqualTo("1024"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x40a0000000000000)), Is.EqualTo("2048"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x40b0000000000000)), Is.EqualTo("4096"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x40c0000000000000)), Is.EqualTo("8192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x40d0000000000000)), Is.EqualTo("16384"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x40e0000000000000)), Is.EqualTo("32768"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x40f0000000000000)), Is.EqualTo("65536"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4100000000000000)), Is.EqualTo("131072"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4110000000000000)), Is.EqualTo("262144"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4120000000000000)), Is.EqualTo("524288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4130000000000000)), Is.EqualTo("1048576"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4140000000000000)), Is.EqualTo("2097152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4150000000000000)), Is.EqualTo("4194304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4160000000000000)), Is.EqualTo("8388608"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4170000000000000)), Is.EqualTo("16777216"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4180000000000000)), Is.EqualTo("33554432"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4190000000000000)), Is.EqualTo("67108864"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x41a0000000000000)), Is.EqualTo("134217728"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x41b0000000000000)), Is.EqualTo("268435456"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x41c0000000000000)), Is.EqualTo("536870912"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x41d0000000000000)), Is.EqualTo("1073741824"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x41e0000000000000)), Is.EqualTo("2147483648"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x41f0000000000000)), Is.EqualTo("4294967296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4200000000000000)), Is.EqualTo("8589934592"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4210000000000000)), Is.EqualTo("17179869184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4220000000000000)), Is.EqualTo("34359738368"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4230000000000000)), Is.EqualTo("68719476736"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4240000000000000)), Is.EqualTo("137438953472"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4250000000000000)), Is.EqualTo("274877906944"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4260000000000000)), Is.EqualTo("549755813888"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4270000000000000)), Is.EqualTo("1099511627776"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4280000000000000)), Is.EqualTo("2199023255552"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4290000000000000)), Is.EqualTo("4398046511104"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x42a0000000000000)), Is.EqualTo("8796093022208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x42b0000000000000)), Is.EqualTo("17592186044416"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x42c0000000000000)), Is.EqualTo("35184372088832"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x42d0000000000000)), Is.EqualTo("70368744177664"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x42e0000000000000)), Is.EqualTo("140737488355328"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x42f0000000000000)), Is.EqualTo("281474976710656"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4300000000000000)), Is.EqualTo("562949953421312"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4310000000000000)), Is.EqualTo("1.12589990684262e+15"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4320000000000000)), Is.EqualTo("2.25179981368525e+15"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4330000000000000)), Is.EqualTo("4.5035996273705e+15"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4340000000000000)), Is.EqualTo("9.00719925474099e+15"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4350000000000000)), Is.EqualTo("1.8014398509482e+16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4360000000000000)), Is.EqualTo("3.6028797018964e+16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4370000000000000)), Is.EqualTo("7.20575940379279e+16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4380000000000000)), Is.EqualTo("1.44115188075856e+17"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4390000000000000)), Is.EqualTo("2.88230376151712e+17"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x43a0000000000000)), Is.EqualTo("5.76460752303423e+17"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x43b0000000000000)), Is.EqualTo("1.15292150460685e+18"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x43c0000000000000)), Is.EqualTo("2.30584300921369e+18"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x43d0000000000000)), Is.EqualTo("4.61168601842739e+18"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x43e0000000000000)), Is.EqualTo("9.22337203685478e+18"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x43f0000000000000)), Is.EqualTo("1.84467440737096e+19"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4400000000000000)), Is.EqualTo("3.68934881474191e+19"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4410000000000000)), Is.EqualTo("7.37869762948382e+19"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4420000000000000)), Is.EqualTo("1.47573952589676e+20"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4430000000000000)), Is.EqualTo("2.95147905179353e+20"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4440000000000000)), Is.EqualTo("5.90295810358706e+20"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4450000000000000)), Is.EqualTo("1.18059162071741e+21"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4460000000000000)), Is.EqualTo("2.36118324143482e+21"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4470000000000000)), Is.EqualTo("4.72236648286965e+21"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4480000000000000)), Is.EqualTo("9.44473296573929e+21"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4490000000000000)), Is.EqualTo("1.88894659314786e+22"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x44a0000000000000)), Is.EqualTo("3.77789318629572e+22"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x44b0000000000000)), Is.EqualTo("7.55578637259143e+22"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x44c0000000000000)), Is.EqualTo("1.51115727451829e+23"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x44d0000000000000)), Is.EqualTo("3.02231454903657e+23"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x44e0000000000000)), Is.EqualTo("6.04462909807315e+23"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x44f0000000000000)), Is.EqualTo("1.20892581961463e+24"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4500000000000000)), Is.EqualTo("2.41785163922926e+24"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4510000000000000)), Is.EqualTo("4.83570327845852e+24"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4520000000000000)), Is.EqualTo("9.67140655691703e+24"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4530000000000000)), Is.EqualTo("1.93428131138341e+25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4540000000000000)), Is.EqualTo("3.86856262276681e+25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4550000000000000)), Is.EqualTo("7.73712524553363e+25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4560000000000000)), Is.EqualTo("1.54742504910673e+26"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4570000000000000)), Is.EqualTo("3.09485009821345e+26"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4580000000000000)), Is.EqualTo("6.1897001964269e+26"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4590000000000000)), Is.EqualTo("1.23794003928538e+27"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x45a0000000000000)), Is.EqualTo("2.47588007857076e+27"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x45b0000000000000)), Is.EqualTo("4.95176015714152e+27"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x45c0000000000000)), Is.EqualTo("9.90352031428304e+27"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x45d0000000000000)), Is.EqualTo("1.98070406285661e+28"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x45e0000000000000)), Is.EqualTo("3.96140812571322e+28"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x45f0000000000000)), Is.EqualTo("7.92281625142643e+28"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4600000000000000)), Is.EqualTo("1.58456325028529e+29"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4610000000000000)), Is.EqualTo("3.16912650057057e+29"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4620000000000000)), Is.EqualTo("6.33825300114115e+29"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4630000000000000)), Is.EqualTo("1.26765060022823e+30"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4640000000000000)), Is.EqualTo("2.53530120045646e+30"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4650000000000000)), Is.EqualTo("5.07060240091292e+30"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4660000000000000)), Is.EqualTo("1.01412048018258e+31"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4670000000000000)), Is.EqualTo("2.02824096036517e+31"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4680000000000000)), Is.EqualTo("4.05648192073033e+31"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4690000000000000)), Is.EqualTo("8.11296384146067e+31"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x46a0000000000000)), Is.EqualTo("1.62259276829213e+32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x46b0000000000000)), Is.EqualTo("3.24518553658427e+32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x46c0000000000000)), Is.EqualTo("6.49037107316853e+32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x46d0000000000000)), Is.EqualTo("1.29807421463371e+33"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x46e0000000000000)), Is.EqualTo("2.59614842926741e+33"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x46f0000000000000)), Is.EqualTo("5.19229685853483e+33"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4700000000000000)), Is.EqualTo("1.03845937170697e+34"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4710000000000000)), Is.EqualTo("2.07691874341393e+34"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4720000000000000)), Is.EqualTo("4.15383748682786e+34"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4730000000000000)), Is.EqualTo("8.30767497365572e+34"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4740000000000000)), Is.EqualTo("1.66153499473114e+35"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4750000000000000)), Is.EqualTo("3.32306998946229e+35"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4760000000000000)), Is.EqualTo("6.64613997892458e+35"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4770000000000000)), Is.EqualTo("1.32922799578492e+36"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4780000000000000)), Is.EqualTo("2.65845599156983e+36"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4790000000000000)), Is.EqualTo("5.31691198313966e+36"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x47a0000000000000)), Is.EqualTo("1.06338239662793e+37"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x47b0000000000000)), Is.EqualTo("2.12676479325587e+37"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x47c0000000000000)), Is.EqualTo("4.25352958651173e+37"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x47d0000000000000)), Is.EqualTo("8.50705917302346e+37"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x47e0000000000000)), Is.EqualTo("1.70141183460469e+38"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x47f0000000000000)), Is.EqualTo("3.40282366920938e+38"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4800000000000000)), Is.EqualTo("6.80564733841877e+38"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4810000000000000)), Is.EqualTo("1.36112946768375e+39"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4820000000000000)), Is.EqualTo("2.72225893536751e+39"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4830000000000000)), Is.EqualTo("5.44451787073502e+39"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4840000000000000)), Is.EqualTo("1.088903574147e+40"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4850000000000000)), Is.EqualTo("2.17780714829401e+40"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4860000000000000)), Is.EqualTo("4.35561429658801e+40"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4870000000000000)), Is.EqualTo("8.71122859317602e+40"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4880000000000000)), Is.EqualTo("1.7422457186352e+41"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4890000000000000)), Is.EqualTo("3.48449143727041e+41"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x48a0000000000000)), Is.EqualTo("6.96898287454082e+41"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x48b0000000000000)), Is.EqualTo("1.39379657490816e+42"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x48c0000000000000)), Is.EqualTo("2.78759314981633e+42"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x48d0000000000000)), Is.EqualTo("5.57518629963266e+42"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x48e0000000000000)), Is.EqualTo("1.11503725992653e+43"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x48f0000000000000)), Is.EqualTo("2.23007451985306e+43"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4900000000000000)), Is.EqualTo("4.46014903970612e+43"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4910000000000000)), Is.EqualTo("8.92029807941225e+43"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4920000000000000)), Is.EqualTo("1.78405961588245e+44"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4930000000000000)), Is.EqualTo("3.5681192317649e+44"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4940000000000000)), Is.EqualTo("7.1362384635298e+44"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4950000000000000)), Is.EqualTo("1.42724769270596e+45"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4960000000000000)), Is.EqualTo("2.85449538541192e+45"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4970000000000000)), Is.EqualTo("5.70899077082384e+45"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4980000000000000)), Is.EqualTo("1.14179815416477e+46"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4990000000000000)), Is.EqualTo("2.28359630832954e+46"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x49a0000000000000)), Is.EqualTo("4.56719261665907e+46"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x49b0000000000000)), Is.EqualTo("9.13438523331814e+46"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x49c0000000000000)), Is.EqualTo("1.82687704666363e+47"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x49d0000000000000)), Is.EqualTo("3.65375409332726e+47"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x49e0000000000000)), Is.EqualTo("7.30750818665451e+47"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x49f0000000000000)), Is.EqualTo("1.4615016373309e+48"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a00000000000000)), Is.EqualTo("2.92300327466181e+48"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a10000000000000)), Is.EqualTo("5.84600654932361e+48"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a20000000000000)), Is.EqualTo("1.16920130986472e+49"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a30000000000000)), Is.EqualTo("2.33840261972944e+49"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a40000000000000)), Is.EqualTo("4.67680523945889e+49"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a50000000000000)), Is.EqualTo("9.35361047891778e+49"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a60000000000000)), Is.EqualTo("1.87072209578356e+50"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a70000000000000)), Is.EqualTo("3.74144419156711e+50"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a80000000000000)), Is.EqualTo("7.48288838313422e+50"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a90000000000000)), Is.EqualTo("1.49657767662684e+51"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4aa0000000000000)), Is.EqualTo("2.99315535325369e+51"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ab0000000000000)), Is.EqualTo("5.98631070650738e+51"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ac0000000000000)), Is.EqualTo("1.19726214130148e+52"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ad0000000000000)), Is.EqualTo("2.39452428260295e+52"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ae0000000000000)), Is.EqualTo("4.7890485652059e+52"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4af0000000000000)), Is.EqualTo("9.57809713041181e+52"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b00000000000000)), Is.EqualTo("1.91561942608236e+53"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b10000000000000)), Is.EqualTo("3.83123885216472e+53"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b20000000000000)), Is.EqualTo("7.66247770432944e+53"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b30000000000000)), Is.EqualTo("1.53249554086589e+54"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b40000000000000)), Is.EqualTo("3.06499108173178e+54"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b50000000000000)), Is.EqualTo("6.12998216346356e+54"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b60000000000000)), Is.EqualTo("1.22599643269271e+55"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b70000000000000)), Is.EqualTo("2.45199286538542e+55"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b80000000000000)), Is.EqualTo("4.90398573077084e+55"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b90000000000000)), Is.EqualTo("9.80797146154169e+55"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ba0000000000000)), Is.EqualTo("1.96159429230834e+56"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4bb0000000000000)), Is.EqualTo("3.92318858461668e+56"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4bc0000000000000)), Is.EqualTo("7.84637716923335e+56"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4bd0000000000000)), Is.EqualTo("1.56927543384667e+57"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4be0000000000000)), Is.EqualTo("3.13855086769334e+57"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4bf0000000000000)), Is.EqualTo("6.27710173538668e+57"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c00000000000000)), Is.EqualTo("1.25542034707734e+58"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c10000000000000)), Is.EqualTo("2.51084069415467e+58"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c20000000000000)), Is.EqualTo("5.02168138830934e+58"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c30000000000000)), Is.EqualTo("1.00433627766187e+59"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c40000000000000)), Is.EqualTo("2.00867255532374e+59"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c50000000000000)), Is.EqualTo("4.01734511064748e+59"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c60000000000000)), Is.EqualTo("8.03469022129495e+59"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c70000000000000)), Is.EqualTo("1.60693804425899e+60"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c80000000000000)), Is.EqualTo("3.21387608851798e+60"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c90000000000000)), Is.EqualTo("6.42775217703596e+60"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ca0000000000000)), Is.EqualTo("1.28555043540719e+61"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4cb0000000000000)), Is.EqualTo("2.57110087081438e+61"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4cc0000000000000)), Is.EqualTo("5.14220174162877e+61"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4cd0000000000000)), Is.EqualTo("1.02844034832575e+62"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ce0000000000000)), Is.EqualTo("2.05688069665151e+62"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4cf0000000000000)), Is.EqualTo("4.11376139330302e+62"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d00000000000000)), Is.EqualTo("8.22752278660603e+62"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d10000000000000)), Is.EqualTo("1.64550455732121e+63"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d20000000000000)), Is.EqualTo("3.29100911464241e+63"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d30000000000000)), Is.EqualTo("6.58201822928482e+63"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d40000000000000)), Is.EqualTo("1.31640364585696e+64"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d50000000000000)), Is.EqualTo("2.63280729171393e+64"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d60000000000000)), Is.EqualTo("5.26561458342786e+64"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d70000000000000)), Is.EqualTo("1.05312291668557e+65"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d80000000000000)), Is.EqualTo("2.10624583337114e+65"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d90000000000000)), Is.EqualTo("4.21249166674229e+65"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4da0000000000000)), Is.EqualTo("8.42498333348457e+65"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4db0000000000000)), Is.EqualTo("1.68499666669692e+66"));   // GCC returns 1.68499666669691e+66
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4dc0000000000000)), Is.EqualTo("3.36999333339383e+66"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4dd0000000000000)), Is.EqualTo("6.73998666678766e+66"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4de0000000000000)), Is.EqualTo("1.34799733335753e+67"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4df0000000000000)), Is.EqualTo("2.69599466671506e+67"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e00000000000000)), Is.EqualTo("5.39198933343013e+67"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e10000000000000)), Is.EqualTo("1.07839786668603e+68"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e20000000000000)), Is.EqualTo("2.15679573337205e+68"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e30000000000000)), Is.EqualTo("4.3135914667441e+68"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e40000000000000)), Is.EqualTo("8.6271829334882e+68"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e50000000000000)), Is.EqualTo("1.72543658669764e+69"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e60000000000000)), Is.EqualTo("3.45087317339528e+69"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e70000000000000)), Is.EqualTo("6.90174634679056e+69"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e80000000000000)), Is.EqualTo("1.38034926935811e+70"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e90000000000000)), Is.EqualTo("2.76069853871623e+70"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ea0000000000000)), Is.EqualTo("5.52139707743245e+70"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4eb0000000000000)), Is.EqualTo("1.10427941548649e+71"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ec0000000000000)), Is.EqualTo("2.20855883097298e+71"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ed0000000000000)), Is.EqualTo("4.41711766194596e+71"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ee0000000000000)), Is.EqualTo("8.83423532389192e+71"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ef0000000000000)), Is.EqualTo("1.76684706477838e+72"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f00000000000000)), Is.EqualTo("3.53369412955677e+72"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f10000000000000)), Is.EqualTo("7.06738825911354e+72"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f20000000000000)), Is.EqualTo("1.41347765182271e+73"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f30000000000000)), Is.EqualTo("2.82695530364541e+73"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f40000000000000)), Is.EqualTo("5.65391060729083e+73"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f50000000000000)), Is.EqualTo("1.13078212145817e+74"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f60000000000000)), Is.EqualTo("2.26156424291633e+74"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f70000000000000)), Is.EqualTo("4.52312848583266e+74"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f80000000000000)), Is.EqualTo("9.04625697166533e+74"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f90000000000000)), Is.EqualTo("1.80925139433307e+75"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4fa0000000000000)), Is.EqualTo("3.61850278866613e+75"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4fb0000000000000)), Is.EqualTo("7.23700557733226e+75"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4fc0000000000000)), Is.EqualTo("1.44740111546645e+76"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4fd0000000000000)), Is.EqualTo("2.8948022309329e+76"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4fe0000000000000)), Is.EqualTo("5.78960446186581e+76"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ff0000000000000)), Is.EqualTo("1.15792089237316e+77"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5000000000000000)), Is.EqualTo("2.31584178474632e+77"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5010000000000000)), Is.EqualTo("4.63168356949265e+77"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5020000000000000)), Is.EqualTo("9.2633671389853e+77"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5030000000000000)), Is.EqualTo("1.85267342779706e+78"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5040000000000000)), Is.EqualTo("3.70534685559412e+78"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5050000000000000)), Is.EqualTo("7.41069371118824e+78"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5060000000000000)), Is.EqualTo("1.48213874223765e+79"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5070000000000000)), Is.EqualTo("2.96427748447529e+79"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5080000000000000)), Is.EqualTo("5.92855496895059e+79"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5090000000000000)), Is.EqualTo("1.18571099379012e+80"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x50a0000000000000)), Is.EqualTo("2.37142198758024e+80"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x50b0000000000000)), Is.EqualTo("4.74284397516047e+80"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x50c0000000000000)), Is.EqualTo("9.48568795032094e+80"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x50d0000000000000)), Is.EqualTo("1.89713759006419e+81"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x50e0000000000000)), Is.EqualTo("3.79427518012838e+81"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x50f0000000000000)), Is.EqualTo("7.58855036025675e+81"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5100000000000000)), Is.EqualTo("1.51771007205135e+82"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5110000000000000)), Is.EqualTo("3.0354201441027e+82"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5120000000000000)), Is.EqualTo("6.0708402882054e+82"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5130000000000000)), Is.EqualTo("1.21416805764108e+83"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5140000000000000)), Is.EqualTo("2.42833611528216e+83"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5150000000000000)), Is.EqualTo("4.85667223056432e+83"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5160000000000000)), Is.EqualTo("9.71334446112865e+83"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5170000000000000)), Is.EqualTo("1.94266889222573e+84"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5180000000000000)), Is.EqualTo("3.88533778445146e+84"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5190000000000000)), Is.EqualTo("7.77067556890292e+84"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x51a0000000000000)), Is.EqualTo("1.55413511378058e+85"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x51b0000000000000)), Is.EqualTo("3.10827022756117e+85"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x51c0000000000000)), Is.EqualTo("6.21654045512233e+85"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x51d0000000000000)), Is.EqualTo("1.24330809102447e+86"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x51e0000000000000)), Is.EqualTo("2.48661618204893e+86"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x51f0000000000000)), Is.EqualTo("4.97323236409787e+86"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5200000000000000)), Is.EqualTo("9.94646472819573e+86"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5210000000000000)), Is.EqualTo("1.98929294563915e+87"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5220000000000000)), Is.EqualTo("3.97858589127829e+87"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5230000000000000)), Is.EqualTo("7.95717178255659e+87"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5240000000000000)), Is.EqualTo("1.59143435651132e+88"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5250000000000000)), Is.EqualTo("3.18286871302263e+88"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5260000000000000)), Is.EqualTo("6.36573742604527e+88"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5270000000000000)), Is.EqualTo("1.27314748520905e+89"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5280000000000000)), Is.EqualTo("2.54629497041811e+89"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5290000000000000)), Is.EqualTo("5.09258994083622e+89"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x52a0000000000000)), Is.EqualTo("1.01851798816724e+90"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x52b0000000000000)), Is.EqualTo("2.03703597633449e+90"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x52c0000000000000)), Is.EqualTo("4.07407195266897e+90"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x52d0000000000000)), Is.EqualTo("8.14814390533794e+90"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x52e0000000000000)), Is.EqualTo("1.62962878106759e+91"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x52f0000000000000)), Is.EqualTo("3.25925756213518e+91"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5300000000000000)), Is.EqualTo("6.51851512427036e+91"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5310000000000000)), Is.EqualTo("1.30370302485407e+92"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5320000000000000)), Is.EqualTo("2.60740604970814e+92"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5330000000000000)), Is.EqualTo("5.21481209941628e+92"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5340000000000000)), Is.EqualTo("1.04296241988326e+93"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5350000000000000)), Is.EqualTo("2.08592483976651e+93"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5360000000000000)), Is.EqualTo("4.17184967953303e+93"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5370000000000000)), Is.EqualTo("8.34369935906606e+93"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5380000000000000)), Is.EqualTo("1.66873987181321e+94"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5390000000000000)), Is.EqualTo("3.33747974362642e+94"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x53a0000000000000)), Is.EqualTo("6.67495948725284e+94"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x53b0000000000000)), Is.EqualTo("1.33499189745057e+95"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x53c0000000000000)), Is.EqualTo("2.66998379490114e+95"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x53d0000000000000)), Is.EqualTo("5.33996758980228e+95"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x53e0000000000000)), Is.EqualTo("1.06799351796046e+96"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x53f0000000000000)), Is.EqualTo("2.13598703592091e+96"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5400000000000000)), Is.EqualTo("4.27197407184182e+96"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5410000000000000)), Is.EqualTo("8.54394814368364e+96"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5420000000000000)), Is.EqualTo("1.70878962873673e+97"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5430000000000000)), Is.EqualTo("3.41757925747346e+97"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5440000000000000)), Is.EqualTo("6.83515851494691e+97"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5450000000000000)), Is.EqualTo("1.36703170298938e+98"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5460000000000000)), Is.EqualTo("2.73406340597876e+98"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5470000000000000)), Is.EqualTo("5.46812681195753e+98"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5480000000000000)), Is.EqualTo("1.09362536239151e+99"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5490000000000000)), Is.EqualTo("2.18725072478301e+99"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x54a0000000000000)), Is.EqualTo("4.37450144956602e+99"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x54b0000000000000)), Is.EqualTo("8.74900289913205e+99"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x54c0000000000000)), Is.EqualTo("1.74980057982641e+100"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x54d0000000000000)), Is.EqualTo("3.49960115965282e+100"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x54e0000000000000)), Is.EqualTo("6.99920231930564e+100"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x54f0000000000000)), Is.EqualTo("1.39984046386113e+101"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5500000000000000)), Is.EqualTo("2.79968092772226e+101"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5510000000000000)), Is.EqualTo("5.59936185544451e+101"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5520000000000000)), Is.EqualTo("1.1198723710889e+102"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5530000000000000)), Is.EqualTo("2.2397447421778e+102"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5540000000000000)), Is.EqualTo("4.47948948435561e+102"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5550000000000000)), Is.EqualTo("8.95897896871122e+102"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5560000000000000)), Is.EqualTo("1.79179579374224e+103"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5570000000000000)), Is.EqualTo("3.58359158748449e+103"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5580000000000000)), Is.EqualTo("7.16718317496897e+103"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5590000000000000)), Is.EqualTo("1.43343663499379e+104"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x55a0000000000000)), Is.EqualTo("2.86687326998759e+104"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x55b0000000000000)), Is.EqualTo("5.73374653997518e+104"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x55c0000000000000)), Is.EqualTo("1.14674930799504e+105"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x55d0000000000000)), Is.EqualTo("2.29349861599007e+105"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x55e0000000000000)), Is.EqualTo("4.58699723198014e+105"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x55f0000000000000)), Is.EqualTo("9.17399446396029e+105"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5600000000000000)), Is.EqualTo("1.83479889279206e+106"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5610000000000000)), Is.EqualTo("3.66959778558411e+106"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5620000000000000)), Is.EqualTo("7.33919557116823e+106"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5630000000000000)), Is.EqualTo("1.46783911423365e+107"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5640000000000000)), Is.EqualTo("2.93567822846729e+107"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5650000000000000)), Is.EqualTo("5.87135645693458e+107"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5660000000000000)), Is.EqualTo("1.17427129138692e+108"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5670000000000000)), Is.EqualTo("2.34854258277383e+108"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5680000000000000)), Is.EqualTo("4.69708516554767e+108"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5690000000000000)), Is.EqualTo("9.39417033109533e+108"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x56a0000000000000)), Is.EqualTo("1.87883406621907e+109"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x56b0000000000000)), Is.EqualTo("3.75766813243813e+109"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x56c0000000000000)), Is.EqualTo("7.51533626487627e+109"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x56d0000000000000)), Is.EqualTo("1.50306725297525e+110"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x56e0000000000000)), Is.EqualTo("3.00613450595051e+110"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x56f0000000000000)), Is.EqualTo("6.01226901190101e+110"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5700000000000000)), Is.EqualTo("1.2024538023802e+111"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5710000000000000)), Is.EqualTo("2.40490760476041e+111"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5720000000000000)), Is.EqualTo("4.80981520952081e+111"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5730000000000000)), Is.EqualTo("9.61963041904162e+111"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5740000000000000)), Is.EqualTo("1.92392608380832e+112"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5750000000000000)), Is.EqualTo("3.84785216761665e+112"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5760000000000000)), Is.EqualTo("7.6957043352333e+112"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5770000000000000)), Is.EqualTo("1.53914086704666e+113"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5780000000000000)), Is.EqualTo("3.07828173409332e+113"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5790000000000000)), Is.EqualTo("6.15656346818664e+113"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x57a0000000000000)), Is.EqualTo("1.23131269363733e+114"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x57b0000000000000)), Is.EqualTo("2.46262538727466e+114"));  // GCC returns 2.46262538727465e+114
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x57c0000000000000)), Is.EqualTo("4.92525077454931e+114"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x57d0000000000000)), Is.EqualTo("9.85050154909862e+114"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x57e0000000000000)), Is.EqualTo("1.97010030981972e+115"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x57f0000000000000)), Is.EqualTo("3.94020061963945e+115"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5800000000000000)), Is.EqualTo("7.8804012392789e+115"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5810000000000000)), Is.EqualTo("1.57608024785578e+116"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5820000000000000)), Is.EqualTo("3.15216049571156e+116"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5830000000000000)), Is.EqualTo("6.30432099142312e+116"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5840000000000000)), Is.EqualTo("1.26086419828462e+117"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5850000000000000)), Is.EqualTo("2.52172839656925e+117"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5860000000000000)), Is.EqualTo("5.04345679313849e+117"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5870000000000000)), Is.EqualTo("1.0086913586277e+118"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5880000000000000)), Is.EqualTo("2.0173827172554e+118"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5890000000000000)), Is.EqualTo("4.03476543451079e+118"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x58a0000000000000)), Is.EqualTo("8.06953086902159e+118"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x58b0000000000000)), Is.EqualTo("1.61390617380432e+119"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x58c0000000000000)), Is.EqualTo("3.22781234760864e+119"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x58d0000000000000)), Is.EqualTo("6.45562469521727e+119"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x58e0000000000000)), Is.EqualTo("1.29112493904345e+120"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x58f0000000000000)), Is.EqualTo("2.58224987808691e+120"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5900000000000000)), Is.EqualTo("5.16449975617382e+120"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5910000000000000)), Is.EqualTo("1.03289995123476e+121"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5920000000000000)), Is.EqualTo("2.06579990246953e+121"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5930000000000000)), Is.EqualTo("4.13159980493905e+121"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5940000000000000)), Is.EqualTo("8.26319960987811e+121"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5950000000000000)), Is.EqualTo("1.65263992197562e+122"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5960000000000000)), Is.EqualTo("3.30527984395124e+122"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5970000000000000)), Is.EqualTo("6.61055968790249e+122"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5980000000000000)), Is.EqualTo("1.3221119375805e+123"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5990000000000000)), Is.EqualTo("2.64422387516099e+123"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x59a0000000000000)), Is.EqualTo("5.28844775032199e+123"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x59b0000000000000)), Is.EqualTo("1.0576895500644e+124"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x59c0000000000000)), Is.EqualTo("2.1153791001288e+124"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x59d0000000000000)), Is.EqualTo("4.23075820025759e+124"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x59e0000000000000)), Is.EqualTo("8.46151640051518e+124"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x59f0000000000000)), Is.EqualTo("1.69230328010304e+125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a00000000000000)), Is.EqualTo("3.38460656020607e+125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a10000000000000)), Is.EqualTo("6.76921312041215e+125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a20000000000000)), Is.EqualTo("1.35384262408243e+126"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a30000000000000)), Is.EqualTo("2.70768524816486e+126"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a40000000000000)), Is.EqualTo("5.41537049632972e+126"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a50000000000000)), Is.EqualTo("1.08307409926594e+127"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a60000000000000)), Is.EqualTo("2.16614819853189e+127"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a70000000000000)), Is.EqualTo("4.33229639706377e+127"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a80000000000000)), Is.EqualTo("8.66459279412755e+127"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a90000000000000)), Is.EqualTo("1.73291855882551e+128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5aa0000000000000)), Is.EqualTo("3.46583711765102e+128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ab0000000000000)), Is.EqualTo("6.93167423530204e+128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ac0000000000000)), Is.EqualTo("1.38633484706041e+129"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ad0000000000000)), Is.EqualTo("2.77266969412081e+129"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ae0000000000000)), Is.EqualTo("5.54533938824163e+129"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5af0000000000000)), Is.EqualTo("1.10906787764833e+130"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b00000000000000)), Is.EqualTo("2.21813575529665e+130"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b10000000000000)), Is.EqualTo("4.4362715105933e+130"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b20000000000000)), Is.EqualTo("8.87254302118661e+130"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b30000000000000)), Is.EqualTo("1.77450860423732e+131"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b40000000000000)), Is.EqualTo("3.54901720847464e+131"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b50000000000000)), Is.EqualTo("7.09803441694929e+131"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b60000000000000)), Is.EqualTo("1.41960688338986e+132"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b70000000000000)), Is.EqualTo("2.83921376677971e+132"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b80000000000000)), Is.EqualTo("5.67842753355943e+132"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b90000000000000)), Is.EqualTo("1.13568550671189e+133"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ba0000000000000)), Is.EqualTo("2.27137101342377e+133"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5bb0000000000000)), Is.EqualTo("4.54274202684754e+133"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5bc0000000000000)), Is.EqualTo("9.08548405369509e+133"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5bd0000000000000)), Is.EqualTo("1.81709681073902e+134"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5be0000000000000)), Is.EqualTo("3.63419362147803e+134"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5bf0000000000000)), Is.EqualTo("7.26838724295607e+134"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c00000000000000)), Is.EqualTo("1.45367744859121e+135"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c10000000000000)), Is.EqualTo("2.90735489718243e+135"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c20000000000000)), Is.EqualTo("5.81470979436486e+135"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c30000000000000)), Is.EqualTo("1.16294195887297e+136"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c40000000000000)), Is.EqualTo("2.32588391774594e+136"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c50000000000000)), Is.EqualTo("4.65176783549188e+136"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c60000000000000)), Is.EqualTo("9.30353567098377e+136"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c70000000000000)), Is.EqualTo("1.86070713419675e+137"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c80000000000000)), Is.EqualTo("3.72141426839351e+137"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c90000000000000)), Is.EqualTo("7.44282853678701e+137"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ca0000000000000)), Is.EqualTo("1.4885657073574e+138"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5cb0000000000000)), Is.EqualTo("2.97713141471481e+138"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5cc0000000000000)), Is.EqualTo("5.95426282942961e+138"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5cd0000000000000)), Is.EqualTo("1.19085256588592e+139"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ce0000000000000)), Is.EqualTo("2.38170513177184e+139"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5cf0000000000000)), Is.EqualTo("4.76341026354369e+139"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d00000000000000)), Is.EqualTo("9.52682052708738e+139"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d10000000000000)), Is.EqualTo("1.90536410541748e+140"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d20000000000000)), Is.EqualTo("3.81072821083495e+140"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d30000000000000)), Is.EqualTo("7.6214564216699e+140"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d40000000000000)), Is.EqualTo("1.52429128433398e+141"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d50000000000000)), Is.EqualTo("3.04858256866796e+141"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d60000000000000)), Is.EqualTo("6.09716513733592e+141"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d70000000000000)), Is.EqualTo("1.21943302746718e+142"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d80000000000000)), Is.EqualTo("2.43886605493437e+142"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d90000000000000)), Is.EqualTo("4.87773210986874e+142"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5da0000000000000)), Is.EqualTo("9.75546421973748e+142"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5db0000000000000)), Is.EqualTo("1.9510928439475e+143"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5dc0000000000000)), Is.EqualTo("3.90218568789499e+143"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5dd0000000000000)), Is.EqualTo("7.80437137578998e+143"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5de0000000000000)), Is.EqualTo("1.560874275158e+144"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5df0000000000000)), Is.EqualTo("3.12174855031599e+144"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e00000000000000)), Is.EqualTo("6.24349710063198e+144"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e10000000000000)), Is.EqualTo("1.2486994201264e+145"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e20000000000000)), Is.EqualTo("2.49739884025279e+145"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e30000000000000)), Is.EqualTo("4.99479768050559e+145"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e40000000000000)), Is.EqualTo("9.98959536101118e+145"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e50000000000000)), Is.EqualTo("1.99791907220224e+146"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e60000000000000)), Is.EqualTo("3.99583814440447e+146"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e70000000000000)), Is.EqualTo("7.99167628880894e+146"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e80000000000000)), Is.EqualTo("1.59833525776179e+147"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e90000000000000)), Is.EqualTo("3.19667051552358e+147"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ea0000000000000)), Is.EqualTo("6.39334103104715e+147"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5eb0000000000000)), Is.EqualTo("1.27866820620943e+148"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ec0000000000000)), Is.EqualTo("2.55733641241886e+148"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ed0000000000000)), Is.EqualTo("5.11467282483772e+148"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ee0000000000000)), Is.EqualTo("1.02293456496754e+149"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ef0000000000000)), Is.EqualTo("2.04586912993509e+149"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f00000000000000)), Is.EqualTo("4.09173825987018e+149"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f10000000000000)), Is.EqualTo("8.18347651974035e+149"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f20000000000000)), Is.EqualTo("1.63669530394807e+150"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f30000000000000)), Is.EqualTo("3.27339060789614e+150"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f40000000000000)), Is.EqualTo("6.54678121579228e+150"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f50000000000000)), Is.EqualTo("1.30935624315846e+151"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f60000000000000)), Is.EqualTo("2.61871248631691e+151"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f70000000000000)), Is.EqualTo("5.23742497263383e+151"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f80000000000000)), Is.EqualTo("1.04748499452677e+152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f90000000000000)), Is.EqualTo("2.09496998905353e+152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5fa0000000000000)), Is.EqualTo("4.18993997810706e+152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5fb0000000000000)), Is.EqualTo("8.37987995621412e+152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5fc0000000000000)), Is.EqualTo("1.67597599124282e+153"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5fd0000000000000)), Is.EqualTo("3.35195198248565e+153"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5fe0000000000000)), Is.EqualTo("6.7039039649713e+153"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ff0000000000000)), Is.EqualTo("1.34078079299426e+154"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6000000000000000)), Is.EqualTo("2.68156158598852e+154"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6010000000000000)), Is.EqualTo("5.36312317197704e+154"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6020000000000000)), Is.EqualTo("1.07262463439541e+155"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6030000000000000)), Is.EqualTo("2.14524926879082e+155"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6040000000000000)), Is.EqualTo("4.29049853758163e+155"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6050000000000000)), Is.EqualTo("8.58099707516326e+155"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6060000000000000)), Is.EqualTo("1.71619941503265e+156"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6070000000000000)), Is.EqualTo("3.4323988300653e+156"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6080000000000000)), Is.EqualTo("6.86479766013061e+156"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6090000000000000)), Is.EqualTo("1.37295953202612e+157"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x60a0000000000000)), Is.EqualTo("2.74591906405224e+157"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x60b0000000000000)), Is.EqualTo("5.49183812810449e+157"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x60c0000000000000)), Is.EqualTo("1.0983676256209e+158"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x60d0000000000000)), Is.EqualTo("2.1967352512418e+158"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x60e0000000000000)), Is.EqualTo("4.39347050248359e+158"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x60f0000000000000)), Is.EqualTo("8.78694100496718e+158"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6100000000000000)), Is.EqualTo("1.75738820099344e+159"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6110000000000000)), Is.EqualTo("3.51477640198687e+159"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6120000000000000)), Is.EqualTo("7.02955280397374e+159"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6130000000000000)), Is.EqualTo("1.40591056079475e+160"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6140000000000000)), Is.EqualTo("2.8118211215895e+160"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6150000000000000)), Is.EqualTo("5.623642243179e+160"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6160000000000000)), Is.EqualTo("1.1247284486358e+161"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6170000000000000)), Is.EqualTo("2.2494568972716e+161"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6180000000000000)), Is.EqualTo("4.4989137945432e+161"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6190000000000000)), Is.EqualTo("8.99782758908639e+161"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x61a0000000000000)), Is.EqualTo("1.79956551781728e+162"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x61b0000000000000)), Is.EqualTo("3.59913103563456e+162"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x61c0000000000000)), Is.EqualTo("7.19826207126911e+162"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x61d0000000000000)), Is.EqualTo("1.43965241425382e+163"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x61e0000000000000)), Is.EqualTo("2.87930482850765e+163"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x61f0000000000000)), Is.EqualTo("5.75860965701529e+163"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6200000000000000)), Is.EqualTo("1.15172193140306e+164"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6210000000000000)), Is.EqualTo("2.30344386280612e+164"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6220000000000000)), Is.EqualTo("4.60688772561223e+164"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6230000000000000)), Is.EqualTo("9.21377545122447e+164"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6240000000000000)), Is.EqualTo("1.84275509024489e+165"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6250000000000000)), Is.EqualTo("3.68551018048979e+165"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6260000000000000)), Is.EqualTo("7.37102036097957e+165"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6270000000000000)), Is.EqualTo("1.47420407219591e+166"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6280000000000000)), Is.EqualTo("2.94840814439183e+166"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6290000000000000)), Is.EqualTo("5.89681628878366e+166"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x62a0000000000000)), Is.EqualTo("1.17936325775673e+167"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x62b0000000000000)), Is.EqualTo("2.35872651551346e+167"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x62c0000000000000)), Is.EqualTo("4.71745303102693e+167"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x62d0000000000000)), Is.EqualTo("9.43490606205385e+167"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x62e0000000000000)), Is.EqualTo("1.88698121241077e+168"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x62f0000000000000)), Is.EqualTo("3.77396242482154e+168"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6300000000000000)), Is.EqualTo("7.54792484964308e+168"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6310000000000000)), Is.EqualTo("1.50958496992862e+169"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6320000000000000)), Is.EqualTo("3.01916993985723e+169"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6330000000000000)), Is.EqualTo("6.03833987971447e+169"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6340000000000000)), Is.EqualTo("1.20766797594289e+170"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6350000000000000)), Is.EqualTo("2.41533595188579e+170"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6360000000000000)), Is.EqualTo("4.83067190377157e+170"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6370000000000000)), Is.EqualTo("9.66134380754315e+170"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6380000000000000)), Is.EqualTo("1.93226876150863e+171"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6390000000000000)), Is.EqualTo("3.86453752301726e+171"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x63a0000000000000)), Is.EqualTo("7.72907504603452e+171"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x63b0000000000000)), Is.EqualTo("1.5458150092069e+172"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x63c0000000000000)), Is.EqualTo("3.09163001841381e+172"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x63d0000000000000)), Is.EqualTo("6.18326003682761e+172"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x63e0000000000000)), Is.EqualTo("1.23665200736552e+173"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x63f0000000000000)), Is.EqualTo("2.47330401473105e+173"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6400000000000000)), Is.EqualTo("4.94660802946209e+173"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6410000000000000)), Is.EqualTo("9.89321605892418e+173"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6420000000000000)), Is.EqualTo("1.97864321178484e+174"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6430000000000000)), Is.EqualTo("3.95728642356967e+174"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6440000000000000)), Is.EqualTo("7.91457284713935e+174"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6450000000000000)), Is.EqualTo("1.58291456942787e+175"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6460000000000000)), Is.EqualTo("3.16582913885574e+175"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6470000000000000)), Is.EqualTo("6.33165827771148e+175"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6480000000000000)), Is.EqualTo("1.2663316555423e+176"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6490000000000000)), Is.EqualTo("2.53266331108459e+176"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x64a0000000000000)), Is.EqualTo("5.06532662216918e+176"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x64b0000000000000)), Is.EqualTo("1.01306532443384e+177"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x64c0000000000000)), Is.EqualTo("2.02613064886767e+177"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x64d0000000000000)), Is.EqualTo("4.05226129773534e+177"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x64e0000000000000)), Is.EqualTo("8.10452259547069e+177"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x64f0000000000000)), Is.EqualTo("1.62090451909414e+178"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6500000000000000)), Is.EqualTo("3.24180903818828e+178"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6510000000000000)), Is.EqualTo("6.48361807637655e+178"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6520000000000000)), Is.EqualTo("1.29672361527531e+179"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6530000000000000)), Is.EqualTo("2.59344723055062e+179"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6540000000000000)), Is.EqualTo("5.18689446110124e+179"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6550000000000000)), Is.EqualTo("1.03737889222025e+180"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6560000000000000)), Is.EqualTo("2.0747577844405e+180"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6570000000000000)), Is.EqualTo("4.14951556888099e+180"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6580000000000000)), Is.EqualTo("8.29903113776199e+180"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6590000000000000)), Is.EqualTo("1.6598062275524e+181"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x65a0000000000000)), Is.EqualTo("3.31961245510479e+181"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x65b0000000000000)), Is.EqualTo("6.63922491020959e+181"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x65c0000000000000)), Is.EqualTo("1.32784498204192e+182"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x65d0000000000000)), Is.EqualTo("2.65568996408384e+182"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x65e0000000000000)), Is.EqualTo("5.31137992816767e+182"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x65f0000000000000)), Is.EqualTo("1.06227598563353e+183"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6600000000000000)), Is.EqualTo("2.12455197126707e+183"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6610000000000000)), Is.EqualTo("4.24910394253414e+183"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6620000000000000)), Is.EqualTo("8.49820788506827e+183"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6630000000000000)), Is.EqualTo("1.69964157701365e+184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6640000000000000)), Is.EqualTo("3.39928315402731e+184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6650000000000000)), Is.EqualTo("6.79856630805462e+184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6660000000000000)), Is.EqualTo("1.35971326161092e+185"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6670000000000000)), Is.EqualTo("2.71942652322185e+185"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6680000000000000)), Is.EqualTo("5.4388530464437e+185"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6690000000000000)), Is.EqualTo("1.08777060928874e+186"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x66a0000000000000)), Is.EqualTo("2.17554121857748e+186"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x66b0000000000000)), Is.EqualTo("4.35108243715496e+186"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x66c0000000000000)), Is.EqualTo("8.70216487430991e+186"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x66d0000000000000)), Is.EqualTo("1.74043297486198e+187"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x66e0000000000000)), Is.EqualTo("3.48086594972396e+187"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x66f0000000000000)), Is.EqualTo("6.96173189944793e+187"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6700000000000000)), Is.EqualTo("1.39234637988959e+188"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6710000000000000)), Is.EqualTo("2.78469275977917e+188"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6720000000000000)), Is.EqualTo("5.56938551955834e+188"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6730000000000000)), Is.EqualTo("1.11387710391167e+189"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6740000000000000)), Is.EqualTo("2.22775420782334e+189"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6750000000000000)), Is.EqualTo("4.45550841564668e+189"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6760000000000000)), Is.EqualTo("8.91101683129335e+189"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6770000000000000)), Is.EqualTo("1.78220336625867e+190"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6780000000000000)), Is.EqualTo("3.56440673251734e+190"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6790000000000000)), Is.EqualTo("7.12881346503468e+190"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x67a0000000000000)), Is.EqualTo("1.42576269300694e+191"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x67b0000000000000)), Is.EqualTo("2.85152538601387e+191"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x67c0000000000000)), Is.EqualTo("5.70305077202774e+191"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x67d0000000000000)), Is.EqualTo("1.14061015440555e+192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x67e0000000000000)), Is.EqualTo("2.2812203088111e+192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x67f0000000000000)), Is.EqualTo("4.5624406176222e+192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6800000000000000)), Is.EqualTo("9.12488123524439e+192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6810000000000000)), Is.EqualTo("1.82497624704888e+193"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6820000000000000)), Is.EqualTo("3.64995249409776e+193"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6830000000000000)), Is.EqualTo("7.29990498819551e+193"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6840000000000000)), Is.EqualTo("1.4599809976391e+194"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6850000000000000)), Is.EqualTo("2.9199619952782e+194"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6860000000000000)), Is.EqualTo("5.83992399055641e+194"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6870000000000000)), Is.EqualTo("1.16798479811128e+195"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6880000000000000)), Is.EqualTo("2.33596959622256e+195"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6890000000000000)), Is.EqualTo("4.67193919244513e+195"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x68a0000000000000)), Is.EqualTo("9.34387838489026e+195"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x68b0000000000000)), Is.EqualTo("1.86877567697805e+196"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x68c0000000000000)), Is.EqualTo("3.7375513539561e+196"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x68d0000000000000)), Is.EqualTo("7.4751027079122e+196"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x68e0000000000000)), Is.EqualTo("1.49502054158244e+197"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x68f0000000000000)), Is.EqualTo("2.99004108316488e+197"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6900000000000000)), Is.EqualTo("5.98008216632976e+197"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6910000000000000)), Is.EqualTo("1.19601643326595e+198"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6920000000000000)), Is.EqualTo("2.39203286653191e+198"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6930000000000000)), Is.EqualTo("4.78406573306381e+198"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6940000000000000)), Is.EqualTo("9.56813146612762e+198"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6950000000000000)), Is.EqualTo("1.91362629322552e+199"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6960000000000000)), Is.EqualTo("3.82725258645105e+199"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6970000000000000)), Is.EqualTo("7.6545051729021e+199"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6980000000000000)), Is.EqualTo("1.53090103458042e+200"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6990000000000000)), Is.EqualTo("3.06180206916084e+200"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x69a0000000000000)), Is.EqualTo("6.12360413832168e+200"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x69b0000000000000)), Is.EqualTo("1.22472082766434e+201"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x69c0000000000000)), Is.EqualTo("2.44944165532867e+201"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x69d0000000000000)), Is.EqualTo("4.89888331065734e+201"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x69e0000000000000)), Is.EqualTo("9.79776662131468e+201"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x69f0000000000000)), Is.EqualTo("1.95955332426294e+202"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a00000000000000)), Is.EqualTo("3.91910664852587e+202"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a10000000000000)), Is.EqualTo("7.83821329705175e+202"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a20000000000000)), Is.EqualTo("1.56764265941035e+203"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a30000000000000)), Is.EqualTo("3.1352853188207e+203"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a40000000000000)), Is.EqualTo("6.2705706376414e+203"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a50000000000000)), Is.EqualTo("1.25411412752828e+204"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a60000000000000)), Is.EqualTo("2.50822825505656e+204"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a70000000000000)), Is.EqualTo("5.01645651011312e+204"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a80000000000000)), Is.EqualTo("1.00329130202262e+205"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a90000000000000)), Is.EqualTo("2.00658260404525e+205"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6aa0000000000000)), Is.EqualTo("4.01316520809049e+205"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ab0000000000000)), Is.EqualTo("8.02633041618099e+205"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ac0000000000000)), Is.EqualTo("1.6052660832362e+206"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ad0000000000000)), Is.EqualTo("3.2105321664724e+206"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ae0000000000000)), Is.EqualTo("6.42106433294479e+206"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6af0000000000000)), Is.EqualTo("1.28421286658896e+207"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b00000000000000)), Is.EqualTo("2.56842573317792e+207"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b10000000000000)), Is.EqualTo("5.13685146635583e+207"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b20000000000000)), Is.EqualTo("1.02737029327117e+208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b30000000000000)), Is.EqualTo("2.05474058654233e+208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b40000000000000)), Is.EqualTo("4.10948117308467e+208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b50000000000000)), Is.EqualTo("8.21896234616933e+208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b60000000000000)), Is.EqualTo("1.64379246923387e+209"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b70000000000000)), Is.EqualTo("3.28758493846773e+209"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b80000000000000)), Is.EqualTo("6.57516987693547e+209"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b90000000000000)), Is.EqualTo("1.31503397538709e+210"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ba0000000000000)), Is.EqualTo("2.63006795077419e+210"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6bb0000000000000)), Is.EqualTo("5.26013590154837e+210"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6bc0000000000000)), Is.EqualTo("1.05202718030967e+211"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6bd0000000000000)), Is.EqualTo("2.10405436061935e+211"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6be0000000000000)), Is.EqualTo("4.2081087212387e+211"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6bf0000000000000)), Is.EqualTo("8.4162174424774e+211"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c00000000000000)), Is.EqualTo("1.68324348849548e+212"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c10000000000000)), Is.EqualTo("3.36648697699096e+212"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c20000000000000)), Is.EqualTo("6.73297395398192e+212"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c30000000000000)), Is.EqualTo("1.34659479079638e+213"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c40000000000000)), Is.EqualTo("2.69318958159277e+213"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c50000000000000)), Is.EqualTo("5.38637916318553e+213"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c60000000000000)), Is.EqualTo("1.07727583263711e+214"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c70000000000000)), Is.EqualTo("2.15455166527421e+214"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c80000000000000)), Is.EqualTo("4.30910333054843e+214"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c90000000000000)), Is.EqualTo("8.61820666109686e+214"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ca0000000000000)), Is.EqualTo("1.72364133221937e+215"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6cb0000000000000)), Is.EqualTo("3.44728266443874e+215"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6cc0000000000000)), Is.EqualTo("6.89456532887748e+215"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6cd0000000000000)), Is.EqualTo("1.3789130657755e+216"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ce0000000000000)), Is.EqualTo("2.75782613155099e+216"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6cf0000000000000)), Is.EqualTo("5.51565226310199e+216"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d00000000000000)), Is.EqualTo("1.1031304526204e+217"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d10000000000000)), Is.EqualTo("2.20626090524079e+217"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d20000000000000)), Is.EqualTo("4.41252181048159e+217"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d30000000000000)), Is.EqualTo("8.82504362096318e+217"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d40000000000000)), Is.EqualTo("1.76500872419264e+218"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d50000000000000)), Is.EqualTo("3.53001744838527e+218"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d60000000000000)), Is.EqualTo("7.06003489677054e+218"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d70000000000000)), Is.EqualTo("1.41200697935411e+219"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d80000000000000)), Is.EqualTo("2.82401395870822e+219"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d90000000000000)), Is.EqualTo("5.64802791741644e+219"));  // GCC returns 5.64802791741643e+219
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6da0000000000000)), Is.EqualTo("1.12960558348329e+220"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6db0000000000000)), Is.EqualTo("2.25921116696657e+220"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6dc0000000000000)), Is.EqualTo("4.51842233393315e+220"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6dd0000000000000)), Is.EqualTo("9.0368446678663e+220"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6de0000000000000)), Is.EqualTo("1.80736893357326e+221"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6df0000000000000)), Is.EqualTo("3.61473786714652e+221"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e00000000000000)), Is.EqualTo("7.22947573429304e+221"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e10000000000000)), Is.EqualTo("1.44589514685861e+222"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e20000000000000)), Is.EqualTo("2.89179029371721e+222"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e30000000000000)), Is.EqualTo("5.78358058743443e+222"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e40000000000000)), Is.EqualTo("1.15671611748689e+223"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e50000000000000)), Is.EqualTo("2.31343223497377e+223"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e60000000000000)), Is.EqualTo("4.62686446994754e+223"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e70000000000000)), Is.EqualTo("9.25372893989509e+223"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e80000000000000)), Is.EqualTo("1.85074578797902e+224"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e90000000000000)), Is.EqualTo("3.70149157595803e+224"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ea0000000000000)), Is.EqualTo("7.40298315191607e+224"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6eb0000000000000)), Is.EqualTo("1.48059663038321e+225"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ec0000000000000)), Is.EqualTo("2.96119326076643e+225"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ed0000000000000)), Is.EqualTo("5.92238652153286e+225"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ee0000000000000)), Is.EqualTo("1.18447730430657e+226"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ef0000000000000)), Is.EqualTo("2.36895460861314e+226"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f00000000000000)), Is.EqualTo("4.73790921722628e+226"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f10000000000000)), Is.EqualTo("9.47581843445257e+226"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f20000000000000)), Is.EqualTo("1.89516368689051e+227"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f30000000000000)), Is.EqualTo("3.79032737378103e+227"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f40000000000000)), Is.EqualTo("7.58065474756206e+227"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f50000000000000)), Is.EqualTo("1.51613094951241e+228"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f60000000000000)), Is.EqualTo("3.03226189902482e+228"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f70000000000000)), Is.EqualTo("6.06452379804964e+228"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f80000000000000)), Is.EqualTo("1.21290475960993e+229"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f90000000000000)), Is.EqualTo("2.42580951921986e+229"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6fa0000000000000)), Is.EqualTo("4.85161903843972e+229"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6fb0000000000000)), Is.EqualTo("9.70323807687943e+229"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6fc0000000000000)), Is.EqualTo("1.94064761537589e+230"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6fd0000000000000)), Is.EqualTo("3.88129523075177e+230"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6fe0000000000000)), Is.EqualTo("7.76259046150354e+230"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ff0000000000000)), Is.EqualTo("1.55251809230071e+231"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7000000000000000)), Is.EqualTo("3.10503618460142e+231"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7010000000000000)), Is.EqualTo("6.21007236920284e+231"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7020000000000000)), Is.EqualTo("1.24201447384057e+232"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7030000000000000)), Is.EqualTo("2.48402894768113e+232"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7040000000000000)), Is.EqualTo("4.96805789536227e+232"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7050000000000000)), Is.EqualTo("9.93611579072454e+232"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7060000000000000)), Is.EqualTo("1.98722315814491e+233"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7070000000000000)), Is.EqualTo("3.97444631628981e+233"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7080000000000000)), Is.EqualTo("7.94889263257963e+233"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7090000000000000)), Is.EqualTo("1.58977852651593e+234"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x70a0000000000000)), Is.EqualTo("3.17955705303185e+234"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x70b0000000000000)), Is.EqualTo("6.3591141060637e+234"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x70c0000000000000)), Is.EqualTo("1.27182282121274e+235"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x70d0000000000000)), Is.EqualTo("2.54364564242548e+235"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x70e0000000000000)), Is.EqualTo("5.08729128485096e+235"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x70f0000000000000)), Is.EqualTo("1.01745825697019e+236"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7100000000000000)), Is.EqualTo("2.03491651394039e+236"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7110000000000000)), Is.EqualTo("4.06983302788077e+236"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7120000000000000)), Is.EqualTo("8.13966605576154e+236"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7130000000000000)), Is.EqualTo("1.62793321115231e+237"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7140000000000000)), Is.EqualTo("3.25586642230462e+237"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7150000000000000)), Is.EqualTo("6.51173284460923e+237"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7160000000000000)), Is.EqualTo("1.30234656892185e+238"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7170000000000000)), Is.EqualTo("2.60469313784369e+238"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7180000000000000)), Is.EqualTo("5.20938627568739e+238"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7190000000000000)), Is.EqualTo("1.04187725513748e+239"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x71a0000000000000)), Is.EqualTo("2.08375451027495e+239"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x71b0000000000000)), Is.EqualTo("4.16750902054991e+239"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x71c0000000000000)), Is.EqualTo("8.33501804109982e+239"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x71d0000000000000)), Is.EqualTo("1.66700360821996e+240"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x71e0000000000000)), Is.EqualTo("3.33400721643993e+240"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x71f0000000000000)), Is.EqualTo("6.66801443287985e+240"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7200000000000000)), Is.EqualTo("1.33360288657597e+241"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7210000000000000)), Is.EqualTo("2.66720577315194e+241"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7220000000000000)), Is.EqualTo("5.33441154630388e+241"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7230000000000000)), Is.EqualTo("1.06688230926078e+242"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7240000000000000)), Is.EqualTo("2.13376461852155e+242"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7250000000000000)), Is.EqualTo("4.26752923704311e+242"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7260000000000000)), Is.EqualTo("8.53505847408621e+242"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7270000000000000)), Is.EqualTo("1.70701169481724e+243"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7280000000000000)), Is.EqualTo("3.41402338963449e+243"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7290000000000000)), Is.EqualTo("6.82804677926897e+243"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x72a0000000000000)), Is.EqualTo("1.36560935585379e+244"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x72b0000000000000)), Is.EqualTo("2.73121871170759e+244"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x72c0000000000000)), Is.EqualTo("5.46243742341518e+244"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x72d0000000000000)), Is.EqualTo("1.09248748468304e+245"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x72e0000000000000)), Is.EqualTo("2.18497496936607e+245"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x72f0000000000000)), Is.EqualTo("4.36994993873214e+245"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7300000000000000)), Is.EqualTo("8.73989987746428e+245"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7310000000000000)), Is.EqualTo("1.74797997549286e+246"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7320000000000000)), Is.EqualTo("3.49595995098571e+246"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7330000000000000)), Is.EqualTo("6.99191990197143e+246"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7340000000000000)), Is.EqualTo("1.39838398039429e+247"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7350000000000000)), Is.EqualTo("2.79676796078857e+247"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7360000000000000)), Is.EqualTo("5.59353592157714e+247"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7370000000000000)), Is.EqualTo("1.11870718431543e+248"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7380000000000000)), Is.EqualTo("2.23741436863086e+248"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7390000000000000)), Is.EqualTo("4.47482873726171e+248"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x73a0000000000000)), Is.EqualTo("8.94965747452343e+248"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x73b0000000000000)), Is.EqualTo("1.78993149490469e+249"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x73c0000000000000)), Is.EqualTo("3.57986298980937e+249"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x73d0000000000000)), Is.EqualTo("7.15972597961874e+249"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x73e0000000000000)), Is.EqualTo("1.43194519592375e+250"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x73f0000000000000)), Is.EqualTo("2.8638903918475e+250"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7400000000000000)), Is.EqualTo("5.72778078369499e+250"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7410000000000000)), Is.EqualTo("1.145556156739e+251"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7420000000000000)), Is.EqualTo("2.291112313478e+251"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7430000000000000)), Is.EqualTo("4.58222462695599e+251"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7440000000000000)), Is.EqualTo("9.16444925391199e+251"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7450000000000000)), Is.EqualTo("1.8328898507824e+252"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7460000000000000)), Is.EqualTo("3.6657797015648e+252"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7470000000000000)), Is.EqualTo("7.33155940312959e+252"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7480000000000000)), Is.EqualTo("1.46631188062592e+253"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7490000000000000)), Is.EqualTo("2.93262376125184e+253"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x74a0000000000000)), Is.EqualTo("5.86524752250367e+253"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x74b0000000000000)), Is.EqualTo("1.17304950450073e+254"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x74c0000000000000)), Is.EqualTo("2.34609900900147e+254"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x74d0000000000000)), Is.EqualTo("4.69219801800294e+254"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x74e0000000000000)), Is.EqualTo("9.38439603600588e+254"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x74f0000000000000)), Is.EqualTo("1.87687920720118e+255"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7500000000000000)), Is.EqualTo("3.75375841440235e+255"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7510000000000000)), Is.EqualTo("7.5075168288047e+255"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7520000000000000)), Is.EqualTo("1.50150336576094e+256"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7530000000000000)), Is.EqualTo("3.00300673152188e+256"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7540000000000000)), Is.EqualTo("6.00601346304376e+256"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7550000000000000)), Is.EqualTo("1.20120269260875e+257"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7560000000000000)), Is.EqualTo("2.4024053852175e+257"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7570000000000000)), Is.EqualTo("4.80481077043501e+257"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7580000000000000)), Is.EqualTo("9.60962154087002e+257"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7590000000000000)), Is.EqualTo("1.921924308174e+258"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x75a0000000000000)), Is.EqualTo("3.84384861634801e+258"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x75b0000000000000)), Is.EqualTo("7.68769723269601e+258"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x75c0000000000000)), Is.EqualTo("1.5375394465392e+259"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x75d0000000000000)), Is.EqualTo("3.07507889307841e+259"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x75e0000000000000)), Is.EqualTo("6.15015778615681e+259"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x75f0000000000000)), Is.EqualTo("1.23003155723136e+260"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7600000000000000)), Is.EqualTo("2.46006311446272e+260"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7610000000000000)), Is.EqualTo("4.92012622892545e+260"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7620000000000000)), Is.EqualTo("9.8402524578509e+260"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7630000000000000)), Is.EqualTo("1.96805049157018e+261"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7640000000000000)), Is.EqualTo("3.93610098314036e+261"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7650000000000000)), Is.EqualTo("7.87220196628072e+261"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7660000000000000)), Is.EqualTo("1.57444039325614e+262"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7670000000000000)), Is.EqualTo("3.14888078651229e+262"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7680000000000000)), Is.EqualTo("6.29776157302457e+262"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7690000000000000)), Is.EqualTo("1.25955231460491e+263"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x76a0000000000000)), Is.EqualTo("2.51910462920983e+263"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x76b0000000000000)), Is.EqualTo("5.03820925841966e+263"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x76c0000000000000)), Is.EqualTo("1.00764185168393e+264"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x76d0000000000000)), Is.EqualTo("2.01528370336786e+264"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x76e0000000000000)), Is.EqualTo("4.03056740673573e+264"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x76f0000000000000)), Is.EqualTo("8.06113481347145e+264"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7700000000000000)), Is.EqualTo("1.61222696269429e+265"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7710000000000000)), Is.EqualTo("3.22445392538858e+265"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7720000000000000)), Is.EqualTo("6.44890785077716e+265"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7730000000000000)), Is.EqualTo("1.28978157015543e+266"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7740000000000000)), Is.EqualTo("2.57956314031087e+266"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7750000000000000)), Is.EqualTo("5.15912628062173e+266"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7760000000000000)), Is.EqualTo("1.03182525612435e+267"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7770000000000000)), Is.EqualTo("2.06365051224869e+267"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7780000000000000)), Is.EqualTo("4.12730102449738e+267"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7790000000000000)), Is.EqualTo("8.25460204899477e+267"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x77a0000000000000)), Is.EqualTo("1.65092040979895e+268"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x77b0000000000000)), Is.EqualTo("3.30184081959791e+268"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x77c0000000000000)), Is.EqualTo("6.60368163919582e+268"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x77d0000000000000)), Is.EqualTo("1.32073632783916e+269"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x77e0000000000000)), Is.EqualTo("2.64147265567833e+269"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x77f0000000000000)), Is.EqualTo("5.28294531135665e+269"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7800000000000000)), Is.EqualTo("1.05658906227133e+270"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7810000000000000)), Is.EqualTo("2.11317812454266e+270"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7820000000000000)), Is.EqualTo("4.22635624908532e+270"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7830000000000000)), Is.EqualTo("8.45271249817064e+270"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7840000000000000)), Is.EqualTo("1.69054249963413e+271"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7850000000000000)), Is.EqualTo("3.38108499926826e+271"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7860000000000000)), Is.EqualTo("6.76216999853652e+271"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7870000000000000)), Is.EqualTo("1.3524339997073e+272"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7880000000000000)), Is.EqualTo("2.70486799941461e+272"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7890000000000000)), Is.EqualTo("5.40973599882921e+272"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x78a0000000000000)), Is.EqualTo("1.08194719976584e+273"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x78b0000000000000)), Is.EqualTo("2.16389439953168e+273"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x78c0000000000000)), Is.EqualTo("4.32778879906337e+273"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x78d0000000000000)), Is.EqualTo("8.65557759812674e+273"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x78e0000000000000)), Is.EqualTo("1.73111551962535e+274"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x78f0000000000000)), Is.EqualTo("3.4622310392507e+274"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7900000000000000)), Is.EqualTo("6.92446207850139e+274"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7910000000000000)), Is.EqualTo("1.38489241570028e+275"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7920000000000000)), Is.EqualTo("2.76978483140056e+275"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7930000000000000)), Is.EqualTo("5.53956966280111e+275"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7940000000000000)), Is.EqualTo("1.10791393256022e+276"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7950000000000000)), Is.EqualTo("2.21582786512045e+276"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7960000000000000)), Is.EqualTo("4.43165573024089e+276"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7970000000000000)), Is.EqualTo("8.86331146048178e+276"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7980000000000000)), Is.EqualTo("1.77266229209636e+277"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7990000000000000)), Is.EqualTo("3.54532458419271e+277"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x79a0000000000000)), Is.EqualTo("7.09064916838542e+277"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x79b0000000000000)), Is.EqualTo("1.41812983367709e+278"));  // GCC returns 1.41812983367708e+278
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x79c0000000000000)), Is.EqualTo("2.83625966735417e+278"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x79d0000000000000)), Is.EqualTo("5.67251933470834e+278"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x79e0000000000000)), Is.EqualTo("1.13450386694167e+279"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x79f0000000000000)), Is.EqualTo("2.26900773388334e+279"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a00000000000000)), Is.EqualTo("4.53801546776667e+279"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a10000000000000)), Is.EqualTo("9.07603093553334e+279"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a20000000000000)), Is.EqualTo("1.81520618710667e+280"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a30000000000000)), Is.EqualTo("3.63041237421334e+280"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a40000000000000)), Is.EqualTo("7.26082474842668e+280"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a50000000000000)), Is.EqualTo("1.45216494968534e+281"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a60000000000000)), Is.EqualTo("2.90432989937067e+281"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a70000000000000)), Is.EqualTo("5.80865979874134e+281"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a80000000000000)), Is.EqualTo("1.16173195974827e+282"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a90000000000000)), Is.EqualTo("2.32346391949654e+282"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7aa0000000000000)), Is.EqualTo("4.64692783899307e+282"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ab0000000000000)), Is.EqualTo("9.29385567798614e+282"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ac0000000000000)), Is.EqualTo("1.85877113559723e+283"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ad0000000000000)), Is.EqualTo("3.71754227119446e+283"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ae0000000000000)), Is.EqualTo("7.43508454238892e+283"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7af0000000000000)), Is.EqualTo("1.48701690847778e+284"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b00000000000000)), Is.EqualTo("2.97403381695557e+284"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b10000000000000)), Is.EqualTo("5.94806763391113e+284"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b20000000000000)), Is.EqualTo("1.18961352678223e+285"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b30000000000000)), Is.EqualTo("2.37922705356445e+285"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b40000000000000)), Is.EqualTo("4.75845410712891e+285"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b50000000000000)), Is.EqualTo("9.51690821425781e+285"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b60000000000000)), Is.EqualTo("1.90338164285156e+286"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b70000000000000)), Is.EqualTo("3.80676328570312e+286"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b80000000000000)), Is.EqualTo("7.61352657140625e+286"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b90000000000000)), Is.EqualTo("1.52270531428125e+287"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ba0000000000000)), Is.EqualTo("3.0454106285625e+287"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7bb0000000000000)), Is.EqualTo("6.090821257125e+287"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7bc0000000000000)), Is.EqualTo("1.218164251425e+288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7bd0000000000000)), Is.EqualTo("2.43632850285e+288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7be0000000000000)), Is.EqualTo("4.8726570057e+288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7bf0000000000000)), Is.EqualTo("9.7453140114e+288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c00000000000000)), Is.EqualTo("1.94906280228e+289"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c10000000000000)), Is.EqualTo("3.89812560456e+289"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c20000000000000)), Is.EqualTo("7.79625120912e+289"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c30000000000000)), Is.EqualTo("1.559250241824e+290"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c40000000000000)), Is.EqualTo("3.118500483648e+290"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c50000000000000)), Is.EqualTo("6.237000967296e+290"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c60000000000000)), Is.EqualTo("1.2474001934592e+291"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c70000000000000)), Is.EqualTo("2.4948003869184e+291"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c80000000000000)), Is.EqualTo("4.9896007738368e+291"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c90000000000000)), Is.EqualTo("9.9792015476736e+291"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ca0000000000000)), Is.EqualTo("1.99584030953472e+292"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7cb0000000000000)), Is.EqualTo("3.99168061906944e+292"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7cc0000000000000)), Is.EqualTo("7.98336123813888e+292"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7cd0000000000000)), Is.EqualTo("1.59667224762778e+293"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ce0000000000000)), Is.EqualTo("3.19334449525555e+293"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7cf0000000000000)), Is.EqualTo("6.3866889905111e+293"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d00000000000000)), Is.EqualTo("1.27733779810222e+294"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d10000000000000)), Is.EqualTo("2.55467559620444e+294"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d20000000000000)), Is.EqualTo("5.10935119240888e+294"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d30000000000000)), Is.EqualTo("1.02187023848178e+295"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d40000000000000)), Is.EqualTo("2.04374047696355e+295"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d50000000000000)), Is.EqualTo("4.08748095392711e+295"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d60000000000000)), Is.EqualTo("8.17496190785421e+295"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d70000000000000)), Is.EqualTo("1.63499238157084e+296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d80000000000000)), Is.EqualTo("3.26998476314168e+296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d90000000000000)), Is.EqualTo("6.53996952628337e+296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7da0000000000000)), Is.EqualTo("1.30799390525667e+297"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7db0000000000000)), Is.EqualTo("2.61598781051335e+297"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7dc0000000000000)), Is.EqualTo("5.2319756210267e+297"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7dd0000000000000)), Is.EqualTo("1.04639512420534e+298"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7de0000000000000)), Is.EqualTo("2.09279024841068e+298"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7df0000000000000)), Is.EqualTo("4.18558049682136e+298"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e00000000000000)), Is.EqualTo("8.37116099364271e+298"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e10000000000000)), Is.EqualTo("1.67423219872854e+299"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e20000000000000)), Is.EqualTo("3.34846439745709e+299"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e30000000000000)), Is.EqualTo("6.69692879491417e+299"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e40000000000000)), Is.EqualTo("1.33938575898283e+300"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e50000000000000)), Is.EqualTo("2.67877151796567e+300"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e60000000000000)), Is.EqualTo("5.35754303593134e+300"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e70000000000000)), Is.EqualTo("1.07150860718627e+301"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e80000000000000)), Is.EqualTo("2.14301721437253e+301"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e90000000000000)), Is.EqualTo("4.28603442874507e+301"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ea0000000000000)), Is.EqualTo("8.57206885749014e+301"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7eb0000000000000)), Is.EqualTo("1.71441377149803e+302"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ec0000000000000)), Is.EqualTo("3.42882754299606e+302"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ed0000000000000)), Is.EqualTo("6.85765508599211e+302"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ee0000000000000)), Is.EqualTo("1.37153101719842e+303"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ef0000000000000)), Is.EqualTo("2.74306203439684e+303"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f00000000000000)), Is.EqualTo("5.48612406879369e+303"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f10000000000000)), Is.EqualTo("1.09722481375874e+304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f20000000000000)), Is.EqualTo("2.19444962751748e+304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f30000000000000)), Is.EqualTo("4.38889925503495e+304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f40000000000000)), Is.EqualTo("8.7777985100699e+304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f50000000000000)), Is.EqualTo("1.75555970201398e+305"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f60000000000000)), Is.EqualTo("3.51111940402796e+305"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f70000000000000)), Is.EqualTo("7.02223880805592e+305"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f80000000000000)), Is.EqualTo("1.40444776161118e+306"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f90000000000000)), Is.EqualTo("2.80889552322237e+306"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7fa0000000000000)), Is.EqualTo("5.61779104644474e+306"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7fb0000000000000)), Is.EqualTo("1.12355820928895e+307"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7fc0000000000000)), Is.EqualTo("2.24711641857789e+307"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7fd0000000000000)), Is.EqualTo("4.49423283715579e+307"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7fe0000000000000)), Is.EqualTo("8.98846567431158e+307"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x001fffffffffffff)), Is.EqualTo("4.4501477170144e-308"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x002fffffffffffff)), Is.EqualTo("8.9002954340288e-308"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x003fffffffffffff)), Is.EqualTo("1.78005908680576e-307"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x004fffffffffffff)), Is.EqualTo("3.56011817361152e-307"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x005fffffffffffff)), Is.EqualTo("7.12023634722304e-307"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x006fffffffffffff)), Is.EqualTo("1.42404726944461e-306"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x007fffffffffffff)), Is.EqualTo("2.84809453888922e-306"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x008fffffffffffff)), Is.EqualTo("5.69618907777843e-306"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x009fffffffffffff)), Is.EqualTo("1.13923781555569e-305"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x00afffffffffffff)), Is.EqualTo("2.27847563111137e-305"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x00bfffffffffffff)), Is.EqualTo("4.55695126222275e-305"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x00cfffffffffffff)), Is.EqualTo("9.1139025244455e-305"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x00dfffffffffffff)), Is.EqualTo("1.8227805048891e-304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x00efffffffffffff)), Is.EqualTo("3.6455610097782e-304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x00ffffffffffffff)), Is.EqualTo("7.2911220195564e-304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x010fffffffffffff)), Is.EqualTo("1.45822440391128e-303"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x011fffffffffffff)), Is.EqualTo("2.91644880782256e-303"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x012fffffffffffff)), Is.EqualTo("5.83289761564512e-303"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x013fffffffffffff)), Is.EqualTo("1.16657952312902e-302"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x014fffffffffffff)), Is.EqualTo("2.33315904625805e-302"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x015fffffffffffff)), Is.EqualTo("4.66631809251609e-302"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x016fffffffffffff)), Is.EqualTo("9.33263618503219e-302"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x017fffffffffffff)), Is.EqualTo("1.86652723700644e-301"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x018fffffffffffff)), Is.EqualTo("3.73305447401288e-301"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x019fffffffffffff)), Is.EqualTo("7.46610894802575e-301"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x01afffffffffffff)), Is.EqualTo("1.49322178960515e-300"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x01bfffffffffffff)), Is.EqualTo("2.9864435792103e-300"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x01cfffffffffffff)), Is.EqualTo("5.9728871584206e-300"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x01dfffffffffffff)), Is.EqualTo("1.19457743168412e-299"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x01efffffffffffff)), Is.EqualTo("2.38915486336824e-299"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x01ffffffffffffff)), Is.EqualTo("4.77830972673648e-299"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x020fffffffffffff)), Is.EqualTo("9.55661945347296e-299"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x021fffffffffffff)), Is.EqualTo("1.91132389069459e-298"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x022fffffffffffff)), Is.EqualTo("3.82264778138918e-298"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x023fffffffffffff)), Is.EqualTo("7.64529556277837e-298"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x024fffffffffffff)), Is.EqualTo("1.52905911255567e-297"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x025fffffffffffff)), Is.EqualTo("3.05811822511135e-297"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x026fffffffffffff)), Is.EqualTo("6.11623645022269e-297"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x027fffffffffffff)), Is.EqualTo("1.22324729004454e-296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x028fffffffffffff)), Is.EqualTo("2.44649458008908e-296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x029fffffffffffff)), Is.EqualTo("4.89298916017816e-296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x02afffffffffffff)), Is.EqualTo("9.78597832035631e-296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x02bfffffffffffff)), Is.EqualTo("1.95719566407126e-295"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x02cfffffffffffff)), Is.EqualTo("3.91439132814252e-295"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x02dfffffffffffff)), Is.EqualTo("7.82878265628505e-295"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x02efffffffffffff)), Is.EqualTo("1.56575653125701e-294"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x02ffffffffffffff)), Is.EqualTo("3.13151306251402e-294"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x030fffffffffffff)), Is.EqualTo("6.26302612502804e-294"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x031fffffffffffff)), Is.EqualTo("1.25260522500561e-293"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x032fffffffffffff)), Is.EqualTo("2.50521045001122e-293"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x033fffffffffffff)), Is.EqualTo("5.01042090002243e-293"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x034fffffffffffff)), Is.EqualTo("1.00208418000449e-292"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x035fffffffffffff)), Is.EqualTo("2.00416836000897e-292"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x036fffffffffffff)), Is.EqualTo("4.00833672001795e-292"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x037fffffffffffff)), Is.EqualTo("8.01667344003589e-292"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x038fffffffffffff)), Is.EqualTo("1.60333468800718e-291"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x039fffffffffffff)), Is.EqualTo("3.20666937601436e-291"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x03afffffffffffff)), Is.EqualTo("6.41333875202871e-291"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x03bfffffffffffff)), Is.EqualTo("1.28266775040574e-290"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x03cfffffffffffff)), Is.EqualTo("2.56533550081148e-290"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x03dfffffffffffff)), Is.EqualTo("5.13067100162297e-290"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x03efffffffffffff)), Is.EqualTo("1.02613420032459e-289"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x03ffffffffffffff)), Is.EqualTo("2.05226840064919e-289"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x040fffffffffffff)), Is.EqualTo("4.10453680129838e-289"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x041fffffffffffff)), Is.EqualTo("8.20907360259675e-289"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x042fffffffffffff)), Is.EqualTo("1.64181472051935e-288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x043fffffffffffff)), Is.EqualTo("3.2836294410387e-288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x044fffffffffffff)), Is.EqualTo("6.5672588820774e-288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x045fffffffffffff)), Is.EqualTo("1.31345177641548e-287"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x046fffffffffffff)), Is.EqualTo("2.62690355283096e-287"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x047fffffffffffff)), Is.EqualTo("5.25380710566192e-287"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x048fffffffffffff)), Is.EqualTo("1.05076142113238e-286"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x049fffffffffffff)), Is.EqualTo("2.10152284226477e-286"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x04afffffffffffff)), Is.EqualTo("4.20304568452954e-286"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x04bfffffffffffff)), Is.EqualTo("8.40609136905907e-286"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x04cfffffffffffff)), Is.EqualTo("1.68121827381181e-285"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x04dfffffffffffff)), Is.EqualTo("3.36243654762363e-285"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x04efffffffffffff)), Is.EqualTo("6.72487309524726e-285"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x04ffffffffffffff)), Is.EqualTo("1.34497461904945e-284"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x050fffffffffffff)), Is.EqualTo("2.6899492380989e-284"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x051fffffffffffff)), Is.EqualTo("5.37989847619781e-284"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x052fffffffffffff)), Is.EqualTo("1.07597969523956e-283"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x053fffffffffffff)), Is.EqualTo("2.15195939047912e-283"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x054fffffffffffff)), Is.EqualTo("4.30391878095825e-283"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x055fffffffffffff)), Is.EqualTo("8.60783756191649e-283"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x056fffffffffffff)), Is.EqualTo("1.7215675123833e-282"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x057fffffffffffff)), Is.EqualTo("3.4431350247666e-282"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x058fffffffffffff)), Is.EqualTo("6.88627004953319e-282"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x059fffffffffffff)), Is.EqualTo("1.37725400990664e-281"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x05afffffffffffff)), Is.EqualTo("2.75450801981328e-281"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x05bfffffffffffff)), Is.EqualTo("5.50901603962655e-281"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x05cfffffffffffff)), Is.EqualTo("1.10180320792531e-280"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x05dfffffffffffff)), Is.EqualTo("2.20360641585062e-280"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x05efffffffffffff)), Is.EqualTo("4.40721283170124e-280"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x05ffffffffffffff)), Is.EqualTo("8.81442566340249e-280"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x060fffffffffffff)), Is.EqualTo("1.7628851326805e-279"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x061fffffffffffff)), Is.EqualTo("3.52577026536099e-279"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x062fffffffffffff)), Is.EqualTo("7.05154053072199e-279"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x063fffffffffffff)), Is.EqualTo("1.4103081061444e-278"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x064fffffffffffff)), Is.EqualTo("2.8206162122888e-278"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x065fffffffffffff)), Is.EqualTo("5.64123242457759e-278"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x066fffffffffffff)), Is.EqualTo("1.12824648491552e-277"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x067fffffffffffff)), Is.EqualTo("2.25649296983104e-277"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x068fffffffffffff)), Is.EqualTo("4.51298593966207e-277"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x069fffffffffffff)), Is.EqualTo("9.02597187932415e-277"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x06afffffffffffff)), Is.EqualTo("1.80519437586483e-276"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x06bfffffffffffff)), Is.EqualTo("3.61038875172966e-276"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x06cfffffffffffff)), Is.EqualTo("7.22077750345932e-276"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x06dfffffffffffff)), Is.EqualTo("1.44415550069186e-275"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x06efffffffffffff)), Is.EqualTo("2.88831100138373e-275"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x06ffffffffffffff)), Is.EqualTo("5.77662200276745e-275"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x070fffffffffffff)), Is.EqualTo("1.15532440055349e-274"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x071fffffffffffff)), Is.EqualTo("2.31064880110698e-274"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x072fffffffffffff)), Is.EqualTo("4.62129760221396e-274"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x073fffffffffffff)), Is.EqualTo("9.24259520442793e-274"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x074fffffffffffff)), Is.EqualTo("1.84851904088559e-273"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x075fffffffffffff)), Is.EqualTo("3.69703808177117e-273"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x076fffffffffffff)), Is.EqualTo("7.39407616354234e-273"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x077fffffffffffff)), Is.EqualTo("1.47881523270847e-272"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x078fffffffffffff)), Is.EqualTo("2.95763046541694e-272"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x079fffffffffffff)), Is.EqualTo("5.91526093083387e-272"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x07afffffffffffff)), Is.EqualTo("1.18305218616677e-271"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x07bfffffffffffff)), Is.EqualTo("2.36610437233355e-271"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x07cfffffffffffff)), Is.EqualTo("4.7322087446671e-271"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x07dfffffffffffff)), Is.EqualTo("9.4644174893342e-271"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x07efffffffffffff)), Is.EqualTo("1.89288349786684e-270"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x07ffffffffffffff)), Is.EqualTo("3.78576699573368e-270"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x080fffffffffffff)), Is.EqualTo("7.57153399146736e-270"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x081fffffffffffff)), Is.EqualTo("1.51430679829347e-269"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x082fffffffffffff)), Is.EqualTo("3.02861359658694e-269"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x083fffffffffffff)), Is.EqualTo("6.05722719317389e-269"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x084fffffffffffff)), Is.EqualTo("1.21144543863478e-268"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x085fffffffffffff)), Is.EqualTo("2.42289087726955e-268"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x086fffffffffffff)), Is.EqualTo("4.84578175453911e-268"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x087fffffffffffff)), Is.EqualTo("9.69156350907822e-268"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x088fffffffffffff)), Is.EqualTo("1.93831270181564e-267"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x089fffffffffffff)), Is.EqualTo("3.87662540363129e-267"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x08afffffffffffff)), Is.EqualTo("7.75325080726257e-267"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x08bfffffffffffff)), Is.EqualTo("1.55065016145251e-266"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x08cfffffffffffff)), Is.EqualTo("3.10130032290503e-266"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x08dfffffffffffff)), Is.EqualTo("6.20260064581006e-266"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x08efffffffffffff)), Is.EqualTo("1.24052012916201e-265"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x08ffffffffffffff)), Is.EqualTo("2.48104025832402e-265"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x090fffffffffffff)), Is.EqualTo("4.96208051664805e-265"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x091fffffffffffff)), Is.EqualTo("9.92416103329609e-265"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x092fffffffffffff)), Is.EqualTo("1.98483220665922e-264"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x093fffffffffffff)), Is.EqualTo("3.96966441331844e-264"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x094fffffffffffff)), Is.EqualTo("7.93932882663688e-264"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x095fffffffffffff)), Is.EqualTo("1.58786576532738e-263"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x096fffffffffffff)), Is.EqualTo("3.17573153065475e-263"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x097fffffffffffff)), Is.EqualTo("6.3514630613095e-263"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x098fffffffffffff)), Is.EqualTo("1.2702926122619e-262"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x099fffffffffffff)), Is.EqualTo("2.5405852245238e-262"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x09afffffffffffff)), Is.EqualTo("5.0811704490476e-262"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x09bfffffffffffff)), Is.EqualTo("1.01623408980952e-261"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x09cfffffffffffff)), Is.EqualTo("2.03246817961904e-261"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x09dfffffffffffff)), Is.EqualTo("4.06493635923808e-261"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x09efffffffffffff)), Is.EqualTo("8.12987271847616e-261"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x09ffffffffffffff)), Is.EqualTo("1.62597454369523e-260"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a0fffffffffffff)), Is.EqualTo("3.25194908739046e-260"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a1fffffffffffff)), Is.EqualTo("6.50389817478093e-260"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a2fffffffffffff)), Is.EqualTo("1.30077963495619e-259"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a3fffffffffffff)), Is.EqualTo("2.60155926991237e-259"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a4fffffffffffff)), Is.EqualTo("5.20311853982474e-259"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a5fffffffffffff)), Is.EqualTo("1.04062370796495e-258"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a6fffffffffffff)), Is.EqualTo("2.0812474159299e-258"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a7fffffffffffff)), Is.EqualTo("4.16249483185979e-258"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a8fffffffffffff)), Is.EqualTo("8.32498966371959e-258"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0a9fffffffffffff)), Is.EqualTo("1.66499793274392e-257"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0aafffffffffffff)), Is.EqualTo("3.32999586548784e-257"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0abfffffffffffff)), Is.EqualTo("6.65999173097567e-257"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0acfffffffffffff)), Is.EqualTo("1.33199834619513e-256"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0adfffffffffffff)), Is.EqualTo("2.66399669239027e-256"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0aefffffffffffff)), Is.EqualTo("5.32799338478054e-256"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0affffffffffffff)), Is.EqualTo("1.06559867695611e-255"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b0fffffffffffff)), Is.EqualTo("2.13119735391221e-255"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b1fffffffffffff)), Is.EqualTo("4.26239470782443e-255"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b2fffffffffffff)), Is.EqualTo("8.52478941564886e-255"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b3fffffffffffff)), Is.EqualTo("1.70495788312977e-254"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b4fffffffffffff)), Is.EqualTo("3.40991576625954e-254"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b5fffffffffffff)), Is.EqualTo("6.81983153251909e-254"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b6fffffffffffff)), Is.EqualTo("1.36396630650382e-253"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b7fffffffffffff)), Is.EqualTo("2.72793261300763e-253"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b8fffffffffffff)), Is.EqualTo("5.45586522601527e-253"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0b9fffffffffffff)), Is.EqualTo("1.09117304520305e-252"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0bafffffffffffff)), Is.EqualTo("2.18234609040611e-252"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0bbfffffffffffff)), Is.EqualTo("4.36469218081222e-252"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0bcfffffffffffff)), Is.EqualTo("8.72938436162443e-252"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0bdfffffffffffff)), Is.EqualTo("1.74587687232489e-251"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0befffffffffffff)), Is.EqualTo("3.49175374464977e-251"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0bffffffffffffff)), Is.EqualTo("6.98350748929955e-251"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c0fffffffffffff)), Is.EqualTo("1.39670149785991e-250"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c1fffffffffffff)), Is.EqualTo("2.79340299571982e-250"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c2fffffffffffff)), Is.EqualTo("5.58680599143964e-250"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c3fffffffffffff)), Is.EqualTo("1.11736119828793e-249"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c4fffffffffffff)), Is.EqualTo("2.23472239657585e-249"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c5fffffffffffff)), Is.EqualTo("4.46944479315171e-249"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c6fffffffffffff)), Is.EqualTo("8.93888958630342e-249"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c7fffffffffffff)), Is.EqualTo("1.78777791726068e-248"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c8fffffffffffff)), Is.EqualTo("3.57555583452137e-248"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0c9fffffffffffff)), Is.EqualTo("7.15111166904273e-248"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0cafffffffffffff)), Is.EqualTo("1.43022233380855e-247"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0cbfffffffffffff)), Is.EqualTo("2.86044466761709e-247"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ccfffffffffffff)), Is.EqualTo("5.72088933523419e-247"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0cdfffffffffffff)), Is.EqualTo("1.14417786704684e-246"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0cefffffffffffff)), Is.EqualTo("2.28835573409367e-246"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0cffffffffffffff)), Is.EqualTo("4.57671146818735e-246"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d0fffffffffffff)), Is.EqualTo("9.1534229363747e-246"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d1fffffffffffff)), Is.EqualTo("1.83068458727494e-245"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d2fffffffffffff)), Is.EqualTo("3.66136917454988e-245"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d3fffffffffffff)), Is.EqualTo("7.32273834909976e-245"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d4fffffffffffff)), Is.EqualTo("1.46454766981995e-244"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d5fffffffffffff)), Is.EqualTo("2.9290953396399e-244"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d6fffffffffffff)), Is.EqualTo("5.85819067927981e-244"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d7fffffffffffff)), Is.EqualTo("1.17163813585596e-243"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d8fffffffffffff)), Is.EqualTo("2.34327627171192e-243"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0d9fffffffffffff)), Is.EqualTo("4.68655254342385e-243"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0dafffffffffffff)), Is.EqualTo("9.37310508684769e-243"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0dbfffffffffffff)), Is.EqualTo("1.87462101736954e-242"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0dcfffffffffffff)), Is.EqualTo("3.74924203473908e-242"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ddfffffffffffff)), Is.EqualTo("7.49848406947815e-242"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0defffffffffffff)), Is.EqualTo("1.49969681389563e-241"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0dffffffffffffff)), Is.EqualTo("2.99939362779126e-241"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e0fffffffffffff)), Is.EqualTo("5.99878725558252e-241"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e1fffffffffffff)), Is.EqualTo("1.1997574511165e-240"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e2fffffffffffff)), Is.EqualTo("2.39951490223301e-240"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e3fffffffffffff)), Is.EqualTo("4.79902980446602e-240"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e4fffffffffffff)), Is.EqualTo("9.59805960893204e-240"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e5fffffffffffff)), Is.EqualTo("1.91961192178641e-239"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e6fffffffffffff)), Is.EqualTo("3.83922384357281e-239"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e7fffffffffffff)), Is.EqualTo("7.67844768714563e-239"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e8fffffffffffff)), Is.EqualTo("1.53568953742913e-238"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0e9fffffffffffff)), Is.EqualTo("3.07137907485825e-238"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0eafffffffffffff)), Is.EqualTo("6.1427581497165e-238"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ebfffffffffffff)), Is.EqualTo("1.2285516299433e-237"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0ecfffffffffffff)), Is.EqualTo("2.4571032598866e-237"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0edfffffffffffff)), Is.EqualTo("4.9142065197732e-237"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0eefffffffffffff)), Is.EqualTo("9.82841303954641e-237"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0effffffffffffff)), Is.EqualTo("1.96568260790928e-236"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f0fffffffffffff)), Is.EqualTo("3.93136521581856e-236"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f1fffffffffffff)), Is.EqualTo("7.86273043163712e-236"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f2fffffffffffff)), Is.EqualTo("1.57254608632742e-235"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f3fffffffffffff)), Is.EqualTo("3.14509217265485e-235"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f4fffffffffffff)), Is.EqualTo("6.2901843453097e-235"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f5fffffffffffff)), Is.EqualTo("1.25803686906194e-234"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f6fffffffffffff)), Is.EqualTo("2.51607373812388e-234"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f7fffffffffffff)), Is.EqualTo("5.03214747624776e-234"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f8fffffffffffff)), Is.EqualTo("1.00642949524955e-233"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0f9fffffffffffff)), Is.EqualTo("2.0128589904991e-233"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0fafffffffffffff)), Is.EqualTo("4.02571798099821e-233"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0fbfffffffffffff)), Is.EqualTo("8.05143596199642e-233"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0fcfffffffffffff)), Is.EqualTo("1.61028719239928e-232"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0fdfffffffffffff)), Is.EqualTo("3.22057438479857e-232"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0fefffffffffffff)), Is.EqualTo("6.44114876959713e-232"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x0fffffffffffffff)), Is.EqualTo("1.28822975391943e-231"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x100fffffffffffff)), Is.EqualTo("2.57645950783885e-231"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x101fffffffffffff)), Is.EqualTo("5.15291901567771e-231"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x102fffffffffffff)), Is.EqualTo("1.03058380313554e-230"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x103fffffffffffff)), Is.EqualTo("2.06116760627108e-230"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x104fffffffffffff)), Is.EqualTo("4.12233521254216e-230"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x105fffffffffffff)), Is.EqualTo("8.24467042508433e-230"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x106fffffffffffff)), Is.EqualTo("1.64893408501687e-229"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x107fffffffffffff)), Is.EqualTo("3.29786817003373e-229"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x108fffffffffffff)), Is.EqualTo("6.59573634006746e-229"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x109fffffffffffff)), Is.EqualTo("1.31914726801349e-228"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x10afffffffffffff)), Is.EqualTo("2.63829453602699e-228"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x10bfffffffffffff)), Is.EqualTo("5.27658907205397e-228"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x10cfffffffffffff)), Is.EqualTo("1.05531781441079e-227"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x10dfffffffffffff)), Is.EqualTo("2.11063562882159e-227"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x10efffffffffffff)), Is.EqualTo("4.22127125764318e-227"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x10ffffffffffffff)), Is.EqualTo("8.44254251528635e-227"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x110fffffffffffff)), Is.EqualTo("1.68850850305727e-226"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x111fffffffffffff)), Is.EqualTo("3.37701700611454e-226"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x112fffffffffffff)), Is.EqualTo("6.75403401222908e-226"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x113fffffffffffff)), Is.EqualTo("1.35080680244582e-225"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x114fffffffffffff)), Is.EqualTo("2.70161360489163e-225"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x115fffffffffffff)), Is.EqualTo("5.40322720978327e-225"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x116fffffffffffff)), Is.EqualTo("1.08064544195665e-224"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x117fffffffffffff)), Is.EqualTo("2.16129088391331e-224"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x118fffffffffffff)), Is.EqualTo("4.32258176782661e-224"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x119fffffffffffff)), Is.EqualTo("8.64516353565323e-224"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x11afffffffffffff)), Is.EqualTo("1.72903270713065e-223"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x11bfffffffffffff)), Is.EqualTo("3.45806541426129e-223"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x11cfffffffffffff)), Is.EqualTo("6.91613082852258e-223"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x11dfffffffffffff)), Is.EqualTo("1.38322616570452e-222"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x11efffffffffffff)), Is.EqualTo("2.76645233140903e-222"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x11ffffffffffffff)), Is.EqualTo("5.53290466281806e-222"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x120fffffffffffff)), Is.EqualTo("1.10658093256361e-221"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x121fffffffffffff)), Is.EqualTo("2.21316186512723e-221"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x122fffffffffffff)), Is.EqualTo("4.42632373025445e-221"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x123fffffffffffff)), Is.EqualTo("8.8526474605089e-221"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x124fffffffffffff)), Is.EqualTo("1.77052949210178e-220"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x125fffffffffffff)), Is.EqualTo("3.54105898420356e-220"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x126fffffffffffff)), Is.EqualTo("7.08211796840712e-220"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x127fffffffffffff)), Is.EqualTo("1.41642359368142e-219"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x128fffffffffffff)), Is.EqualTo("2.83284718736285e-219"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x129fffffffffffff)), Is.EqualTo("5.6656943747257e-219"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x12afffffffffffff)), Is.EqualTo("1.13313887494514e-218"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x12bfffffffffffff)), Is.EqualTo("2.26627774989028e-218"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x12cfffffffffffff)), Is.EqualTo("4.53255549978056e-218"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x12dfffffffffffff)), Is.EqualTo("9.06511099956112e-218"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x12efffffffffffff)), Is.EqualTo("1.81302219991222e-217"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x12ffffffffffffff)), Is.EqualTo("3.62604439982445e-217"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x130fffffffffffff)), Is.EqualTo("7.25208879964889e-217"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x131fffffffffffff)), Is.EqualTo("1.45041775992978e-216"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x132fffffffffffff)), Is.EqualTo("2.90083551985956e-216"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x133fffffffffffff)), Is.EqualTo("5.80167103971912e-216"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x134fffffffffffff)), Is.EqualTo("1.16033420794382e-215"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x135fffffffffffff)), Is.EqualTo("2.32066841588765e-215"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x136fffffffffffff)), Is.EqualTo("4.64133683177529e-215"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x137fffffffffffff)), Is.EqualTo("9.28267366355058e-215"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x138fffffffffffff)), Is.EqualTo("1.85653473271012e-214"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x139fffffffffffff)), Is.EqualTo("3.71306946542023e-214"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x13afffffffffffff)), Is.EqualTo("7.42613893084047e-214"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x13bfffffffffffff)), Is.EqualTo("1.48522778616809e-213"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x13cfffffffffffff)), Is.EqualTo("2.97045557233619e-213"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x13dfffffffffffff)), Is.EqualTo("5.94091114467237e-213"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x13efffffffffffff)), Is.EqualTo("1.18818222893447e-212"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x13ffffffffffffff)), Is.EqualTo("2.37636445786895e-212"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x140fffffffffffff)), Is.EqualTo("4.7527289157379e-212"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x141fffffffffffff)), Is.EqualTo("9.5054578314758e-212"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x142fffffffffffff)), Is.EqualTo("1.90109156629516e-211"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x143fffffffffffff)), Is.EqualTo("3.80218313259032e-211"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x144fffffffffffff)), Is.EqualTo("7.60436626518064e-211"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x145fffffffffffff)), Is.EqualTo("1.52087325303613e-210"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x146fffffffffffff)), Is.EqualTo("3.04174650607226e-210"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x147fffffffffffff)), Is.EqualTo("6.08349301214451e-210"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x148fffffffffffff)), Is.EqualTo("1.2166986024289e-209"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x149fffffffffffff)), Is.EqualTo("2.4333972048578e-209"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x14afffffffffffff)), Is.EqualTo("4.86679440971561e-209"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x14bfffffffffffff)), Is.EqualTo("9.73358881943122e-209"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x14cfffffffffffff)), Is.EqualTo("1.94671776388624e-208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x14dfffffffffffff)), Is.EqualTo("3.89343552777249e-208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x14efffffffffffff)), Is.EqualTo("7.78687105554497e-208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x14ffffffffffffff)), Is.EqualTo("1.55737421110899e-207"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x150fffffffffffff)), Is.EqualTo("3.11474842221799e-207"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x151fffffffffffff)), Is.EqualTo("6.22949684443598e-207"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x152fffffffffffff)), Is.EqualTo("1.2458993688872e-206"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x153fffffffffffff)), Is.EqualTo("2.49179873777439e-206"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x154fffffffffffff)), Is.EqualTo("4.98359747554878e-206"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x155fffffffffffff)), Is.EqualTo("9.96719495109757e-206"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x156fffffffffffff)), Is.EqualTo("1.99343899021951e-205"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x157fffffffffffff)), Is.EqualTo("3.98687798043903e-205"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x158fffffffffffff)), Is.EqualTo("7.97375596087805e-205"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x159fffffffffffff)), Is.EqualTo("1.59475119217561e-204"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x15afffffffffffff)), Is.EqualTo("3.18950238435122e-204"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x15bfffffffffffff)), Is.EqualTo("6.37900476870244e-204"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x15cfffffffffffff)), Is.EqualTo("1.27580095374049e-203"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x15dfffffffffffff)), Is.EqualTo("2.55160190748098e-203"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x15efffffffffffff)), Is.EqualTo("5.10320381496195e-203"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x15ffffffffffffff)), Is.EqualTo("1.02064076299239e-202"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x160fffffffffffff)), Is.EqualTo("2.04128152598478e-202"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x161fffffffffffff)), Is.EqualTo("4.08256305196956e-202"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x162fffffffffffff)), Is.EqualTo("8.16512610393913e-202"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x163fffffffffffff)), Is.EqualTo("1.63302522078783e-201"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x164fffffffffffff)), Is.EqualTo("3.26605044157565e-201"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x165fffffffffffff)), Is.EqualTo("6.5321008831513e-201"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x166fffffffffffff)), Is.EqualTo("1.30642017663026e-200"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x167fffffffffffff)), Is.EqualTo("2.61284035326052e-200"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x168fffffffffffff)), Is.EqualTo("5.22568070652104e-200"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x169fffffffffffff)), Is.EqualTo("1.04513614130421e-199"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x16afffffffffffff)), Is.EqualTo("2.09027228260842e-199"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x16bfffffffffffff)), Is.EqualTo("4.18054456521683e-199"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x16cfffffffffffff)), Is.EqualTo("8.36108913043367e-199"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x16dfffffffffffff)), Is.EqualTo("1.67221782608673e-198"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x16efffffffffffff)), Is.EqualTo("3.34443565217347e-198"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x16ffffffffffffff)), Is.EqualTo("6.68887130434693e-198"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x170fffffffffffff)), Is.EqualTo("1.33777426086939e-197"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x171fffffffffffff)), Is.EqualTo("2.67554852173877e-197"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x172fffffffffffff)), Is.EqualTo("5.35109704347755e-197"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x173fffffffffffff)), Is.EqualTo("1.07021940869551e-196"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x174fffffffffffff)), Is.EqualTo("2.14043881739102e-196"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x175fffffffffffff)), Is.EqualTo("4.28087763478204e-196"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x176fffffffffffff)), Is.EqualTo("8.56175526956407e-196"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x177fffffffffffff)), Is.EqualTo("1.71235105391281e-195"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x178fffffffffffff)), Is.EqualTo("3.42470210782563e-195"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x179fffffffffffff)), Is.EqualTo("6.84940421565126e-195"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x17afffffffffffff)), Is.EqualTo("1.36988084313025e-194"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x17bfffffffffffff)), Is.EqualTo("2.7397616862605e-194"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x17cfffffffffffff)), Is.EqualTo("5.47952337252101e-194"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x17dfffffffffffff)), Is.EqualTo("1.0959046745042e-193"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x17efffffffffffff)), Is.EqualTo("2.1918093490084e-193"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x17ffffffffffffff)), Is.EqualTo("4.38361869801681e-193"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x180fffffffffffff)), Is.EqualTo("8.76723739603361e-193"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x181fffffffffffff)), Is.EqualTo("1.75344747920672e-192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x182fffffffffffff)), Is.EqualTo("3.50689495841344e-192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x183fffffffffffff)), Is.EqualTo("7.01378991682689e-192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x184fffffffffffff)), Is.EqualTo("1.40275798336538e-191"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x185fffffffffffff)), Is.EqualTo("2.80551596673076e-191"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x186fffffffffffff)), Is.EqualTo("5.61103193346151e-191"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x187fffffffffffff)), Is.EqualTo("1.1222063866923e-190"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x188fffffffffffff)), Is.EqualTo("2.2444127733846e-190"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x189fffffffffffff)), Is.EqualTo("4.48882554676921e-190"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x18afffffffffffff)), Is.EqualTo("8.97765109353842e-190"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x18bfffffffffffff)), Is.EqualTo("1.79553021870768e-189"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x18cfffffffffffff)), Is.EqualTo("3.59106043741537e-189"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x18dfffffffffffff)), Is.EqualTo("7.18212087483073e-189"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x18efffffffffffff)), Is.EqualTo("1.43642417496615e-188"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x18ffffffffffffff)), Is.EqualTo("2.87284834993229e-188"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x190fffffffffffff)), Is.EqualTo("5.74569669986459e-188"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x191fffffffffffff)), Is.EqualTo("1.14913933997292e-187"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x192fffffffffffff)), Is.EqualTo("2.29827867994584e-187"));  // GCC returns 2.29827867994583e-187
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x193fffffffffffff)), Is.EqualTo("4.59655735989167e-187"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x194fffffffffffff)), Is.EqualTo("9.19311471978334e-187"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x195fffffffffffff)), Is.EqualTo("1.83862294395667e-186"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x196fffffffffffff)), Is.EqualTo("3.67724588791334e-186"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x197fffffffffffff)), Is.EqualTo("7.35449177582667e-186"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x198fffffffffffff)), Is.EqualTo("1.47089835516533e-185"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x199fffffffffffff)), Is.EqualTo("2.94179671033067e-185"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x19afffffffffffff)), Is.EqualTo("5.88359342066134e-185"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x19bfffffffffffff)), Is.EqualTo("1.17671868413227e-184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x19cfffffffffffff)), Is.EqualTo("2.35343736826454e-184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x19dfffffffffffff)), Is.EqualTo("4.70687473652907e-184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x19efffffffffffff)), Is.EqualTo("9.41374947305814e-184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x19ffffffffffffff)), Is.EqualTo("1.88274989461163e-183"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a0fffffffffffff)), Is.EqualTo("3.76549978922326e-183"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a1fffffffffffff)), Is.EqualTo("7.53099957844651e-183"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a2fffffffffffff)), Is.EqualTo("1.5061999156893e-182"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a3fffffffffffff)), Is.EqualTo("3.0123998313786e-182"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a4fffffffffffff)), Is.EqualTo("6.02479966275721e-182"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a5fffffffffffff)), Is.EqualTo("1.20495993255144e-181"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a6fffffffffffff)), Is.EqualTo("2.40991986510288e-181"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a7fffffffffffff)), Is.EqualTo("4.81983973020577e-181"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a8fffffffffffff)), Is.EqualTo("9.63967946041154e-181"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1a9fffffffffffff)), Is.EqualTo("1.92793589208231e-180"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1aafffffffffffff)), Is.EqualTo("3.85587178416461e-180"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1abfffffffffffff)), Is.EqualTo("7.71174356832923e-180"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1acfffffffffffff)), Is.EqualTo("1.54234871366585e-179"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1adfffffffffffff)), Is.EqualTo("3.08469742733169e-179"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1aefffffffffffff)), Is.EqualTo("6.16939485466338e-179"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1affffffffffffff)), Is.EqualTo("1.23387897093268e-178"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b0fffffffffffff)), Is.EqualTo("2.46775794186535e-178"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b1fffffffffffff)), Is.EqualTo("4.93551588373071e-178"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b2fffffffffffff)), Is.EqualTo("9.87103176746141e-178"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b3fffffffffffff)), Is.EqualTo("1.97420635349228e-177"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b4fffffffffffff)), Is.EqualTo("3.94841270698456e-177"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b5fffffffffffff)), Is.EqualTo("7.89682541396913e-177"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b6fffffffffffff)), Is.EqualTo("1.57936508279383e-176"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b7fffffffffffff)), Is.EqualTo("3.15873016558765e-176"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b8fffffffffffff)), Is.EqualTo("6.3174603311753e-176"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1b9fffffffffffff)), Is.EqualTo("1.26349206623506e-175"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1bafffffffffffff)), Is.EqualTo("2.52698413247012e-175"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1bbfffffffffffff)), Is.EqualTo("5.05396826494024e-175"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1bcfffffffffffff)), Is.EqualTo("1.01079365298805e-174"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1bdfffffffffffff)), Is.EqualTo("2.0215873059761e-174"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1befffffffffffff)), Is.EqualTo("4.04317461195219e-174"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1bffffffffffffff)), Is.EqualTo("8.08634922390439e-174"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c0fffffffffffff)), Is.EqualTo("1.61726984478088e-173"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c1fffffffffffff)), Is.EqualTo("3.23453968956176e-173"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c2fffffffffffff)), Is.EqualTo("6.46907937912351e-173"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c3fffffffffffff)), Is.EqualTo("1.2938158758247e-172"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c4fffffffffffff)), Is.EqualTo("2.5876317516494e-172"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c5fffffffffffff)), Is.EqualTo("5.17526350329881e-172"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c6fffffffffffff)), Is.EqualTo("1.03505270065976e-171"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c7fffffffffffff)), Is.EqualTo("2.07010540131952e-171"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c8fffffffffffff)), Is.EqualTo("4.14021080263905e-171"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1c9fffffffffffff)), Is.EqualTo("8.28042160527809e-171"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1cafffffffffffff)), Is.EqualTo("1.65608432105562e-170"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1cbfffffffffffff)), Is.EqualTo("3.31216864211124e-170"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ccfffffffffffff)), Is.EqualTo("6.62433728422248e-170"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1cdfffffffffffff)), Is.EqualTo("1.3248674568445e-169"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1cefffffffffffff)), Is.EqualTo("2.64973491368899e-169"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1cffffffffffffff)), Is.EqualTo("5.29946982737798e-169"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d0fffffffffffff)), Is.EqualTo("1.0598939654756e-168"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d1fffffffffffff)), Is.EqualTo("2.11978793095119e-168"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d2fffffffffffff)), Is.EqualTo("4.23957586190238e-168"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d3fffffffffffff)), Is.EqualTo("8.47915172380477e-168"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d4fffffffffffff)), Is.EqualTo("1.69583034476095e-167"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d5fffffffffffff)), Is.EqualTo("3.39166068952191e-167"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d6fffffffffffff)), Is.EqualTo("6.78332137904381e-167"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d7fffffffffffff)), Is.EqualTo("1.35666427580876e-166"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d8fffffffffffff)), Is.EqualTo("2.71332855161753e-166"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1d9fffffffffffff)), Is.EqualTo("5.42665710323505e-166"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1dafffffffffffff)), Is.EqualTo("1.08533142064701e-165"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1dbfffffffffffff)), Is.EqualTo("2.17066284129402e-165"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1dcfffffffffffff)), Is.EqualTo("4.34132568258804e-165"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ddfffffffffffff)), Is.EqualTo("8.68265136517608e-165"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1defffffffffffff)), Is.EqualTo("1.73653027303522e-164"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1dffffffffffffff)), Is.EqualTo("3.47306054607043e-164"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e0fffffffffffff)), Is.EqualTo("6.94612109214087e-164"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e1fffffffffffff)), Is.EqualTo("1.38922421842817e-163"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e2fffffffffffff)), Is.EqualTo("2.77844843685635e-163"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e3fffffffffffff)), Is.EqualTo("5.55689687371269e-163"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e4fffffffffffff)), Is.EqualTo("1.11137937474254e-162"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e5fffffffffffff)), Is.EqualTo("2.22275874948508e-162"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e6fffffffffffff)), Is.EqualTo("4.44551749897015e-162"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e7fffffffffffff)), Is.EqualTo("8.89103499794031e-162"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e8fffffffffffff)), Is.EqualTo("1.77820699958806e-161"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1e9fffffffffffff)), Is.EqualTo("3.55641399917612e-161"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1eafffffffffffff)), Is.EqualTo("7.11282799835225e-161"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ebfffffffffffff)), Is.EqualTo("1.42256559967045e-160"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1ecfffffffffffff)), Is.EqualTo("2.8451311993409e-160"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1edfffffffffffff)), Is.EqualTo("5.6902623986818e-160"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1eefffffffffffff)), Is.EqualTo("1.13805247973636e-159"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1effffffffffffff)), Is.EqualTo("2.27610495947272e-159"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f0fffffffffffff)), Is.EqualTo("4.55220991894544e-159"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f1fffffffffffff)), Is.EqualTo("9.10441983789088e-159"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f2fffffffffffff)), Is.EqualTo("1.82088396757818e-158"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f3fffffffffffff)), Is.EqualTo("3.64176793515635e-158"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f4fffffffffffff)), Is.EqualTo("7.2835358703127e-158"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f5fffffffffffff)), Is.EqualTo("1.45670717406254e-157"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f6fffffffffffff)), Is.EqualTo("2.91341434812508e-157"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f7fffffffffffff)), Is.EqualTo("5.82682869625016e-157"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f8fffffffffffff)), Is.EqualTo("1.16536573925003e-156"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1f9fffffffffffff)), Is.EqualTo("2.33073147850006e-156"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1fafffffffffffff)), Is.EqualTo("4.66146295700013e-156"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1fbfffffffffffff)), Is.EqualTo("9.32292591400026e-156"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1fcfffffffffffff)), Is.EqualTo("1.86458518280005e-155"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1fdfffffffffffff)), Is.EqualTo("3.7291703656001e-155"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1fefffffffffffff)), Is.EqualTo("7.45834073120021e-155"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x1fffffffffffffff)), Is.EqualTo("1.49166814624004e-154"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x200fffffffffffff)), Is.EqualTo("2.98333629248008e-154"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x201fffffffffffff)), Is.EqualTo("5.96667258496016e-154"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x202fffffffffffff)), Is.EqualTo("1.19333451699203e-153"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x203fffffffffffff)), Is.EqualTo("2.38666903398407e-153"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x204fffffffffffff)), Is.EqualTo("4.77333806796813e-153"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x205fffffffffffff)), Is.EqualTo("9.54667613593626e-153"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x206fffffffffffff)), Is.EqualTo("1.90933522718725e-152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x207fffffffffffff)), Is.EqualTo("3.81867045437451e-152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x208fffffffffffff)), Is.EqualTo("7.63734090874901e-152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x209fffffffffffff)), Is.EqualTo("1.5274681817498e-151"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x20afffffffffffff)), Is.EqualTo("3.0549363634996e-151"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x20bfffffffffffff)), Is.EqualTo("6.10987272699921e-151"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x20cfffffffffffff)), Is.EqualTo("1.22197454539984e-150"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x20dfffffffffffff)), Is.EqualTo("2.44394909079968e-150"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x20efffffffffffff)), Is.EqualTo("4.88789818159937e-150"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x20ffffffffffffff)), Is.EqualTo("9.77579636319873e-150"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x210fffffffffffff)), Is.EqualTo("1.95515927263975e-149"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x211fffffffffffff)), Is.EqualTo("3.91031854527949e-149"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x212fffffffffffff)), Is.EqualTo("7.82063709055899e-149"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x213fffffffffffff)), Is.EqualTo("1.5641274181118e-148"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x214fffffffffffff)), Is.EqualTo("3.12825483622359e-148"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x215fffffffffffff)), Is.EqualTo("6.25650967244719e-148"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x216fffffffffffff)), Is.EqualTo("1.25130193448944e-147"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x217fffffffffffff)), Is.EqualTo("2.50260386897888e-147"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x218fffffffffffff)), Is.EqualTo("5.00520773795775e-147"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x219fffffffffffff)), Is.EqualTo("1.00104154759155e-146"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x21afffffffffffff)), Is.EqualTo("2.0020830951831e-146"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x21bfffffffffffff)), Is.EqualTo("4.0041661903662e-146"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x21cfffffffffffff)), Is.EqualTo("8.0083323807324e-146"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x21dfffffffffffff)), Is.EqualTo("1.60166647614648e-145"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x21efffffffffffff)), Is.EqualTo("3.20333295229296e-145"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x21ffffffffffffff)), Is.EqualTo("6.40666590458592e-145"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x220fffffffffffff)), Is.EqualTo("1.28133318091718e-144"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x221fffffffffffff)), Is.EqualTo("2.56266636183437e-144"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x222fffffffffffff)), Is.EqualTo("5.12533272366874e-144"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x223fffffffffffff)), Is.EqualTo("1.02506654473375e-143"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x224fffffffffffff)), Is.EqualTo("2.0501330894675e-143"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x225fffffffffffff)), Is.EqualTo("4.10026617893499e-143"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x226fffffffffffff)), Is.EqualTo("8.20053235786998e-143"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x227fffffffffffff)), Is.EqualTo("1.640106471574e-142"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x228fffffffffffff)), Is.EqualTo("3.28021294314799e-142"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x229fffffffffffff)), Is.EqualTo("6.56042588629598e-142"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x22afffffffffffff)), Is.EqualTo("1.3120851772592e-141"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x22bfffffffffffff)), Is.EqualTo("2.62417035451839e-141"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x22cfffffffffffff)), Is.EqualTo("5.24834070903679e-141"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x22dfffffffffffff)), Is.EqualTo("1.04966814180736e-140"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x22efffffffffffff)), Is.EqualTo("2.09933628361472e-140"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x22ffffffffffffff)), Is.EqualTo("4.19867256722943e-140"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x230fffffffffffff)), Is.EqualTo("8.39734513445886e-140"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x231fffffffffffff)), Is.EqualTo("1.67946902689177e-139"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x232fffffffffffff)), Is.EqualTo("3.35893805378354e-139"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x233fffffffffffff)), Is.EqualTo("6.71787610756709e-139"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x234fffffffffffff)), Is.EqualTo("1.34357522151342e-138"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x235fffffffffffff)), Is.EqualTo("2.68715044302684e-138"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x236fffffffffffff)), Is.EqualTo("5.37430088605367e-138"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x237fffffffffffff)), Is.EqualTo("1.07486017721073e-137"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x238fffffffffffff)), Is.EqualTo("2.14972035442147e-137"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x239fffffffffffff)), Is.EqualTo("4.29944070884294e-137"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x23afffffffffffff)), Is.EqualTo("8.59888141768587e-137"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x23bfffffffffffff)), Is.EqualTo("1.71977628353717e-136"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x23cfffffffffffff)), Is.EqualTo("3.43955256707435e-136"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x23dfffffffffffff)), Is.EqualTo("6.8791051341487e-136"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x23efffffffffffff)), Is.EqualTo("1.37582102682974e-135"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x23ffffffffffffff)), Is.EqualTo("2.75164205365948e-135"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x240fffffffffffff)), Is.EqualTo("5.50328410731896e-135"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x241fffffffffffff)), Is.EqualTo("1.10065682146379e-134"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x242fffffffffffff)), Is.EqualTo("2.20131364292758e-134"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x243fffffffffffff)), Is.EqualTo("4.40262728585517e-134"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x244fffffffffffff)), Is.EqualTo("8.80525457171033e-134"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x245fffffffffffff)), Is.EqualTo("1.76105091434207e-133"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x246fffffffffffff)), Is.EqualTo("3.52210182868413e-133"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x247fffffffffffff)), Is.EqualTo("7.04420365736827e-133"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x248fffffffffffff)), Is.EqualTo("1.40884073147365e-132"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x249fffffffffffff)), Is.EqualTo("2.81768146294731e-132"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x24afffffffffffff)), Is.EqualTo("5.63536292589461e-132"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x24bfffffffffffff)), Is.EqualTo("1.12707258517892e-131"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x24cfffffffffffff)), Is.EqualTo("2.25414517035785e-131"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x24dfffffffffffff)), Is.EqualTo("4.50829034071569e-131"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x24efffffffffffff)), Is.EqualTo("9.01658068143138e-131"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x24ffffffffffffff)), Is.EqualTo("1.80331613628628e-130"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x250fffffffffffff)), Is.EqualTo("3.60663227257255e-130"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x251fffffffffffff)), Is.EqualTo("7.21326454514511e-130"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x252fffffffffffff)), Is.EqualTo("1.44265290902902e-129"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x253fffffffffffff)), Is.EqualTo("2.88530581805804e-129"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x254fffffffffffff)), Is.EqualTo("5.77061163611608e-129"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x255fffffffffffff)), Is.EqualTo("1.15412232722322e-128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x256fffffffffffff)), Is.EqualTo("2.30824465444643e-128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x257fffffffffffff)), Is.EqualTo("4.61648930889287e-128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x258fffffffffffff)), Is.EqualTo("9.23297861778573e-128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x259fffffffffffff)), Is.EqualTo("1.84659572355715e-127"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x25afffffffffffff)), Is.EqualTo("3.69319144711429e-127"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x25bfffffffffffff)), Is.EqualTo("7.38638289422859e-127"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x25cfffffffffffff)), Is.EqualTo("1.47727657884572e-126"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x25dfffffffffffff)), Is.EqualTo("2.95455315769144e-126"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x25efffffffffffff)), Is.EqualTo("5.90910631538287e-126"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x25ffffffffffffff)), Is.EqualTo("1.18182126307657e-125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x260fffffffffffff)), Is.EqualTo("2.36364252615315e-125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x261fffffffffffff)), Is.EqualTo("4.7272850523063e-125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x262fffffffffffff)), Is.EqualTo("9.45457010461259e-125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x263fffffffffffff)), Is.EqualTo("1.89091402092252e-124"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x264fffffffffffff)), Is.EqualTo("3.78182804184504e-124"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x265fffffffffffff)), Is.EqualTo("7.56365608369007e-124"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x266fffffffffffff)), Is.EqualTo("1.51273121673801e-123"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x267fffffffffffff)), Is.EqualTo("3.02546243347603e-123"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x268fffffffffffff)), Is.EqualTo("6.05092486695206e-123"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x269fffffffffffff)), Is.EqualTo("1.21018497339041e-122"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x26afffffffffffff)), Is.EqualTo("2.42036994678082e-122"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x26bfffffffffffff)), Is.EqualTo("4.84073989356165e-122"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x26cfffffffffffff)), Is.EqualTo("9.68147978712329e-122"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x26dfffffffffffff)), Is.EqualTo("1.93629595742466e-121"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x26efffffffffffff)), Is.EqualTo("3.87259191484932e-121"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x26ffffffffffffff)), Is.EqualTo("7.74518382969864e-121"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x270fffffffffffff)), Is.EqualTo("1.54903676593973e-120"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x271fffffffffffff)), Is.EqualTo("3.09807353187945e-120"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x272fffffffffffff)), Is.EqualTo("6.19614706375891e-120"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x273fffffffffffff)), Is.EqualTo("1.23922941275178e-119"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x274fffffffffffff)), Is.EqualTo("2.47845882550356e-119"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x275fffffffffffff)), Is.EqualTo("4.95691765100713e-119"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x276fffffffffffff)), Is.EqualTo("9.91383530201425e-119"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x277fffffffffffff)), Is.EqualTo("1.98276706040285e-118"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x278fffffffffffff)), Is.EqualTo("3.9655341208057e-118"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x279fffffffffffff)), Is.EqualTo("7.9310682416114e-118"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x27afffffffffffff)), Is.EqualTo("1.58621364832228e-117"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x27bfffffffffffff)), Is.EqualTo("3.17242729664456e-117"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x27cfffffffffffff)), Is.EqualTo("6.34485459328912e-117"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x27dfffffffffffff)), Is.EqualTo("1.26897091865782e-116"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x27efffffffffffff)), Is.EqualTo("2.53794183731565e-116"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x27ffffffffffffff)), Is.EqualTo("5.0758836746313e-116"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x280fffffffffffff)), Is.EqualTo("1.01517673492626e-115"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x281fffffffffffff)), Is.EqualTo("2.03035346985252e-115"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x282fffffffffffff)), Is.EqualTo("4.06070693970504e-115"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x283fffffffffffff)), Is.EqualTo("8.12141387941008e-115"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x284fffffffffffff)), Is.EqualTo("1.62428277588202e-114"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x285fffffffffffff)), Is.EqualTo("3.24856555176403e-114"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x286fffffffffffff)), Is.EqualTo("6.49713110352806e-114"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x287fffffffffffff)), Is.EqualTo("1.29942622070561e-113"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x288fffffffffffff)), Is.EqualTo("2.59885244141122e-113"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x289fffffffffffff)), Is.EqualTo("5.19770488282245e-113"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x28afffffffffffff)), Is.EqualTo("1.03954097656449e-112"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x28bfffffffffffff)), Is.EqualTo("2.07908195312898e-112"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x28cfffffffffffff)), Is.EqualTo("4.15816390625796e-112"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x28dfffffffffffff)), Is.EqualTo("8.31632781251592e-112"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x28efffffffffffff)), Is.EqualTo("1.66326556250318e-111"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x28ffffffffffffff)), Is.EqualTo("3.32653112500637e-111"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x290fffffffffffff)), Is.EqualTo("6.65306225001273e-111"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x291fffffffffffff)), Is.EqualTo("1.33061245000255e-110"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x292fffffffffffff)), Is.EqualTo("2.66122490000509e-110"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x293fffffffffffff)), Is.EqualTo("5.32244980001019e-110"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x294fffffffffffff)), Is.EqualTo("1.06448996000204e-109"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x295fffffffffffff)), Is.EqualTo("2.12897992000408e-109"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x296fffffffffffff)), Is.EqualTo("4.25795984000815e-109"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x297fffffffffffff)), Is.EqualTo("8.5159196800163e-109"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x298fffffffffffff)), Is.EqualTo("1.70318393600326e-108"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x299fffffffffffff)), Is.EqualTo("3.40636787200652e-108"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x29afffffffffffff)), Is.EqualTo("6.81273574401304e-108"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x29bfffffffffffff)), Is.EqualTo("1.36254714880261e-107"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x29cfffffffffffff)), Is.EqualTo("2.72509429760522e-107"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x29dfffffffffffff)), Is.EqualTo("5.45018859521043e-107"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x29efffffffffffff)), Is.EqualTo("1.09003771904209e-106"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x29ffffffffffffff)), Is.EqualTo("2.18007543808417e-106"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a0fffffffffffff)), Is.EqualTo("4.36015087616835e-106"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a1fffffffffffff)), Is.EqualTo("8.72030175233669e-106"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a2fffffffffffff)), Is.EqualTo("1.74406035046734e-105"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a3fffffffffffff)), Is.EqualTo("3.48812070093468e-105"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a4fffffffffffff)), Is.EqualTo("6.97624140186935e-105"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a5fffffffffffff)), Is.EqualTo("1.39524828037387e-104"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a6fffffffffffff)), Is.EqualTo("2.79049656074774e-104"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a7fffffffffffff)), Is.EqualTo("5.58099312149548e-104"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a8fffffffffffff)), Is.EqualTo("1.1161986242991e-103"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2a9fffffffffffff)), Is.EqualTo("2.23239724859819e-103"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2aafffffffffffff)), Is.EqualTo("4.46479449719639e-103"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2abfffffffffffff)), Is.EqualTo("8.92958899439277e-103"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2acfffffffffffff)), Is.EqualTo("1.78591779887855e-102"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2adfffffffffffff)), Is.EqualTo("3.57183559775711e-102"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2aefffffffffffff)), Is.EqualTo("7.14367119551422e-102"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2affffffffffffff)), Is.EqualTo("1.42873423910284e-101"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b0fffffffffffff)), Is.EqualTo("2.85746847820569e-101"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b1fffffffffffff)), Is.EqualTo("5.71493695641137e-101"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b2fffffffffffff)), Is.EqualTo("1.14298739128227e-100"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b3fffffffffffff)), Is.EqualTo("2.28597478256455e-100"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b4fffffffffffff)), Is.EqualTo("4.5719495651291e-100"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b5fffffffffffff)), Is.EqualTo("9.1438991302582e-100"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b6fffffffffffff)), Is.EqualTo("1.82877982605164e-99"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b7fffffffffffff)), Is.EqualTo("3.65755965210328e-99"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b8fffffffffffff)), Is.EqualTo("7.31511930420656e-99"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2b9fffffffffffff)), Is.EqualTo("1.46302386084131e-98"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2bafffffffffffff)), Is.EqualTo("2.92604772168262e-98"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2bbfffffffffffff)), Is.EqualTo("5.85209544336525e-98"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2bcfffffffffffff)), Is.EqualTo("1.17041908867305e-97"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2bdfffffffffffff)), Is.EqualTo("2.3408381773461e-97"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2befffffffffffff)), Is.EqualTo("4.6816763546922e-97"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2bffffffffffffff)), Is.EqualTo("9.3633527093844e-97"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c0fffffffffffff)), Is.EqualTo("1.87267054187688e-96"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c1fffffffffffff)), Is.EqualTo("3.74534108375376e-96"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c2fffffffffffff)), Is.EqualTo("7.49068216750752e-96"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c3fffffffffffff)), Is.EqualTo("1.4981364335015e-95"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c4fffffffffffff)), Is.EqualTo("2.99627286700301e-95"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c5fffffffffffff)), Is.EqualTo("5.99254573400601e-95"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c6fffffffffffff)), Is.EqualTo("1.1985091468012e-94"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c7fffffffffffff)), Is.EqualTo("2.39701829360241e-94"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c8fffffffffffff)), Is.EqualTo("4.79403658720481e-94"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2c9fffffffffffff)), Is.EqualTo("9.58807317440962e-94"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2cafffffffffffff)), Is.EqualTo("1.91761463488192e-93"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2cbfffffffffffff)), Is.EqualTo("3.83522926976385e-93"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ccfffffffffffff)), Is.EqualTo("7.6704585395277e-93"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2cdfffffffffffff)), Is.EqualTo("1.53409170790554e-92"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2cefffffffffffff)), Is.EqualTo("3.06818341581108e-92"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2cffffffffffffff)), Is.EqualTo("6.13636683162216e-92"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d0fffffffffffff)), Is.EqualTo("1.22727336632443e-91"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d1fffffffffffff)), Is.EqualTo("2.45454673264886e-91"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d2fffffffffffff)), Is.EqualTo("4.90909346529773e-91"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d3fffffffffffff)), Is.EqualTo("9.81818693059545e-91"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d4fffffffffffff)), Is.EqualTo("1.96363738611909e-90"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d5fffffffffffff)), Is.EqualTo("3.92727477223818e-90"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d6fffffffffffff)), Is.EqualTo("7.85454954447636e-90"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d7fffffffffffff)), Is.EqualTo("1.57090990889527e-89"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d8fffffffffffff)), Is.EqualTo("3.14181981779054e-89"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2d9fffffffffffff)), Is.EqualTo("6.28363963558109e-89"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2dafffffffffffff)), Is.EqualTo("1.25672792711622e-88"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2dbfffffffffffff)), Is.EqualTo("2.51345585423244e-88"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2dcfffffffffffff)), Is.EqualTo("5.02691170846487e-88"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ddfffffffffffff)), Is.EqualTo("1.00538234169297e-87"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2defffffffffffff)), Is.EqualTo("2.01076468338595e-87"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2dffffffffffffff)), Is.EqualTo("4.0215293667719e-87"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e0fffffffffffff)), Is.EqualTo("8.04305873354379e-87"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e1fffffffffffff)), Is.EqualTo("1.60861174670876e-86"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e2fffffffffffff)), Is.EqualTo("3.21722349341752e-86"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e3fffffffffffff)), Is.EqualTo("6.43444698683504e-86"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e4fffffffffffff)), Is.EqualTo("1.28688939736701e-85"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e5fffffffffffff)), Is.EqualTo("2.57377879473401e-85"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e6fffffffffffff)), Is.EqualTo("5.14755758946803e-85"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e7fffffffffffff)), Is.EqualTo("1.02951151789361e-84"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e8fffffffffffff)), Is.EqualTo("2.05902303578721e-84"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2e9fffffffffffff)), Is.EqualTo("4.11804607157442e-84"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2eafffffffffffff)), Is.EqualTo("8.23609214314885e-84"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ebfffffffffffff)), Is.EqualTo("1.64721842862977e-83"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2ecfffffffffffff)), Is.EqualTo("3.29443685725954e-83"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2edfffffffffffff)), Is.EqualTo("6.58887371451908e-83"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2eefffffffffffff)), Is.EqualTo("1.31777474290382e-82"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2effffffffffffff)), Is.EqualTo("2.63554948580763e-82"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f0fffffffffffff)), Is.EqualTo("5.27109897161526e-82"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f1fffffffffffff)), Is.EqualTo("1.05421979432305e-81"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f2fffffffffffff)), Is.EqualTo("2.1084395886461e-81"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f3fffffffffffff)), Is.EqualTo("4.21687917729221e-81"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f4fffffffffffff)), Is.EqualTo("8.43375835458442e-81"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f5fffffffffffff)), Is.EqualTo("1.68675167091688e-80"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f6fffffffffffff)), Is.EqualTo("3.37350334183377e-80"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f7fffffffffffff)), Is.EqualTo("6.74700668366753e-80"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f8fffffffffffff)), Is.EqualTo("1.34940133673351e-79"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2f9fffffffffffff)), Is.EqualTo("2.69880267346701e-79"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2fafffffffffffff)), Is.EqualTo("5.39760534693403e-79"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2fbfffffffffffff)), Is.EqualTo("1.07952106938681e-78"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2fcfffffffffffff)), Is.EqualTo("2.15904213877361e-78"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2fdfffffffffffff)), Is.EqualTo("4.31808427754722e-78"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2fefffffffffffff)), Is.EqualTo("8.63616855509444e-78"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x2fffffffffffffff)), Is.EqualTo("1.72723371101889e-77"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x300fffffffffffff)), Is.EqualTo("3.45446742203778e-77"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x301fffffffffffff)), Is.EqualTo("6.90893484407555e-77"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x302fffffffffffff)), Is.EqualTo("1.38178696881511e-76"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x303fffffffffffff)), Is.EqualTo("2.76357393763022e-76"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x304fffffffffffff)), Is.EqualTo("5.52714787526044e-76"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x305fffffffffffff)), Is.EqualTo("1.10542957505209e-75"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x306fffffffffffff)), Is.EqualTo("2.21085915010418e-75"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x307fffffffffffff)), Is.EqualTo("4.42171830020836e-75"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x308fffffffffffff)), Is.EqualTo("8.84343660041671e-75"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x309fffffffffffff)), Is.EqualTo("1.76868732008334e-74"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x30afffffffffffff)), Is.EqualTo("3.53737464016668e-74"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x30bfffffffffffff)), Is.EqualTo("7.07474928033337e-74"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x30cfffffffffffff)), Is.EqualTo("1.41494985606667e-73"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x30dfffffffffffff)), Is.EqualTo("2.82989971213335e-73"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x30efffffffffffff)), Is.EqualTo("5.65979942426669e-73"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x30ffffffffffffff)), Is.EqualTo("1.13195988485334e-72"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x310fffffffffffff)), Is.EqualTo("2.26391976970668e-72"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x311fffffffffffff)), Is.EqualTo("4.52783953941336e-72"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x312fffffffffffff)), Is.EqualTo("9.05567907882671e-72"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x313fffffffffffff)), Is.EqualTo("1.81113581576534e-71"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x314fffffffffffff)), Is.EqualTo("3.62227163153068e-71"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x315fffffffffffff)), Is.EqualTo("7.24454326306137e-71"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x316fffffffffffff)), Is.EqualTo("1.44890865261227e-70"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x317fffffffffffff)), Is.EqualTo("2.89781730522455e-70"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x318fffffffffffff)), Is.EqualTo("5.7956346104491e-70"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x319fffffffffffff)), Is.EqualTo("1.15912692208982e-69"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x31afffffffffffff)), Is.EqualTo("2.31825384417964e-69"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x31bfffffffffffff)), Is.EqualTo("4.63650768835928e-69"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x31cfffffffffffff)), Is.EqualTo("9.27301537671855e-69"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x31dfffffffffffff)), Is.EqualTo("1.85460307534371e-68"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x31efffffffffffff)), Is.EqualTo("3.70920615068742e-68"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x31ffffffffffffff)), Is.EqualTo("7.41841230137484e-68"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x320fffffffffffff)), Is.EqualTo("1.48368246027497e-67"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x321fffffffffffff)), Is.EqualTo("2.96736492054994e-67"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x322fffffffffffff)), Is.EqualTo("5.93472984109987e-67"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x323fffffffffffff)), Is.EqualTo("1.18694596821997e-66"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x324fffffffffffff)), Is.EqualTo("2.37389193643995e-66"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x325fffffffffffff)), Is.EqualTo("4.7477838728799e-66"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x326fffffffffffff)), Is.EqualTo("9.4955677457598e-66"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x327fffffffffffff)), Is.EqualTo("1.89911354915196e-65"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x328fffffffffffff)), Is.EqualTo("3.79822709830392e-65"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x329fffffffffffff)), Is.EqualTo("7.59645419660784e-65"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x32afffffffffffff)), Is.EqualTo("1.51929083932157e-64"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x32bfffffffffffff)), Is.EqualTo("3.03858167864314e-64"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x32cfffffffffffff)), Is.EqualTo("6.07716335728627e-64"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x32dfffffffffffff)), Is.EqualTo("1.21543267145725e-63"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x32efffffffffffff)), Is.EqualTo("2.43086534291451e-63"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x32ffffffffffffff)), Is.EqualTo("4.86173068582902e-63"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x330fffffffffffff)), Is.EqualTo("9.72346137165803e-63"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x331fffffffffffff)), Is.EqualTo("1.94469227433161e-62"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x332fffffffffffff)), Is.EqualTo("3.88938454866321e-62"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x333fffffffffffff)), Is.EqualTo("7.77876909732643e-62"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x334fffffffffffff)), Is.EqualTo("1.55575381946529e-61"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x335fffffffffffff)), Is.EqualTo("3.11150763893057e-61"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x336fffffffffffff)), Is.EqualTo("6.22301527786114e-61"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x337fffffffffffff)), Is.EqualTo("1.24460305557223e-60"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x338fffffffffffff)), Is.EqualTo("2.48920611114446e-60"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x339fffffffffffff)), Is.EqualTo("4.97841222228891e-60"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x33afffffffffffff)), Is.EqualTo("9.95682444457783e-60"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x33bfffffffffffff)), Is.EqualTo("1.99136488891557e-59"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x33cfffffffffffff)), Is.EqualTo("3.98272977783113e-59"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x33dfffffffffffff)), Is.EqualTo("7.96545955566226e-59"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x33efffffffffffff)), Is.EqualTo("1.59309191113245e-58"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x33ffffffffffffff)), Is.EqualTo("3.1861838222649e-58"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x340fffffffffffff)), Is.EqualTo("6.37236764452981e-58"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x341fffffffffffff)), Is.EqualTo("1.27447352890596e-57"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x342fffffffffffff)), Is.EqualTo("2.54894705781192e-57"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x343fffffffffffff)), Is.EqualTo("5.09789411562385e-57"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x344fffffffffffff)), Is.EqualTo("1.01957882312477e-56"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x345fffffffffffff)), Is.EqualTo("2.03915764624954e-56"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x346fffffffffffff)), Is.EqualTo("4.07831529249908e-56"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x347fffffffffffff)), Is.EqualTo("8.15663058499815e-56"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x348fffffffffffff)), Is.EqualTo("1.63132611699963e-55"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x349fffffffffffff)), Is.EqualTo("3.26265223399926e-55"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x34afffffffffffff)), Is.EqualTo("6.52530446799852e-55"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x34bfffffffffffff)), Is.EqualTo("1.3050608935997e-54"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x34cfffffffffffff)), Is.EqualTo("2.61012178719941e-54"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x34dfffffffffffff)), Is.EqualTo("5.22024357439882e-54"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x34efffffffffffff)), Is.EqualTo("1.04404871487976e-53"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x34ffffffffffffff)), Is.EqualTo("2.08809742975953e-53"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x350fffffffffffff)), Is.EqualTo("4.17619485951906e-53"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x351fffffffffffff)), Is.EqualTo("8.35238971903811e-53"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x352fffffffffffff)), Is.EqualTo("1.67047794380762e-52"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x353fffffffffffff)), Is.EqualTo("3.34095588761524e-52"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x354fffffffffffff)), Is.EqualTo("6.68191177523049e-52"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x355fffffffffffff)), Is.EqualTo("1.3363823550461e-51"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x356fffffffffffff)), Is.EqualTo("2.6727647100922e-51"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x357fffffffffffff)), Is.EqualTo("5.34552942018439e-51"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x358fffffffffffff)), Is.EqualTo("1.06910588403688e-50"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x359fffffffffffff)), Is.EqualTo("2.13821176807376e-50"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x35afffffffffffff)), Is.EqualTo("4.27642353614751e-50"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x35bfffffffffffff)), Is.EqualTo("8.55284707229503e-50"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x35cfffffffffffff)), Is.EqualTo("1.71056941445901e-49"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x35dfffffffffffff)), Is.EqualTo("3.42113882891801e-49"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x35efffffffffffff)), Is.EqualTo("6.84227765783602e-49"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x35ffffffffffffff)), Is.EqualTo("1.3684555315672e-48"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x360fffffffffffff)), Is.EqualTo("2.73691106313441e-48"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x361fffffffffffff)), Is.EqualTo("5.47382212626882e-48"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x362fffffffffffff)), Is.EqualTo("1.09476442525376e-47"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x363fffffffffffff)), Is.EqualTo("2.18952885050753e-47"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x364fffffffffffff)), Is.EqualTo("4.37905770101505e-47"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x365fffffffffffff)), Is.EqualTo("8.75811540203011e-47"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x366fffffffffffff)), Is.EqualTo("1.75162308040602e-46"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x367fffffffffffff)), Is.EqualTo("3.50324616081204e-46"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x368fffffffffffff)), Is.EqualTo("7.00649232162408e-46"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x369fffffffffffff)), Is.EqualTo("1.40129846432482e-45"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x36afffffffffffff)), Is.EqualTo("2.80259692864963e-45"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x36bfffffffffffff)), Is.EqualTo("5.60519385729927e-45"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x36cfffffffffffff)), Is.EqualTo("1.12103877145985e-44"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x36dfffffffffffff)), Is.EqualTo("2.24207754291971e-44"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x36efffffffffffff)), Is.EqualTo("4.48415508583941e-44"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x36ffffffffffffff)), Is.EqualTo("8.96831017167883e-44"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x370fffffffffffff)), Is.EqualTo("1.79366203433577e-43"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x371fffffffffffff)), Is.EqualTo("3.58732406867153e-43"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x372fffffffffffff)), Is.EqualTo("7.17464813734306e-43"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x373fffffffffffff)), Is.EqualTo("1.43492962746861e-42"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x374fffffffffffff)), Is.EqualTo("2.86985925493723e-42"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x375fffffffffffff)), Is.EqualTo("5.73971850987445e-42"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x376fffffffffffff)), Is.EqualTo("1.14794370197489e-41"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x377fffffffffffff)), Is.EqualTo("2.29588740394978e-41"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x378fffffffffffff)), Is.EqualTo("4.59177480789956e-41"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x379fffffffffffff)), Is.EqualTo("9.18354961579912e-41"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x37afffffffffffff)), Is.EqualTo("1.83670992315982e-40"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x37bfffffffffffff)), Is.EqualTo("3.67341984631965e-40"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x37cfffffffffffff)), Is.EqualTo("7.3468396926393e-40"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x37dfffffffffffff)), Is.EqualTo("1.46936793852786e-39"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x37efffffffffffff)), Is.EqualTo("2.93873587705572e-39"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x37ffffffffffffff)), Is.EqualTo("5.87747175411144e-39"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x380fffffffffffff)), Is.EqualTo("1.17549435082229e-38"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x381fffffffffffff)), Is.EqualTo("2.35098870164457e-38"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x382fffffffffffff)), Is.EqualTo("4.70197740328915e-38"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x383fffffffffffff)), Is.EqualTo("9.4039548065783e-38"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x384fffffffffffff)), Is.EqualTo("1.88079096131566e-37"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x385fffffffffffff)), Is.EqualTo("3.76158192263132e-37"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x386fffffffffffff)), Is.EqualTo("7.52316384526264e-37"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x387fffffffffffff)), Is.EqualTo("1.50463276905253e-36"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x388fffffffffffff)), Is.EqualTo("3.00926553810506e-36"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x389fffffffffffff)), Is.EqualTo("6.01853107621011e-36"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x38afffffffffffff)), Is.EqualTo("1.20370621524202e-35"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x38bfffffffffffff)), Is.EqualTo("2.40741243048404e-35"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x38cfffffffffffff)), Is.EqualTo("4.81482486096809e-35"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x38dfffffffffffff)), Is.EqualTo("9.62964972193618e-35"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x38efffffffffffff)), Is.EqualTo("1.92592994438724e-34"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x38ffffffffffffff)), Is.EqualTo("3.85185988877447e-34"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x390fffffffffffff)), Is.EqualTo("7.70371977754894e-34"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x391fffffffffffff)), Is.EqualTo("1.54074395550979e-33"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x392fffffffffffff)), Is.EqualTo("3.08148791101958e-33"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x393fffffffffffff)), Is.EqualTo("6.16297582203915e-33"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x394fffffffffffff)), Is.EqualTo("1.23259516440783e-32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x395fffffffffffff)), Is.EqualTo("2.46519032881566e-32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x396fffffffffffff)), Is.EqualTo("4.93038065763132e-32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x397fffffffffffff)), Is.EqualTo("9.86076131526265e-32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x398fffffffffffff)), Is.EqualTo("1.97215226305253e-31"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x399fffffffffffff)), Is.EqualTo("3.94430452610506e-31"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x39afffffffffffff)), Is.EqualTo("7.88860905221012e-31"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x39bfffffffffffff)), Is.EqualTo("1.57772181044202e-30"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x39cfffffffffffff)), Is.EqualTo("3.15544362088405e-30"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x39dfffffffffffff)), Is.EqualTo("6.31088724176809e-30"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x39efffffffffffff)), Is.EqualTo("1.26217744835362e-29"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x39ffffffffffffff)), Is.EqualTo("2.52435489670724e-29"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a0fffffffffffff)), Is.EqualTo("5.04870979341448e-29"));   // GCC returns 5.04870979341447e-29
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a1fffffffffffff)), Is.EqualTo("1.0097419586829e-28"));    // GCC returns 1.00974195868289e-28
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a2fffffffffffff)), Is.EqualTo("2.01948391736579e-28"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a3fffffffffffff)), Is.EqualTo("4.03896783473158e-28"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a4fffffffffffff)), Is.EqualTo("8.07793566946316e-28"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a5fffffffffffff)), Is.EqualTo("1.61558713389263e-27"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a6fffffffffffff)), Is.EqualTo("3.23117426778526e-27"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a7fffffffffffff)), Is.EqualTo("6.46234853557053e-27"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a8fffffffffffff)), Is.EqualTo("1.29246970711411e-26"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3a9fffffffffffff)), Is.EqualTo("2.58493941422821e-26"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3aafffffffffffff)), Is.EqualTo("5.16987882845642e-26"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3abfffffffffffff)), Is.EqualTo("1.03397576569128e-25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3acfffffffffffff)), Is.EqualTo("2.06795153138257e-25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3adfffffffffffff)), Is.EqualTo("4.13590306276514e-25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3aefffffffffffff)), Is.EqualTo("8.27180612553028e-25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3affffffffffffff)), Is.EqualTo("1.65436122510606e-24"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b0fffffffffffff)), Is.EqualTo("3.30872245021211e-24"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b1fffffffffffff)), Is.EqualTo("6.61744490042422e-24"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b2fffffffffffff)), Is.EqualTo("1.32348898008484e-23"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b3fffffffffffff)), Is.EqualTo("2.64697796016969e-23"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b4fffffffffffff)), Is.EqualTo("5.29395592033938e-23"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b5fffffffffffff)), Is.EqualTo("1.05879118406788e-22"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b6fffffffffffff)), Is.EqualTo("2.11758236813575e-22"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b7fffffffffffff)), Is.EqualTo("4.2351647362715e-22"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b8fffffffffffff)), Is.EqualTo("8.470329472543e-22"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3b9fffffffffffff)), Is.EqualTo("1.6940658945086e-21"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3bafffffffffffff)), Is.EqualTo("3.3881317890172e-21"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3bbfffffffffffff)), Is.EqualTo("6.7762635780344e-21"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3bcfffffffffffff)), Is.EqualTo("1.35525271560688e-20"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3bdfffffffffffff)), Is.EqualTo("2.71050543121376e-20"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3befffffffffffff)), Is.EqualTo("5.42101086242752e-20"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3bffffffffffffff)), Is.EqualTo("1.0842021724855e-19"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c0fffffffffffff)), Is.EqualTo("2.16840434497101e-19"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c1fffffffffffff)), Is.EqualTo("4.33680868994202e-19"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c2fffffffffffff)), Is.EqualTo("8.67361737988403e-19"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c3fffffffffffff)), Is.EqualTo("1.73472347597681e-18"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c4fffffffffffff)), Is.EqualTo("3.46944695195361e-18"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c5fffffffffffff)), Is.EqualTo("6.93889390390723e-18"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c6fffffffffffff)), Is.EqualTo("1.38777878078145e-17"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c7fffffffffffff)), Is.EqualTo("2.77555756156289e-17"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c8fffffffffffff)), Is.EqualTo("5.55111512312578e-17"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3c9fffffffffffff)), Is.EqualTo("1.11022302462516e-16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3cafffffffffffff)), Is.EqualTo("2.22044604925031e-16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3cbfffffffffffff)), Is.EqualTo("4.44089209850063e-16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ccfffffffffffff)), Is.EqualTo("8.88178419700125e-16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3cdfffffffffffff)), Is.EqualTo("1.77635683940025e-15"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3cefffffffffffff)), Is.EqualTo("3.5527136788005e-15"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3cffffffffffffff)), Is.EqualTo("7.105427357601e-15"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d0fffffffffffff)), Is.EqualTo("1.4210854715202e-14"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d1fffffffffffff)), Is.EqualTo("2.8421709430404e-14"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d2fffffffffffff)), Is.EqualTo("5.6843418860808e-14"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d3fffffffffffff)), Is.EqualTo("1.13686837721616e-13"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d4fffffffffffff)), Is.EqualTo("2.27373675443232e-13"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d5fffffffffffff)), Is.EqualTo("4.54747350886464e-13"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d6fffffffffffff)), Is.EqualTo("9.09494701772928e-13"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d7fffffffffffff)), Is.EqualTo("1.81898940354586e-12"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d8fffffffffffff)), Is.EqualTo("3.63797880709171e-12"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3d9fffffffffffff)), Is.EqualTo("7.27595761418343e-12"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3dafffffffffffff)), Is.EqualTo("1.45519152283669e-11"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3dbfffffffffffff)), Is.EqualTo("2.91038304567337e-11"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3dcfffffffffffff)), Is.EqualTo("5.82076609134674e-11"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ddfffffffffffff)), Is.EqualTo("1.16415321826935e-10"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3defffffffffffff)), Is.EqualTo("2.3283064365387e-10"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3dffffffffffffff)), Is.EqualTo("4.65661287307739e-10"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e0fffffffffffff)), Is.EqualTo("9.31322574615478e-10"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e1fffffffffffff)), Is.EqualTo("1.86264514923096e-09"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e2fffffffffffff)), Is.EqualTo("3.72529029846191e-09"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e3fffffffffffff)), Is.EqualTo("7.45058059692383e-09"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e4fffffffffffff)), Is.EqualTo("1.49011611938477e-08"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e5fffffffffffff)), Is.EqualTo("2.98023223876953e-08"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e6fffffffffffff)), Is.EqualTo("5.96046447753906e-08"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e7fffffffffffff)), Is.EqualTo("1.19209289550781e-07"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e8fffffffffffff)), Is.EqualTo("2.38418579101562e-07"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3e9fffffffffffff)), Is.EqualTo("4.76837158203125e-07"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3eafffffffffffff)), Is.EqualTo("9.5367431640625e-07"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ebfffffffffffff)), Is.EqualTo("1.9073486328125e-06"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3ecfffffffffffff)), Is.EqualTo("3.814697265625e-06"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3edfffffffffffff)), Is.EqualTo("7.62939453125e-06"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3eefffffffffffff)), Is.EqualTo("1.52587890625e-05"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3effffffffffffff)), Is.EqualTo("3.0517578125e-05"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f0fffffffffffff)), Is.EqualTo("6.103515625e-05"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f1fffffffffffff)), Is.EqualTo("0.0001220703125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f2fffffffffffff)), Is.EqualTo("0.000244140625"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f3fffffffffffff)), Is.EqualTo("0.00048828125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f4fffffffffffff)), Is.EqualTo("0.0009765625"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f5fffffffffffff)), Is.EqualTo("0.001953125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f6fffffffffffff)), Is.EqualTo("0.00390625"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f7fffffffffffff)), Is.EqualTo("0.0078125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f8fffffffffffff)), Is.EqualTo("0.015625"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3f9fffffffffffff)), Is.EqualTo("0.03125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3fafffffffffffff)), Is.EqualTo("0.0625"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3fbfffffffffffff)), Is.EqualTo("0.125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3fcfffffffffffff)), Is.EqualTo("0.25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3fdfffffffffffff)), Is.EqualTo("0.5"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3fefffffffffffff)), Is.EqualTo("1"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x3fffffffffffffff)), Is.EqualTo("2"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x400fffffffffffff)), Is.EqualTo("4"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x401fffffffffffff)), Is.EqualTo("8"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x402fffffffffffff)), Is.EqualTo("16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x403fffffffffffff)), Is.EqualTo("32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x404fffffffffffff)), Is.EqualTo("64"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x405fffffffffffff)), Is.EqualTo("128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x406fffffffffffff)), Is.EqualTo("256"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x407fffffffffffff)), Is.EqualTo("512"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x408fffffffffffff)), Is.EqualTo("1024"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x409fffffffffffff)), Is.EqualTo("2048"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x40afffffffffffff)), Is.EqualTo("4096"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x40bfffffffffffff)), Is.EqualTo("8192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x40cfffffffffffff)), Is.EqualTo("16384"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x40dfffffffffffff)), Is.EqualTo("32768"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x40efffffffffffff)), Is.EqualTo("65536"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x40ffffffffffffff)), Is.EqualTo("131072"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x410fffffffffffff)), Is.EqualTo("262144"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x411fffffffffffff)), Is.EqualTo("524288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x412fffffffffffff)), Is.EqualTo("1048576"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x413fffffffffffff)), Is.EqualTo("2097152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x414fffffffffffff)), Is.EqualTo("4194304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x415fffffffffffff)), Is.EqualTo("8388608"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x416fffffffffffff)), Is.EqualTo("16777216"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x417fffffffffffff)), Is.EqualTo("33554432"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x418fffffffffffff)), Is.EqualTo("67108864"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x419fffffffffffff)), Is.EqualTo("134217728"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x41afffffffffffff)), Is.EqualTo("268435456"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x41bfffffffffffff)), Is.EqualTo("536870912"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x41cfffffffffffff)), Is.EqualTo("1073741824"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x41dfffffffffffff)), Is.EqualTo("2147483648"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x41efffffffffffff)), Is.EqualTo("4294967296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x41ffffffffffffff)), Is.EqualTo("8589934592"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x420fffffffffffff)), Is.EqualTo("17179869184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x421fffffffffffff)), Is.EqualTo("34359738368"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x422fffffffffffff)), Is.EqualTo("68719476736"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x423fffffffffffff)), Is.EqualTo("137438953472"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x424fffffffffffff)), Is.EqualTo("274877906944"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x425fffffffffffff)), Is.EqualTo("549755813888"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x426fffffffffffff)), Is.EqualTo("1099511627776"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x427fffffffffffff)), Is.EqualTo("2199023255552"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x428fffffffffffff)), Is.EqualTo("4398046511104"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x429fffffffffffff)), Is.EqualTo("8796093022208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x42afffffffffffff)), Is.EqualTo("17592186044416"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x42bfffffffffffff)), Is.EqualTo("35184372088832"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x42cfffffffffffff)), Is.EqualTo("70368744177664"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x42dfffffffffffff)), Is.EqualTo("140737488355328"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x42efffffffffffff)), Is.EqualTo("281474976710656"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x42ffffffffffffff)), Is.EqualTo("562949953421312"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x430fffffffffffff)), Is.EqualTo("1.12589990684262e+15"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x431fffffffffffff)), Is.EqualTo("2.25179981368525e+15"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x432fffffffffffff)), Is.EqualTo("4.5035996273705e+15"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x433fffffffffffff)), Is.EqualTo("9.00719925474099e+15"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x434fffffffffffff)), Is.EqualTo("1.8014398509482e+16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x435fffffffffffff)), Is.EqualTo("3.6028797018964e+16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x436fffffffffffff)), Is.EqualTo("7.20575940379279e+16"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x437fffffffffffff)), Is.EqualTo("1.44115188075856e+17"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x438fffffffffffff)), Is.EqualTo("2.88230376151712e+17"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x439fffffffffffff)), Is.EqualTo("5.76460752303423e+17"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x43afffffffffffff)), Is.EqualTo("1.15292150460685e+18"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x43bfffffffffffff)), Is.EqualTo("2.30584300921369e+18"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x43cfffffffffffff)), Is.EqualTo("4.61168601842739e+18"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x43dfffffffffffff)), Is.EqualTo("9.22337203685477e+18"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x43efffffffffffff)), Is.EqualTo("1.84467440737096e+19"));   // GCC returns 1.84467440737095e+19
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x43ffffffffffffff)), Is.EqualTo("3.68934881474191e+19"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x440fffffffffffff)), Is.EqualTo("7.37869762948382e+19"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x441fffffffffffff)), Is.EqualTo("1.47573952589676e+20"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x442fffffffffffff)), Is.EqualTo("2.95147905179353e+20"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x443fffffffffffff)), Is.EqualTo("5.90295810358706e+20"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x444fffffffffffff)), Is.EqualTo("1.18059162071741e+21"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x445fffffffffffff)), Is.EqualTo("2.36118324143482e+21"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x446fffffffffffff)), Is.EqualTo("4.72236648286964e+21"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x447fffffffffffff)), Is.EqualTo("9.44473296573929e+21"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x448fffffffffffff)), Is.EqualTo("1.88894659314786e+22"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x449fffffffffffff)), Is.EqualTo("3.77789318629572e+22"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x44afffffffffffff)), Is.EqualTo("7.55578637259143e+22"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x44bfffffffffffff)), Is.EqualTo("1.51115727451829e+23"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x44cfffffffffffff)), Is.EqualTo("3.02231454903657e+23"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x44dfffffffffffff)), Is.EqualTo("6.04462909807315e+23"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x44efffffffffffff)), Is.EqualTo("1.20892581961463e+24"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x44ffffffffffffff)), Is.EqualTo("2.41785163922926e+24"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x450fffffffffffff)), Is.EqualTo("4.83570327845852e+24"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x451fffffffffffff)), Is.EqualTo("9.67140655691703e+24"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x452fffffffffffff)), Is.EqualTo("1.93428131138341e+25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x453fffffffffffff)), Is.EqualTo("3.86856262276681e+25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x454fffffffffffff)), Is.EqualTo("7.73712524553363e+25"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x455fffffffffffff)), Is.EqualTo("1.54742504910673e+26"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x456fffffffffffff)), Is.EqualTo("3.09485009821345e+26"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x457fffffffffffff)), Is.EqualTo("6.1897001964269e+26"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x458fffffffffffff)), Is.EqualTo("1.23794003928538e+27"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x459fffffffffffff)), Is.EqualTo("2.47588007857076e+27"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x45afffffffffffff)), Is.EqualTo("4.95176015714152e+27"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x45bfffffffffffff)), Is.EqualTo("9.90352031428304e+27"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x45cfffffffffffff)), Is.EqualTo("1.98070406285661e+28"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x45dfffffffffffff)), Is.EqualTo("3.96140812571322e+28"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x45efffffffffffff)), Is.EqualTo("7.92281625142643e+28"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x45ffffffffffffff)), Is.EqualTo("1.58456325028529e+29"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x460fffffffffffff)), Is.EqualTo("3.16912650057057e+29"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x461fffffffffffff)), Is.EqualTo("6.33825300114115e+29"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x462fffffffffffff)), Is.EqualTo("1.26765060022823e+30"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x463fffffffffffff)), Is.EqualTo("2.53530120045646e+30"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x464fffffffffffff)), Is.EqualTo("5.07060240091292e+30"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x465fffffffffffff)), Is.EqualTo("1.01412048018258e+31"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x466fffffffffffff)), Is.EqualTo("2.02824096036517e+31"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x467fffffffffffff)), Is.EqualTo("4.05648192073033e+31"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x468fffffffffffff)), Is.EqualTo("8.11296384146067e+31"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x469fffffffffffff)), Is.EqualTo("1.62259276829213e+32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x46afffffffffffff)), Is.EqualTo("3.24518553658427e+32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x46bfffffffffffff)), Is.EqualTo("6.49037107316853e+32"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x46cfffffffffffff)), Is.EqualTo("1.29807421463371e+33"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x46dfffffffffffff)), Is.EqualTo("2.59614842926741e+33"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x46efffffffffffff)), Is.EqualTo("5.19229685853483e+33"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x46ffffffffffffff)), Is.EqualTo("1.03845937170697e+34"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x470fffffffffffff)), Is.EqualTo("2.07691874341393e+34"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x471fffffffffffff)), Is.EqualTo("4.15383748682786e+34"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x472fffffffffffff)), Is.EqualTo("8.30767497365572e+34"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x473fffffffffffff)), Is.EqualTo("1.66153499473114e+35"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x474fffffffffffff)), Is.EqualTo("3.32306998946229e+35"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x475fffffffffffff)), Is.EqualTo("6.64613997892458e+35"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x476fffffffffffff)), Is.EqualTo("1.32922799578492e+36"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x477fffffffffffff)), Is.EqualTo("2.65845599156983e+36"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x478fffffffffffff)), Is.EqualTo("5.31691198313966e+36"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x479fffffffffffff)), Is.EqualTo("1.06338239662793e+37"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x47afffffffffffff)), Is.EqualTo("2.12676479325587e+37"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x47bfffffffffffff)), Is.EqualTo("4.25352958651173e+37"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x47cfffffffffffff)), Is.EqualTo("8.50705917302346e+37"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x47dfffffffffffff)), Is.EqualTo("1.70141183460469e+38"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x47efffffffffffff)), Is.EqualTo("3.40282366920938e+38"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x47ffffffffffffff)), Is.EqualTo("6.80564733841877e+38"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x480fffffffffffff)), Is.EqualTo("1.36112946768375e+39"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x481fffffffffffff)), Is.EqualTo("2.72225893536751e+39"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x482fffffffffffff)), Is.EqualTo("5.44451787073501e+39"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x483fffffffffffff)), Is.EqualTo("1.088903574147e+40"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x484fffffffffffff)), Is.EqualTo("2.17780714829401e+40"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x485fffffffffffff)), Is.EqualTo("4.35561429658801e+40"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x486fffffffffffff)), Is.EqualTo("8.71122859317602e+40"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x487fffffffffffff)), Is.EqualTo("1.7422457186352e+41"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x488fffffffffffff)), Is.EqualTo("3.48449143727041e+41"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x489fffffffffffff)), Is.EqualTo("6.96898287454082e+41"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x48afffffffffffff)), Is.EqualTo("1.39379657490816e+42"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x48bfffffffffffff)), Is.EqualTo("2.78759314981633e+42"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x48cfffffffffffff)), Is.EqualTo("5.57518629963266e+42"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x48dfffffffffffff)), Is.EqualTo("1.11503725992653e+43"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x48efffffffffffff)), Is.EqualTo("2.23007451985306e+43"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x48ffffffffffffff)), Is.EqualTo("4.46014903970612e+43"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x490fffffffffffff)), Is.EqualTo("8.92029807941225e+43"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x491fffffffffffff)), Is.EqualTo("1.78405961588245e+44"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x492fffffffffffff)), Is.EqualTo("3.5681192317649e+44"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x493fffffffffffff)), Is.EqualTo("7.1362384635298e+44"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x494fffffffffffff)), Is.EqualTo("1.42724769270596e+45"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x495fffffffffffff)), Is.EqualTo("2.85449538541192e+45"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x496fffffffffffff)), Is.EqualTo("5.70899077082384e+45"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x497fffffffffffff)), Is.EqualTo("1.14179815416477e+46"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x498fffffffffffff)), Is.EqualTo("2.28359630832954e+46"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x499fffffffffffff)), Is.EqualTo("4.56719261665907e+46"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x49afffffffffffff)), Is.EqualTo("9.13438523331814e+46"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x49bfffffffffffff)), Is.EqualTo("1.82687704666363e+47"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x49cfffffffffffff)), Is.EqualTo("3.65375409332726e+47"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x49dfffffffffffff)), Is.EqualTo("7.30750818665451e+47"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x49efffffffffffff)), Is.EqualTo("1.4615016373309e+48"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x49ffffffffffffff)), Is.EqualTo("2.92300327466181e+48"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a0fffffffffffff)), Is.EqualTo("5.84600654932361e+48"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a1fffffffffffff)), Is.EqualTo("1.16920130986472e+49"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a2fffffffffffff)), Is.EqualTo("2.33840261972944e+49"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a3fffffffffffff)), Is.EqualTo("4.67680523945889e+49"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a4fffffffffffff)), Is.EqualTo("9.35361047891778e+49"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a5fffffffffffff)), Is.EqualTo("1.87072209578356e+50"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a6fffffffffffff)), Is.EqualTo("3.74144419156711e+50"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a7fffffffffffff)), Is.EqualTo("7.48288838313422e+50"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a8fffffffffffff)), Is.EqualTo("1.49657767662684e+51"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4a9fffffffffffff)), Is.EqualTo("2.99315535325369e+51"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4aafffffffffffff)), Is.EqualTo("5.98631070650738e+51"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4abfffffffffffff)), Is.EqualTo("1.19726214130148e+52"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4acfffffffffffff)), Is.EqualTo("2.39452428260295e+52"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4adfffffffffffff)), Is.EqualTo("4.7890485652059e+52"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4aefffffffffffff)), Is.EqualTo("9.5780971304118e+52"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4affffffffffffff)), Is.EqualTo("1.91561942608236e+53"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b0fffffffffffff)), Is.EqualTo("3.83123885216472e+53"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b1fffffffffffff)), Is.EqualTo("7.66247770432944e+53"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b2fffffffffffff)), Is.EqualTo("1.53249554086589e+54"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b3fffffffffffff)), Is.EqualTo("3.06499108173178e+54"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b4fffffffffffff)), Is.EqualTo("6.12998216346355e+54"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b5fffffffffffff)), Is.EqualTo("1.22599643269271e+55"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b6fffffffffffff)), Is.EqualTo("2.45199286538542e+55"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b7fffffffffffff)), Is.EqualTo("4.90398573077084e+55"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b8fffffffffffff)), Is.EqualTo("9.80797146154169e+55"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4b9fffffffffffff)), Is.EqualTo("1.96159429230834e+56"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4bafffffffffffff)), Is.EqualTo("3.92318858461668e+56"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4bbfffffffffffff)), Is.EqualTo("7.84637716923335e+56"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4bcfffffffffffff)), Is.EqualTo("1.56927543384667e+57"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4bdfffffffffffff)), Is.EqualTo("3.13855086769334e+57"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4befffffffffffff)), Is.EqualTo("6.27710173538668e+57"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4bffffffffffffff)), Is.EqualTo("1.25542034707734e+58"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c0fffffffffffff)), Is.EqualTo("2.51084069415467e+58"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c1fffffffffffff)), Is.EqualTo("5.02168138830934e+58"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c2fffffffffffff)), Is.EqualTo("1.00433627766187e+59"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c3fffffffffffff)), Is.EqualTo("2.00867255532374e+59"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c4fffffffffffff)), Is.EqualTo("4.01734511064748e+59"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c5fffffffffffff)), Is.EqualTo("8.03469022129495e+59"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c6fffffffffffff)), Is.EqualTo("1.60693804425899e+60"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c7fffffffffffff)), Is.EqualTo("3.21387608851798e+60"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c8fffffffffffff)), Is.EqualTo("6.42775217703596e+60"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4c9fffffffffffff)), Is.EqualTo("1.28555043540719e+61"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4cafffffffffffff)), Is.EqualTo("2.57110087081438e+61"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4cbfffffffffffff)), Is.EqualTo("5.14220174162877e+61"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ccfffffffffffff)), Is.EqualTo("1.02844034832575e+62"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4cdfffffffffffff)), Is.EqualTo("2.05688069665151e+62"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4cefffffffffffff)), Is.EqualTo("4.11376139330301e+62"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4cffffffffffffff)), Is.EqualTo("8.22752278660603e+62"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d0fffffffffffff)), Is.EqualTo("1.64550455732121e+63"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d1fffffffffffff)), Is.EqualTo("3.29100911464241e+63"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d2fffffffffffff)), Is.EqualTo("6.58201822928482e+63"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d3fffffffffffff)), Is.EqualTo("1.31640364585696e+64"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d4fffffffffffff)), Is.EqualTo("2.63280729171393e+64"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d5fffffffffffff)), Is.EqualTo("5.26561458342786e+64"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d6fffffffffffff)), Is.EqualTo("1.05312291668557e+65"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d7fffffffffffff)), Is.EqualTo("2.10624583337114e+65"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d8fffffffffffff)), Is.EqualTo("4.21249166674229e+65"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4d9fffffffffffff)), Is.EqualTo("8.42498333348457e+65"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4dafffffffffffff)), Is.EqualTo("1.68499666669691e+66"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4dbfffffffffffff)), Is.EqualTo("3.36999333339383e+66"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4dcfffffffffffff)), Is.EqualTo("6.73998666678766e+66"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ddfffffffffffff)), Is.EqualTo("1.34799733335753e+67"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4defffffffffffff)), Is.EqualTo("2.69599466671506e+67"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4dffffffffffffff)), Is.EqualTo("5.39198933343013e+67"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e0fffffffffffff)), Is.EqualTo("1.07839786668603e+68"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e1fffffffffffff)), Is.EqualTo("2.15679573337205e+68"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e2fffffffffffff)), Is.EqualTo("4.3135914667441e+68"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e3fffffffffffff)), Is.EqualTo("8.6271829334882e+68"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e4fffffffffffff)), Is.EqualTo("1.72543658669764e+69"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e5fffffffffffff)), Is.EqualTo("3.45087317339528e+69"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e6fffffffffffff)), Is.EqualTo("6.90174634679056e+69"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e7fffffffffffff)), Is.EqualTo("1.38034926935811e+70"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e8fffffffffffff)), Is.EqualTo("2.76069853871623e+70"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4e9fffffffffffff)), Is.EqualTo("5.52139707743245e+70"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4eafffffffffffff)), Is.EqualTo("1.10427941548649e+71"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ebfffffffffffff)), Is.EqualTo("2.20855883097298e+71"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4ecfffffffffffff)), Is.EqualTo("4.41711766194596e+71"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4edfffffffffffff)), Is.EqualTo("8.83423532389192e+71"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4eefffffffffffff)), Is.EqualTo("1.76684706477838e+72"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4effffffffffffff)), Is.EqualTo("3.53369412955677e+72"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f0fffffffffffff)), Is.EqualTo("7.06738825911354e+72"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f1fffffffffffff)), Is.EqualTo("1.41347765182271e+73"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f2fffffffffffff)), Is.EqualTo("2.82695530364541e+73"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f3fffffffffffff)), Is.EqualTo("5.65391060729083e+73"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f4fffffffffffff)), Is.EqualTo("1.13078212145817e+74"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f5fffffffffffff)), Is.EqualTo("2.26156424291633e+74"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f6fffffffffffff)), Is.EqualTo("4.52312848583266e+74"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f7fffffffffffff)), Is.EqualTo("9.04625697166533e+74"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f8fffffffffffff)), Is.EqualTo("1.80925139433307e+75"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4f9fffffffffffff)), Is.EqualTo("3.61850278866613e+75"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4fafffffffffffff)), Is.EqualTo("7.23700557733226e+75"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4fbfffffffffffff)), Is.EqualTo("1.44740111546645e+76"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4fcfffffffffffff)), Is.EqualTo("2.8948022309329e+76"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4fdfffffffffffff)), Is.EqualTo("5.78960446186581e+76"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4fefffffffffffff)), Is.EqualTo("1.15792089237316e+77"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x4fffffffffffffff)), Is.EqualTo("2.31584178474632e+77"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x500fffffffffffff)), Is.EqualTo("4.63168356949265e+77"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x501fffffffffffff)), Is.EqualTo("9.26336713898529e+77"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x502fffffffffffff)), Is.EqualTo("1.85267342779706e+78"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x503fffffffffffff)), Is.EqualTo("3.70534685559412e+78"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x504fffffffffffff)), Is.EqualTo("7.41069371118824e+78"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x505fffffffffffff)), Is.EqualTo("1.48213874223765e+79"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x506fffffffffffff)), Is.EqualTo("2.96427748447529e+79"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x507fffffffffffff)), Is.EqualTo("5.92855496895059e+79"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x508fffffffffffff)), Is.EqualTo("1.18571099379012e+80"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x509fffffffffffff)), Is.EqualTo("2.37142198758024e+80"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x50afffffffffffff)), Is.EqualTo("4.74284397516047e+80"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x50bfffffffffffff)), Is.EqualTo("9.48568795032094e+80"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x50cfffffffffffff)), Is.EqualTo("1.89713759006419e+81"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x50dfffffffffffff)), Is.EqualTo("3.79427518012838e+81"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x50efffffffffffff)), Is.EqualTo("7.58855036025675e+81"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x50ffffffffffffff)), Is.EqualTo("1.51771007205135e+82"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x510fffffffffffff)), Is.EqualTo("3.0354201441027e+82"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x511fffffffffffff)), Is.EqualTo("6.0708402882054e+82"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x512fffffffffffff)), Is.EqualTo("1.21416805764108e+83"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x513fffffffffffff)), Is.EqualTo("2.42833611528216e+83"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x514fffffffffffff)), Is.EqualTo("4.85667223056432e+83"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x515fffffffffffff)), Is.EqualTo("9.71334446112864e+83"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x516fffffffffffff)), Is.EqualTo("1.94266889222573e+84"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x517fffffffffffff)), Is.EqualTo("3.88533778445146e+84"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x518fffffffffffff)), Is.EqualTo("7.77067556890292e+84"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x519fffffffffffff)), Is.EqualTo("1.55413511378058e+85"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x51afffffffffffff)), Is.EqualTo("3.10827022756117e+85"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x51bfffffffffffff)), Is.EqualTo("6.21654045512233e+85"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x51cfffffffffffff)), Is.EqualTo("1.24330809102447e+86"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x51dfffffffffffff)), Is.EqualTo("2.48661618204893e+86"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x51efffffffffffff)), Is.EqualTo("4.97323236409787e+86"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x51ffffffffffffff)), Is.EqualTo("9.94646472819573e+86"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x520fffffffffffff)), Is.EqualTo("1.98929294563915e+87"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x521fffffffffffff)), Is.EqualTo("3.97858589127829e+87"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x522fffffffffffff)), Is.EqualTo("7.95717178255659e+87"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x523fffffffffffff)), Is.EqualTo("1.59143435651132e+88"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x524fffffffffffff)), Is.EqualTo("3.18286871302263e+88"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x525fffffffffffff)), Is.EqualTo("6.36573742604527e+88"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x526fffffffffffff)), Is.EqualTo("1.27314748520905e+89"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x527fffffffffffff)), Is.EqualTo("2.54629497041811e+89"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x528fffffffffffff)), Is.EqualTo("5.09258994083621e+89"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x529fffffffffffff)), Is.EqualTo("1.01851798816724e+90"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x52afffffffffffff)), Is.EqualTo("2.03703597633449e+90"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x52bfffffffffffff)), Is.EqualTo("4.07407195266897e+90"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x52cfffffffffffff)), Is.EqualTo("8.14814390533794e+90"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x52dfffffffffffff)), Is.EqualTo("1.62962878106759e+91"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x52efffffffffffff)), Is.EqualTo("3.25925756213518e+91"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x52ffffffffffffff)), Is.EqualTo("6.51851512427035e+91"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x530fffffffffffff)), Is.EqualTo("1.30370302485407e+92"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x531fffffffffffff)), Is.EqualTo("2.60740604970814e+92"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x532fffffffffffff)), Is.EqualTo("5.21481209941628e+92"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x533fffffffffffff)), Is.EqualTo("1.04296241988326e+93"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x534fffffffffffff)), Is.EqualTo("2.08592483976651e+93"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x535fffffffffffff)), Is.EqualTo("4.17184967953303e+93"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x536fffffffffffff)), Is.EqualTo("8.34369935906605e+93"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x537fffffffffffff)), Is.EqualTo("1.66873987181321e+94"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x538fffffffffffff)), Is.EqualTo("3.33747974362642e+94"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x539fffffffffffff)), Is.EqualTo("6.67495948725284e+94"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x53afffffffffffff)), Is.EqualTo("1.33499189745057e+95"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x53bfffffffffffff)), Is.EqualTo("2.66998379490114e+95"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x53cfffffffffffff)), Is.EqualTo("5.33996758980227e+95"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x53dfffffffffffff)), Is.EqualTo("1.06799351796045e+96"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x53efffffffffffff)), Is.EqualTo("2.13598703592091e+96"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x53ffffffffffffff)), Is.EqualTo("4.27197407184182e+96"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x540fffffffffffff)), Is.EqualTo("8.54394814368364e+96"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x541fffffffffffff)), Is.EqualTo("1.70878962873673e+97"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x542fffffffffffff)), Is.EqualTo("3.41757925747346e+97"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x543fffffffffffff)), Is.EqualTo("6.83515851494691e+97"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x544fffffffffffff)), Is.EqualTo("1.36703170298938e+98"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x545fffffffffffff)), Is.EqualTo("2.73406340597876e+98"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x546fffffffffffff)), Is.EqualTo("5.46812681195753e+98"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x547fffffffffffff)), Is.EqualTo("1.09362536239151e+99"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x548fffffffffffff)), Is.EqualTo("2.18725072478301e+99"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x549fffffffffffff)), Is.EqualTo("4.37450144956602e+99"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x54afffffffffffff)), Is.EqualTo("8.74900289913205e+99"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x54bfffffffffffff)), Is.EqualTo("1.74980057982641e+100"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x54cfffffffffffff)), Is.EqualTo("3.49960115965282e+100"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x54dfffffffffffff)), Is.EqualTo("6.99920231930564e+100"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x54efffffffffffff)), Is.EqualTo("1.39984046386113e+101"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x54ffffffffffffff)), Is.EqualTo("2.79968092772226e+101"));  // GCC returns 2.79968092772225e+101
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x550fffffffffffff)), Is.EqualTo("5.59936185544451e+101"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x551fffffffffffff)), Is.EqualTo("1.1198723710889e+102"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x552fffffffffffff)), Is.EqualTo("2.2397447421778e+102"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x553fffffffffffff)), Is.EqualTo("4.47948948435561e+102"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x554fffffffffffff)), Is.EqualTo("8.95897896871122e+102"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x555fffffffffffff)), Is.EqualTo("1.79179579374224e+103"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x556fffffffffffff)), Is.EqualTo("3.58359158748449e+103"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x557fffffffffffff)), Is.EqualTo("7.16718317496897e+103"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x558fffffffffffff)), Is.EqualTo("1.43343663499379e+104"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x559fffffffffffff)), Is.EqualTo("2.86687326998759e+104"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x55afffffffffffff)), Is.EqualTo("5.73374653997518e+104"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x55bfffffffffffff)), Is.EqualTo("1.14674930799504e+105"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x55cfffffffffffff)), Is.EqualTo("2.29349861599007e+105"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x55dfffffffffffff)), Is.EqualTo("4.58699723198014e+105"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x55efffffffffffff)), Is.EqualTo("9.17399446396029e+105"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x55ffffffffffffff)), Is.EqualTo("1.83479889279206e+106"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x560fffffffffffff)), Is.EqualTo("3.66959778558411e+106"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x561fffffffffffff)), Is.EqualTo("7.33919557116823e+106"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x562fffffffffffff)), Is.EqualTo("1.46783911423365e+107"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x563fffffffffffff)), Is.EqualTo("2.93567822846729e+107"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x564fffffffffffff)), Is.EqualTo("5.87135645693458e+107"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x565fffffffffffff)), Is.EqualTo("1.17427129138692e+108"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x566fffffffffffff)), Is.EqualTo("2.34854258277383e+108"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x567fffffffffffff)), Is.EqualTo("4.69708516554767e+108"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x568fffffffffffff)), Is.EqualTo("9.39417033109533e+108"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x569fffffffffffff)), Is.EqualTo("1.87883406621907e+109"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x56afffffffffffff)), Is.EqualTo("3.75766813243813e+109"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x56bfffffffffffff)), Is.EqualTo("7.51533626487627e+109"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x56cfffffffffffff)), Is.EqualTo("1.50306725297525e+110"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x56dfffffffffffff)), Is.EqualTo("3.00613450595051e+110"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x56efffffffffffff)), Is.EqualTo("6.01226901190101e+110"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x56ffffffffffffff)), Is.EqualTo("1.2024538023802e+111"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x570fffffffffffff)), Is.EqualTo("2.40490760476041e+111"));  // GCC returns 2.4049076047604e+111
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x571fffffffffffff)), Is.EqualTo("4.80981520952081e+111"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x572fffffffffffff)), Is.EqualTo("9.61963041904162e+111"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x573fffffffffffff)), Is.EqualTo("1.92392608380832e+112"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x574fffffffffffff)), Is.EqualTo("3.84785216761665e+112"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x575fffffffffffff)), Is.EqualTo("7.6957043352333e+112"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x576fffffffffffff)), Is.EqualTo("1.53914086704666e+113"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x577fffffffffffff)), Is.EqualTo("3.07828173409332e+113"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x578fffffffffffff)), Is.EqualTo("6.15656346818664e+113"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x579fffffffffffff)), Is.EqualTo("1.23131269363733e+114"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x57afffffffffffff)), Is.EqualTo("2.46262538727465e+114"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x57bfffffffffffff)), Is.EqualTo("4.92525077454931e+114"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x57cfffffffffffff)), Is.EqualTo("9.85050154909862e+114"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x57dfffffffffffff)), Is.EqualTo("1.97010030981972e+115"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x57efffffffffffff)), Is.EqualTo("3.94020061963945e+115"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x57ffffffffffffff)), Is.EqualTo("7.8804012392789e+115"));   // GCC returns 7.88040123927889e+115
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x580fffffffffffff)), Is.EqualTo("1.57608024785578e+116"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x581fffffffffffff)), Is.EqualTo("3.15216049571156e+116"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x582fffffffffffff)), Is.EqualTo("6.30432099142312e+116"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x583fffffffffffff)), Is.EqualTo("1.26086419828462e+117"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x584fffffffffffff)), Is.EqualTo("2.52172839656925e+117"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x585fffffffffffff)), Is.EqualTo("5.04345679313849e+117"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x586fffffffffffff)), Is.EqualTo("1.0086913586277e+118"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x587fffffffffffff)), Is.EqualTo("2.0173827172554e+118"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x588fffffffffffff)), Is.EqualTo("4.03476543451079e+118"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x589fffffffffffff)), Is.EqualTo("8.06953086902159e+118"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x58afffffffffffff)), Is.EqualTo("1.61390617380432e+119"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x58bfffffffffffff)), Is.EqualTo("3.22781234760864e+119"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x58cfffffffffffff)), Is.EqualTo("6.45562469521727e+119"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x58dfffffffffffff)), Is.EqualTo("1.29112493904345e+120"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x58efffffffffffff)), Is.EqualTo("2.58224987808691e+120"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x58ffffffffffffff)), Is.EqualTo("5.16449975617382e+120"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x590fffffffffffff)), Is.EqualTo("1.03289995123476e+121"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x591fffffffffffff)), Is.EqualTo("2.06579990246953e+121"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x592fffffffffffff)), Is.EqualTo("4.13159980493905e+121"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x593fffffffffffff)), Is.EqualTo("8.26319960987811e+121"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x594fffffffffffff)), Is.EqualTo("1.65263992197562e+122"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x595fffffffffffff)), Is.EqualTo("3.30527984395124e+122"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x596fffffffffffff)), Is.EqualTo("6.61055968790249e+122"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x597fffffffffffff)), Is.EqualTo("1.3221119375805e+123"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x598fffffffffffff)), Is.EqualTo("2.64422387516099e+123"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x599fffffffffffff)), Is.EqualTo("5.28844775032199e+123"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x59afffffffffffff)), Is.EqualTo("1.0576895500644e+124"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x59bfffffffffffff)), Is.EqualTo("2.1153791001288e+124"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x59cfffffffffffff)), Is.EqualTo("4.23075820025759e+124"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x59dfffffffffffff)), Is.EqualTo("8.46151640051518e+124"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x59efffffffffffff)), Is.EqualTo("1.69230328010304e+125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x59ffffffffffffff)), Is.EqualTo("3.38460656020607e+125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a0fffffffffffff)), Is.EqualTo("6.76921312041214e+125"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a1fffffffffffff)), Is.EqualTo("1.35384262408243e+126"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a2fffffffffffff)), Is.EqualTo("2.70768524816486e+126"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a3fffffffffffff)), Is.EqualTo("5.41537049632972e+126"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a4fffffffffffff)), Is.EqualTo("1.08307409926594e+127"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a5fffffffffffff)), Is.EqualTo("2.16614819853189e+127"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a6fffffffffffff)), Is.EqualTo("4.33229639706377e+127"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a7fffffffffffff)), Is.EqualTo("8.66459279412755e+127"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a8fffffffffffff)), Is.EqualTo("1.73291855882551e+128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5a9fffffffffffff)), Is.EqualTo("3.46583711765102e+128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5aafffffffffffff)), Is.EqualTo("6.93167423530204e+128"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5abfffffffffffff)), Is.EqualTo("1.38633484706041e+129"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5acfffffffffffff)), Is.EqualTo("2.77266969412081e+129"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5adfffffffffffff)), Is.EqualTo("5.54533938824163e+129"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5aefffffffffffff)), Is.EqualTo("1.10906787764833e+130"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5affffffffffffff)), Is.EqualTo("2.21813575529665e+130"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b0fffffffffffff)), Is.EqualTo("4.4362715105933e+130"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b1fffffffffffff)), Is.EqualTo("8.87254302118661e+130"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b2fffffffffffff)), Is.EqualTo("1.77450860423732e+131"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b3fffffffffffff)), Is.EqualTo("3.54901720847464e+131"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b4fffffffffffff)), Is.EqualTo("7.09803441694929e+131"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b5fffffffffffff)), Is.EqualTo("1.41960688338986e+132"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b6fffffffffffff)), Is.EqualTo("2.83921376677971e+132"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b7fffffffffffff)), Is.EqualTo("5.67842753355943e+132"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b8fffffffffffff)), Is.EqualTo("1.13568550671189e+133"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5b9fffffffffffff)), Is.EqualTo("2.27137101342377e+133"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5bafffffffffffff)), Is.EqualTo("4.54274202684754e+133"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5bbfffffffffffff)), Is.EqualTo("9.08548405369509e+133"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5bcfffffffffffff)), Is.EqualTo("1.81709681073902e+134"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5bdfffffffffffff)), Is.EqualTo("3.63419362147803e+134"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5befffffffffffff)), Is.EqualTo("7.26838724295607e+134"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5bffffffffffffff)), Is.EqualTo("1.45367744859121e+135"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c0fffffffffffff)), Is.EqualTo("2.90735489718243e+135"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c1fffffffffffff)), Is.EqualTo("5.81470979436485e+135"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c2fffffffffffff)), Is.EqualTo("1.16294195887297e+136"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c3fffffffffffff)), Is.EqualTo("2.32588391774594e+136"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c4fffffffffffff)), Is.EqualTo("4.65176783549188e+136"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c5fffffffffffff)), Is.EqualTo("9.30353567098377e+136"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c6fffffffffffff)), Is.EqualTo("1.86070713419675e+137"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c7fffffffffffff)), Is.EqualTo("3.72141426839351e+137"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c8fffffffffffff)), Is.EqualTo("7.44282853678701e+137"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5c9fffffffffffff)), Is.EqualTo("1.4885657073574e+138"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5cafffffffffffff)), Is.EqualTo("2.97713141471481e+138"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5cbfffffffffffff)), Is.EqualTo("5.95426282942961e+138"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ccfffffffffffff)), Is.EqualTo("1.19085256588592e+139"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5cdfffffffffffff)), Is.EqualTo("2.38170513177184e+139"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5cefffffffffffff)), Is.EqualTo("4.76341026354369e+139"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5cffffffffffffff)), Is.EqualTo("9.52682052708738e+139"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d0fffffffffffff)), Is.EqualTo("1.90536410541748e+140"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d1fffffffffffff)), Is.EqualTo("3.81072821083495e+140"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d2fffffffffffff)), Is.EqualTo("7.6214564216699e+140"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d3fffffffffffff)), Is.EqualTo("1.52429128433398e+141"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d4fffffffffffff)), Is.EqualTo("3.04858256866796e+141"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d5fffffffffffff)), Is.EqualTo("6.09716513733592e+141"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d6fffffffffffff)), Is.EqualTo("1.21943302746718e+142"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d7fffffffffffff)), Is.EqualTo("2.43886605493437e+142"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d8fffffffffffff)), Is.EqualTo("4.87773210986874e+142"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5d9fffffffffffff)), Is.EqualTo("9.75546421973747e+142"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5dafffffffffffff)), Is.EqualTo("1.95109284394749e+143"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5dbfffffffffffff)), Is.EqualTo("3.90218568789499e+143"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5dcfffffffffffff)), Is.EqualTo("7.80437137578998e+143"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ddfffffffffffff)), Is.EqualTo("1.560874275158e+144"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5defffffffffffff)), Is.EqualTo("3.12174855031599e+144"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5dffffffffffffff)), Is.EqualTo("6.24349710063198e+144"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e0fffffffffffff)), Is.EqualTo("1.2486994201264e+145"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e1fffffffffffff)), Is.EqualTo("2.49739884025279e+145"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e2fffffffffffff)), Is.EqualTo("4.99479768050559e+145"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e3fffffffffffff)), Is.EqualTo("9.98959536101117e+145"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e4fffffffffffff)), Is.EqualTo("1.99791907220223e+146"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e5fffffffffffff)), Is.EqualTo("3.99583814440447e+146"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e6fffffffffffff)), Is.EqualTo("7.99167628880894e+146"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e7fffffffffffff)), Is.EqualTo("1.59833525776179e+147"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e8fffffffffffff)), Is.EqualTo("3.19667051552358e+147"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5e9fffffffffffff)), Is.EqualTo("6.39334103104715e+147"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5eafffffffffffff)), Is.EqualTo("1.27866820620943e+148"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ebfffffffffffff)), Is.EqualTo("2.55733641241886e+148"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5ecfffffffffffff)), Is.EqualTo("5.11467282483772e+148"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5edfffffffffffff)), Is.EqualTo("1.02293456496754e+149"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5eefffffffffffff)), Is.EqualTo("2.04586912993509e+149"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5effffffffffffff)), Is.EqualTo("4.09173825987018e+149"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f0fffffffffffff)), Is.EqualTo("8.18347651974035e+149"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f1fffffffffffff)), Is.EqualTo("1.63669530394807e+150"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f2fffffffffffff)), Is.EqualTo("3.27339060789614e+150"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f3fffffffffffff)), Is.EqualTo("6.54678121579228e+150"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f4fffffffffffff)), Is.EqualTo("1.30935624315846e+151"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f5fffffffffffff)), Is.EqualTo("2.61871248631691e+151"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f6fffffffffffff)), Is.EqualTo("5.23742497263383e+151"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f7fffffffffffff)), Is.EqualTo("1.04748499452677e+152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f8fffffffffffff)), Is.EqualTo("2.09496998905353e+152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5f9fffffffffffff)), Is.EqualTo("4.18993997810706e+152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5fafffffffffffff)), Is.EqualTo("8.37987995621412e+152"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5fbfffffffffffff)), Is.EqualTo("1.67597599124282e+153"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5fcfffffffffffff)), Is.EqualTo("3.35195198248565e+153"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5fdfffffffffffff)), Is.EqualTo("6.7039039649713e+153"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5fefffffffffffff)), Is.EqualTo("1.34078079299426e+154"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x5fffffffffffffff)), Is.EqualTo("2.68156158598852e+154"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x600fffffffffffff)), Is.EqualTo("5.36312317197704e+154"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x601fffffffffffff)), Is.EqualTo("1.07262463439541e+155"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x602fffffffffffff)), Is.EqualTo("2.14524926879082e+155"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x603fffffffffffff)), Is.EqualTo("4.29049853758163e+155"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x604fffffffffffff)), Is.EqualTo("8.58099707516326e+155"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x605fffffffffffff)), Is.EqualTo("1.71619941503265e+156"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x606fffffffffffff)), Is.EqualTo("3.4323988300653e+156"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x607fffffffffffff)), Is.EqualTo("6.86479766013061e+156"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x608fffffffffffff)), Is.EqualTo("1.37295953202612e+157"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x609fffffffffffff)), Is.EqualTo("2.74591906405224e+157"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x60afffffffffffff)), Is.EqualTo("5.49183812810449e+157"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x60bfffffffffffff)), Is.EqualTo("1.0983676256209e+158"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x60cfffffffffffff)), Is.EqualTo("2.19673525124179e+158"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x60dfffffffffffff)), Is.EqualTo("4.39347050248359e+158"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x60efffffffffffff)), Is.EqualTo("8.78694100496718e+158"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x60ffffffffffffff)), Is.EqualTo("1.75738820099344e+159"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x610fffffffffffff)), Is.EqualTo("3.51477640198687e+159"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x611fffffffffffff)), Is.EqualTo("7.02955280397374e+159"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x612fffffffffffff)), Is.EqualTo("1.40591056079475e+160"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x613fffffffffffff)), Is.EqualTo("2.8118211215895e+160"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x614fffffffffffff)), Is.EqualTo("5.62364224317899e+160"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x615fffffffffffff)), Is.EqualTo("1.1247284486358e+161"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x616fffffffffffff)), Is.EqualTo("2.2494568972716e+161"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x617fffffffffffff)), Is.EqualTo("4.4989137945432e+161"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x618fffffffffffff)), Is.EqualTo("8.99782758908639e+161"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x619fffffffffffff)), Is.EqualTo("1.79956551781728e+162"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x61afffffffffffff)), Is.EqualTo("3.59913103563456e+162"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x61bfffffffffffff)), Is.EqualTo("7.19826207126911e+162"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x61cfffffffffffff)), Is.EqualTo("1.43965241425382e+163"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x61dfffffffffffff)), Is.EqualTo("2.87930482850765e+163"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x61efffffffffffff)), Is.EqualTo("5.75860965701529e+163"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x61ffffffffffffff)), Is.EqualTo("1.15172193140306e+164"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x620fffffffffffff)), Is.EqualTo("2.30344386280612e+164"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x621fffffffffffff)), Is.EqualTo("4.60688772561223e+164"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x622fffffffffffff)), Is.EqualTo("9.21377545122447e+164"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x623fffffffffffff)), Is.EqualTo("1.84275509024489e+165"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x624fffffffffffff)), Is.EqualTo("3.68551018048979e+165"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x625fffffffffffff)), Is.EqualTo("7.37102036097957e+165"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x626fffffffffffff)), Is.EqualTo("1.47420407219591e+166"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x627fffffffffffff)), Is.EqualTo("2.94840814439183e+166"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x628fffffffffffff)), Is.EqualTo("5.89681628878366e+166"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x629fffffffffffff)), Is.EqualTo("1.17936325775673e+167"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x62afffffffffffff)), Is.EqualTo("2.35872651551346e+167"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x62bfffffffffffff)), Is.EqualTo("4.71745303102693e+167"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x62cfffffffffffff)), Is.EqualTo("9.43490606205385e+167"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x62dfffffffffffff)), Is.EqualTo("1.88698121241077e+168"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x62efffffffffffff)), Is.EqualTo("3.77396242482154e+168"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x62ffffffffffffff)), Is.EqualTo("7.54792484964308e+168"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x630fffffffffffff)), Is.EqualTo("1.50958496992862e+169"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x631fffffffffffff)), Is.EqualTo("3.01916993985723e+169"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x632fffffffffffff)), Is.EqualTo("6.03833987971447e+169"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x633fffffffffffff)), Is.EqualTo("1.20766797594289e+170"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x634fffffffffffff)), Is.EqualTo("2.41533595188579e+170"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x635fffffffffffff)), Is.EqualTo("4.83067190377157e+170"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x636fffffffffffff)), Is.EqualTo("9.66134380754314e+170"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x637fffffffffffff)), Is.EqualTo("1.93226876150863e+171"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x638fffffffffffff)), Is.EqualTo("3.86453752301726e+171"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x639fffffffffffff)), Is.EqualTo("7.72907504603452e+171"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x63afffffffffffff)), Is.EqualTo("1.5458150092069e+172"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x63bfffffffffffff)), Is.EqualTo("3.09163001841381e+172"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x63cfffffffffffff)), Is.EqualTo("6.18326003682761e+172"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x63dfffffffffffff)), Is.EqualTo("1.23665200736552e+173"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x63efffffffffffff)), Is.EqualTo("2.47330401473105e+173"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x63ffffffffffffff)), Is.EqualTo("4.94660802946209e+173"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x640fffffffffffff)), Is.EqualTo("9.89321605892418e+173"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x641fffffffffffff)), Is.EqualTo("1.97864321178484e+174"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x642fffffffffffff)), Is.EqualTo("3.95728642356967e+174"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x643fffffffffffff)), Is.EqualTo("7.91457284713934e+174"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x644fffffffffffff)), Is.EqualTo("1.58291456942787e+175"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x645fffffffffffff)), Is.EqualTo("3.16582913885574e+175"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x646fffffffffffff)), Is.EqualTo("6.33165827771148e+175"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x647fffffffffffff)), Is.EqualTo("1.2663316555423e+176"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x648fffffffffffff)), Is.EqualTo("2.53266331108459e+176"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x649fffffffffffff)), Is.EqualTo("5.06532662216918e+176"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x64afffffffffffff)), Is.EqualTo("1.01306532443384e+177"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x64bfffffffffffff)), Is.EqualTo("2.02613064886767e+177"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x64cfffffffffffff)), Is.EqualTo("4.05226129773534e+177"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x64dfffffffffffff)), Is.EqualTo("8.10452259547069e+177"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x64efffffffffffff)), Is.EqualTo("1.62090451909414e+178"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x64ffffffffffffff)), Is.EqualTo("3.24180903818828e+178"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x650fffffffffffff)), Is.EqualTo("6.48361807637655e+178"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x651fffffffffffff)), Is.EqualTo("1.29672361527531e+179"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x652fffffffffffff)), Is.EqualTo("2.59344723055062e+179"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x653fffffffffffff)), Is.EqualTo("5.18689446110124e+179"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x654fffffffffffff)), Is.EqualTo("1.03737889222025e+180"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x655fffffffffffff)), Is.EqualTo("2.0747577844405e+180"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x656fffffffffffff)), Is.EqualTo("4.14951556888099e+180"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x657fffffffffffff)), Is.EqualTo("8.29903113776199e+180"));  // GCC returns 8.29903113776198e+180
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x658fffffffffffff)), Is.EqualTo("1.6598062275524e+181"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x659fffffffffffff)), Is.EqualTo("3.31961245510479e+181"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x65afffffffffffff)), Is.EqualTo("6.63922491020959e+181"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x65bfffffffffffff)), Is.EqualTo("1.32784498204192e+182"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x65cfffffffffffff)), Is.EqualTo("2.65568996408384e+182"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x65dfffffffffffff)), Is.EqualTo("5.31137992816767e+182"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x65efffffffffffff)), Is.EqualTo("1.06227598563353e+183"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x65ffffffffffffff)), Is.EqualTo("2.12455197126707e+183"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x660fffffffffffff)), Is.EqualTo("4.24910394253414e+183"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x661fffffffffffff)), Is.EqualTo("8.49820788506827e+183"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x662fffffffffffff)), Is.EqualTo("1.69964157701365e+184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x663fffffffffffff)), Is.EqualTo("3.39928315402731e+184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x664fffffffffffff)), Is.EqualTo("6.79856630805462e+184"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x665fffffffffffff)), Is.EqualTo("1.35971326161092e+185"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x666fffffffffffff)), Is.EqualTo("2.71942652322185e+185"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x667fffffffffffff)), Is.EqualTo("5.43885304644369e+185"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x668fffffffffffff)), Is.EqualTo("1.08777060928874e+186"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x669fffffffffffff)), Is.EqualTo("2.17554121857748e+186"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x66afffffffffffff)), Is.EqualTo("4.35108243715496e+186"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x66bfffffffffffff)), Is.EqualTo("8.70216487430991e+186"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x66cfffffffffffff)), Is.EqualTo("1.74043297486198e+187"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x66dfffffffffffff)), Is.EqualTo("3.48086594972396e+187"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x66efffffffffffff)), Is.EqualTo("6.96173189944793e+187"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x66ffffffffffffff)), Is.EqualTo("1.39234637988959e+188"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x670fffffffffffff)), Is.EqualTo("2.78469275977917e+188"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x671fffffffffffff)), Is.EqualTo("5.56938551955834e+188"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x672fffffffffffff)), Is.EqualTo("1.11387710391167e+189"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x673fffffffffffff)), Is.EqualTo("2.22775420782334e+189"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x674fffffffffffff)), Is.EqualTo("4.45550841564667e+189"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x675fffffffffffff)), Is.EqualTo("8.91101683129335e+189"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x676fffffffffffff)), Is.EqualTo("1.78220336625867e+190"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x677fffffffffffff)), Is.EqualTo("3.56440673251734e+190"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x678fffffffffffff)), Is.EqualTo("7.12881346503468e+190"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x679fffffffffffff)), Is.EqualTo("1.42576269300694e+191"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x67afffffffffffff)), Is.EqualTo("2.85152538601387e+191"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x67bfffffffffffff)), Is.EqualTo("5.70305077202774e+191"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x67cfffffffffffff)), Is.EqualTo("1.14061015440555e+192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x67dfffffffffffff)), Is.EqualTo("2.2812203088111e+192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x67efffffffffffff)), Is.EqualTo("4.56244061762219e+192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x67ffffffffffffff)), Is.EqualTo("9.12488123524439e+192"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x680fffffffffffff)), Is.EqualTo("1.82497624704888e+193"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x681fffffffffffff)), Is.EqualTo("3.64995249409776e+193"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x682fffffffffffff)), Is.EqualTo("7.29990498819551e+193"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x683fffffffffffff)), Is.EqualTo("1.4599809976391e+194"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x684fffffffffffff)), Is.EqualTo("2.9199619952782e+194"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x685fffffffffffff)), Is.EqualTo("5.83992399055641e+194"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x686fffffffffffff)), Is.EqualTo("1.16798479811128e+195"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x687fffffffffffff)), Is.EqualTo("2.33596959622256e+195"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x688fffffffffffff)), Is.EqualTo("4.67193919244513e+195"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x689fffffffffffff)), Is.EqualTo("9.34387838489025e+195"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x68afffffffffffff)), Is.EqualTo("1.86877567697805e+196"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x68bfffffffffffff)), Is.EqualTo("3.7375513539561e+196"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x68cfffffffffffff)), Is.EqualTo("7.4751027079122e+196"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x68dfffffffffffff)), Is.EqualTo("1.49502054158244e+197"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x68efffffffffffff)), Is.EqualTo("2.99004108316488e+197"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x68ffffffffffffff)), Is.EqualTo("5.98008216632976e+197"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x690fffffffffffff)), Is.EqualTo("1.19601643326595e+198"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x691fffffffffffff)), Is.EqualTo("2.39203286653191e+198"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x692fffffffffffff)), Is.EqualTo("4.78406573306381e+198"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x693fffffffffffff)), Is.EqualTo("9.56813146612762e+198"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x694fffffffffffff)), Is.EqualTo("1.91362629322552e+199"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x695fffffffffffff)), Is.EqualTo("3.82725258645105e+199"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x696fffffffffffff)), Is.EqualTo("7.6545051729021e+199"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x697fffffffffffff)), Is.EqualTo("1.53090103458042e+200"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x698fffffffffffff)), Is.EqualTo("3.06180206916084e+200"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x699fffffffffffff)), Is.EqualTo("6.12360413832168e+200"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x69afffffffffffff)), Is.EqualTo("1.22472082766434e+201"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x69bfffffffffffff)), Is.EqualTo("2.44944165532867e+201"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x69cfffffffffffff)), Is.EqualTo("4.89888331065734e+201"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x69dfffffffffffff)), Is.EqualTo("9.79776662131468e+201"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x69efffffffffffff)), Is.EqualTo("1.95955332426294e+202"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x69ffffffffffffff)), Is.EqualTo("3.91910664852587e+202"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a0fffffffffffff)), Is.EqualTo("7.83821329705175e+202"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a1fffffffffffff)), Is.EqualTo("1.56764265941035e+203"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a2fffffffffffff)), Is.EqualTo("3.1352853188207e+203"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a3fffffffffffff)), Is.EqualTo("6.2705706376414e+203"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a4fffffffffffff)), Is.EqualTo("1.25411412752828e+204"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a5fffffffffffff)), Is.EqualTo("2.50822825505656e+204"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a6fffffffffffff)), Is.EqualTo("5.01645651011312e+204"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a7fffffffffffff)), Is.EqualTo("1.00329130202262e+205"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a8fffffffffffff)), Is.EqualTo("2.00658260404525e+205"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6a9fffffffffffff)), Is.EqualTo("4.01316520809049e+205"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6aafffffffffffff)), Is.EqualTo("8.02633041618099e+205"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6abfffffffffffff)), Is.EqualTo("1.6052660832362e+206"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6acfffffffffffff)), Is.EqualTo("3.2105321664724e+206"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6adfffffffffffff)), Is.EqualTo("6.42106433294479e+206"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6aefffffffffffff)), Is.EqualTo("1.28421286658896e+207"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6affffffffffffff)), Is.EqualTo("2.56842573317792e+207"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b0fffffffffffff)), Is.EqualTo("5.13685146635583e+207"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b1fffffffffffff)), Is.EqualTo("1.02737029327117e+208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b2fffffffffffff)), Is.EqualTo("2.05474058654233e+208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b3fffffffffffff)), Is.EqualTo("4.10948117308467e+208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b4fffffffffffff)), Is.EqualTo("8.21896234616933e+208"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b5fffffffffffff)), Is.EqualTo("1.64379246923387e+209"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b6fffffffffffff)), Is.EqualTo("3.28758493846773e+209"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b7fffffffffffff)), Is.EqualTo("6.57516987693547e+209"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b8fffffffffffff)), Is.EqualTo("1.31503397538709e+210"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6b9fffffffffffff)), Is.EqualTo("2.63006795077419e+210"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6bafffffffffffff)), Is.EqualTo("5.26013590154837e+210"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6bbfffffffffffff)), Is.EqualTo("1.05202718030967e+211"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6bcfffffffffffff)), Is.EqualTo("2.10405436061935e+211"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6bdfffffffffffff)), Is.EqualTo("4.2081087212387e+211"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6befffffffffffff)), Is.EqualTo("8.4162174424774e+211"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6bffffffffffffff)), Is.EqualTo("1.68324348849548e+212"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c0fffffffffffff)), Is.EqualTo("3.36648697699096e+212"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c1fffffffffffff)), Is.EqualTo("6.73297395398192e+212"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c2fffffffffffff)), Is.EqualTo("1.34659479079638e+213"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c3fffffffffffff)), Is.EqualTo("2.69318958159277e+213"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c4fffffffffffff)), Is.EqualTo("5.38637916318553e+213"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c5fffffffffffff)), Is.EqualTo("1.07727583263711e+214"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c6fffffffffffff)), Is.EqualTo("2.15455166527421e+214"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c7fffffffffffff)), Is.EqualTo("4.30910333054843e+214"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c8fffffffffffff)), Is.EqualTo("8.61820666109685e+214"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6c9fffffffffffff)), Is.EqualTo("1.72364133221937e+215"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6cafffffffffffff)), Is.EqualTo("3.44728266443874e+215"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6cbfffffffffffff)), Is.EqualTo("6.89456532887748e+215"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ccfffffffffffff)), Is.EqualTo("1.3789130657755e+216"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6cdfffffffffffff)), Is.EqualTo("2.75782613155099e+216"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6cefffffffffffff)), Is.EqualTo("5.51565226310199e+216"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6cffffffffffffff)), Is.EqualTo("1.1031304526204e+217"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d0fffffffffffff)), Is.EqualTo("2.20626090524079e+217"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d1fffffffffffff)), Is.EqualTo("4.41252181048159e+217"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d2fffffffffffff)), Is.EqualTo("8.82504362096318e+217"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d3fffffffffffff)), Is.EqualTo("1.76500872419264e+218"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d4fffffffffffff)), Is.EqualTo("3.53001744838527e+218"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d5fffffffffffff)), Is.EqualTo("7.06003489677054e+218"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d6fffffffffffff)), Is.EqualTo("1.41200697935411e+219"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d7fffffffffffff)), Is.EqualTo("2.82401395870822e+219"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d8fffffffffffff)), Is.EqualTo("5.64802791741643e+219"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6d9fffffffffffff)), Is.EqualTo("1.12960558348329e+220"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6dafffffffffffff)), Is.EqualTo("2.25921116696657e+220"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6dbfffffffffffff)), Is.EqualTo("4.51842233393315e+220"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6dcfffffffffffff)), Is.EqualTo("9.0368446678663e+220"));   // GCC returns 9.03684466786629e+220
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ddfffffffffffff)), Is.EqualTo("1.80736893357326e+221"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6defffffffffffff)), Is.EqualTo("3.61473786714652e+221"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6dffffffffffffff)), Is.EqualTo("7.22947573429304e+221"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e0fffffffffffff)), Is.EqualTo("1.44589514685861e+222"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e1fffffffffffff)), Is.EqualTo("2.89179029371721e+222"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e2fffffffffffff)), Is.EqualTo("5.78358058743443e+222"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e3fffffffffffff)), Is.EqualTo("1.15671611748689e+223"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e4fffffffffffff)), Is.EqualTo("2.31343223497377e+223"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e5fffffffffffff)), Is.EqualTo("4.62686446994754e+223"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e6fffffffffffff)), Is.EqualTo("9.25372893989509e+223"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e7fffffffffffff)), Is.EqualTo("1.85074578797902e+224"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e8fffffffffffff)), Is.EqualTo("3.70149157595803e+224"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6e9fffffffffffff)), Is.EqualTo("7.40298315191607e+224"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6eafffffffffffff)), Is.EqualTo("1.48059663038321e+225"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ebfffffffffffff)), Is.EqualTo("2.96119326076643e+225"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6ecfffffffffffff)), Is.EqualTo("5.92238652153286e+225"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6edfffffffffffff)), Is.EqualTo("1.18447730430657e+226"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6eefffffffffffff)), Is.EqualTo("2.36895460861314e+226"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6effffffffffffff)), Is.EqualTo("4.73790921722628e+226"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f0fffffffffffff)), Is.EqualTo("9.47581843445257e+226"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f1fffffffffffff)), Is.EqualTo("1.89516368689051e+227"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f2fffffffffffff)), Is.EqualTo("3.79032737378103e+227"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f3fffffffffffff)), Is.EqualTo("7.58065474756205e+227"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f4fffffffffffff)), Is.EqualTo("1.51613094951241e+228"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f5fffffffffffff)), Is.EqualTo("3.03226189902482e+228"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f6fffffffffffff)), Is.EqualTo("6.06452379804964e+228"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f7fffffffffffff)), Is.EqualTo("1.21290475960993e+229"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f8fffffffffffff)), Is.EqualTo("2.42580951921986e+229"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6f9fffffffffffff)), Is.EqualTo("4.85161903843971e+229"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6fafffffffffffff)), Is.EqualTo("9.70323807687943e+229"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6fbfffffffffffff)), Is.EqualTo("1.94064761537589e+230"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6fcfffffffffffff)), Is.EqualTo("3.88129523075177e+230"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6fdfffffffffffff)), Is.EqualTo("7.76259046150354e+230"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6fefffffffffffff)), Is.EqualTo("1.55251809230071e+231"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x6fffffffffffffff)), Is.EqualTo("3.10503618460142e+231"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x700fffffffffffff)), Is.EqualTo("6.21007236920284e+231"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x701fffffffffffff)), Is.EqualTo("1.24201447384057e+232"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x702fffffffffffff)), Is.EqualTo("2.48402894768113e+232"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x703fffffffffffff)), Is.EqualTo("4.96805789536227e+232"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x704fffffffffffff)), Is.EqualTo("9.93611579072454e+232"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x705fffffffffffff)), Is.EqualTo("1.98722315814491e+233"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x706fffffffffffff)), Is.EqualTo("3.97444631628981e+233"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x707fffffffffffff)), Is.EqualTo("7.94889263257963e+233"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x708fffffffffffff)), Is.EqualTo("1.58977852651593e+234"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x709fffffffffffff)), Is.EqualTo("3.17955705303185e+234"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x70afffffffffffff)), Is.EqualTo("6.3591141060637e+234"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x70bfffffffffffff)), Is.EqualTo("1.27182282121274e+235"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x70cfffffffffffff)), Is.EqualTo("2.54364564242548e+235"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x70dfffffffffffff)), Is.EqualTo("5.08729128485096e+235"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x70efffffffffffff)), Is.EqualTo("1.01745825697019e+236"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x70ffffffffffffff)), Is.EqualTo("2.03491651394039e+236"));  // GCC returns 2.03491651394038e+236
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x710fffffffffffff)), Is.EqualTo("4.06983302788077e+236"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x711fffffffffffff)), Is.EqualTo("8.13966605576154e+236"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x712fffffffffffff)), Is.EqualTo("1.62793321115231e+237"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x713fffffffffffff)), Is.EqualTo("3.25586642230462e+237"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x714fffffffffffff)), Is.EqualTo("6.51173284460923e+237"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x715fffffffffffff)), Is.EqualTo("1.30234656892185e+238"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x716fffffffffffff)), Is.EqualTo("2.60469313784369e+238"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x717fffffffffffff)), Is.EqualTo("5.20938627568739e+238"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x718fffffffffffff)), Is.EqualTo("1.04187725513748e+239"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x719fffffffffffff)), Is.EqualTo("2.08375451027495e+239"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x71afffffffffffff)), Is.EqualTo("4.16750902054991e+239"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x71bfffffffffffff)), Is.EqualTo("8.33501804109982e+239"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x71cfffffffffffff)), Is.EqualTo("1.66700360821996e+240"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x71dfffffffffffff)), Is.EqualTo("3.33400721643993e+240"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x71efffffffffffff)), Is.EqualTo("6.66801443287985e+240"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x71ffffffffffffff)), Is.EqualTo("1.33360288657597e+241"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x720fffffffffffff)), Is.EqualTo("2.66720577315194e+241"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x721fffffffffffff)), Is.EqualTo("5.33441154630388e+241"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x722fffffffffffff)), Is.EqualTo("1.06688230926078e+242"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x723fffffffffffff)), Is.EqualTo("2.13376461852155e+242"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x724fffffffffffff)), Is.EqualTo("4.26752923704311e+242"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x725fffffffffffff)), Is.EqualTo("8.53505847408621e+242"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x726fffffffffffff)), Is.EqualTo("1.70701169481724e+243"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x727fffffffffffff)), Is.EqualTo("3.41402338963449e+243"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x728fffffffffffff)), Is.EqualTo("6.82804677926897e+243"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x729fffffffffffff)), Is.EqualTo("1.36560935585379e+244"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x72afffffffffffff)), Is.EqualTo("2.73121871170759e+244"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x72bfffffffffffff)), Is.EqualTo("5.46243742341518e+244"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x72cfffffffffffff)), Is.EqualTo("1.09248748468304e+245"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x72dfffffffffffff)), Is.EqualTo("2.18497496936607e+245"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x72efffffffffffff)), Is.EqualTo("4.36994993873214e+245"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x72ffffffffffffff)), Is.EqualTo("8.73989987746428e+245"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x730fffffffffffff)), Is.EqualTo("1.74797997549286e+246"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x731fffffffffffff)), Is.EqualTo("3.49595995098571e+246"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x732fffffffffffff)), Is.EqualTo("6.99191990197143e+246"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x733fffffffffffff)), Is.EqualTo("1.39838398039429e+247"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x734fffffffffffff)), Is.EqualTo("2.79676796078857e+247"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x735fffffffffffff)), Is.EqualTo("5.59353592157714e+247"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x736fffffffffffff)), Is.EqualTo("1.11870718431543e+248"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x737fffffffffffff)), Is.EqualTo("2.23741436863086e+248"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x738fffffffffffff)), Is.EqualTo("4.47482873726171e+248"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x739fffffffffffff)), Is.EqualTo("8.94965747452342e+248"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x73afffffffffffff)), Is.EqualTo("1.78993149490468e+249"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x73bfffffffffffff)), Is.EqualTo("3.57986298980937e+249"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x73cfffffffffffff)), Is.EqualTo("7.15972597961874e+249"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x73dfffffffffffff)), Is.EqualTo("1.43194519592375e+250"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x73efffffffffffff)), Is.EqualTo("2.8638903918475e+250"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x73ffffffffffffff)), Is.EqualTo("5.72778078369499e+250"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x740fffffffffffff)), Is.EqualTo("1.145556156739e+251"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x741fffffffffffff)), Is.EqualTo("2.291112313478e+251"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x742fffffffffffff)), Is.EqualTo("4.58222462695599e+251"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x743fffffffffffff)), Is.EqualTo("9.16444925391199e+251"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x744fffffffffffff)), Is.EqualTo("1.8328898507824e+252"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x745fffffffffffff)), Is.EqualTo("3.66577970156479e+252"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x746fffffffffffff)), Is.EqualTo("7.33155940312959e+252"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x747fffffffffffff)), Is.EqualTo("1.46631188062592e+253"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x748fffffffffffff)), Is.EqualTo("2.93262376125184e+253"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x749fffffffffffff)), Is.EqualTo("5.86524752250367e+253"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x74afffffffffffff)), Is.EqualTo("1.17304950450073e+254"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x74bfffffffffffff)), Is.EqualTo("2.34609900900147e+254"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x74cfffffffffffff)), Is.EqualTo("4.69219801800294e+254"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x74dfffffffffffff)), Is.EqualTo("9.38439603600587e+254"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x74efffffffffffff)), Is.EqualTo("1.87687920720117e+255"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x74ffffffffffffff)), Is.EqualTo("3.75375841440235e+255"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x750fffffffffffff)), Is.EqualTo("7.5075168288047e+255"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x751fffffffffffff)), Is.EqualTo("1.50150336576094e+256"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x752fffffffffffff)), Is.EqualTo("3.00300673152188e+256"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x753fffffffffffff)), Is.EqualTo("6.00601346304376e+256"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x754fffffffffffff)), Is.EqualTo("1.20120269260875e+257"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x755fffffffffffff)), Is.EqualTo("2.4024053852175e+257"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x756fffffffffffff)), Is.EqualTo("4.80481077043501e+257"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x757fffffffffffff)), Is.EqualTo("9.60962154087002e+257"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x758fffffffffffff)), Is.EqualTo("1.921924308174e+258"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x759fffffffffffff)), Is.EqualTo("3.84384861634801e+258"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x75afffffffffffff)), Is.EqualTo("7.68769723269601e+258"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x75bfffffffffffff)), Is.EqualTo("1.5375394465392e+259"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x75cfffffffffffff)), Is.EqualTo("3.0750788930784e+259"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x75dfffffffffffff)), Is.EqualTo("6.15015778615681e+259"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x75efffffffffffff)), Is.EqualTo("1.23003155723136e+260"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x75ffffffffffffff)), Is.EqualTo("2.46006311446272e+260"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x760fffffffffffff)), Is.EqualTo("4.92012622892545e+260"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x761fffffffffffff)), Is.EqualTo("9.8402524578509e+260"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x762fffffffffffff)), Is.EqualTo("1.96805049157018e+261"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x763fffffffffffff)), Is.EqualTo("3.93610098314036e+261"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x764fffffffffffff)), Is.EqualTo("7.87220196628072e+261"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x765fffffffffffff)), Is.EqualTo("1.57444039325614e+262"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x766fffffffffffff)), Is.EqualTo("3.14888078651229e+262"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x767fffffffffffff)), Is.EqualTo("6.29776157302457e+262"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x768fffffffffffff)), Is.EqualTo("1.25955231460491e+263"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x769fffffffffffff)), Is.EqualTo("2.51910462920983e+263"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x76afffffffffffff)), Is.EqualTo("5.03820925841966e+263"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x76bfffffffffffff)), Is.EqualTo("1.00764185168393e+264"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x76cfffffffffffff)), Is.EqualTo("2.01528370336786e+264"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x76dfffffffffffff)), Is.EqualTo("4.03056740673573e+264"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x76efffffffffffff)), Is.EqualTo("8.06113481347145e+264"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x76ffffffffffffff)), Is.EqualTo("1.61222696269429e+265"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x770fffffffffffff)), Is.EqualTo("3.22445392538858e+265"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x771fffffffffffff)), Is.EqualTo("6.44890785077716e+265"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x772fffffffffffff)), Is.EqualTo("1.28978157015543e+266"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x773fffffffffffff)), Is.EqualTo("2.57956314031087e+266"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x774fffffffffffff)), Is.EqualTo("5.15912628062173e+266"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x775fffffffffffff)), Is.EqualTo("1.03182525612435e+267"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x776fffffffffffff)), Is.EqualTo("2.06365051224869e+267"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x777fffffffffffff)), Is.EqualTo("4.12730102449738e+267"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x778fffffffffffff)), Is.EqualTo("8.25460204899477e+267"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x779fffffffffffff)), Is.EqualTo("1.65092040979895e+268"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x77afffffffffffff)), Is.EqualTo("3.30184081959791e+268"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x77bfffffffffffff)), Is.EqualTo("6.60368163919581e+268"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x77cfffffffffffff)), Is.EqualTo("1.32073632783916e+269"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x77dfffffffffffff)), Is.EqualTo("2.64147265567833e+269"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x77efffffffffffff)), Is.EqualTo("5.28294531135665e+269"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x77ffffffffffffff)), Is.EqualTo("1.05658906227133e+270"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x780fffffffffffff)), Is.EqualTo("2.11317812454266e+270"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x781fffffffffffff)), Is.EqualTo("4.22635624908532e+270"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x782fffffffffffff)), Is.EqualTo("8.45271249817064e+270"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x783fffffffffffff)), Is.EqualTo("1.69054249963413e+271"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x784fffffffffffff)), Is.EqualTo("3.38108499926826e+271"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x785fffffffffffff)), Is.EqualTo("6.76216999853651e+271"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x786fffffffffffff)), Is.EqualTo("1.3524339997073e+272"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x787fffffffffffff)), Is.EqualTo("2.70486799941461e+272"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x788fffffffffffff)), Is.EqualTo("5.40973599882921e+272"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x789fffffffffffff)), Is.EqualTo("1.08194719976584e+273"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x78afffffffffffff)), Is.EqualTo("2.16389439953168e+273"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x78bfffffffffffff)), Is.EqualTo("4.32778879906337e+273"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x78cfffffffffffff)), Is.EqualTo("8.65557759812674e+273"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x78dfffffffffffff)), Is.EqualTo("1.73111551962535e+274"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x78efffffffffffff)), Is.EqualTo("3.4622310392507e+274"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x78ffffffffffffff)), Is.EqualTo("6.92446207850139e+274"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x790fffffffffffff)), Is.EqualTo("1.38489241570028e+275"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x791fffffffffffff)), Is.EqualTo("2.76978483140056e+275"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x792fffffffffffff)), Is.EqualTo("5.53956966280111e+275"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x793fffffffffffff)), Is.EqualTo("1.10791393256022e+276"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x794fffffffffffff)), Is.EqualTo("2.21582786512045e+276"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x795fffffffffffff)), Is.EqualTo("4.43165573024089e+276"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x796fffffffffffff)), Is.EqualTo("8.86331146048178e+276"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x797fffffffffffff)), Is.EqualTo("1.77266229209636e+277"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x798fffffffffffff)), Is.EqualTo("3.54532458419271e+277"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x799fffffffffffff)), Is.EqualTo("7.09064916838542e+277"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x79afffffffffffff)), Is.EqualTo("1.41812983367708e+278"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x79bfffffffffffff)), Is.EqualTo("2.83625966735417e+278"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x79cfffffffffffff)), Is.EqualTo("5.67251933470834e+278"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x79dfffffffffffff)), Is.EqualTo("1.13450386694167e+279"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x79efffffffffffff)), Is.EqualTo("2.26900773388334e+279"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x79ffffffffffffff)), Is.EqualTo("4.53801546776667e+279"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a0fffffffffffff)), Is.EqualTo("9.07603093553334e+279"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a1fffffffffffff)), Is.EqualTo("1.81520618710667e+280"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a2fffffffffffff)), Is.EqualTo("3.63041237421334e+280"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a3fffffffffffff)), Is.EqualTo("7.26082474842667e+280"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a4fffffffffffff)), Is.EqualTo("1.45216494968533e+281"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a5fffffffffffff)), Is.EqualTo("2.90432989937067e+281"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a6fffffffffffff)), Is.EqualTo("5.80865979874134e+281"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a7fffffffffffff)), Is.EqualTo("1.16173195974827e+282"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a8fffffffffffff)), Is.EqualTo("2.32346391949654e+282"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7a9fffffffffffff)), Is.EqualTo("4.64692783899307e+282"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7aafffffffffffff)), Is.EqualTo("9.29385567798614e+282"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7abfffffffffffff)), Is.EqualTo("1.85877113559723e+283"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7acfffffffffffff)), Is.EqualTo("3.71754227119446e+283"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7adfffffffffffff)), Is.EqualTo("7.43508454238891e+283"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7aefffffffffffff)), Is.EqualTo("1.48701690847778e+284"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7affffffffffffff)), Is.EqualTo("2.97403381695557e+284"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b0fffffffffffff)), Is.EqualTo("5.94806763391113e+284"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b1fffffffffffff)), Is.EqualTo("1.18961352678223e+285"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b2fffffffffffff)), Is.EqualTo("2.37922705356445e+285"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b3fffffffffffff)), Is.EqualTo("4.75845410712891e+285"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b4fffffffffffff)), Is.EqualTo("9.51690821425781e+285"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b5fffffffffffff)), Is.EqualTo("1.90338164285156e+286"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b6fffffffffffff)), Is.EqualTo("3.80676328570312e+286"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b7fffffffffffff)), Is.EqualTo("7.61352657140625e+286"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b8fffffffffffff)), Is.EqualTo("1.52270531428125e+287"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7b9fffffffffffff)), Is.EqualTo("3.0454106285625e+287"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7bafffffffffffff)), Is.EqualTo("6.090821257125e+287"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7bbfffffffffffff)), Is.EqualTo("1.218164251425e+288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7bcfffffffffffff)), Is.EqualTo("2.43632850285e+288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7bdfffffffffffff)), Is.EqualTo("4.8726570057e+288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7befffffffffffff)), Is.EqualTo("9.7453140114e+288"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7bffffffffffffff)), Is.EqualTo("1.94906280228e+289"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c0fffffffffffff)), Is.EqualTo("3.89812560456e+289"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c1fffffffffffff)), Is.EqualTo("7.79625120912e+289"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c2fffffffffffff)), Is.EqualTo("1.559250241824e+290"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c3fffffffffffff)), Is.EqualTo("3.118500483648e+290"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c4fffffffffffff)), Is.EqualTo("6.237000967296e+290"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c5fffffffffffff)), Is.EqualTo("1.2474001934592e+291"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c6fffffffffffff)), Is.EqualTo("2.4948003869184e+291"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c7fffffffffffff)), Is.EqualTo("4.9896007738368e+291"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c8fffffffffffff)), Is.EqualTo("9.9792015476736e+291"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7c9fffffffffffff)), Is.EqualTo("1.99584030953472e+292"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7cafffffffffffff)), Is.EqualTo("3.99168061906944e+292"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7cbfffffffffffff)), Is.EqualTo("7.98336123813888e+292"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ccfffffffffffff)), Is.EqualTo("1.59667224762778e+293"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7cdfffffffffffff)), Is.EqualTo("3.19334449525555e+293"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7cefffffffffffff)), Is.EqualTo("6.3866889905111e+293"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7cffffffffffffff)), Is.EqualTo("1.27733779810222e+294"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d0fffffffffffff)), Is.EqualTo("2.55467559620444e+294"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d1fffffffffffff)), Is.EqualTo("5.10935119240888e+294"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d2fffffffffffff)), Is.EqualTo("1.02187023848178e+295"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d3fffffffffffff)), Is.EqualTo("2.04374047696355e+295"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d4fffffffffffff)), Is.EqualTo("4.08748095392711e+295"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d5fffffffffffff)), Is.EqualTo("8.17496190785421e+295"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d6fffffffffffff)), Is.EqualTo("1.63499238157084e+296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d7fffffffffffff)), Is.EqualTo("3.26998476314168e+296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d8fffffffffffff)), Is.EqualTo("6.53996952628337e+296"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7d9fffffffffffff)), Is.EqualTo("1.30799390525667e+297"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7dafffffffffffff)), Is.EqualTo("2.61598781051335e+297"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7dbfffffffffffff)), Is.EqualTo("5.2319756210267e+297"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7dcfffffffffffff)), Is.EqualTo("1.04639512420534e+298"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ddfffffffffffff)), Is.EqualTo("2.09279024841068e+298"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7defffffffffffff)), Is.EqualTo("4.18558049682136e+298"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7dffffffffffffff)), Is.EqualTo("8.37116099364271e+298"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e0fffffffffffff)), Is.EqualTo("1.67423219872854e+299"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e1fffffffffffff)), Is.EqualTo("3.34846439745709e+299"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e2fffffffffffff)), Is.EqualTo("6.69692879491417e+299"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e3fffffffffffff)), Is.EqualTo("1.33938575898283e+300"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e4fffffffffffff)), Is.EqualTo("2.67877151796567e+300"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e5fffffffffffff)), Is.EqualTo("5.35754303593134e+300"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e6fffffffffffff)), Is.EqualTo("1.07150860718627e+301"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e7fffffffffffff)), Is.EqualTo("2.14301721437253e+301"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e8fffffffffffff)), Is.EqualTo("4.28603442874507e+301"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7e9fffffffffffff)), Is.EqualTo("8.57206885749014e+301"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7eafffffffffffff)), Is.EqualTo("1.71441377149803e+302"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ebfffffffffffff)), Is.EqualTo("3.42882754299606e+302"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7ecfffffffffffff)), Is.EqualTo("6.85765508599211e+302"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7edfffffffffffff)), Is.EqualTo("1.37153101719842e+303"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7eefffffffffffff)), Is.EqualTo("2.74306203439684e+303"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7effffffffffffff)), Is.EqualTo("5.48612406879369e+303"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f0fffffffffffff)), Is.EqualTo("1.09722481375874e+304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f1fffffffffffff)), Is.EqualTo("2.19444962751748e+304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f2fffffffffffff)), Is.EqualTo("4.38889925503495e+304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f3fffffffffffff)), Is.EqualTo("8.7777985100699e+304"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f4fffffffffffff)), Is.EqualTo("1.75555970201398e+305"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f5fffffffffffff)), Is.EqualTo("3.51111940402796e+305"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f6fffffffffffff)), Is.EqualTo("7.02223880805592e+305"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f7fffffffffffff)), Is.EqualTo("1.40444776161118e+306"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f8fffffffffffff)), Is.EqualTo("2.80889552322237e+306"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7f9fffffffffffff)), Is.EqualTo("5.61779104644474e+306"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7fafffffffffffff)), Is.EqualTo("1.12355820928895e+307"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7fbfffffffffffff)), Is.EqualTo("2.24711641857789e+307"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7fcfffffffffffff)), Is.EqualTo("4.49423283715579e+307"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7fdfffffffffffff)), Is.EqualTo("8.98846567431158e+307"));
-                Assert.That(SPrintF("%.15g", UInt64ToDouble(0x7fefffffffffffff)), Is.EqualTo("1.79769313486232e+308"));
-            });
-        }
-
-        private static unsafe float UInt32ToFloat(uint value)
-        {
-            return *(float*)&value;
-        }
-
-        [Test]
-        public void FloatBinary()
-        {
-            Assert.Multiple(() => {
-                // Zero special case
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x00000000)), Is.EqualTo("0"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x80000000)), Is.EqualTo("-0"));
-                // Subnormals have exponent with bias of zero
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x00000001)), Is.EqualTo("1.401298e-45"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x00000002)), Is.EqualTo("2.802597e-45"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x00000004)), Is.EqualTo("5.605194e-45"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x00000008)), Is.EqualTo("1.121039e-44"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x00000010)), Is.EqualTo("2.242078e-44"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x00000100)), Is.EqualTo("3.587324e-43"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x00001000)), Is.EqualTo("5.739719e-42"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x00010000)), Is.EqualTo("9.18355e-41"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x00100000)), Is.EqualTo("1.469368e-39"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x00200000)), Is.EqualTo("2.938736e-39"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x00400000)), Is.EqualTo("5.877472e-39"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x007fffff)), Is.EqualTo("1.175494e-38"));
-                // All possible exponents
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x00800000)), Is.EqualTo("1.175494e-38"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x01000000)), Is.EqualTo("2.350989e-38"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x01800000)), Is.EqualTo("4.701977e-38"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x02000000)), Is.EqualTo("9.403955e-38"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x02800000)), Is.EqualTo("1.880791e-37"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x03000000)), Is.EqualTo("3.761582e-37"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x03800000)), Is.EqualTo("7.523164e-37"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x04000000)), Is.EqualTo("1.504633e-36"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x04800000)), Is.EqualTo("3.009266e-36"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x05000000)), Is.EqualTo("6.018531e-36"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x05800000)), Is.EqualTo("1.203706e-35"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x06000000)), Is.EqualTo("2.407412e-35"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x06800000)), Is.EqualTo("4.814825e-35"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x07000000)), Is.EqualTo("9.62965e-35"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x07800000)), Is.EqualTo("1.92593e-34"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x08000000)), Is.EqualTo("3.85186e-34"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x08800000)), Is.EqualTo("7.70372e-34"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x09000000)), Is.EqualTo("1.540744e-33"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x09800000)), Is.EqualTo("3.081488e-33"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0a000000)), Is.EqualTo("6.162976e-33"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0a800000)), Is.EqualTo("1.232595e-32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0b000000)), Is.EqualTo("2.46519e-32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0b800000)), Is.EqualTo("4.930381e-32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0c000000)), Is.EqualTo("9.860761e-32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0c800000)), Is.EqualTo("1.972152e-31"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0d000000)), Is.EqualTo("3.944305e-31"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0d800000)), Is.EqualTo("7.888609e-31"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0e000000)), Is.EqualTo("1.577722e-30"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0e800000)), Is.EqualTo("3.155444e-30"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0f000000)), Is.EqualTo("6.310887e-30"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0f800000)), Is.EqualTo("1.262177e-29"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x10000000)), Is.EqualTo("2.524355e-29"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x10800000)), Is.EqualTo("5.04871e-29"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x11000000)), Is.EqualTo("1.009742e-28"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x11800000)), Is.EqualTo("2.019484e-28"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x12000000)), Is.EqualTo("4.038968e-28"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x12800000)), Is.EqualTo("8.077936e-28"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x13000000)), Is.EqualTo("1.615587e-27"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x13800000)), Is.EqualTo("3.231174e-27"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x14000000)), Is.EqualTo("6.462349e-27"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x14800000)), Is.EqualTo("1.29247e-26"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x15000000)), Is.EqualTo("2.584939e-26"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x15800000)), Is.EqualTo("5.169879e-26"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x16000000)), Is.EqualTo("1.033976e-25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x16800000)), Is.EqualTo("2.067952e-25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x17000000)), Is.EqualTo("4.135903e-25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x17800000)), Is.EqualTo("8.271806e-25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x18000000)), Is.EqualTo("1.654361e-24"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x18800000)), Is.EqualTo("3.308722e-24"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x19000000)), Is.EqualTo("6.617445e-24"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x19800000)), Is.EqualTo("1.323489e-23"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1a000000)), Is.EqualTo("2.646978e-23"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1a800000)), Is.EqualTo("5.293956e-23"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1b000000)), Is.EqualTo("1.058791e-22"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1b800000)), Is.EqualTo("2.117582e-22"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1c000000)), Is.EqualTo("4.235165e-22"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1c800000)), Is.EqualTo("8.470329e-22"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1d000000)), Is.EqualTo("1.694066e-21"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1d800000)), Is.EqualTo("3.388132e-21"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1e000000)), Is.EqualTo("6.776264e-21"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1e800000)), Is.EqualTo("1.355253e-20"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1f000000)), Is.EqualTo("2.710505e-20"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1f800000)), Is.EqualTo("5.421011e-20"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x20000000)), Is.EqualTo("1.084202e-19"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x20800000)), Is.EqualTo("2.168404e-19"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x21000000)), Is.EqualTo("4.336809e-19"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x21800000)), Is.EqualTo("8.673617e-19"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x22000000)), Is.EqualTo("1.734723e-18"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x22800000)), Is.EqualTo("3.469447e-18"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x23000000)), Is.EqualTo("6.938894e-18"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x23800000)), Is.EqualTo("1.387779e-17"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x24000000)), Is.EqualTo("2.775558e-17"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x24800000)), Is.EqualTo("5.551115e-17"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x25000000)), Is.EqualTo("1.110223e-16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x25800000)), Is.EqualTo("2.220446e-16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x26000000)), Is.EqualTo("4.440892e-16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x26800000)), Is.EqualTo("8.881784e-16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x27000000)), Is.EqualTo("1.776357e-15"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x27800000)), Is.EqualTo("3.552714e-15"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x28000000)), Is.EqualTo("7.105427e-15"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x28800000)), Is.EqualTo("1.421085e-14"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x29000000)), Is.EqualTo("2.842171e-14"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x29800000)), Is.EqualTo("5.684342e-14"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2a000000)), Is.EqualTo("1.136868e-13"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2a800000)), Is.EqualTo("2.273737e-13"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2b000000)), Is.EqualTo("4.547474e-13"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2b800000)), Is.EqualTo("9.094947e-13"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2c000000)), Is.EqualTo("1.818989e-12"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2c800000)), Is.EqualTo("3.637979e-12"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2d000000)), Is.EqualTo("7.275958e-12"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2d800000)), Is.EqualTo("1.455192e-11"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2e000000)), Is.EqualTo("2.910383e-11"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2e800000)), Is.EqualTo("5.820766e-11"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2f000000)), Is.EqualTo("1.164153e-10"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2f800000)), Is.EqualTo("2.328306e-10"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x30000000)), Is.EqualTo("4.656613e-10"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x30800000)), Is.EqualTo("9.313226e-10"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x31000000)), Is.EqualTo("1.862645e-09"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x31800000)), Is.EqualTo("3.72529e-09"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x32000000)), Is.EqualTo("7.450581e-09"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x32800000)), Is.EqualTo("1.490116e-08"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x33000000)), Is.EqualTo("2.980232e-08"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x33800000)), Is.EqualTo("5.960464e-08"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x34000000)), Is.EqualTo("1.192093e-07"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x34800000)), Is.EqualTo("2.384186e-07"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x35000000)), Is.EqualTo("4.768372e-07"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x35800000)), Is.EqualTo("9.536743e-07"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x36000000)), Is.EqualTo("1.907349e-06"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x36800000)), Is.EqualTo("3.814697e-06"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x37000000)), Is.EqualTo("7.629395e-06"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x37800000)), Is.EqualTo("1.525879e-05"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x38000000)), Is.EqualTo("3.051758e-05"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x38800000)), Is.EqualTo("6.103516e-05"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x39000000)), Is.EqualTo("0.0001220703"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x39800000)), Is.EqualTo("0.0002441406"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3a000000)), Is.EqualTo("0.0004882813")); // GCC returns 0.0004882812
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3a800000)), Is.EqualTo("0.0009765625"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3b000000)), Is.EqualTo("0.001953125"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3b800000)), Is.EqualTo("0.00390625"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3c000000)), Is.EqualTo("0.0078125"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3c800000)), Is.EqualTo("0.015625"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3d000000)), Is.EqualTo("0.03125"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3d800000)), Is.EqualTo("0.0625"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3e000000)), Is.EqualTo("0.125"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3e800000)), Is.EqualTo("0.25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3f000000)), Is.EqualTo("0.5"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3f800000)), Is.EqualTo("1"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x40000000)), Is.EqualTo("2"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x40800000)), Is.EqualTo("4"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x41000000)), Is.EqualTo("8"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x41800000)), Is.EqualTo("16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x42000000)), Is.EqualTo("32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x42800000)), Is.EqualTo("64"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x43000000)), Is.EqualTo("128"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x43800000)), Is.EqualTo("256"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x44000000)), Is.EqualTo("512"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x44800000)), Is.EqualTo("1024"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x45000000)), Is.EqualTo("2048"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x45800000)), Is.EqualTo("4096"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x46000000)), Is.EqualTo("8192"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x46800000)), Is.EqualTo("16384"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x47000000)), Is.EqualTo("32768"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x47800000)), Is.EqualTo("65536"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x48000000)), Is.EqualTo("131072"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x48800000)), Is.EqualTo("262144"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x49000000)), Is.EqualTo("524288"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x49800000)), Is.EqualTo("1048576"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4a000000)), Is.EqualTo("2097152"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4a800000)), Is.EqualTo("4194304"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4b000000)), Is.EqualTo("8388608"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4b800000)), Is.EqualTo("1.677722e+07"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4c000000)), Is.EqualTo("3.355443e+07"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4c800000)), Is.EqualTo("6.710886e+07"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4d000000)), Is.EqualTo("1.342177e+08"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4d800000)), Is.EqualTo("2.684355e+08"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4e000000)), Is.EqualTo("5.368709e+08"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4e800000)), Is.EqualTo("1.073742e+09"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4f000000)), Is.EqualTo("2.147484e+09"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4f800000)), Is.EqualTo("4.294967e+09"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x50000000)), Is.EqualTo("8.589935e+09"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x50800000)), Is.EqualTo("1.717987e+10"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x51000000)), Is.EqualTo("3.435974e+10"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x51800000)), Is.EqualTo("6.871948e+10"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x52000000)), Is.EqualTo("1.37439e+11"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x52800000)), Is.EqualTo("2.748779e+11"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x53000000)), Is.EqualTo("5.497558e+11"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x53800000)), Is.EqualTo("1.099512e+12"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x54000000)), Is.EqualTo("2.199023e+12"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x54800000)), Is.EqualTo("4.398047e+12"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x55000000)), Is.EqualTo("8.796093e+12"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x55800000)), Is.EqualTo("1.759219e+13"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x56000000)), Is.EqualTo("3.518437e+13"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x56800000)), Is.EqualTo("7.036874e+13"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x57000000)), Is.EqualTo("1.407375e+14"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x57800000)), Is.EqualTo("2.81475e+14"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x58000000)), Is.EqualTo("5.6295e+14"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x58800000)), Is.EqualTo("1.1259e+15"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x59000000)), Is.EqualTo("2.2518e+15"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x59800000)), Is.EqualTo("4.5036e+15"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5a000000)), Is.EqualTo("9.007199e+15"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5a800000)), Is.EqualTo("1.80144e+16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5b000000)), Is.EqualTo("3.60288e+16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5b800000)), Is.EqualTo("7.205759e+16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5c000000)), Is.EqualTo("1.441152e+17"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5c800000)), Is.EqualTo("2.882304e+17"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5d000000)), Is.EqualTo("5.764608e+17"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5d800000)), Is.EqualTo("1.152922e+18"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5e000000)), Is.EqualTo("2.305843e+18"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5e800000)), Is.EqualTo("4.611686e+18"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5f000000)), Is.EqualTo("9.223372e+18"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5f800000)), Is.EqualTo("1.844674e+19"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x60000000)), Is.EqualTo("3.689349e+19"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x60800000)), Is.EqualTo("7.378698e+19"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x61000000)), Is.EqualTo("1.47574e+20"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x61800000)), Is.EqualTo("2.951479e+20"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x62000000)), Is.EqualTo("5.902958e+20"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x62800000)), Is.EqualTo("1.180592e+21"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x63000000)), Is.EqualTo("2.361183e+21"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x63800000)), Is.EqualTo("4.722366e+21"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x64000000)), Is.EqualTo("9.444733e+21"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x64800000)), Is.EqualTo("1.888947e+22"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x65000000)), Is.EqualTo("3.777893e+22"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x65800000)), Is.EqualTo("7.555786e+22"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x66000000)), Is.EqualTo("1.511157e+23"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x66800000)), Is.EqualTo("3.022315e+23"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x67000000)), Is.EqualTo("6.044629e+23"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x67800000)), Is.EqualTo("1.208926e+24"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x68000000)), Is.EqualTo("2.417852e+24"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x68800000)), Is.EqualTo("4.835703e+24"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x69000000)), Is.EqualTo("9.671407e+24"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x69800000)), Is.EqualTo("1.934281e+25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6a000000)), Is.EqualTo("3.868563e+25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6a800000)), Is.EqualTo("7.737125e+25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6b000000)), Is.EqualTo("1.547425e+26"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6b800000)), Is.EqualTo("3.09485e+26"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6c000000)), Is.EqualTo("6.1897e+26"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6c800000)), Is.EqualTo("1.23794e+27"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6d000000)), Is.EqualTo("2.47588e+27"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6d800000)), Is.EqualTo("4.95176e+27"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6e000000)), Is.EqualTo("9.90352e+27"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6e800000)), Is.EqualTo("1.980704e+28"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6f000000)), Is.EqualTo("3.961408e+28"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6f800000)), Is.EqualTo("7.922816e+28"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x70000000)), Is.EqualTo("1.584563e+29"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x70800000)), Is.EqualTo("3.169127e+29"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x71000000)), Is.EqualTo("6.338253e+29"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x71800000)), Is.EqualTo("1.267651e+30"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x72000000)), Is.EqualTo("2.535301e+30"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x72800000)), Is.EqualTo("5.070602e+30"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x73000000)), Is.EqualTo("1.01412e+31"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x73800000)), Is.EqualTo("2.028241e+31"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x74000000)), Is.EqualTo("4.056482e+31"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x74800000)), Is.EqualTo("8.112964e+31"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x75000000)), Is.EqualTo("1.622593e+32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x75800000)), Is.EqualTo("3.245186e+32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x76000000)), Is.EqualTo("6.490371e+32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x76800000)), Is.EqualTo("1.298074e+33"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x77000000)), Is.EqualTo("2.596148e+33"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x77800000)), Is.EqualTo("5.192297e+33"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x78000000)), Is.EqualTo("1.038459e+34"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x78800000)), Is.EqualTo("2.076919e+34"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x79000000)), Is.EqualTo("4.153837e+34"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x79800000)), Is.EqualTo("8.307675e+34"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7a000000)), Is.EqualTo("1.661535e+35"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7a800000)), Is.EqualTo("3.32307e+35"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7b000000)), Is.EqualTo("6.64614e+35"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7b800000)), Is.EqualTo("1.329228e+36"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7c000000)), Is.EqualTo("2.658456e+36"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7c800000)), Is.EqualTo("5.316912e+36"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7d000000)), Is.EqualTo("1.063382e+37"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7d800000)), Is.EqualTo("2.126765e+37"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7e000000)), Is.EqualTo("4.25353e+37"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7e800000)), Is.EqualTo("8.507059e+37"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7f000000)), Is.EqualTo("1.701412e+38"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x00ffffff)), Is.EqualTo("2.350989e-38"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x017fffff)), Is.EqualTo("4.701977e-38"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x01ffffff)), Is.EqualTo("9.403954e-38"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x027fffff)), Is.EqualTo("1.880791e-37"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x02ffffff)), Is.EqualTo("3.761582e-37"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x037fffff)), Is.EqualTo("7.523163e-37"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x03ffffff)), Is.EqualTo("1.504633e-36"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x047fffff)), Is.EqualTo("3.009265e-36"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x04ffffff)), Is.EqualTo("6.018531e-36"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x057fffff)), Is.EqualTo("1.203706e-35"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x05ffffff)), Is.EqualTo("2.407412e-35"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x067fffff)), Is.EqualTo("4.814825e-35"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x06ffffff)), Is.EqualTo("9.629649e-35"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x077fffff)), Is.EqualTo("1.92593e-34"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x07ffffff)), Is.EqualTo("3.85186e-34"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x087fffff)), Is.EqualTo("7.703719e-34"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x08ffffff)), Is.EqualTo("1.540744e-33"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x097fffff)), Is.EqualTo("3.081488e-33"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x09ffffff)), Is.EqualTo("6.162975e-33"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0a7fffff)), Is.EqualTo("1.232595e-32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0affffff)), Is.EqualTo("2.46519e-32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0b7fffff)), Is.EqualTo("4.93038e-32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0bffffff)), Is.EqualTo("9.860761e-32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0c7fffff)), Is.EqualTo("1.972152e-31"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0cffffff)), Is.EqualTo("3.944304e-31"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0d7fffff)), Is.EqualTo("7.888609e-31"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0dffffff)), Is.EqualTo("1.577722e-30"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0e7fffff)), Is.EqualTo("3.155443e-30"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0effffff)), Is.EqualTo("6.310887e-30"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0f7fffff)), Is.EqualTo("1.262177e-29"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x0fffffff)), Is.EqualTo("2.524355e-29"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x107fffff)), Is.EqualTo("5.048709e-29"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x10ffffff)), Is.EqualTo("1.009742e-28"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x117fffff)), Is.EqualTo("2.019484e-28"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x11ffffff)), Is.EqualTo("4.038968e-28"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x127fffff)), Is.EqualTo("8.077935e-28"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x12ffffff)), Is.EqualTo("1.615587e-27"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x137fffff)), Is.EqualTo("3.231174e-27"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x13ffffff)), Is.EqualTo("6.462348e-27"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x147fffff)), Is.EqualTo("1.29247e-26"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x14ffffff)), Is.EqualTo("2.584939e-26"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x157fffff)), Is.EqualTo("5.169879e-26"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x15ffffff)), Is.EqualTo("1.033976e-25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x167fffff)), Is.EqualTo("2.067951e-25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x16ffffff)), Is.EqualTo("4.135903e-25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x177fffff)), Is.EqualTo("8.271806e-25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x17ffffff)), Is.EqualTo("1.654361e-24"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x187fffff)), Is.EqualTo("3.308722e-24"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x18ffffff)), Is.EqualTo("6.617445e-24"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x197fffff)), Is.EqualTo("1.323489e-23"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x19ffffff)), Is.EqualTo("2.646978e-23"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1a7fffff)), Is.EqualTo("5.293956e-23"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1affffff)), Is.EqualTo("1.058791e-22"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1b7fffff)), Is.EqualTo("2.117582e-22"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1bffffff)), Is.EqualTo("4.235164e-22"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1c7fffff)), Is.EqualTo("8.470329e-22"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1cffffff)), Is.EqualTo("1.694066e-21"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1d7fffff)), Is.EqualTo("3.388132e-21"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1dffffff)), Is.EqualTo("6.776263e-21"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1e7fffff)), Is.EqualTo("1.355253e-20"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1effffff)), Is.EqualTo("2.710505e-20"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1f7fffff)), Is.EqualTo("5.421011e-20"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x1fffffff)), Is.EqualTo("1.084202e-19"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x207fffff)), Is.EqualTo("2.168404e-19"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x20ffffff)), Is.EqualTo("4.336808e-19"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x217fffff)), Is.EqualTo("8.673617e-19"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x21ffffff)), Is.EqualTo("1.734723e-18"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x227fffff)), Is.EqualTo("3.469447e-18"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x22ffffff)), Is.EqualTo("6.938893e-18"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x237fffff)), Is.EqualTo("1.387779e-17"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x23ffffff)), Is.EqualTo("2.775557e-17"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x247fffff)), Is.EqualTo("5.551115e-17"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x24ffffff)), Is.EqualTo("1.110223e-16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x257fffff)), Is.EqualTo("2.220446e-16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x25ffffff)), Is.EqualTo("4.440892e-16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x267fffff)), Is.EqualTo("8.881784e-16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x26ffffff)), Is.EqualTo("1.776357e-15"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x277fffff)), Is.EqualTo("3.552713e-15"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x27ffffff)), Is.EqualTo("7.105427e-15"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x287fffff)), Is.EqualTo("1.421085e-14"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x28ffffff)), Is.EqualTo("2.842171e-14"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x297fffff)), Is.EqualTo("5.684342e-14"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x29ffffff)), Is.EqualTo("1.136868e-13"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2a7fffff)), Is.EqualTo("2.273737e-13"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2affffff)), Is.EqualTo("4.547473e-13"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2b7fffff)), Is.EqualTo("9.094946e-13"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2bffffff)), Is.EqualTo("1.818989e-12"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2c7fffff)), Is.EqualTo("3.637979e-12"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2cffffff)), Is.EqualTo("7.275957e-12"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2d7fffff)), Is.EqualTo("1.455191e-11"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2dffffff)), Is.EqualTo("2.910383e-11"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2e7fffff)), Is.EqualTo("5.820766e-11"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2effffff)), Is.EqualTo("1.164153e-10"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2f7fffff)), Is.EqualTo("2.328306e-10"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x2fffffff)), Is.EqualTo("4.656613e-10"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x307fffff)), Is.EqualTo("9.313225e-10"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x30ffffff)), Is.EqualTo("1.862645e-09"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x317fffff)), Is.EqualTo("3.72529e-09"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x31ffffff)), Is.EqualTo("7.45058e-09"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x327fffff)), Is.EqualTo("1.490116e-08"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x32ffffff)), Is.EqualTo("2.980232e-08"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x337fffff)), Is.EqualTo("5.960464e-08"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x33ffffff)), Is.EqualTo("1.192093e-07"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x347fffff)), Is.EqualTo("2.384186e-07"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x34ffffff)), Is.EqualTo("4.768371e-07"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x357fffff)), Is.EqualTo("9.536743e-07"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x35ffffff)), Is.EqualTo("1.907349e-06"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x367fffff)), Is.EqualTo("3.814697e-06"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x36ffffff)), Is.EqualTo("7.629394e-06"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x377fffff)), Is.EqualTo("1.525879e-05"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x37ffffff)), Is.EqualTo("3.051758e-05"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x387fffff)), Is.EqualTo("6.103515e-05"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x38ffffff)), Is.EqualTo("0.0001220703"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x397fffff)), Is.EqualTo("0.0002441406"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x39ffffff)), Is.EqualTo("0.0004882812"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3a7fffff)), Is.EqualTo("0.0009765624"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3affffff)), Is.EqualTo("0.001953125"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3b7fffff)), Is.EqualTo("0.00390625"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3bffffff)), Is.EqualTo("0.0078125"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3c7fffff)), Is.EqualTo("0.015625"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3cffffff)), Is.EqualTo("0.03125"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3d7fffff)), Is.EqualTo("0.0625"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3dffffff)), Is.EqualTo("0.125"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3e7fffff)), Is.EqualTo("0.25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3effffff)), Is.EqualTo("0.5"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3f7fffff)), Is.EqualTo("0.9999999"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x3fffffff)), Is.EqualTo("2"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x407fffff)), Is.EqualTo("4"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x40ffffff)), Is.EqualTo("8"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x417fffff)), Is.EqualTo("16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x41ffffff)), Is.EqualTo("32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x427fffff)), Is.EqualTo("64"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x42ffffff)), Is.EqualTo("128"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x437fffff)), Is.EqualTo("256"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x43ffffff)), Is.EqualTo("512"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x447fffff)), Is.EqualTo("1024"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x44ffffff)), Is.EqualTo("2048"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x457fffff)), Is.EqualTo("4096"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x45ffffff)), Is.EqualTo("8192"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x467fffff)), Is.EqualTo("16384"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x46ffffff)), Is.EqualTo("32768"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x477fffff)), Is.EqualTo("65536"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x47ffffff)), Is.EqualTo("131072"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x487fffff)), Is.EqualTo("262144"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x48ffffff)), Is.EqualTo("524288"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x497fffff)), Is.EqualTo("1048576"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x49ffffff)), Is.EqualTo("2097152"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4a7fffff)), Is.EqualTo("4194304"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4affffff)), Is.EqualTo("8388608"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4b7fffff)), Is.EqualTo("1.677722e+07"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4bffffff)), Is.EqualTo("3.355443e+07"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4c7fffff)), Is.EqualTo("6.710886e+07"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4cffffff)), Is.EqualTo("1.342177e+08"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4d7fffff)), Is.EqualTo("2.684354e+08"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4dffffff)), Is.EqualTo("5.368709e+08"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4e7fffff)), Is.EqualTo("1.073742e+09"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4effffff)), Is.EqualTo("2.147484e+09"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4f7fffff)), Is.EqualTo("4.294967e+09"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x4fffffff)), Is.EqualTo("8.589934e+09"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x507fffff)), Is.EqualTo("1.717987e+10"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x50ffffff)), Is.EqualTo("3.435974e+10"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x517fffff)), Is.EqualTo("6.871947e+10"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x51ffffff)), Is.EqualTo("1.374389e+11"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x527fffff)), Is.EqualTo("2.748779e+11"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x52ffffff)), Is.EqualTo("5.497558e+11"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x537fffff)), Is.EqualTo("1.099512e+12"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x53ffffff)), Is.EqualTo("2.199023e+12"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x547fffff)), Is.EqualTo("4.398046e+12"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x54ffffff)), Is.EqualTo("8.796092e+12"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x557fffff)), Is.EqualTo("1.759218e+13"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x55ffffff)), Is.EqualTo("3.518437e+13"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x567fffff)), Is.EqualTo("7.036874e+13"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x56ffffff)), Is.EqualTo("1.407375e+14"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x577fffff)), Is.EqualTo("2.81475e+14"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x57ffffff)), Is.EqualTo("5.629499e+14"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x587fffff)), Is.EqualTo("1.1259e+15"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x58ffffff)), Is.EqualTo("2.2518e+15"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x597fffff)), Is.EqualTo("4.503599e+15"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x59ffffff)), Is.EqualTo("9.007199e+15"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5a7fffff)), Is.EqualTo("1.80144e+16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5affffff)), Is.EqualTo("3.602879e+16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5b7fffff)), Is.EqualTo("7.205759e+16"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5bffffff)), Is.EqualTo("1.441152e+17"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5c7fffff)), Is.EqualTo("2.882304e+17"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5cffffff)), Is.EqualTo("5.764607e+17"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5d7fffff)), Is.EqualTo("1.152921e+18"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5dffffff)), Is.EqualTo("2.305843e+18"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5e7fffff)), Is.EqualTo("4.611686e+18"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5effffff)), Is.EqualTo("9.223371e+18"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5f7fffff)), Is.EqualTo("1.844674e+19"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x5fffffff)), Is.EqualTo("3.689349e+19"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x607fffff)), Is.EqualTo("7.378697e+19"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x60ffffff)), Is.EqualTo("1.475739e+20"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x617fffff)), Is.EqualTo("2.951479e+20"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x61ffffff)), Is.EqualTo("5.902958e+20"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x627fffff)), Is.EqualTo("1.180592e+21"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x62ffffff)), Is.EqualTo("2.361183e+21"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x637fffff)), Is.EqualTo("4.722366e+21"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x63ffffff)), Is.EqualTo("9.444732e+21"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x647fffff)), Is.EqualTo("1.888946e+22"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x64ffffff)), Is.EqualTo("3.777893e+22"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x657fffff)), Is.EqualTo("7.555786e+22"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x65ffffff)), Is.EqualTo("1.511157e+23"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x667fffff)), Is.EqualTo("3.022314e+23"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x66ffffff)), Is.EqualTo("6.044629e+23"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x677fffff)), Is.EqualTo("1.208926e+24"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x67ffffff)), Is.EqualTo("2.417851e+24"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x687fffff)), Is.EqualTo("4.835703e+24"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x68ffffff)), Is.EqualTo("9.671406e+24"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x697fffff)), Is.EqualTo("1.934281e+25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x69ffffff)), Is.EqualTo("3.868562e+25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6a7fffff)), Is.EqualTo("7.737125e+25"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6affffff)), Is.EqualTo("1.547425e+26"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6b7fffff)), Is.EqualTo("3.09485e+26"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6bffffff)), Is.EqualTo("6.1897e+26"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6c7fffff)), Is.EqualTo("1.23794e+27"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6cffffff)), Is.EqualTo("2.47588e+27"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6d7fffff)), Is.EqualTo("4.95176e+27"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6dffffff)), Is.EqualTo("9.90352e+27"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6e7fffff)), Is.EqualTo("1.980704e+28"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6effffff)), Is.EqualTo("3.961408e+28"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6f7fffff)), Is.EqualTo("7.922816e+28"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x6fffffff)), Is.EqualTo("1.584563e+29"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x707fffff)), Is.EqualTo("3.169126e+29"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x70ffffff)), Is.EqualTo("6.338253e+29"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x717fffff)), Is.EqualTo("1.267651e+30"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x71ffffff)), Is.EqualTo("2.535301e+30"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x727fffff)), Is.EqualTo("5.070602e+30"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x72ffffff)), Is.EqualTo("1.01412e+31"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x737fffff)), Is.EqualTo("2.028241e+31"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x73ffffff)), Is.EqualTo("4.056482e+31"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x747fffff)), Is.EqualTo("8.112963e+31"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x74ffffff)), Is.EqualTo("1.622593e+32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x757fffff)), Is.EqualTo("3.245185e+32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x75ffffff)), Is.EqualTo("6.490371e+32"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x767fffff)), Is.EqualTo("1.298074e+33"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x76ffffff)), Is.EqualTo("2.596148e+33"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x777fffff)), Is.EqualTo("5.192297e+33"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x77ffffff)), Is.EqualTo("1.038459e+34"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x787fffff)), Is.EqualTo("2.076919e+34"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x78ffffff)), Is.EqualTo("4.153837e+34"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x797fffff)), Is.EqualTo("8.307674e+34"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x79ffffff)), Is.EqualTo("1.661535e+35"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7a7fffff)), Is.EqualTo("3.32307e+35"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7affffff)), Is.EqualTo("6.64614e+35"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7b7fffff)), Is.EqualTo("1.329228e+36"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7bffffff)), Is.EqualTo("2.658456e+36"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7c7fffff)), Is.EqualTo("5.316912e+36"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7cffffff)), Is.EqualTo("1.063382e+37"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7d7fffff)), Is.EqualTo("2.126765e+37"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7dffffff)), Is.EqualTo("4.253529e+37"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7e7fffff)), Is.EqualTo("8.507059e+37"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7effffff)), Is.EqualTo("1.701412e+38"));
-                Assert.That(SPrintF("%.7g", UInt32ToFloat(0x7f7fffff)), Is.EqualTo("3.402823e+38"));
-            });
-        }
-
         [Test]
         public void InvalidSpecifier()
         {
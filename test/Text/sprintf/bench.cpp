@@ -0,0 +1,272 @@
+// Measures the time of the C library snprintf for the cases of the managed
+// SPrintFBenchmark, so that the managed implementation can be compared to the
+// implementation it copies. The results are printed in the table layout of
+// docs/Benchmark.md.
+//
+//   bench [FILTER]
+//
+// Only the benchmarks with FILTER in their name are run.
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <gnu/libc-version.h>
+#endif
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Number of measurements of each benchmark, and the time of one
+    // measurement.
+    constexpr int Runs = 20;
+    constexpr auto RunTime = std::chrono::milliseconds(25);
+
+    enum class Kind
+    {
+        Integer,
+        Double,
+        Single
+    };
+
+    struct Benchmark
+    {
+        std::string name;
+        std::string format;
+        Kind kind;
+        double value;
+    };
+
+    struct Result
+    {
+        std::string name;
+        double mean;
+        double stderror;
+    };
+
+    // The values are read through volatile variables on each iteration, so
+    // that the compiler can't evaluate or hoist the call.
+    volatile int IntegerValue;
+    volatile double DoubleValue;
+    volatile float SingleValue;
+    volatile unsigned Checksum;
+
+    auto Benchmarks() -> std::vector<Benchmark>
+    {
+        // The cases of testbenchmark/Text/SPrintFBenchmark.cs.
+        std::vector<Benchmark> benchmarks = {
+            { "FormatD_Integer", "%d", Kind::Integer, 16384 },
+            { "FormatU_Unsigned", "%u", Kind::Integer, 16384 },
+            { "FormatE_Double", "%e", Kind::Double, 123456.789 },
+            { "FormatE_Single", "%e", Kind::Single, 123456.789 },
+            { "FormatF_Double", "%f", Kind::Double, 123456.789 },
+            { "FormatF_Single", "%f", Kind::Single, 123456.789 },
+            { "FormatG_Double", "%g", Kind::Double, 123456.789 },
+            { "FormatG_Single", "%g", Kind::Single, 123456.789 },
+        };
+
+        // The cost of the conversion depends on the binary exponent, as the
+        // mantissa is scaled by a power of two to get the decimal digits.
+        struct ExponentClass {
+            const char *name;
+            double value;
+        };
+        const ExponentClass exponents[] = {
+            { "Subnormal", 1.2345678901234567e-310 },
+            { "Small", 1.2345678901234567e-100 },
+            { "Huge", 1.2345678901234567e+300 },
+        };
+        for (char specifier: { 'E', 'F', 'G' }) {
+            for (const ExponentClass &exponent: exponents) {
+                std::string name{"Format"};
+                name.push_back(specifier);
+                name.append("_");
+                name.append(exponent.name);
+                std::string format{"%"};
+                format.push_back(static_cast<char>(std::tolower(specifier)));
+                benchmarks.push_back({ name, format, Kind::Double, exponent.value });
+            }
+        }
+
+        for (char specifier: { 'E', 'F', 'G' }) {
+            for (int precision: { 0, 3, 10, 17, 30 }) {
+                std::string name{"Format"};
+                name.push_back(specifier);
+                name.append("_Precision");
+                name.append(std::to_string(precision));
+                std::string format{"%."};
+                format.append(std::to_string(precision));
+                format.push_back(static_cast<char>(std::tolower(specifier)));
+                benchmarks.push_back({ name, format, Kind::Double, 123456.789 });
+            }
+        }
+
+        std::sort(benchmarks.begin(), benchmarks.end(), [](const Benchmark &a, const Benchmark &b) {
+            return a.name < b.name;
+        });
+        return benchmarks;
+    }
+
+    // Returns the time in nanoseconds for the number of iterations.
+    auto Measure(const Benchmark &benchmark, uint64_t iterations) -> double
+    {
+        char buffer[512];
+        const char *format = benchmark.format.c_str();
+        IntegerValue = static_cast<int>(benchmark.value);
+        DoubleValue = benchmark.value;
+        SingleValue = static_cast<float>(benchmark.value);
+
+        unsigned checksum = 0;
+        auto start = Clock::now();
+        switch (benchmark.kind) {
+        case Kind::Integer:
+            for (uint64_t i = 0; i < iterations; i++) {
+                checksum += snprintf(buffer, sizeof(buffer), format, IntegerValue);
+            }
+            break;
+        case Kind::Double:
+            for (uint64_t i = 0; i < iterations; i++) {
+                checksum += snprintf(buffer, sizeof(buffer), format, DoubleValue);
+            }
+            break;
+        case Kind::Single:
+            for (uint64_t i = 0; i < iterations; i++) {
+                checksum += snprintf(buffer, sizeof(buffer), format, SingleValue);
+            }
+            break;
+        }
+        auto end = Clock::now();
+
+        // Use the result, so that the calls can't be removed.
+        Checksum = checksum;
+        return std::chrono::duration<double, std::nano>(end - start).count();
+    }
+
+    auto Run(const Benchmark &benchmark) -> Result
+    {
+        // Warm up and find the number of iterations for one measurement.
+        uint64_t iterations = 1000;
+        double time = Measure(benchmark, iterations);
+        while (time < 1e6) {
+            iterations *= 4;
+            time = Measure(benchmark, iterations);
+        }
+        iterations = std::max<uint64_t>(1, static_cast<uint64_t>(
+            iterations * std::chrono::duration<double, std::nano>(RunTime).count() / time));
+
+        double sum = 0;
+        double squares = 0;
+        for (int run = 0; run < Runs; run++) {
+            double ns = Measure(benchmark, iterations) / static_cast<double>(iterations);
+            sum += ns;
+            squares += ns * ns;
+        }
+        double mean = sum / Runs;
+        double variance = std::max(0.0, (squares - sum * sum / Runs) / (Runs - 1));
+        return { benchmark.name, mean, std::sqrt(variance / Runs) };
+    }
+
+    auto CpuName() -> std::string
+    {
+        std::ifstream cpuinfo{"/proc/cpuinfo"};
+        std::string line;
+        while (std::getline(cpuinfo, line)) {
+            if (line.compare(0, 10, "model name") != 0) continue;
+            auto colon = line.find(':');
+            if (colon != std::string::npos) return line.substr(colon + 2);
+        }
+        return "Unknown CPU";
+    }
+
+    auto LibcName() -> std::string
+    {
+#ifdef __GLIBC__
+        return std::string{"glibc "} + gnu_get_libc_version();
+#else
+        return "libc";
+#endif
+    }
+
+    auto Format(double value) -> std::string
+    {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%.2f", value);
+        return buffer;
+    }
+
+    auto Pad(const std::string &text, size_t width) -> std::string
+    {
+        if (text.size() >= width) return text;
+        return text + std::string(width - text.size(), ' ');
+    }
+
+    auto PrintTable(const std::string &libc, const std::vector<Result> &results) -> void
+    {
+        const std::string type{"SnprintfBenchmark"};
+        const std::string meanTitle{"mean (" + libc + ")"};
+
+        size_t typeWidth = std::string{"Project 'text' Type"}.size();
+        size_t methodWidth = std::string{"Method"}.size();
+        size_t meanWidth = meanTitle.size();
+        size_t errorWidth = std::string{"stderr"}.size();
+        typeWidth = std::max(typeWidth, type.size());
+        for (const Result &result: results) {
+            methodWidth = std::max(methodWidth, result.name.size());
+            meanWidth = std::max(meanWidth, Format(result.mean).size());
+            errorWidth = std::max(errorWidth, Format(result.stderror).size());
+        }
+
+        std::cout << "| " << Pad("Project 'text' Type", typeWidth)
+            << " | " << Pad("Method", methodWidth)
+            << " | " << Pad(meanTitle, meanWidth)
+            << " | " << Pad("stderr", errorWidth) << " |" << std::endl;
+        std::cout << "|:" << std::string(typeWidth + 1, '-')
+            << "|:" << std::string(methodWidth + 1, '-')
+            << "|" << std::string(meanWidth + 1, '-')
+            << ":|" << std::string(errorWidth + 1, '-') << ":|" << std::endl;
+        for (const Result &result: results) {
+            std::cout << "| " << Pad(type, typeWidth)
+                << " | " << Pad(result.name, methodWidth)
+                << " | " << Pad(Format(result.mean), meanWidth)
+                << " | " << Pad(Format(result.stderror), errorWidth) << " |" << std::endl;
+        }
+    }
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+    std::string filter;
+    if (argc > 2) {
+        std::cerr << "Usage: bench [FILTER]" << std::endl;
+        return 1;
+    }
+    if (argc == 2) filter = argv[1];
+
+    std::vector<Result> results;
+    for (const Benchmark &benchmark: Benchmarks()) {
+        if (benchmark.name.find(filter) == std::string::npos) continue;
+        std::cerr << benchmark.name << std::endl;
+        results.push_back(Run(benchmark));
+    }
+
+    std::string libc = LibcName();
+    std::cout << "```text" << std::endl
+        << "Results = " << libc << std::endl
+        << std::endl
+        << "g++ " << __VERSION__ << std::endl
+        << CpuName() << std::endl
+        << "```" << std::endl
+        << std::endl;
+    PrintTable(libc, results);
+    return 0;
+}
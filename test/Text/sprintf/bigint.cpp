@@ -0,0 +1,208 @@
+#include "bigint.hpp"
+
+#include <algorithm>
+
+BigInt::BigInt(uint64_t value)
+{
+    while (value != 0) {
+        words_.push_back(static_cast<uint32_t>(value));
+        value >>= 32;
+    }
+}
+
+auto BigInt::Pow2(unsigned exponent) -> BigInt
+{
+    BigInt result{1};
+    result <<= exponent;
+    return result;
+}
+
+auto BigInt::Pow10(unsigned exponent) -> BigInt
+{
+    // 5^13 is the largest power of five that fits in 32 bits.
+    BigInt result{1};
+    unsigned fives = exponent;
+    while (fives >= 13) {
+        result *= 1220703125;
+        fives -= 13;
+    }
+    uint32_t rest = 1;
+    while (fives-- > 0) rest *= 5;
+    result *= rest;
+    result <<= exponent;
+    return result;
+}
+
+auto BigInt::DivMod(const BigInt &dividend, const BigInt &divisor, BigInt &remainder) -> BigInt
+{
+    // Long division one bit at a time. The quotients needed are small, so
+    // start with the remainder as the top bits of the dividend that are less
+    // than the divisor.
+    BigInt quotient{};
+    unsigned dividendBits = dividend.BitLength();
+    unsigned divisorBits = divisor.BitLength();
+    if (dividendBits < divisorBits) {
+        remainder = dividend;
+        return quotient;
+    }
+
+    unsigned shift = dividendBits - divisorBits + 1;
+    remainder = dividend;
+    remainder >>= shift;
+    quotient.words_.assign(shift / 32 + 1, 0);
+    for (unsigned bit = shift; bit-- > 0; ) {
+        remainder <<= 1;
+        if (dividend.Bit(bit)) {
+            if (remainder.words_.empty()) remainder.words_.push_back(0);
+            remainder.words_[0] |= 1;
+        }
+        if (divisor <= remainder) {
+            remainder -= divisor;
+            quotient.words_[bit / 32] |= 1u << (bit % 32);
+        }
+    }
+    quotient.Trim();
+    return quotient;
+}
+
+auto BigInt::operator+=(const BigInt &value) -> BigInt &
+{
+    if (words_.size() < value.words_.size()) words_.resize(value.words_.size(), 0);
+
+    uint64_t carry = 0;
+    for (size_t i = 0; i < words_.size(); i++) {
+        uint64_t sum = carry + words_[i];
+        if (i < value.words_.size()) sum += value.words_[i];
+        words_[i] = static_cast<uint32_t>(sum);
+        carry = sum >> 32;
+    }
+    if (carry != 0) words_.push_back(static_cast<uint32_t>(carry));
+    return *this;
+}
+
+auto BigInt::operator-=(const BigInt &value) -> BigInt &
+{
+    // The value must not be larger than this.
+    int64_t borrow = 0;
+    for (size_t i = 0; i < words_.size(); i++) {
+        int64_t difference = static_cast<int64_t>(words_[i]) - borrow;
+        if (i < value.words_.size()) difference -= value.words_[i];
+        borrow = difference < 0 ? 1 : 0;
+        words_[i] = static_cast<uint32_t>(difference + (borrow << 32));
+    }
+    Trim();
+    return *this;
+}
+
+auto BigInt::operator*=(uint32_t value) -> BigInt &
+{
+    uint64_t carry = 0;
+    for (uint32_t &word: words_) {
+        uint64_t product = static_cast<uint64_t>(word) * value + carry;
+        word = static_cast<uint32_t>(product);
+        carry = product >> 32;
+    }
+    if (carry != 0) words_.push_back(static_cast<uint32_t>(carry));
+    Trim();
+    return *this;
+}
+
+auto BigInt::operator<<=(unsigned bits) -> BigInt &
+{
+    if (words_.empty()) return *this;
+
+    unsigned wordShift = bits / 32;
+    unsigned bitShift = bits % 32;
+    if (bitShift != 0) {
+        uint32_t carry = 0;
+        for (uint32_t &word: words_) {
+            uint32_t next = word >> (32 - bitShift);
+            word = (word << bitShift) | carry;
+            carry = next;
+        }
+        if (carry != 0) words_.push_back(carry);
+    }
+    words_.insert(words_.begin(), wordShift, 0);
+    return *this;
+}
+
+auto BigInt::operator>>=(unsigned bits) -> BigInt &
+{
+    unsigned wordShift = bits / 32;
+    unsigned bitShift = bits % 32;
+    if (wordShift >= words_.size()) {
+        words_.clear();
+        return *this;
+    }
+    words_.erase(words_.begin(), words_.begin() + wordShift);
+    if (bitShift != 0) {
+        for (size_t i = 0; i < words_.size(); i++) {
+            uint32_t next = i + 1 < words_.size() ? words_[i + 1] : 0;
+            words_[i] = (words_[i] >> bitShift) | (next << (32 - bitShift));
+        }
+    }
+    Trim();
+    return *this;
+}
+
+auto BigInt::Compare(const BigInt &value) const -> int
+{
+    if (words_.size() != value.words_.size()) {
+        return words_.size() < value.words_.size() ? -1 : 1;
+    }
+    for (size_t i = words_.size(); i-- > 0; ) {
+        if (words_[i] != value.words_[i]) return words_[i] < value.words_[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+auto BigInt::BitLength() const -> unsigned
+{
+    if (words_.empty()) return 0;
+    return static_cast<unsigned>(words_.size() * 32) - __builtin_clz(words_.back());
+}
+
+auto BigInt::Bit(unsigned bit) const -> bool
+{
+    if (bit / 32 >= words_.size()) return false;
+    return (words_[bit / 32] >> (bit % 32)) & 1;
+}
+
+auto BigInt::Bits64(unsigned bit) const -> uint64_t
+{
+    uint64_t result = 0;
+    for (unsigned i = 0; i < 64; i++) {
+        if (Bit(bit + i)) result |= static_cast<uint64_t>(1) << i;
+    }
+    return result;
+}
+
+auto BigInt::ToString() const -> std::string
+{
+    if (words_.empty()) return "0";
+
+    // Repeatedly divide by 10^9, giving nine digits each time.
+    std::string result;
+    std::vector<uint32_t> words{words_};
+    while (!words.empty()) {
+        uint64_t remainder = 0;
+        for (size_t i = words.size(); i-- > 0; ) {
+            uint64_t value = (remainder << 32) | words[i];
+            words[i] = static_cast<uint32_t>(value / 1000000000);
+            remainder = value % 1000000000;
+        }
+        while (!words.empty() && words.back() == 0) words.pop_back();
+        for (int digit = 0; digit < 9; digit++) {
+            result.push_back(static_cast<char>('0' + remainder % 10));
+            remainder /= 10;
+            if (words.empty() && remainder == 0) break;
+        }
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+auto BigInt::Trim() -> void
+{
+    while (!words_.empty() && words_.back() == 0) words_.pop_back();
+}
@@ -0,0 +1,51 @@
+#ifndef BIGINT_HPP
+#define BIGINT_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// An arbitrary precision unsigned integer, for the exact computation of the
+// powers of two and ten that the double conversion approximates. Only the
+// operations needed for that are implemented, and none are fast, but a value
+// of a few thousand bits is still computed in microseconds.
+class BigInt
+{
+public:
+    BigInt() = default;
+    BigInt(uint64_t value);
+
+    static auto Pow2(unsigned exponent) -> BigInt;
+    static auto Pow10(unsigned exponent) -> BigInt;
+
+    // Returns the quotient of the division, and the remainder in remainder.
+    static auto DivMod(const BigInt &dividend, const BigInt &divisor, BigInt &remainder) -> BigInt;
+
+    auto operator+=(const BigInt &value) -> BigInt &;
+    auto operator-=(const BigInt &value) -> BigInt &;
+    auto operator*=(uint32_t value) -> BigInt &;
+    auto operator<<=(unsigned bits) -> BigInt &;
+    auto operator>>=(unsigned bits) -> BigInt &;
+
+    auto Compare(const BigInt &value) const -> int;
+    auto IsZero() const -> bool { return words_.empty(); }
+    auto BitLength() const -> unsigned;
+    auto Bit(unsigned bit) const -> bool;
+
+    // The 64 bits starting at the given bit.
+    auto Bits64(unsigned bit) const -> uint64_t;
+
+    auto ToString() const -> std::string;
+
+private:
+    auto Trim() -> void;
+
+    // Least significant word first, without leading zero words.
+    std::vector<uint32_t> words_;
+};
+
+inline auto operator<(const BigInt &a, const BigInt &b) -> bool { return a.Compare(b) < 0; }
+inline auto operator<=(const BigInt &a, const BigInt &b) -> bool { return a.Compare(b) <= 0; }
+inline auto operator==(const BigInt &a, const BigInt &b) -> bool { return a.Compare(b) == 0; }
+
+#endif
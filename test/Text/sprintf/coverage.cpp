@@ -0,0 +1,175 @@
+#include "coverage.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    struct Digits
+    {
+        std::string digits;
+        int exponent;
+    };
+
+    // All significant digits of the exact decimal value, without trailing
+    // zeros, and the decimal exponent of the first digit. The C library
+    // prints the exact value when asked for enough digits.
+    auto ExactDigits(double value) -> Digits
+    {
+        char buffer[1024];
+        snprintf(buffer, sizeof(buffer), "%.800e", std::fabs(value));
+        Digits exact{};
+        const char *p = buffer;
+        for (; *p != 'e'; p++) {
+            if (*p >= '0' && *p <= '9') exact.digits.push_back(*p);
+        }
+        exact.exponent = std::atoi(p + 1);
+        exact.digits.erase(exact.digits.find_last_not_of('0') + 1);
+        return exact;
+    }
+
+    // The significant digits printed, without leading zeros, and the decimal
+    // exponent of the first digit. Returns the number of trailing zeros.
+    auto PrintedDigits(const char *result, size_t length, Digits &printed, bool &exponentNotation) -> int
+    {
+        std::string mantissa;
+        int point = -1;
+        int exponent = 0;
+        exponentNotation = false;
+        for (size_t i = 0; i < length; i++) {
+            char c = result[i];
+            if (c >= '0' && c <= '9') {
+                mantissa.push_back(c);
+            } else if (c == '.') {
+                point = static_cast<int>(mantissa.size());
+            } else if (c == 'e' || c == 'E') {
+                exponentNotation = true;
+                exponent = std::atoi(std::string(result + i + 1, length - i - 1).c_str());
+                break;
+            }
+        }
+        if (point < 0) point = static_cast<int>(mantissa.size());
+
+        size_t first = mantissa.find_first_not_of('0');
+        size_t trailing = mantissa.size() - (mantissa.find_last_not_of('0') + 1);
+        if (first == std::string::npos) {
+            printed.digits.clear();
+            printed.exponent = 0;
+            return static_cast<int>(trailing);
+        }
+        printed.digits = mantissa.substr(first);
+        printed.exponent = point - 1 - static_cast<int>(first) + exponent;
+        return static_cast<int>(trailing);
+    }
+
+    auto Direction(const Digits &exact, const Digits &printed) -> const char *
+    {
+        if (printed.digits.empty()) return exact.digits.empty() ? "exact" : "down";
+        if (printed.exponent > exact.exponent) return "up";
+
+        std::string prefix = exact.digits.substr(0, printed.digits.size());
+        prefix.append(printed.digits.size() - prefix.size(), '0');
+        int compare = printed.digits.compare(prefix);
+        if (compare > 0) return "up";
+        if (compare < 0) return "down";
+        return exact.digits.size() > printed.digits.size() ? "down" : "exact";
+    }
+
+    // The band of the decimal exponent: the subnormals, then the ranges where
+    // %e has three exponent digits, where %g switches to exponent notation, and
+    // where the fixed notation has leading zeros or all digits left of the
+    // decimal point.
+    auto Band(int exponent, int precision) -> const char *
+    {
+        if (exponent < -99) return "tiny";
+        if (exponent < -4) return "small";
+        if (exponent < 0) return "fraction";
+        if (exponent < precision) return "integer";
+        if (exponent < 100) return "large";
+        return "huge";
+    }
+
+    auto Precision(const std::string &format) -> int
+    {
+        size_t dot = format.find('.');
+        if (dot == std::string::npos) return 6;
+        return std::atoi(format.c_str() + dot + 1);
+    }
+}
+
+auto Coverage::Add(const std::string &format, GoldenKind kind, uint64_t bits, const char *result, size_t length) -> bool
+{
+    return classes_.insert(Class(format, kind, bits, result, length)).second;
+}
+
+auto Coverage::Class(const std::string &format, GoldenKind kind, uint64_t bits, const char *result, size_t length) -> std::string
+{
+    double value;
+    int binaryExponent;
+    if (kind == GoldenKind::Double) {
+        std::memcpy(&value, &bits, sizeof(value));
+        binaryExponent = static_cast<int>((bits >> 52) & 0x7FF);
+    } else {
+        uint32_t binaryFloat = static_cast<uint32_t>(bits);
+        float single;
+        std::memcpy(&single, &binaryFloat, sizeof(single));
+        value = single;
+        binaryExponent = static_cast<int>((binaryFloat >> 23) & 0xFF);
+    }
+
+    std::string key{format};
+    key.push_back('|');
+    key.append(std::signbit(value) ? "-" : "+");
+    if (value == 0 || !std::isfinite(value)) {
+        key.append(std::string(result, length));
+        return key;
+    }
+
+    char specifier = format.back();
+    bool hex = specifier == 'a' || specifier == 'A';
+    Digits exact = ExactDigits(value);
+
+    // The hexadecimal notation is exact, and its exponent is the binary
+    // exponent, so the band is the number of exponent digits.
+    key.push_back('|');
+    if (binaryExponent == 0) {
+        key.append("subnormal");
+    } else if (hex) {
+        int exponent = std::abs(static_cast<int>(std::ilogb(value)));
+        key.append(std::to_string(exponent == 0 ? 1 : static_cast<int>(std::to_string(exponent).size())));
+        key.append(std::ilogb(value) < 0 ? "n" : "p");
+    } else {
+        key.append(Band(exact.exponent, Precision(format)));
+    }
+
+    Digits printed{};
+    bool exponentNotation;
+    int trailing;
+    if (hex) {
+        // Only the digits after "0x", which are the mantissa.
+        const char *begin = static_cast<const char *>(std::memchr(result, 'x', length));
+        const char *end = static_cast<const char *>(std::memchr(result, specifier == 'a' ? 'p' : 'P', length));
+        std::string mantissa;
+        for (const char *p = begin + 1; p < end; p++) {
+            if (*p != '.') mantissa.push_back(*p);
+        }
+        printed.digits = mantissa;
+        trailing = static_cast<int>(mantissa.size() - (mantissa.find_last_not_of('0') + 1));
+        exponentNotation = true;
+    } else {
+        trailing = PrintedDigits(result, length, printed, exponentNotation);
+    }
+
+    key.push_back('|');
+    key.append(std::to_string(printed.digits.size()));
+    key.push_back('|');
+    key.append(hex ? "exact" : Direction(exact, printed));
+    key.push_back('|');
+    key.append(std::to_string(std::min(trailing, 2)));
+    key.push_back('|');
+    key.append(exponentNotation ? "e" : "f");
+    return key;
+}
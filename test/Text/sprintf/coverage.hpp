@@ -0,0 +1,36 @@
+#ifndef COVERAGE_HPP
+#define COVERAGE_HPP
+
+#include "golden.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+
+// Classifies the IEEE754 test vectors by the paths they take through
+// DoubleFormatter, so that only one vector of each equivalence class needs to
+// be tested. The class of a vector is its format and
+//
+//  - the sign,
+//  - the exponent band (subnormal, or the range of the decimal exponent
+//    that decides between fixed and exponent notation and the number of
+//    exponent digits),
+//  - the number of significant digits printed,
+//  - the rounding direction of the last digit (exact, down or up),
+//  - the number of trailing zeros printed (0, 1, 2 or more), and
+//  - for %g, if the result is in exponent notation.
+class Coverage
+{
+public:
+    // Returns true if the vector is the first of its class.
+    auto Add(const std::string &format, GoldenKind kind, uint64_t bits, const char *result, size_t length) -> bool;
+    auto Classes() const -> size_t { return classes_.size(); }
+
+    static auto Class(const std::string &format, GoldenKind kind, uint64_t bits, const char *result, size_t length) -> std::string;
+
+private:
+    std::unordered_set<std::string> classes_;
+};
+
+#endif
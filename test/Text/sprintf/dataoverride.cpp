@@ -0,0 +1,46 @@
+#include "dataoverride.hpp"
+#include "transcript.hpp"
+
+#include <iostream>
+#include <vector>
+
+auto DataOverrides::Read(const std::string &fileName) -> bool
+{
+    std::string text;
+    if (!ReadFile(fileName, text)) return false;
+
+    std::vector<std::string> lines = SplitLines(text);
+    overrides_.clear();
+    for (size_t i = 0; i < lines.size(); i++) {
+        const std::string &line = lines[i];
+        if (line.empty() || line[0] == '#') continue;
+
+        // The key is the format, kind and bits, which are the first three
+        // fields, so it's everything before the third tab.
+        size_t tab = 0;
+        size_t tabs[4];
+        int count = 0;
+        while (count < 4 && (tab = line.find('\t', tab)) != std::string::npos) {
+            tabs[count++] = tab++;
+        }
+        if (count < 4 || line.compare(tabs[3] + 1, 2, "# ") != 0) {
+            std::cerr << fileName << ":" << i + 1 << ": invalid line" << std::endl;
+            return false;
+        }
+
+        DataOverride correction{};
+        correction.result = line.substr(tabs[2] + 1, tabs[3] - tabs[2] - 1);
+        correction.note = line.substr(tabs[3] + 3);
+        if (!overrides_.emplace(line.substr(0, tabs[2]), std::move(correction)).second) {
+            std::cerr << fileName << ":" << i + 1 << ": duplicate test case" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+auto DataOverrides::Find(const char *key, size_t length) const -> const DataOverride *
+{
+    auto it = overrides_.find(std::string{key, length});
+    return it == overrides_.end() ? nullptr : &it->second;
+}
@@ -0,0 +1,37 @@
+#ifndef DATAOVERRIDE_HPP
+#define DATAOVERRIDE_HPP
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+// The results of the data file for the NUnit tests that are corrected by
+// hand, because the results of this libc are not the ones expected. Each line
+// of the override file is a line of the data file, with the corrected result
+// and a note:
+//
+//   <format> TAB <Double|Single> TAB 0x<bits> TAB <result> TAB # <note>
+//
+// Empty lines and lines starting with '#' are ignored. The data file is
+// generated with the overrides merged in, so it never needs to be edited.
+struct DataOverride
+{
+    std::string result;
+    std::string note;
+};
+
+class DataOverrides
+{
+public:
+    auto Read(const std::string &fileName) -> bool;
+
+    // Finds the override of the test case, given by the first three fields
+    // of its line, i.e. up to and including the bits.
+    auto Find(const char *key, size_t length) const -> const DataOverride *;
+    auto Size() const -> size_t { return overrides_.size(); }
+
+private:
+    std::unordered_map<std::string, DataOverride> overrides_;
+};
+
+#endif
@@ -0,0 +1,262 @@
+#include "delta.hpp"
+#include "sink.hpp"
+#include "transcript.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <unistd.h>
+
+namespace
+{
+    // A delta file is the header line, followed by one line per test case
+    // with a different result to the canonical transcript:
+    //
+    //   <key> TAB <call> TAB <result>
+    //
+    // The key is the FNV-1a hash of the call, which is the text between
+    // "SPrintF(" and "), Is.EqualTo(", i.e. the format and the arguments with
+    // their exact bits. The call is kept for the reader and for the query.
+    const std::string DeltaHeader{"# SPrintF toolchain delta, keyed by the FNV-1a hash of (format, arguments)"};
+
+    struct TestCase
+    {
+        uint64_t key;
+        std::string call;
+        std::string result;
+    };
+
+    auto Key(const std::string &line, const CaseLine &position) -> uint64_t
+    {
+        return Fnv1a(line.data() + position.callBegin, position.callEnd - position.callBegin);
+    }
+
+    auto ReadDelta(const std::string &fileName, std::vector<TestCase> &cases) -> bool
+    {
+        std::string text;
+        if (!ReadFile(fileName, text)) return false;
+
+        std::vector<std::string> lines = SplitLines(text);
+        if (lines.empty() || lines[0] != DeltaHeader) {
+            std::cerr << fileName << ": not a delta file" << std::endl;
+            return false;
+        }
+
+        cases.clear();
+        for (size_t i = 1; i < lines.size(); i++) {
+            const std::string &line = lines[i];
+            size_t tab1 = line.find('\t');
+            size_t tab2 = tab1 == std::string::npos ? tab1 : line.find('\t', tab1 + 1);
+            if (tab2 == std::string::npos) {
+                std::cerr << fileName << ":" << i + 1 << ": invalid line" << std::endl;
+                return false;
+            }
+
+            TestCase testCase{};
+            testCase.key = std::stoull(line.substr(0, tab1), nullptr, 16);
+            testCase.call = line.substr(tab1 + 1, tab2 - tab1 - 1);
+            testCase.result = line.substr(tab2 + 1);
+            cases.push_back(std::move(testCase));
+        }
+        return true;
+    }
+
+    // The name of a toolchain is the name of its file without the directory
+    // and extension.
+    auto ToolchainName(const std::string &fileName) -> std::string
+    {
+        size_t slash = fileName.find_last_of('/');
+        std::string name = slash == std::string::npos ? fileName : fileName.substr(slash + 1);
+        size_t dot = name.find_last_of('.');
+        if (dot != std::string::npos && dot != 0) name.erase(dot);
+        return name;
+    }
+
+    auto FormatMatches(const Options &options, const std::string &call) -> bool
+    {
+        if (options.formats.empty()) return true;
+        for (const std::string &format: options.formats) {
+            std::string quoted = "\"" + format + "\"";
+            if (call.compare(0, quoted.size(), quoted) == 0) return true;
+        }
+        return false;
+    }
+}
+
+// Compares the test cases of this toolchain (or of the transcript given with
+// --transcript) to the canonical transcript and writes the test cases with a
+// different result as a delta file. Both must have the same test cases in the
+// same order, which holds as long as they are from the same generator.
+auto RunDelta(const Options &options, GenerateFunction generate) -> int
+{
+    std::string canonical;
+    if (!ReadFile(options.canonicalFile, canonical)) return 1;
+
+    std::string transcript;
+    if (!ReadTranscript(options, generate, transcript)) return 1;
+
+    std::vector<std::string> canonicalLines = SplitLines(canonical);
+    std::vector<std::string> lines = SplitLines(transcript);
+    if (lines.size() != canonicalLines.size()) {
+        std::cerr << "The test cases don't match the canonical transcript, "
+            << lines.size() << " lines instead of " << canonicalLines.size() << std::endl;
+        return 1;
+    }
+
+    ArenaSink out{STDOUT_FILENO};
+    ArenaSink record{-1, 4096};
+    record.Append(DeltaHeader.data(), DeltaHeader.size());
+    record.EndLine();
+    out.Write(record.Data(), record.Size());
+    for (size_t i = 0; i < lines.size(); i++) {
+        const std::string &line = lines[i];
+        const std::string &canonicalLine = canonicalLines[i];
+        CaseLine position;
+        CaseLine canonicalPosition;
+        bool isCase = ParseCase(line, position);
+        if (!isCase || !ParseCase(canonicalLine, canonicalPosition)) {
+            if (line == canonicalLine) continue;
+        } else if (line.compare(0, position.resultBegin, canonicalLine, 0, canonicalPosition.resultBegin) == 0) {
+            if (line == canonicalLine) continue;
+
+            char key[20];
+            snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(Key(line, position)));
+            record.Clear();
+            record.Append(key);
+            record.Append('\t');
+            record.Append(line.data() + position.callBegin, position.callEnd - position.callBegin);
+            record.Append('\t');
+            record.Append(line.data() + position.resultBegin, position.resultEnd - position.resultBegin);
+            record.EndLine();
+            out.Write(record.Data(), record.Size());
+            out.AddRecord();
+            continue;
+        }
+
+        std::cerr << "Line " << i + 1 << " doesn't match the canonical transcript" << std::endl;
+        return 1;
+    }
+
+    bool good = out.Flush();
+    if (options.stats) PrintStats(out);
+    return good ? 0 : 1;
+}
+
+// Writes the transcript of a toolchain, which is the canonical transcript
+// with the results of the delta file.
+auto RunPatch(const Options &options) -> int
+{
+    std::string canonical;
+    std::vector<TestCase> cases;
+    if (!ReadFile(options.canonicalFile, canonical)) return 1;
+    if (!ReadDelta(options.inputFile, cases)) return 1;
+
+    std::unordered_map<uint64_t, const TestCase *> delta;
+    for (const TestCase &testCase: cases) {
+        delta.emplace(testCase.key, &testCase);
+    }
+
+    std::unordered_map<uint64_t, bool> applied;
+    ArenaSink out{STDOUT_FILENO};
+    for (const std::string &line: SplitLines(canonical)) {
+        CaseLine position;
+        if (ParseCase(line, position)) {
+            uint64_t key = Key(line, position);
+            auto it = delta.find(key);
+            if (it != delta.end()) {
+                out.Append(line.data(), position.resultBegin);
+                out.Append(it->second->result.data(), it->second->result.size());
+                out.Append(CaseEnd.data(), CaseEnd.size());
+                out.EndLine();
+                applied[key] = true;
+                continue;
+            }
+        }
+        out.Append(line.data(), line.size());
+        out.EndLine();
+    }
+
+    if (applied.size() != delta.size()) {
+        std::cerr << options.inputFile << ": " << delta.size() - applied.size()
+            << " test cases aren't in the canonical transcript" << std::endl;
+        return 1;
+    }
+    return out.Flush() ? 0 : 1;
+}
+
+// Prints the test cases where the toolchains disagree, with the result of
+// each toolchain. Only the delta files and the test cases of the canonical
+// transcript with the same key are looked at.
+auto RunQuery(const Options &options) -> int
+{
+    std::vector<std::string> names{ToolchainName(options.canonicalFile)};
+    std::unordered_map<uint64_t, std::vector<const TestCase *>> disagree;
+    std::vector<std::vector<TestCase>> deltas(options.deltaFiles.size());
+    for (size_t i = 0; i < options.deltaFiles.size(); i++) {
+        if (!ReadDelta(options.deltaFiles[i], deltas[i])) return 1;
+        names.push_back(ToolchainName(options.deltaFiles[i]));
+        for (const TestCase &testCase: deltas[i]) {
+            auto &results = disagree[testCase.key];
+            results.resize(options.deltaFiles.size(), nullptr);
+            results[i] = &testCase;
+        }
+    }
+
+    size_t width = 0;
+    for (const std::string &name: names) {
+        width = std::max(width, name.size());
+    }
+
+    std::string canonical;
+    if (!ReadFile(options.canonicalFile, canonical)) return 1;
+
+    ArenaSink out{STDOUT_FILENO};
+    ArenaSink record{-1, 4096};
+    std::unordered_map<uint64_t, bool> printed;
+    for (const std::string &line: SplitLines(canonical)) {
+        CaseLine position;
+        if (!ParseCase(line, position)) continue;
+        uint64_t key = Key(line, position);
+        auto it = disagree.find(key);
+        if (it == disagree.end() || printed[key]) continue;
+        printed[key] = true;
+
+        std::string call = line.substr(position.callBegin, position.callEnd - position.callBegin);
+        if (!FormatMatches(options, call)) continue;
+
+        record.Clear();
+        record.Append(call.data(), call.size());
+        record.EndLine();
+        for (size_t i = 0; i < names.size(); i++) {
+            const std::string *result = nullptr;
+            std::string canonicalResult;
+            if (i > 0 && it->second[i - 1]) {
+                result = &it->second[i - 1]->result;
+            } else {
+                canonicalResult = line.substr(position.resultBegin, position.resultEnd - position.resultBegin);
+                result = &canonicalResult;
+            }
+            record.AppendRepeat(' ', 4);
+            record.Append(names[i].data(), names[i].size());
+            record.AppendRepeat(' ', width - names[i].size() + 2);
+            record.Append('"');
+            record.Append(result->data(), result->size());
+            record.Append('"');
+            record.EndLine();
+        }
+        out.Write(record.Data(), record.Size());
+        out.AddRecord();
+    }
+
+    if (printed.size() != disagree.size()) {
+        std::cerr << disagree.size() - printed.size()
+            << " test cases of the delta files aren't in the canonical transcript" << std::endl;
+    }
+    bool good = out.Flush();
+    if (options.stats) PrintStats(out);
+    return good ? 0 : 1;
+}
@@ -0,0 +1,11 @@
+#ifndef DELTA_HPP
+#define DELTA_HPP
+
+#include "options.hpp"
+#include "shard.hpp"
+
+auto RunDelta(const Options &options, GenerateFunction generate) -> int;
+auto RunPatch(const Options &options) -> int;
+auto RunQuery(const Options &options) -> int;
+
+#endif
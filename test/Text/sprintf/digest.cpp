@@ -0,0 +1,123 @@
+#include "digest.hpp"
+#include "sink.hpp"
+#include "transcript.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace
+{
+    // Number of binary exponents in one band, so that doubles and floats both
+    // have 32 bands.
+    constexpr int DoubleBandExponents = 64;
+    constexpr int SingleBandExponents = 8;
+
+    struct Digest
+    {
+        uint64_t records = 0;
+        uint64_t hash = Fnv1aBasis;
+
+        auto Add(const std::string &record) -> void
+        {
+            records++;
+            hash = Fnv1a(record.data(), record.size(), hash);
+        }
+    };
+
+    struct Category
+    {
+        std::string name;
+        Digest digest;
+        std::map<int, Digest> bands;
+        int bandExponents = 0;
+    };
+
+    // The first exponent of the band of the first binary argument, or -1 if
+    // there is none.
+    auto Band(const std::string &call, int &bandExponents) -> int
+    {
+        const std::string doublePrefix{"UInt64ToDouble(0x"};
+        const std::string singlePrefix{"UInt32ToFloat(0x"};
+        size_t position = call.find(doublePrefix);
+        if (position != std::string::npos) {
+            uint64_t bits = std::strtoull(call.c_str() + position + doublePrefix.size(), nullptr, 16);
+            bandExponents = DoubleBandExponents;
+            return static_cast<int>((bits >> 52) & 0x7FF) / bandExponents * bandExponents;
+        }
+        position = call.find(singlePrefix);
+        if (position != std::string::npos) {
+            uint64_t bits = std::strtoull(call.c_str() + position + singlePrefix.size(), nullptr, 16);
+            bandExponents = SingleBandExponents;
+            return static_cast<int>((bits >> 23) & 0xFF) / bandExponents * bandExponents;
+        }
+        return -1;
+    }
+
+    auto AppendDigest(ArenaSink &out, const std::string &category, const std::string &band, const Digest &digest) -> void
+    {
+        char line[256];
+        int length = snprintf(line, sizeof(line), "%s\t%s\t%llu\t%016llx\n", category.c_str(), band.c_str(),
+            static_cast<unsigned long long>(digest.records), static_cast<unsigned long long>(digest.hash));
+        out.Write(line, length);
+        out.AddRecord();
+    }
+}
+
+// Prints a digest of the results of each test category (test function), and
+// of each band of binary exponents within the category:
+//
+//   <category> TAB <band> TAB <records> TAB <digest>
+//
+// The band of the category as a whole is "*". The digest is the FNV-1a hash
+// of "<call> TAB <result> LF" of the test cases in order, where the call is
+// the format and the arguments as in the transcript. testdiff --digest prints
+// the same for the results of SPrintF, so two digests are compared with diff
+// and a difference is narrowed down to a band without the results.
+auto RunDigest(const Options &options, GenerateFunction generate) -> int
+{
+    std::string transcript;
+    if (!ReadTranscript(options, generate, transcript)) return 1;
+
+    std::vector<Category> categories;
+    std::string record;
+    for (const std::string &line: SplitLines(transcript)) {
+        std::string name;
+        if (ParseFunction(line, name)) {
+            categories.emplace_back();
+            categories.back().name = name;
+            continue;
+        }
+
+        CaseLine position;
+        if (categories.empty() || !ParseCase(line, position)) continue;
+
+        std::string call = line.substr(position.callBegin, position.callEnd - position.callBegin);
+        record.assign(call);
+        record.push_back('\t');
+        record.append(line, position.resultBegin, position.resultEnd - position.resultBegin);
+        record.push_back('\n');
+
+        Category &category = categories.back();
+        category.digest.Add(record);
+        int band = Band(call, category.bandExponents);
+        if (band >= 0) category.bands[band].Add(record);
+    }
+
+    ArenaSink out{STDOUT_FILENO};
+    for (const Category &category: categories) {
+        AppendDigest(out, category.name, "*", category.digest);
+        for (const auto &band: category.bands) {
+            std::string name = "E=" + std::to_string(band.first) + "-" +
+                std::to_string(band.first + category.bandExponents - 1);
+            AppendDigest(out, category.name, name, band.second);
+        }
+    }
+    bool good = out.Flush();
+    if (options.stats) PrintStats(out);
+    return good ? 0 : 1;
+}
@@ -0,0 +1,9 @@
+#ifndef DIGEST_HPP
+#define DIGEST_HPP
+
+#include "options.hpp"
+#include "shard.hpp"
+
+auto RunDigest(const Options &options, GenerateFunction generate) -> int;
+
+#endif
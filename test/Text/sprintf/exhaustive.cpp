@@ -0,0 +1,203 @@
+#include "exhaustive.hpp"
+#include "golden.hpp"
+#include "rangescheduler.hpp"
+#include "sink.hpp"
+#include "stream.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace
+{
+    // Number of bit patterns in one unit of work. Small enough that the
+    // scheduler can balance the load, large enough that the overhead of
+    // scheduling is negligible compared to snprintf.
+    constexpr uint64_t ChunkSize = 4096;
+
+    // Number of chunks per worker in one epoch. The output of an epoch is
+    // held in memory until it can be written in order, so this bounds memory.
+    constexpr uint64_t EpochChunksPerWorker = 16;
+
+    // Initial size of the buffer for the output of one chunk, for four
+    // formats. The buffers grow as needed and are reused between epochs.
+    constexpr size_t ChunkBufferSize = ChunkSize * 4 * 32;
+
+    using Chunks = std::vector<std::unique_ptr<ArenaSink>>;
+
+    enum class Output
+    {
+        Text,
+        Golden,
+        Stream
+    };
+
+    // In text mode, the output is the lines as they are written. In golden
+    // mode, only the results are kept, each NUL terminated, and the bit
+    // pattern and format are implied by the position. In stream mode, each
+    // chunk is a batch of the binary stream.
+    auto FormatChunk(const Options &options, Output mode, uint64_t first, uint64_t last, ArenaSink &output) -> void
+    {
+        // Grows for long results, such as FLT_MAX with %.120f, so that no
+        // result is truncated.
+        std::vector<char> result(128);
+        output.Clear();
+        for (uint64_t bits = first; bits <= last; bits++) {
+            uint32_t binaryFloat = static_cast<uint32_t>(bits);
+            float value;
+            std::memcpy(&value, &binaryFloat, sizeof(value));
+
+            for (const std::string &format: options.formats) {
+                int length = snprintf(result.data(), result.size(), format.c_str(), value);
+                if (length < 0) length = 0;
+                if (static_cast<size_t>(length) >= result.size()) {
+                    result.resize(length + 1);
+                    snprintf(result.data(), result.size(), format.c_str(), value);
+                }
+
+                if (mode == Output::Golden) {
+                    output.Append(result.data(), length);
+                    output.Append('\0');
+                    continue;
+                }
+
+                if (mode == Output::Stream) {
+                    StreamArg arg{StreamArgType::Single, binaryFloat, nullptr, 0};
+                    AppendStreamRecord(output, binaryFloat, format.data(), format.size(), &arg, 1, result.data(), length);
+                    continue;
+                }
+
+                output.Append(format.data(), format.size());
+                output.Append("\t0x");
+                output.AppendHex(binaryFloat, 8);
+                output.Append('\t');
+                output.Append(result.data(), length);
+                output.EndLine();
+            }
+        }
+    }
+
+    auto WriteChunks(OutputSink &out, const Chunks &chunks, uint64_t count, uint64_t records) -> void
+    {
+        for (uint64_t i = 0; i < count; i++) {
+            out.Write(chunks[i]->Data(), chunks[i]->Size());
+        }
+        out.AddRecord(records);
+    }
+
+    auto WriteChunks(const Options &options, GoldenWriter &golden,
+        const Chunks &chunks, uint64_t firstChunk, uint64_t count) -> void
+    {
+        size_t formats = options.formats.size();
+        for (uint64_t i = 0; i < count; i++) {
+            uint64_t bits = options.first + (firstChunk + i) * ChunkSize;
+            size_t format = 0;
+            const char *result = chunks[i]->Data();
+            const char *end = result + chunks[i]->Size();
+            while (result < end) {
+                size_t length = std::strlen(result);
+                golden.Add(options.formats[format], GoldenKind::Single, bits, result, length);
+                result += length + 1;
+                if (++format == formats) {
+                    format = 0;
+                    bits++;
+                }
+            }
+        }
+    }
+}
+
+// Formats every single precision bit pattern in the range with every format.
+// The output is one line per pattern and format, tab separated, in ascending
+// order of the bit pattern regardless of the number of threads:
+//
+//   <format> TAB 0x<bits> TAB <libc result>
+//
+// If a binary file is given, the results are written as a golden vector file
+// instead, or with --stream, as a binary stream.
+auto RunFloat32All(const Options &options) -> int
+{
+    bool binary = !options.binaryFile.empty();
+    Output mode = binary ? Output::Golden : options.stream ? Output::Stream : Output::Text;
+    GoldenWriter golden{};
+    if (binary && !golden.Open(options.binaryFile)) {
+        std::cerr << "Couldn't create " << options.binaryFile << std::endl;
+        return 1;
+    }
+
+    unsigned threads = options.threads;
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+
+    uint64_t total = options.last - options.first + 1;
+    uint64_t chunks = (total + ChunkSize - 1) / ChunkSize;
+    uint64_t epochChunks = threads * EpochChunksPerWorker;
+
+    RangeScheduler scheduler{threads};
+    Chunks current;
+    Chunks previous;
+    for (uint64_t i = 0; i < epochChunks; i++) {
+        current.emplace_back(new ArenaSink{-1, ChunkBufferSize});
+        previous.emplace_back(new ArenaSink{-1, ChunkBufferSize});
+    }
+    uint64_t previousCount = 0;
+    uint64_t previousEpoch = 0;
+    uint64_t previousRecords = 0;
+
+    ArenaSink out{STDOUT_FILENO};
+    auto write = [&]() {
+        if (binary) {
+            WriteChunks(options, golden, previous, previousEpoch, previousCount);
+        } else if (options.stream) {
+            for (uint64_t i = 0; i < previousCount; i++) {
+                WriteStreamBatch(out, *previous[i]);
+            }
+        } else {
+            WriteChunks(out, previous, previousCount, previousRecords);
+        }
+    };
+
+    if (options.stream) WriteStreamHeader(out);
+    for (uint64_t epoch = 0; epoch < chunks; epoch += epochChunks) {
+        uint64_t count = std::min(epochChunks, chunks - epoch);
+        scheduler.Reset(epoch, epoch + count);
+
+        std::vector<std::thread> workers;
+        for (unsigned w = 0; w < threads; w++) {
+            workers.emplace_back([&, w, epoch]() {
+                uint64_t chunk;
+                while (scheduler.Next(w, chunk)) {
+                    uint64_t first = options.first + chunk * ChunkSize;
+                    uint64_t last = std::min(first + ChunkSize - 1, options.last);
+                    FormatChunk(options, mode, first, last, *current[chunk - epoch]);
+                }
+            });
+        }
+
+        // Write the previous epoch while the workers are busy with this one.
+        write();
+        for (std::thread &worker: workers) {
+            worker.join();
+        }
+
+        std::swap(current, previous);
+        previousCount = count;
+        previousEpoch = epoch;
+        previousRecords = (std::min(options.first + (epoch + count) * ChunkSize - 1, options.last) -
+            (options.first + epoch * ChunkSize) + 1) * options.formats.size();
+    }
+    write();
+
+    if (binary) return golden.Close() ? 0 : 1;
+    if (options.stream) WriteStreamEnd(out);
+    bool good = out.Flush();
+    if (options.stats) PrintStats(out);
+    return good ? 0 : 1;
+}
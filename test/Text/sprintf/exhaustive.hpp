@@ -0,0 +1,8 @@
+#ifndef EXHAUSTIVE_HPP
+#define EXHAUSTIVE_HPP
+
+#include "options.hpp"
+
+auto RunFloat32All(const Options &options) -> int;
+
+#endif
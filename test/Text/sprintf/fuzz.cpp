@@ -0,0 +1,689 @@
+#include "fuzz.hpp"
+#include "rangescheduler.hpp"
+#include "sink.hpp"
+#include "stream.hpp"
+#include "testcasegen.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+    // Number of test cases in one unit of work, see RunFloat32All.
+    constexpr uint64_t ChunkSize = 4096;
+    constexpr uint64_t EpochChunksPerWorker = 16;
+    constexpr size_t ChunkBufferSize = ChunkSize * 64;
+
+    // Large enough for the widest result, a width of 64 or a precision of 60
+    // with the largest double.
+    constexpr size_t ResultSize = 1024;
+
+    // Characters for %c and %s, that don't need to be escaped in C#.
+    constexpr char TextCharacters[] =
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 !#$&()*+,-./:;<=>?@[]^_{|}~";
+
+    const char *const IntegerLengths[] = { "hh", "h", "l", "ll", "j", "z", "t" };
+
+    const int64_t IntegerValues[] = {
+        0, 1, -1, 7, 8, 9, 10, 15, 16, 99, 100, 127, 128, -128, -129, 255, 256,
+        32767, 32768, -32768, -32769, 65535, 65536, 999999999, 1000000000,
+        std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min(),
+        0xFFFFFFFF, 0x100000000, 999999999999999999, 1000000000000000000,
+        std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min(),
+        std::numeric_limits<int64_t>::min() + 1
+    };
+
+    // Values that are close to a rounding decision, or where the exponent or
+    // the number of digits changes.
+    const double RealValues[] = {
+        0.0, -0.0, 0.5, 1.0, 1.5, 2.5, 9.5, 0.05, 0.15, 0.25, 0.95, 0.1, 99.5,
+        9.999999, 1e-5, 9.9999e-5, 0.00001234, 123456789.0, 1e15, 1e16, 1e17,
+        1e22, 1e23, 4503599627370495.5, 9007199254740993.0,
+        std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+        std::numeric_limits<double>::quiet_NaN(), -std::numeric_limits<double>::quiet_NaN(),
+        std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::min(),
+        std::numeric_limits<double>::max(), -std::numeric_limits<double>::max()
+    };
+
+    static_assert(sizeof(long long) == 8 && sizeof(size_t) == 8 && sizeof(ptrdiff_t) == 8 &&
+        sizeof(intmax_t) == 8, "The length modifiers ll, z, t and j are expected to be 64-bit");
+
+    // SplitMix64. Every test case has its own generator, seeded from the seed
+    // and the number of the test case, so that any test case can be generated
+    // again on its own, independent of the threads and shards.
+    class FuzzRandom
+    {
+    public:
+        FuzzRandom(uint64_t seed, uint64_t index)
+            : state_(seed ^ Mix(index + 1)) { }
+
+        auto Next() -> uint64_t
+        {
+            state_ += 0x9E3779B97F4A7C15;
+            return Mix(state_);
+        }
+
+        auto Below(uint64_t count) -> uint64_t { return Next() % count; }
+        auto Chance(unsigned percent) -> bool { return Below(100) < percent; }
+
+    private:
+        static auto Mix(uint64_t z) -> uint64_t
+        {
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+            return z ^ (z >> 31);
+        }
+
+        uint64_t state_;
+    };
+
+    // A single format specifier and its arguments.
+    struct FuzzCase
+    {
+        uint64_t index;
+        std::string flags;
+        int width;                  // -1 if not given, may be negative if widthArg.
+        bool widthArg;              // The width is given with '*'.
+        int precision;              // -1 if not given, may be negative if precisionArg.
+        bool precisionArg;          // The precision is given with '.*'.
+        bool precisionEmpty;        // Only the '.', which is a precision of zero.
+        std::string length;
+        char specifier;
+        int64_t integer;
+        double real;
+        std::string text;           // The character for %c, the string for %s.
+    };
+
+    auto IsInteger(char specifier) -> bool { return std::strchr("diouxX", specifier); }
+    auto IsSigned(char specifier) -> bool { return specifier == 'd' || specifier == 'i'; }
+    auto IsReal(char specifier) -> bool { return std::strchr("fFeEgGaA", specifier); }
+
+    // Only the flags that C defines for the specifier.
+    auto Flags(char specifier) -> const char *
+    {
+        if (IsSigned(specifier) || specifier == 'u') return "-+ 0";
+        if (IsInteger(specifier) || IsReal(specifier)) return "-+ #0";
+        return "-";
+    }
+
+    // Truncates the integer to the type that is passed for the length
+    // modifier. C# truncates the same way, except that 'l' is 32-bit in C#
+    // but 64-bit in C, so the values are restricted to 32-bit.
+    auto Normalize(FuzzCase &c) -> void
+    {
+        if (!c.widthArg && c.width == 0) c.width = -1;
+        if (!IsInteger(c.specifier)) return;
+
+        if (c.length.empty() || c.length == "hh" || c.length == "h") {
+            c.integer = static_cast<int32_t>(c.integer);
+        } else if (c.length == "l") {
+            if (IsSigned(c.specifier)) {
+                c.integer = static_cast<int32_t>(c.integer);
+            } else {
+                c.integer = static_cast<uint32_t>(c.integer);
+            }
+        }
+    }
+
+    auto RandomText(FuzzRandom &random, size_t length) -> std::string
+    {
+        std::string text;
+        for (size_t i = 0; i < length; i++) {
+            text.push_back(TextCharacters[random.Below(sizeof(TextCharacters) - 1)]);
+        }
+        return text;
+    }
+
+    auto RandomReal(FuzzRandom &random) -> double
+    {
+        if (random.Chance(50)) {
+            return RealValues[random.Below(std::size(RealValues))];
+        }
+
+        if (random.Chance(50)) {
+            uint64_t bits = random.Next();
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        // A decimal number with up to 17 digits, scaled by a power of ten.
+        double value = static_cast<double>(random.Next() >> (11 + random.Below(53)));
+        double scale = std::pow(10.0, static_cast<double>(random.Below(23)));
+        value = random.Chance(50) ? value / scale : value * scale;
+        return random.Chance(50) ? -value : value;
+    }
+
+    auto Generate(uint64_t seed, uint64_t index, const std::string &specifiers) -> FuzzCase
+    {
+        FuzzRandom random{seed, index};
+        FuzzCase c{};
+        c.index = index;
+        c.width = -1;
+        c.precision = -1;
+        c.specifier = specifiers[random.Below(specifiers.size())];
+        if (c.specifier == '%') return c;
+
+        // Flags in any order, sometimes repeated.
+        const char *flags = Flags(c.specifier);
+        size_t flagCount = random.Chance(40) ? 0 : 1 + random.Below(4);
+        for (size_t i = 0; i < flagCount; i++) {
+            c.flags.push_back(flags[random.Below(std::strlen(flags))]);
+        }
+
+        uint64_t choice = random.Below(100);
+        if (choice < 40) {
+            c.width = -1;
+        } else if (choice < 50) {
+            c.widthArg = true;
+            c.width = static_cast<int>(random.Below(41)) - 20;
+        } else if (choice < 90) {
+            c.width = static_cast<int>(1 + random.Below(20));
+        } else {
+            c.width = static_cast<int>(1 + random.Below(64));
+        }
+
+        // The precision of %c is undefined.
+        choice = c.specifier == 'c' ? 0 : random.Below(100);
+        if (choice < 40) {
+            c.precision = -1;
+        } else if (choice < 45) {
+            c.precisionEmpty = true;
+            c.precision = 0;
+        } else if (choice < 55) {
+            c.precisionArg = true;
+            c.precision = static_cast<int>(random.Below(41)) - 10;
+        } else if (choice < 90) {
+            c.precision = static_cast<int>(random.Below(20));
+        } else {
+            c.precision = static_cast<int>(random.Below(61));
+        }
+
+        if (IsInteger(c.specifier)) {
+            if (random.Chance(60)) c.length = IntegerLengths[random.Below(std::size(IntegerLengths))];
+            if (random.Chance(50)) {
+                c.integer = IntegerValues[random.Below(std::size(IntegerValues))];
+            } else {
+                c.integer = static_cast<int64_t>(random.Next() >> random.Below(64));
+                if (random.Chance(50)) c.integer = -c.integer;
+            }
+        } else if (IsReal(c.specifier)) {
+            choice = random.Below(100);
+            if (choice < 15) {
+                c.length = "l";
+            } else if (choice < 30) {
+                c.length = "L";
+            }
+            c.real = RandomReal(random);
+        } else if (c.specifier == 'c') {
+            c.text = RandomText(random, 1);
+        } else {
+            c.text = RandomText(random, random.Below(13));
+        }
+
+        Normalize(c);
+        return c;
+    }
+
+    auto BuildFormat(const FuzzCase &c) -> std::string
+    {
+        if (c.specifier == '%') return "%%";
+
+        std::string format{"%"};
+        format.append(c.flags);
+        if (c.widthArg) {
+            format.push_back('*');
+        } else if (c.width >= 0) {
+            format.append(std::to_string(c.width));
+        }
+        if (c.precisionArg) {
+            format.append(".*");
+        } else if (c.precisionEmpty) {
+            format.push_back('.');
+        } else if (c.precision >= 0) {
+            format.push_back('.');
+            format.append(std::to_string(c.precision));
+        }
+        format.append(c.length);
+        format.push_back(c.specifier);
+        return format;
+    }
+
+    // The arguments as C# source, as given to SPrintF.
+    auto AppendParams(ArenaSink &sink, const FuzzCase &c) -> void
+    {
+        bool first = true;
+        auto separator = [&]() {
+            if (!first) sink.Append(", ");
+            first = false;
+        };
+
+        if (c.widthArg) {
+            separator();
+            sink.AppendDecimal(c.width);
+        }
+        if (c.precisionArg) {
+            separator();
+            sink.AppendDecimal(c.precision);
+        }
+
+        if (IsInteger(c.specifier)) {
+            separator();
+            sink.AppendDecimal(c.integer);
+            if (c.integer < std::numeric_limits<int32_t>::min() || c.integer > std::numeric_limits<int32_t>::max())
+                sink.Append('L');
+        } else if (IsReal(c.specifier)) {
+            uint64_t bits;
+            std::memcpy(&bits, &c.real, sizeof(bits));
+            separator();
+            sink.Append("UInt64ToDouble(0x");
+            sink.AppendHex(bits, 16);
+            sink.Append(')');
+        } else if (c.specifier == 'c') {
+            separator();
+            sink.Append('\'');
+            sink.Append(c.text.data(), c.text.size());
+            sink.Append('\'');
+        } else if (c.specifier == 's') {
+            separator();
+            sink.Append('"');
+            sink.Append(c.text.data(), c.text.size());
+            sink.Append('"');
+        }
+    }
+
+    template <typename T>
+    auto Call(char *buffer, const std::string &format, const FuzzCase &c, T value) -> int
+    {
+        if (c.widthArg && c.precisionArg)
+            return snprintf(buffer, ResultSize, format.c_str(), c.width, c.precision, value);
+        if (c.widthArg) return snprintf(buffer, ResultSize, format.c_str(), c.width, value);
+        if (c.precisionArg) return snprintf(buffer, ResultSize, format.c_str(), c.precision, value);
+        return snprintf(buffer, ResultSize, format.c_str(), value);
+    }
+
+    // Formats the test case with the C library, passing the type of argument
+    // that C expects for the length modifier.
+    auto Format(const FuzzCase &c, const std::string &format, char *buffer) -> int
+    {
+        int result;
+        if (c.specifier == '%') {
+            result = snprintf(buffer, ResultSize, "%%");
+        } else if (IsInteger(c.specifier)) {
+            if (c.length.empty() || c.length == "hh" || c.length == "h") {
+                result = Call(buffer, format, c, static_cast<int>(c.integer));
+            } else if (c.length == "l") {
+                result = Call(buffer, format, c, static_cast<long>(c.integer));
+            } else {
+                result = Call(buffer, format, c, static_cast<long long>(c.integer));
+            }
+        } else if (IsReal(c.specifier)) {
+            if (c.length == "L") {
+                result = Call(buffer, format, c, static_cast<long double>(c.real));
+            } else {
+                result = Call(buffer, format, c, c.real);
+            }
+        } else if (c.specifier == 'c') {
+            result = Call(buffer, format, c, static_cast<int>(c.text[0]));
+        } else {
+            result = Call(buffer, format, c, c.text.c_str());
+        }
+
+        if (result < 0) result = 0;
+        if (result >= static_cast<int>(ResultSize)) result = ResultSize - 1;
+        return result;
+    }
+
+    //   <case> TAB <format> TAB <C# arguments> TAB <libc result>
+    auto AppendRecord(ArenaSink &sink, const FuzzCase &c) -> void
+    {
+        char result[ResultSize];
+        std::string format = BuildFormat(c);
+        int length = Format(c, format, result);
+
+        sink.AppendDecimal(static_cast<int64_t>(c.index));
+        sink.Append('\t');
+        sink.Append(format.data(), format.size());
+        sink.Append('\t');
+        AppendParams(sink, c);
+        sink.Append('\t');
+        sink.Append(result, length);
+        sink.EndLine();
+        sink.AddRecord();
+    }
+
+    // The same test case as a record of the binary stream.
+    auto AppendStream(ArenaSink &batch, const FuzzCase &c) -> void
+    {
+        char result[ResultSize];
+        std::string format = BuildFormat(c);
+        int length = Format(c, format, result);
+
+        StreamArg args[3] = {};
+        size_t count = 0;
+        if (c.widthArg) args[count++] = { StreamArgType::Int32, static_cast<uint32_t>(c.width), nullptr, 0 };
+        if (c.precisionArg) args[count++] = { StreamArgType::Int32, static_cast<uint32_t>(c.precision), nullptr, 0 };
+        if (IsInteger(c.specifier)) {
+            bool int32 = c.integer >= std::numeric_limits<int32_t>::min() && c.integer <= std::numeric_limits<int32_t>::max();
+            args[count++] = { int32 ? StreamArgType::Int32 : StreamArgType::Int64, static_cast<uint64_t>(c.integer), nullptr, 0 };
+        } else if (IsReal(c.specifier)) {
+            uint64_t bits;
+            std::memcpy(&bits, &c.real, sizeof(bits));
+            args[count++] = { StreamArgType::Double, bits, nullptr, 0 };
+        } else if (c.specifier == 'c') {
+            args[count++] = { StreamArgType::Char, static_cast<uint8_t>(c.text[0]), nullptr, 0 };
+        } else if (c.specifier == 's') {
+            args[count++] = { StreamArgType::String, 0, c.text.data(), c.text.size() };
+        }
+
+        AppendStreamRecord(batch, c.index, format.data(), format.size(), args, count, result, length);
+    }
+
+    // Identifies a test case by its format and arguments.
+    auto Key(const FuzzCase &c) -> std::string
+    {
+        ArenaSink params{-1, 0};
+        AppendParams(params, c);
+        std::string key{BuildFormat(c)};
+        key.push_back('\t');
+        key.append(params.Data(), params.Size());
+        return key;
+    }
+
+    using Chunks = std::vector<std::unique_ptr<ArenaSink>>;
+
+    // The test case still shows the problem, if the predicate command exits
+    // with zero when given the record on its standard input.
+    auto Interesting(const std::string &predicate, const FuzzCase &c) -> bool
+    {
+        ArenaSink record{-1, 0};
+        AppendRecord(record, c);
+
+        FILE *pipe = popen(predicate.c_str(), "w");
+        if (!pipe) return false;
+        std::fwrite(record.Data(), 1, record.Size(), pipe);
+        int status = pclose(pipe);
+        return status != -1 && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+
+    auto SignificantDigits(double value) -> int
+    {
+        char buffer[32];
+        for (int digits = 1; digits < 17; digits++) {
+            snprintf(buffer, sizeof(buffer), "%.*e", digits - 1, value);
+            if (std::strtod(buffer, nullptr) == value) return digits;
+        }
+        return 17;
+    }
+
+    // The reducer only moves to simpler values, so that it terminates.
+    auto Complexity(double value) -> int
+    {
+        if (value == 0.0 && !std::signbit(value)) return 0;
+        if (std::isnan(value) || std::isinf(value)) return 100;
+        return 1 + (std::signbit(value) ? 1 : 0) + SignificantDigits(value);
+    }
+
+    // Simpler variants of the test case, the most simplifying first.
+    auto Candidates(const FuzzCase &c) -> std::vector<FuzzCase>
+    {
+        std::vector<FuzzCase> candidates;
+        std::set<std::string> keys{Key(c)};
+        auto add = [&](FuzzCase candidate) {
+            Normalize(candidate);
+            if (keys.insert(Key(candidate)).second) candidates.push_back(candidate);
+        };
+
+        for (size_t i = 0; i < c.flags.size(); i++) {
+            FuzzCase candidate{c};
+            candidate.flags.erase(i, 1);
+            add(candidate);
+        }
+
+        if (c.widthArg || c.width >= 0) {
+            FuzzCase candidate{c};
+            candidate.widthArg = false;
+            candidate.width = -1;
+            add(candidate);
+        }
+        if (c.widthArg ? c.width != 0 : c.width > 1) {
+            FuzzCase half{c};
+            half.width = c.width / 2;
+            add(half);
+            FuzzCase less{c};
+            less.width = c.width > 0 ? c.width - 1 : c.width + 1;
+            if (less.width != half.width) add(less);
+        }
+
+        if (c.precisionArg || c.precisionEmpty || c.precision >= 0) {
+            FuzzCase candidate{c};
+            candidate.precisionArg = false;
+            candidate.precisionEmpty = false;
+            candidate.precision = -1;
+            add(candidate);
+        }
+        if (c.precisionArg ? c.precision != 0 : !c.precisionEmpty && c.precision > 0) {
+            FuzzCase half{c};
+            half.precision = c.precision / 2;
+            add(half);
+            FuzzCase less{c};
+            less.precision = c.precision > 0 ? c.precision - 1 : c.precision + 1;
+            if (less.precision != half.precision) add(less);
+        }
+
+        if (!c.length.empty()) {
+            FuzzCase candidate{c};
+            candidate.length.clear();
+            add(candidate);
+        }
+
+        if (IsInteger(c.specifier) && c.integer != 0) {
+            std::vector<int64_t> values{0, c.integer / 10, c.integer / 2, c.integer > 0 ? c.integer - 1 : c.integer + 1};
+            if (c.integer < 0 && c.integer != std::numeric_limits<int64_t>::min()) {
+                values.insert(values.begin() + 1, -c.integer);
+            }
+            for (int64_t value: values) {
+                FuzzCase candidate{c};
+                candidate.integer = value;
+                add(candidate);
+            }
+        } else if (IsReal(c.specifier)) {
+            int complexity = Complexity(c.real);
+            std::vector<double> values{0.0, 1.0, std::fabs(c.real), std::trunc(c.real)};
+            int digits = std::isfinite(c.real) ? SignificantDigits(c.real) : 0;
+            for (int d = 1; d < digits; d++) {
+                char buffer[32];
+                snprintf(buffer, sizeof(buffer), "%.*e", d - 1, c.real);
+                values.push_back(std::strtod(buffer, nullptr));
+            }
+            for (double value: values) {
+                if (Complexity(value) >= complexity) continue;
+                FuzzCase candidate{c};
+                candidate.real = value;
+                add(candidate);
+            }
+        } else if (c.specifier == 'c' && c.text != "a") {
+            FuzzCase candidate{c};
+            candidate.text = "a";
+            add(candidate);
+        } else if (c.specifier == 's') {
+            for (size_t i = 0; i < c.text.size(); i++) {
+                FuzzCase candidate{c};
+                candidate.text.erase(i, 1);
+                add(candidate);
+            }
+        }
+        return candidates;
+    }
+
+    // Greedily applies the first simplification that still shows the
+    // problem, until there is none left.
+    auto Reduce(const std::string &predicate, FuzzCase &c) -> void
+    {
+        bool reduced = true;
+        while (reduced) {
+            reduced = false;
+            for (const FuzzCase &candidate: Candidates(c)) {
+                if (Interesting(predicate, candidate)) {
+                    c = candidate;
+                    reduced = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// Generates random test cases, one per line, in the order of the test case
+// number regardless of the number of threads:
+//
+//   <case> TAB <format> TAB <C# arguments> TAB <libc result>
+//
+// The test case number and the seed are enough to generate a test case again.
+// With --stream, the test cases are written as a binary stream instead, one
+// batch per chunk.
+auto RunFuzz(const Options &options) -> int
+{
+    uint64_t first = options.fuzzCount * (options.shardIndex - 1) / options.shardCount;
+    uint64_t end = options.fuzzCount * options.shardIndex / options.shardCount;
+
+    unsigned threads = options.threads;
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+
+    uint64_t chunks = (end - first + ChunkSize - 1) / ChunkSize;
+    uint64_t epochChunks = threads * EpochChunksPerWorker;
+
+    RangeScheduler scheduler{threads};
+    Chunks current;
+    Chunks previous;
+    for (uint64_t i = 0; i < epochChunks; i++) {
+        current.emplace_back(new ArenaSink{-1, ChunkBufferSize});
+        previous.emplace_back(new ArenaSink{-1, ChunkBufferSize});
+    }
+    uint64_t previousCount = 0;
+
+    ArenaSink out{STDOUT_FILENO};
+    auto write = [&]() {
+        for (uint64_t i = 0; i < previousCount; i++) {
+            if (options.stream) {
+                WriteStreamBatch(out, *previous[i]);
+            } else {
+                out.Write(previous[i]->Data(), previous[i]->Size());
+                out.AddRecord(previous[i]->Records());
+            }
+        }
+    };
+
+    if (options.stream) WriteStreamHeader(out);
+
+    for (uint64_t epoch = 0; epoch < chunks; epoch += epochChunks) {
+        uint64_t count = std::min(epochChunks, chunks - epoch);
+        scheduler.Reset(epoch, epoch + count);
+
+        std::vector<std::thread> workers;
+        for (unsigned w = 0; w < threads; w++) {
+            workers.emplace_back([&, w, epoch]() {
+                uint64_t chunk;
+                while (scheduler.Next(w, chunk)) {
+                    ArenaSink &output = *current[chunk - epoch];
+                    output.Clear();
+                    uint64_t last = std::min(first + (chunk + 1) * ChunkSize, end);
+                    for (uint64_t index = first + chunk * ChunkSize; index < last; index++) {
+                        FuzzCase c = Generate(options.seed, index, options.specifiers);
+                        if (options.stream) {
+                            AppendStream(output, c);
+                        } else {
+                            AppendRecord(output, c);
+                        }
+                    }
+                }
+            });
+        }
+
+        // Write the previous epoch while the workers are busy with this one.
+        write();
+        for (std::thread &worker: workers) {
+            worker.join();
+        }
+
+        std::swap(current, previous);
+        previousCount = count;
+    }
+    write();
+    if (options.stream) WriteStreamEnd(out);
+
+    bool good = out.Flush();
+    if (options.stats) PrintStats(out);
+    return good ? 0 : 1;
+}
+
+// Reads test cases found by the fuzzer, one per line starting with the test
+// case number (e.g. the failing records of the fuzzer output). Each test case
+// is reduced to the simplest test case for which the predicate command still
+// exits with zero, and printed as an NUnit test. Test cases that reduce to the
+// same test case are printed once.
+auto RunReduce(const Options &options) -> int
+{
+    std::ifstream input{options.inputFile};
+    if (!input) {
+        std::cerr << "Couldn't open " << options.inputFile << std::endl;
+        return 1;
+    }
+
+    // The predicate may exit without reading the record.
+    signal(SIGPIPE, SIG_IGN);
+
+    std::set<std::string> keys;
+    std::vector<FuzzCase> reduced;
+    std::string line;
+    while (std::getline(input, line)) {
+        uint64_t index;
+        auto parsed = std::from_chars(line.data(), line.data() + line.size(), index);
+        if (parsed.ec != std::errc{}) continue;
+
+        FuzzCase c = Generate(options.seed, index, options.specifiers);
+        if (!Interesting(options.predicate, c)) {
+            std::cerr << "Test case " << index << " doesn't match the predicate" << std::endl;
+            continue;
+        }
+        Reduce(options.predicate, c);
+        if (keys.insert(Key(c)).second) reduced.push_back(c);
+    }
+    if (reduced.empty()) return 0;
+
+    ArenaSink out{STDOUT_FILENO};
+    TestCaseGen gen{out};
+    {
+        auto function_block = gen.Function("Fuzz");
+        auto multiple_block = gen.TestMultiple();
+        for (const FuzzCase &c: reduced) {
+            std::string format = BuildFormat(c);
+            ArenaSink params{-1, 0};
+            AppendParams(params, c);
+            char result[ResultSize];
+            int length = Format(c, format, result);
+            gen.Comment("Seed " + std::to_string(options.seed) + ", test case " + std::to_string(c.index));
+            gen.TestSPrintFResult(format, std::string{params.Data(), params.Size()}, result, length);
+        }
+    }
+    return out.Flush() ? 0 : 1;
+}
@@ -0,0 +1,9 @@
+#ifndef FUZZ_HPP
+#define FUZZ_HPP
+
+#include "options.hpp"
+
+auto RunFuzz(const Options &options) -> int;
+auto RunReduce(const Options &options) -> int;
+
+#endif
@@ -0,0 +1,285 @@
+#include "golden.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+const char GoldenMagic[8] = { 'S', 'P', 'R', 'I', 'N', 'T', 'F', 'G' };
+
+namespace
+{
+    constexpr size_t StreamBufferSize = 1 << 20;
+
+    auto Padding(uint64_t size) -> uint64_t
+    {
+        return (8 - (size & 7)) & 7;
+    }
+}
+
+GoldenWriter::GoldenWriter()
+    : file_(nullptr)
+    , heap_(nullptr)
+    , recordCount_(0)
+    , heapSize_(0) { }
+
+GoldenWriter::~GoldenWriter()
+{
+    if (file_) std::fclose(file_);
+    if (heap_) std::fclose(heap_);
+}
+
+auto GoldenWriter::Open(const std::string &fileName) -> bool
+{
+    file_ = std::fopen(fileName.c_str(), "w+b");
+    if (!file_) return false;
+    heap_ = std::tmpfile();
+    if (!heap_) return false;
+
+    std::setvbuf(file_, nullptr, _IOFBF, StreamBufferSize);
+    std::setvbuf(heap_, nullptr, _IOFBF, StreamBufferSize);
+    fileName_ = fileName;
+
+    // Reserve space for the header, which is written last.
+    GoldenHeader header{};
+    return std::fwrite(&header, sizeof(header), 1, file_) == 1;
+}
+
+auto GoldenWriter::Add(const std::string &format, GoldenKind kind, uint64_t bits, const char *result, size_t length) -> void
+{
+    GoldenRecord record{};
+    record.formatId = FormatId(format, kind);
+    record.length = static_cast<uint32_t>(length);
+    record.bits = bits;
+    record.heapOffset = AddString(result, length);
+    std::fwrite(&record, sizeof(record), 1, file_);
+
+    formats_[record.formatId].count++;
+    recordCount_++;
+}
+
+auto GoldenWriter::FormatId(const std::string &format, GoldenKind kind) -> uint32_t
+{
+    std::string key{format};
+    key.push_back('\0');
+    key.push_back(static_cast<char>(kind));
+
+    auto it = formatIds_.find(key);
+    if (it != formatIds_.end()) return it->second;
+
+    GoldenFormat entry{};
+    entry.heapOffset = AddString(format.c_str(), format.size());
+    entry.length = static_cast<uint32_t>(format.size());
+    entry.kind = kind;
+
+    uint32_t id = static_cast<uint32_t>(formats_.size());
+    formats_.push_back(entry);
+    formatIds_.emplace(std::move(key), id);
+    return id;
+}
+
+auto GoldenWriter::AddString(const char *str, size_t length) -> uint64_t
+{
+    uint64_t offset = heapSize_;
+    std::fwrite(str, 1, length, heap_);
+    std::fputc(0, heap_);
+    heapSize_ += length + 1;
+    return offset;
+}
+
+auto GoldenWriter::BuildIndex() -> bool
+{
+    if (std::fflush(file_) != 0) return false;
+
+    std::vector<uint64_t> index(recordCount_);
+    if (recordCount_ > 0) {
+        size_t length = sizeof(GoldenHeader) + recordCount_ * sizeof(GoldenRecord);
+        void *map = mmap(nullptr, length, PROT_READ, MAP_SHARED, fileno(file_), 0);
+        if (map == MAP_FAILED) return false;
+
+        const GoldenRecord *records = reinterpret_cast<const GoldenRecord *>(
+            static_cast<const char *>(map) + sizeof(GoldenHeader));
+        for (uint64_t i = 0; i < recordCount_; i++) {
+            index[i] = i;
+        }
+        std::stable_sort(index.begin(), index.end(), [records](uint64_t a, uint64_t b) {
+            if (records[a].formatId != records[b].formatId)
+                return records[a].formatId < records[b].formatId;
+            return records[a].bits < records[b].bits;
+        });
+        munmap(map, length);
+    }
+
+    uint64_t first = 0;
+    for (GoldenFormat &format: formats_) {
+        format.firstIndex = first;
+        first += format.count;
+    }
+
+    // The file position is at the end of the records.
+    if (!formats_.empty() &&
+        std::fwrite(formats_.data(), sizeof(GoldenFormat), formats_.size(), file_) != formats_.size())
+        return false;
+
+    char buffer[65536];
+    std::rewind(heap_);
+    size_t read;
+    while ((read = std::fread(buffer, 1, sizeof(buffer), heap_)) > 0) {
+        if (std::fwrite(buffer, 1, read, file_) != read) return false;
+    }
+    static const char zeroes[8] = {};
+    uint64_t padding = Padding(heapSize_);
+    if (std::fwrite(zeroes, 1, padding, file_) != padding) return false;
+
+    if (!index.empty() &&
+        std::fwrite(index.data(), sizeof(uint64_t), index.size(), file_) != index.size())
+        return false;
+    return true;
+}
+
+auto GoldenWriter::Close() -> bool
+{
+    if (!file_) return false;
+
+    bool result = BuildIndex();
+
+    GoldenHeader header{};
+    std::memcpy(header.magic, GoldenMagic, sizeof(header.magic));
+    header.version = GoldenVersion;
+    header.formatCount = static_cast<uint32_t>(formats_.size());
+    header.recordCount = recordCount_;
+    header.recordOffset = sizeof(GoldenHeader);
+    header.formatOffset = header.recordOffset + recordCount_ * sizeof(GoldenRecord);
+    header.heapOffset = header.formatOffset + formats_.size() * sizeof(GoldenFormat);
+    header.heapSize = heapSize_ + Padding(heapSize_);
+    header.indexOffset = header.heapOffset + header.heapSize;
+
+    std::rewind(file_);
+    if (std::fwrite(&header, sizeof(header), 1, file_) != 1) result = false;
+    if (std::fclose(file_) != 0) result = false;
+    std::fclose(heap_);
+    file_ = nullptr;
+    heap_ = nullptr;
+    return result;
+}
+
+GoldenReader::GoldenReader()
+    : map_(nullptr)
+    , size_(0)
+    , header_(nullptr)
+    , records_(nullptr)
+    , formats_(nullptr)
+    , heap_(nullptr)
+    , index_(nullptr)
+    , invalid_(false) { }
+
+GoldenReader::~GoldenReader()
+{
+    Close();
+}
+
+auto GoldenReader::Open(const std::string &fileName) -> bool
+{
+    Close();
+    invalid_ = false;
+
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    if (static_cast<size_t>(st.st_size) < sizeof(GoldenHeader)) {
+        close(fd);
+        invalid_ = true;
+        return false;
+    }
+
+    size_ = static_cast<size_t>(st.st_size);
+    void *map = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return false;
+    map_ = map;
+
+    const char *base = static_cast<const char *>(map_);
+    header_ = reinterpret_cast<const GoldenHeader *>(base);
+    if (std::memcmp(header_->magic, GoldenMagic, sizeof(GoldenMagic)) != 0 ||
+        header_->version != GoldenVersion ||
+        !Fits(header_->recordOffset, header_->recordCount, sizeof(GoldenRecord), size_) ||
+        !Fits(header_->formatOffset, header_->formatCount, sizeof(GoldenFormat), size_) ||
+        !Fits(header_->heapOffset, header_->heapSize, 1, size_) ||
+        !Fits(header_->indexOffset, header_->recordCount, sizeof(uint64_t), size_)) {
+        Close();
+        invalid_ = true;
+        return false;
+    }
+
+    records_ = reinterpret_cast<const GoldenRecord *>(base + header_->recordOffset);
+    formats_ = reinterpret_cast<const GoldenFormat *>(base + header_->formatOffset);
+    heap_ = base + header_->heapOffset;
+    index_ = reinterpret_cast<const uint64_t *>(base + header_->indexOffset);
+    if (!Validate()) {
+        Close();
+        invalid_ = true;
+        return false;
+    }
+    return true;
+}
+
+auto GoldenReader::Fits(uint64_t offset, uint64_t count, uint64_t size, uint64_t limit) -> bool
+{
+    return offset <= limit && count <= (limit - offset) / size;
+}
+
+auto GoldenReader::ValidString(uint64_t heapOffset, uint32_t length) const -> bool
+{
+    return heapOffset < header_->heapSize && length < header_->heapSize - heapOffset &&
+        heap_[heapOffset + length] == '\0';
+}
+
+// Checks every offset and count of the tables, so that the accessors don't
+// need to, even if the file is corrupted.
+auto GoldenReader::Validate() const -> bool
+{
+    for (uint32_t i = 0; i < header_->formatCount; i++) {
+        const GoldenFormat &format = formats_[i];
+        if (format.kind != GoldenKind::Double && format.kind != GoldenKind::Single) return false;
+        if (!ValidString(format.heapOffset, format.length)) return false;
+        if (format.firstIndex > header_->recordCount ||
+            format.count > header_->recordCount - format.firstIndex) return false;
+    }
+    for (uint64_t i = 0; i < header_->recordCount; i++) {
+        const GoldenRecord &record = records_[i];
+        if (record.formatId >= header_->formatCount) return false;
+        if (!ValidString(record.heapOffset, record.length)) return false;
+        if (index_[i] >= header_->recordCount) return false;
+    }
+    return true;
+}
+
+auto GoldenReader::Close() -> void
+{
+    if (map_) munmap(map_, size_);
+    map_ = nullptr;
+    size_ = 0;
+    header_ = nullptr;
+}
+
+auto GoldenReader::Find(uint32_t formatId, uint64_t bits) const -> const GoldenRecord *
+{
+    if (formatId >= header_->formatCount) return nullptr;
+
+    const GoldenFormat &format = formats_[formatId];
+    const uint64_t *first = index_ + format.firstIndex;
+    const uint64_t *last = first + format.count;
+    const uint64_t *found = std::lower_bound(first, last, bits, [this](uint64_t record, uint64_t value) {
+        return records_[record].bits < value;
+    });
+    if (found == last || records_[*found].bits != bits) return nullptr;
+    return &records_[*found];
+}
@@ -0,0 +1,134 @@
+#ifndef GOLDEN_HPP
+#define GOLDEN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Binary golden vector file. All structures are written in the byte order of
+// the host (little endian on all supported platforms) and are 8-byte aligned,
+// so that a reader can map the file into memory and use it without parsing.
+//
+//   GoldenHeader
+//   GoldenRecord[recordCount]    In the order the test cases were generated.
+//   GoldenFormat[formatCount]    Indexed by GoldenRecord::formatId.
+//   char heap[heapSize]          NUL terminated strings.
+//   uint64_t index[recordCount]  Record numbers sorted by (formatId, bits).
+//
+// The records of one format are the slice [firstIndex, firstIndex + count) of
+// the index, so a single vector is found with a binary search.
+
+enum class GoldenKind : uint32_t
+{
+    Double = 1,
+    Single = 2
+};
+
+struct GoldenHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t formatCount;
+    uint64_t recordCount;
+    uint64_t recordOffset;
+    uint64_t formatOffset;
+    uint64_t heapOffset;
+    uint64_t heapSize;
+    uint64_t indexOffset;
+};
+
+struct GoldenFormat
+{
+    uint64_t heapOffset;
+    uint32_t length;
+    GoldenKind kind;
+    uint64_t firstIndex;
+    uint64_t count;
+};
+
+struct GoldenRecord
+{
+    uint32_t formatId;
+    uint32_t length;
+    uint64_t bits;
+    uint64_t heapOffset;
+};
+
+static_assert(sizeof(GoldenHeader) == 64, "GoldenHeader layout");
+static_assert(sizeof(GoldenFormat) == 32, "GoldenFormat layout");
+static_assert(sizeof(GoldenRecord) == 24, "GoldenRecord layout");
+
+extern const char GoldenMagic[8];
+constexpr uint32_t GoldenVersion = 1;
+
+// Streams records to a file. The strings and format table are kept aside and
+// appended, and the index is built, when the file is closed.
+class GoldenWriter
+{
+public:
+    GoldenWriter();
+    GoldenWriter(const GoldenWriter &) = delete;
+    auto operator=(const GoldenWriter &) -> GoldenWriter & = delete;
+    ~GoldenWriter();
+
+    auto Open(const std::string &fileName) -> bool;
+    auto Add(const std::string &format, GoldenKind kind, uint64_t bits, const char *result, size_t length) -> void;
+    auto Close() -> bool;
+
+private:
+    auto FormatId(const std::string &format, GoldenKind kind) -> uint32_t;
+    auto AddString(const char *str, size_t length) -> uint64_t;
+    auto BuildIndex() -> bool;
+
+    std::string fileName_;
+    std::FILE *file_;
+    std::FILE *heap_;
+    uint64_t recordCount_;
+    uint64_t heapSize_;
+    std::unordered_map<std::string, uint32_t> formatIds_;
+    std::vector<GoldenFormat> formats_;
+};
+
+// Maps a golden vector file into memory. The file is checked when it is
+// opened, so that all offsets, identifiers and index entries that it refers to
+// are within the file.
+class GoldenReader
+{
+public:
+    GoldenReader();
+    GoldenReader(const GoldenReader &) = delete;
+    auto operator=(const GoldenReader &) -> GoldenReader & = delete;
+    ~GoldenReader();
+
+    auto Open(const std::string &fileName) -> bool;
+    auto Close() -> void;
+
+    // The last Open failed, because the file isn't a valid golden vector file.
+    auto Invalid() const -> bool { return invalid_; }
+
+    auto RecordCount() const -> uint64_t { return header_->recordCount; }
+    auto Record(uint64_t record) const -> const GoldenRecord & { return records_[record]; }
+    auto FormatCount() const -> uint32_t { return header_->formatCount; }
+    auto Format(uint32_t formatId) const -> const GoldenFormat & { return formats_[formatId]; }
+    auto String(uint64_t heapOffset) const -> const char * { return heap_ + heapOffset; }
+    auto Find(uint32_t formatId, uint64_t bits) const -> const GoldenRecord *;
+
+private:
+    static auto Fits(uint64_t offset, uint64_t count, uint64_t size, uint64_t limit) -> bool;
+    auto ValidString(uint64_t heapOffset, uint32_t length) const -> bool;
+    auto Validate() const -> bool;
+
+    void *map_;
+    size_t size_;
+    const GoldenHeader *header_;
+    const GoldenRecord *records_;
+    const GoldenFormat *formats_;
+    const char *heap_;
+    const uint64_t *index_;
+    bool invalid_;
+};
+
+#endif
@@ -0,0 +1,211 @@
+#include "options.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+    auto ParseNumber(const std::string &arg, uint64_t &value) -> bool
+    {
+        if (arg.empty()) return false;
+
+        char *end = nullptr;
+        value = std::strtoull(arg.c_str(), &end, 0);
+        return *end == 0;
+    }
+
+    auto ParseList(const std::string &arg, std::vector<std::string> &list) -> bool
+    {
+        std::istringstream stream{arg};
+        std::string item;
+        list.clear();
+        while (std::getline(stream, item, ',')) {
+            if (item.empty()) return false;
+            list.push_back(item);
+        }
+        return !list.empty();
+    }
+
+    // A format for --float32-all is given a single float (promoted to double)
+    // by snprintf, so it must have exactly one floating point conversion,
+    // %[flags][width][.precision]{aAeEfFgG}, besides any %%.
+    auto ValidFloatFormat(const std::string &format) -> bool
+    {
+        int conversions = 0;
+        size_t i = 0;
+        while (i < format.size()) {
+            if (format[i++] != '%') continue;
+            if (i < format.size() && format[i] == '%') {
+                i++;
+                continue;
+            }
+
+            while (i < format.size() && std::strchr("-+ #0", format[i])) i++;
+            while (i < format.size() && format[i] >= '0' && format[i] <= '9') i++;
+            if (i < format.size() && format[i] == '.') {
+                i++;
+                while (i < format.size() && format[i] >= '0' && format[i] <= '9') i++;
+            }
+            if (i == format.size() || !std::strchr("aAeEfFgG", format[i])) return false;
+            i++;
+            conversions++;
+        }
+        return conversions == 1;
+    }
+
+    auto ParseRange(const std::string &arg, uint64_t &first, uint64_t &last) -> bool
+    {
+        auto colon = arg.find(':');
+        if (colon == std::string::npos) return false;
+        if (!ParseNumber(arg.substr(0, colon), first)) return false;
+        if (!ParseNumber(arg.substr(colon + 1), last)) return false;
+        return first <= last;
+    }
+
+    auto ParseShard(const std::string &arg, uint64_t &index, uint64_t &count) -> bool
+    {
+        auto slash = arg.find('/');
+        if (slash == std::string::npos) return false;
+        if (!ParseNumber(arg.substr(0, slash), index)) return false;
+        if (!ParseNumber(arg.substr(slash + 1), count)) return false;
+        return index >= 1 && index <= count;
+    }
+}
+
+auto ParseOptions(int argc, char *argv[], Options &options) -> bool
+{
+    for (int i = 1; i < argc; i++) {
+        std::string arg{argv[i]};
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--float32-all") {
+            options.mode = Mode::Float32All;
+        } else if (arg == "--formats" && hasValue) {
+            if (!ParseList(argv[++i], options.formats)) return false;
+        } else if (arg == "--threads" && hasValue) {
+            uint64_t threads;
+            if (!ParseNumber(argv[++i], threads) || threads == 0 || threads > 1024) return false;
+            options.threads = static_cast<unsigned>(threads);
+        } else if (arg == "--shard" && hasValue) {
+            if (!ParseShard(argv[++i], options.shardIndex, options.shardCount)) return false;
+        } else if (arg == "--stats") {
+            options.stats = true;
+        } else if (arg == "--digest") {
+            options.mode = Mode::Digest;
+        } else if (arg == "--long-precision") {
+            options.mode = Mode::LongPrecision;
+        } else if (arg == "--rounding") {
+            options.mode = Mode::Rounding;
+        } else if (arg == "--minimal") {
+            options.minimal = true;
+        } else if (arg == "--data") {
+            options.data = true;
+        } else if (arg == "--override" && hasValue) {
+            options.overrideFile = argv[++i];
+        } else if (arg == "--stream") {
+            options.stream = true;
+        } else if (arg == "--binary" && hasValue) {
+            options.binaryFile = argv[++i];
+        } else if (arg == "--verify" && hasValue) {
+            options.mode = Mode::Verify;
+            options.inputFile = argv[++i];
+        } else if (arg == "--dump" && hasValue) {
+            options.mode = Mode::Dump;
+            options.inputFile = argv[++i];
+        } else if (arg == "--fuzz" && hasValue) {
+            options.mode = Mode::Fuzz;
+            if (!ParseNumber(argv[++i], options.fuzzCount)) return false;
+        } else if (arg == "--seed" && hasValue) {
+            if (!ParseNumber(argv[++i], options.seed)) return false;
+        } else if (arg == "--specifiers" && hasValue) {
+            options.specifiers = argv[++i];
+        } else if (arg == "--reduce" && hasValue) {
+            options.mode = Mode::Reduce;
+            options.inputFile = argv[++i];
+        } else if (arg == "--predicate" && hasValue) {
+            options.predicate = argv[++i];
+        } else if (arg == "--canonical" && hasValue) {
+            options.canonicalFile = argv[++i];
+        } else if (arg == "--delta") {
+            options.mode = Mode::Delta;
+        } else if (arg == "--transcript" && hasValue) {
+            options.inputFile = argv[++i];
+        } else if (arg == "--patch" && hasValue) {
+            options.mode = Mode::Patch;
+            options.inputFile = argv[++i];
+        } else if (arg == "--query" && hasValue) {
+            options.mode = Mode::Query;
+            if (!ParseList(argv[++i], options.deltaFiles)) return false;
+        } else if (arg == "--range" && hasValue) {
+            if (!ParseRange(argv[++i], options.first, options.last)) return false;
+        } else {
+            return false;
+        }
+    }
+
+    if (options.mode == Mode::Float32All) {
+        if (options.formats.empty()) {
+            options.formats = {"%.7g", "%e", "%a", "%.9g"};
+        }
+        for (const std::string &format: options.formats) {
+            if (!ValidFloatFormat(format)) return false;
+        }
+        if (options.last > 0xFFFFFFFF) return false;
+    }
+
+    if (options.stream) {
+        if (options.mode != Mode::Float32All && options.mode != Mode::Fuzz && options.mode != Mode::Dump) return false;
+        if (!options.binaryFile.empty()) return false;
+    }
+
+    if (options.mode == Mode::Fuzz || options.mode == Mode::Reduce) {
+        // %p and %n have no C# equivalent (a pointer), and %a isn't implemented
+        // in C# yet, but can be given explicitly.
+        if (options.specifiers.empty()) options.specifiers = "diouxXfFeEgGcs%";
+        if (options.specifiers.find_first_not_of("diouxXfFeEgGaAcs%") != std::string::npos) return false;
+        if (options.mode == Mode::Reduce && options.predicate.empty()) return false;
+    }
+
+    if (!options.overrideFile.empty() && !options.data) return false;
+
+    if (options.mode == Mode::Delta || options.mode == Mode::Patch || options.mode == Mode::Query) {
+        if (options.canonicalFile.empty()) return false;
+    }
+    return true;
+}
+
+auto Usage() -> void
+{
+    std::cerr << "Usage: sprintf [options]" << std::endl
+        << std::endl
+        << "Without options, generate the NUnit test cases for SPrintF." << std::endl
+        << std::endl
+        << "  --shard N/M          Generate only the N'th of M slices of the test cases." << std::endl
+        << "  --threads N          Number of worker threads (default all cores)." << std::endl
+        << "  --stats              Print the number of records and bytes written." << std::endl
+        << "  --digest             Print a digest of the results per test category and exponent band." << std::endl
+        << "  --long-precision     Generate the exact decimal expansion of every exponent." << std::endl
+        << "  --rounding           Generate the doubles nearest to the decimal rounding ties." << std::endl
+        << "  --minimal            Only one IEEE754 test case of each equivalence class." << std::endl
+        << "  --data               Write the IEEE754 test cases as a data file for the NUnit tests." << std::endl
+        << "  --override FILE      Results corrected by hand, merged into the --data file." << std::endl
+        << "  --binary FILE        Write the IEEE754 binary test cases to a golden vector file." << std::endl
+        << "  --stream             Write --fuzz, --float32-all or --dump as a binary stream for testdiff." << std::endl
+        << "  --verify FILE        Replay a golden vector file against this libc." << std::endl
+        << "  --dump FILE          Print a golden vector file as text." << std::endl
+        << "  --float32-all        Format every 32-bit float bit pattern." << std::endl
+        << "  --formats F1,F2,...  Formats for --float32-all (default %.7g,%e,%a,%.9g)." << std::endl
+        << "  --range FIRST:LAST   Only the bit patterns FIRST to LAST inclusive." << std::endl
+        << "  --fuzz COUNT         Generate COUNT random format specifiers and their results." << std::endl
+        << "  --seed N             Seed for --fuzz and --reduce (default 1)." << std::endl
+        << "  --specifiers LIST    Specifiers for --fuzz and --reduce (default diouxXfFeEgGcs%)." << std::endl
+        << "  --reduce FILE        Reduce the fuzz test cases listed in FILE to NUnit tests." << std::endl
+        << "  --predicate CMD      Command that exits with zero if a fuzz record on stdin fails." << std::endl
+        << "  --canonical FILE     Canonical transcript for --delta, --patch and --query." << std::endl
+        << "  --delta              Print the test cases that differ from the canonical transcript." << std::endl
+        << "  --transcript FILE    Use the transcript in FILE for --delta and --digest instead of this libc." << std::endl
+        << "  --patch FILE         Print the transcript of the delta file FILE." << std::endl
+        << "  --query F1,F2,...    Print the test cases where the delta files and canonical disagree." << std::endl;
+}
@@ -0,0 +1,51 @@
+#ifndef OPTIONS_HPP
+#define OPTIONS_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class Mode
+{
+    TestCases,
+    Float32All,
+    Verify,
+    Dump,
+    Fuzz,
+    Reduce,
+    Delta,
+    Patch,
+    Query,
+    LongPrecision,
+    Rounding,
+    Digest
+};
+
+struct Options
+{
+    Mode mode = Mode::TestCases;
+    std::vector<std::string> formats;
+    unsigned threads = 0;
+    uint64_t first = 0;
+    uint64_t last = 0xFFFFFFFF;
+    uint64_t shardIndex = 1;
+    uint64_t shardCount = 1;
+    bool stats = false;
+    bool stream = false;
+    bool minimal = false;
+    bool data = false;
+    uint64_t fuzzCount = 0;
+    uint64_t seed = 1;
+    std::string specifiers;
+    std::string predicate;
+    std::string binaryFile;
+    std::string overrideFile;
+    std::string inputFile;
+    std::string canonicalFile;
+    std::vector<std::string> deltaFiles;
+};
+
+auto ParseOptions(int argc, char *argv[], Options &options) -> bool;
+auto Usage() -> void;
+
+#endif
@@ -0,0 +1,84 @@
+#include "rangescheduler.hpp"
+
+namespace
+{
+    auto Pack(uint64_t first, uint64_t end) -> uint64_t
+    {
+        return (first << 32) | end;
+    }
+
+    auto First(uint64_t range) -> uint64_t
+    {
+        return range >> 32;
+    }
+
+    auto End(uint64_t range) -> uint64_t
+    {
+        return range & 0xFFFFFFFF;
+    }
+}
+
+RangeScheduler::RangeScheduler(unsigned workers)
+    : workers_(workers == 0 ? 1 : workers)
+    , base_(0)
+    , slots_(new Slot[workers == 0 ? 1 : workers])
+{
+    for (unsigned i = 0; i < workers_; i++) {
+        slots_[i].range.store(0);
+    }
+}
+
+// Not thread safe. All workers must have finished with the previous range
+// before the next range is set. The range may not be larger than 2^32 items.
+auto RangeScheduler::Reset(uint64_t begin, uint64_t end) -> void
+{
+    base_ = begin;
+    uint64_t length = end - begin;
+    for (unsigned i = 0; i < workers_; i++) {
+        uint64_t first = length * i / workers_;
+        uint64_t last = length * (i + 1) / workers_;
+        slots_[i].range.store(Pack(first, last));
+    }
+}
+
+auto RangeScheduler::Next(unsigned worker, uint64_t &item) -> bool
+{
+    std::atomic<uint64_t> &slot = slots_[worker].range;
+    uint64_t range = slot.load();
+    while (First(range) < End(range)) {
+        uint64_t next = Pack(First(range) + 1, End(range));
+        if (slot.compare_exchange_weak(range, next)) {
+            item = base_ + First(range);
+            return true;
+        }
+    }
+    return Steal(worker, item);
+}
+
+auto RangeScheduler::Steal(unsigned worker, uint64_t &item) -> bool
+{
+    // Keep looking until every worker is empty. A failed compare means the
+    // victim changed underneath us, so look at it again.
+    bool found = true;
+    while (found) {
+        found = false;
+        for (unsigned i = 1; i < workers_; i++) {
+            std::atomic<uint64_t> &victim = slots_[(worker + i) % workers_].range;
+            uint64_t range = victim.load();
+            while (First(range) < End(range)) {
+                found = true;
+                uint64_t first = First(range);
+                uint64_t end = End(range);
+                uint64_t mid = end - first == 1 ? first : first + (end - first) / 2;
+                uint64_t left = mid == first ? Pack(first + 1, end) : Pack(first, mid);
+                if (victim.compare_exchange_weak(range, left)) {
+                    // We own [mid, end) now. Take the first and keep the rest.
+                    item = base_ + mid;
+                    slots_[worker].range.store(mid == first ? Pack(0, 0) : Pack(mid + 1, end));
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
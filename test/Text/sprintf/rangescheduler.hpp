@@ -0,0 +1,35 @@
+#ifndef RANGESCHEDULER_HPP
+#define RANGESCHEDULER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// Hands out the items of a range [begin, end) to a fixed number of workers.
+// Each worker owns a contiguous sub-range and takes items from its front. A
+// worker that runs out steals the back half of another worker's sub-range, so
+// that all workers finish at about the same time.
+class RangeScheduler
+{
+public:
+    RangeScheduler(unsigned workers);
+    auto Workers() const -> unsigned { return workers_; }
+    auto Reset(uint64_t begin, uint64_t end) -> void;
+    auto Next(unsigned worker, uint64_t &item) -> bool;
+
+private:
+    struct alignas(64) Slot
+    {
+        // Upper 32-bits is the first item, lower 32-bits is the end item,
+        // relative to base_.
+        std::atomic<uint64_t> range;
+    };
+
+    auto Steal(unsigned worker, uint64_t &item) -> bool;
+
+    unsigned workers_;
+    uint64_t base_;
+    std::unique_ptr<Slot[]> slots_;
+};
+
+#endif
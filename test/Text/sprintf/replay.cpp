@@ -0,0 +1,148 @@
+#include "replay.hpp"
+#include "golden.hpp"
+#include "sink.hpp"
+#include "stream.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include <unistd.h>
+
+namespace
+{
+    auto FormatRecord(const char *format, GoldenKind kind, uint64_t bits, std::string &result) -> void
+    {
+        char buffer[512];
+        int length;
+        if (kind == GoldenKind::Double) {
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            length = snprintf(buffer, sizeof(buffer), format, value);
+        } else {
+            uint32_t binaryFloat = static_cast<uint32_t>(bits);
+            float value;
+            std::memcpy(&value, &binaryFloat, sizeof(value));
+            length = snprintf(buffer, sizeof(buffer), format, value);
+        }
+        if (length < 0) length = 0;
+        if (length >= static_cast<int>(sizeof(buffer))) length = sizeof(buffer) - 1;
+        result.assign(buffer, length);
+    }
+
+    auto AppendBits(std::string &line, GoldenKind kind, uint64_t bits) -> void
+    {
+        char hex[20];
+        if (kind == GoldenKind::Double) {
+            snprintf(hex, sizeof(hex), "0x%016llx", static_cast<unsigned long long>(bits));
+        } else {
+            snprintf(hex, sizeof(hex), "0x%08llx", static_cast<unsigned long long>(bits));
+        }
+        line.append(hex);
+    }
+
+    // Number of records in one batch of the binary stream.
+    constexpr uint64_t StreamBatchSize = 4096;
+
+    auto RunDumpStream(const GoldenReader &reader) -> int
+    {
+        ArenaSink out{STDOUT_FILENO};
+        ArenaSink batch{-1, StreamBatchSize * 64};
+        WriteStreamHeader(out);
+        for (uint64_t i = 0; i < reader.RecordCount(); i++) {
+            const GoldenRecord &record = reader.Record(i);
+            const GoldenFormat &format = reader.Format(record.formatId);
+
+            StreamArg arg{};
+            arg.type = format.kind == GoldenKind::Double ? StreamArgType::Double : StreamArgType::Single;
+            arg.value = record.bits;
+            AppendStreamRecord(batch, record.bits, reader.String(format.heapOffset), format.length,
+                &arg, 1, reader.String(record.heapOffset), record.length);
+            if (batch.Records() == StreamBatchSize) {
+                WriteStreamBatch(out, batch);
+                batch.Clear();
+            }
+        }
+        WriteStreamBatch(out, batch);
+        WriteStreamEnd(out);
+        return out.Flush() ? 0 : 1;
+    }
+
+    auto OpenGolden(const Options &options, GoldenReader &reader) -> bool
+    {
+        if (reader.Open(options.inputFile)) return true;
+        if (reader.Invalid()) {
+            std::cerr << "Invalid golden vector file " << options.inputFile << std::endl;
+        } else {
+            std::cerr << "Couldn't open golden vector file " << options.inputFile << std::endl;
+        }
+        return false;
+    }
+}
+
+// Formats every record of the golden vector file again with this libc and
+// prints the records that differ:
+//
+//   <format> TAB 0x<bits> TAB <golden result> TAB <libc result>
+auto RunVerify(const Options &options) -> int
+{
+    GoldenReader reader{};
+    if (!OpenGolden(options, reader)) return 1;
+
+    std::string result;
+    std::string line;
+    uint64_t mismatches = 0;
+    for (uint64_t i = 0; i < reader.RecordCount(); i++) {
+        const GoldenRecord &record = reader.Record(i);
+        const GoldenFormat &format = reader.Format(record.formatId);
+        const char *fmt = reader.String(format.heapOffset);
+        const char *expected = reader.String(record.heapOffset);
+
+        FormatRecord(fmt, format.kind, record.bits, result);
+        if (result.size() == record.length && std::memcmp(result.data(), expected, record.length) == 0)
+            continue;
+
+        mismatches++;
+        line.assign(fmt);
+        line.push_back('\t');
+        AppendBits(line, format.kind, record.bits);
+        line.push_back('\t');
+        line.append(expected, record.length);
+        line.push_back('\t');
+        line.append(result);
+        std::cout << line << '\n';
+    }
+
+    std::cout.flush();
+    std::cerr << reader.RecordCount() << " records, " << mismatches << " mismatches" << std::endl;
+    return mismatches == 0 ? 0 : 2;
+}
+
+// Prints every record of the golden vector file in the order it was written:
+//
+//   <format> TAB 0x<bits> TAB <golden result>
+//
+// With --stream, the records are written as a binary stream instead.
+auto RunDump(const Options &options) -> int
+{
+    GoldenReader reader{};
+    if (!OpenGolden(options, reader)) return 1;
+    if (options.stream) return RunDumpStream(reader);
+
+    ArenaSink out{STDOUT_FILENO};
+    for (uint64_t i = 0; i < reader.RecordCount(); i++) {
+        const GoldenRecord &record = reader.Record(i);
+        const GoldenFormat &format = reader.Format(record.formatId);
+
+        out.Append(reader.String(format.heapOffset), format.length);
+        out.Append("\t0x");
+        out.AppendHex(record.bits, format.kind == GoldenKind::Double ? 16 : 8);
+        out.Append('\t');
+        out.Append(reader.String(record.heapOffset), record.length);
+        out.EndLine();
+        out.AddRecord();
+        if (out.Size() >= ArenaSink::DefaultFlushSize) out.Flush();
+    }
+    return out.Flush() ? 0 : 1;
+}
@@ -0,0 +1,9 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include "options.hpp"
+
+auto RunVerify(const Options &options) -> int;
+auto RunDump(const Options &options) -> int;
+
+#endif
@@ -0,0 +1,192 @@
+#include "rounding.hpp"
+#include "bigint.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // Number of consecutive ties in the middle of each binade that are
+    // searched for the one closest to a double.
+    constexpr uint64_t Candidates = 64;
+
+    constexpr double Log10Of2 = 0.30102999566398120;
+
+    constexpr uint64_t Pow10[] = {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+        1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+        100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+        1000000000000000000ULL
+    };
+
+    constexpr uint64_t Infinity = 0x7FF0000000000000;
+
+    // Returns value * 2^binary * 10^decimal as the fraction of the result and
+    // the denominator.
+    auto Scale(uint64_t value, int binary, int decimal, BigInt &denominator) -> BigInt
+    {
+        BigInt numerator{value};
+        for (int i = 0; i < decimal; i++) {
+            numerator *= 10;
+        }
+        if (binary > 0) numerator <<= binary;
+        denominator = BigInt::Pow10(decimal < 0 ? -decimal : 0);
+        if (binary < 0) denominator <<= -binary;
+        return numerator;
+    }
+
+    struct Binade
+    {
+        int exponent;
+
+        // The value of the double is m * 2^binary, for the integer mantissa m
+        // in the range [first, end).
+        int binary;
+        uint64_t first;
+        uint64_t end;
+    };
+
+    auto MakeBinade(int exponent) -> Binade
+    {
+        if (exponent == 0) return { 0, -1074, 1, 1ULL << 52 };
+        return { exponent, exponent - 1075, 1ULL << 52, 1ULL << 53 };
+    }
+
+    // The index of the tie below the middle of the binade, where tie n is
+    // (n + 1/2) * 10^decimal.
+    auto MiddleTie(const Binade &binade, int decimal) -> uint64_t
+    {
+        BigInt divisor;
+        BigInt middle = Scale((binade.first + binade.end) / 2, binade.binary, -decimal, divisor);
+        BigInt remainder;
+        BigInt index = BigInt::DivMod(middle, divisor, remainder);
+        return index.BitLength() > 64 ? UINT64_MAX : index.Bits64(0);
+    }
+
+    // Finds the tie closest to a double among the ties [first, end), and adds
+    // the double nearest to it and its neighbours.
+    auto AddClosest(const Binade &binade, int decimal, uint64_t first, uint64_t end, std::vector<uint64_t> &vectors) -> void
+    {
+        // The mantissa of tie n is (2n + 1) * 10^decimal * 2^(-binary - 1),
+        // and the next tie is an increment of 2 * 10^decimal * 2^(-binary - 1).
+        BigInt denominator;
+        BigInt remainder;
+        BigInt mantissa = BigInt::DivMod(Scale(2 * first + 1, -binade.binary - 1, decimal, denominator), denominator, remainder);
+        BigInt incrementRemainder;
+        BigInt increment = BigInt::DivMod(Scale(2, -binade.binary - 1, decimal, denominator), denominator, incrementRemainder);
+
+        bool found = false;
+        BigInt bestMantissa;
+        BigInt bestRemainder;
+        BigInt bestDistance;
+        for (uint64_t n = first; n < end; n++) {
+            // The distance of the tie to the nearest double, in units of
+            // 1/denominator ulp.
+            BigInt distance{remainder};
+            distance <<= 1;
+            if (denominator < distance) {
+                distance = denominator;
+                distance -= remainder;
+            } else {
+                distance = remainder;
+            }
+
+            // Only the ties in the binade.
+            bool inside = BigInt{binade.first} <= mantissa && mantissa < BigInt{binade.end};
+            if (inside && (!found || distance < bestDistance)) {
+                found = true;
+                bestMantissa = mantissa;
+                bestRemainder = remainder;
+                bestDistance = distance;
+            }
+
+            mantissa += increment;
+            remainder += incrementRemainder;
+            if (denominator <= remainder) {
+                remainder -= denominator;
+                mantissa += BigInt{1};
+            }
+        }
+        if (!found || bestMantissa.BitLength() > 64) return;
+
+        uint64_t nearest = bestMantissa.Bits64(0);
+        bestRemainder <<= 1;
+        if (denominator < bestRemainder) nearest++;
+        if (nearest < binade.first || nearest >= binade.end) return;
+
+        // Consecutive bit patterns are consecutive doubles, also across the
+        // boundary of the binade.
+        uint64_t base = binade.exponent == 0 ? 0 : (static_cast<uint64_t>(binade.exponent) << 52) - (1ULL << 52);
+        for (uint64_t m = nearest - 1; m <= nearest + 1; m++) {
+            uint64_t bits = base + m;
+            if (bits != 0 && bits < Infinity) vectors.push_back(bits);
+        }
+    }
+
+    auto AddExponent(const Binade &binade, int precision, std::vector<uint64_t> &vectors) -> void
+    {
+        // The decimal exponent of the middle of the binade, corrected so that
+        // the ties have precision + 1 digits.
+        double middle = static_cast<double>((binade.first + binade.end) / 2);
+        int decimal = static_cast<int>(std::floor(std::log10(middle) + binade.binary * Log10Of2)) - precision;
+        uint64_t index = MiddleTie(binade, decimal);
+        for (int retry = 0; retry < 2; retry++) {
+            if (index >= Pow10[precision + 1]) {
+                index = MiddleTie(binade, ++decimal);
+            } else if (index < Pow10[precision]) {
+                index = MiddleTie(binade, --decimal);
+            }
+        }
+        if (index < Pow10[precision] || index >= Pow10[precision + 1]) return;
+
+        uint64_t first = std::max(index - std::min(index, Candidates / 2), Pow10[precision]);
+        uint64_t end = std::min(first + Candidates, Pow10[precision + 1]);
+        AddClosest(binade, decimal, first, end, vectors);
+    }
+
+    auto AddFixed(const Binade &binade, int precision, std::vector<uint64_t> &vectors) -> void
+    {
+        // There are no ties if the ulp is at least the rounding step, or if
+        // the binade is below the first tie.
+        int decimal = -precision;
+        if (binade.binary * Log10Of2 >= decimal) return;
+        if ((binade.binary + 53) * Log10Of2 < decimal - 1) return;
+
+        uint64_t index = MiddleTie(binade, decimal);
+        uint64_t first = index - std::min(index, Candidates / 2);
+        AddClosest(binade, decimal, first, first + Candidates, vectors);
+    }
+
+    auto Compute(RoundingFormat format, int precision) -> std::vector<uint64_t>
+    {
+        std::vector<uint64_t> vectors;
+        for (int exponent = 0; exponent < 2047; exponent++) {
+            Binade binade = MakeBinade(exponent);
+            if (format == RoundingFormat::Exponent) {
+                AddExponent(binade, precision, vectors);
+            } else {
+                AddFixed(binade, precision, vectors);
+            }
+        }
+        std::sort(vectors.begin(), vectors.end());
+        vectors.erase(std::unique(vectors.begin(), vectors.end()), vectors.end());
+        return vectors;
+    }
+
+    auto ComputeAll(RoundingFormat format) -> std::vector<std::vector<uint64_t>>
+    {
+        std::vector<std::vector<uint64_t>> all;
+        for (int precision = 0; precision <= RoundingPrecisionMax; precision++) {
+            all.push_back(Compute(format, precision));
+        }
+        return all;
+    }
+}
+
+auto RoundingVectors(RoundingFormat format, int precision) -> const std::vector<uint64_t> &
+{
+    // Initialisation of a static local is thread safe.
+    static const std::vector<std::vector<uint64_t>> exponent = ComputeAll(RoundingFormat::Exponent);
+    static const std::vector<std::vector<uint64_t>> fixed = ComputeAll(RoundingFormat::Fixed);
+    return format == RoundingFormat::Exponent ? exponent[precision] : fixed[precision];
+}
@@ -0,0 +1,31 @@
+#ifndef ROUNDING_HPP
+#define ROUNDING_HPP
+
+#include <cstdint>
+#include <vector>
+
+enum class RoundingFormat
+{
+    // %.Ne and %.(N+1)g round at the N'th digit after the first significant
+    // digit.
+    Exponent,
+
+    // %.Nf rounds at the N'th digit after the decimal point.
+    Fixed
+};
+
+// The largest precision that the rounding vectors are computed for.
+constexpr int RoundingPrecisionMax = 17;
+
+// Returns the bit patterns of the doubles around the decimal rounding ties of
+// the format and precision, ascending. For each binary exponent, the tie
+// closest to a double is found with exact integer arithmetic among a range of
+// ties in the middle of the binade, and the double nearest to it and the
+// doubles one ulp either side are returned. If the tie is representable, the
+// nearest double is exactly on it.
+//
+// The vectors are computed once, on the first call, and can be used from
+// multiple threads.
+auto RoundingVectors(RoundingFormat format, int precision) -> const std::vector<uint64_t> &;
+
+#endif
@@ -0,0 +1,107 @@
+#include "shard.hpp"
+#include "golden.hpp"
+#include "rangescheduler.hpp"
+
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace
+{
+    // Number of tasks per worker, so that the scheduler can balance tasks
+    // that take longer (e.g. the binary double test cases).
+    constexpr uint64_t TasksPerWorker = 4;
+
+    // Initial size of the output buffer of each task.
+    constexpr size_t TaskBufferSize = 65536;
+
+    auto CountCases(const Options &options, GenerateFunction generate) -> uint64_t
+    {
+        ArenaSink discard{-1, 0};
+        TestCaseGen counter{discard};
+        counter.SetRange(0, 0);
+        counter.SetMinimal(options.minimal);
+        generate(counter);
+        return counter.Cases();
+    }
+
+    auto RunGolden(const Options &options, GenerateFunction generate, uint64_t first, uint64_t end) -> int
+    {
+        GoldenWriter golden{};
+        if (!golden.Open(options.binaryFile)) {
+            std::cerr << "Couldn't create " << options.binaryFile << std::endl;
+            return 1;
+        }
+        TestCaseGen gen{golden};
+        gen.SetRange(first, end);
+        gen.SetMinimal(options.minimal);
+        generate(gen);
+        return golden.Close() ? 0 : 1;
+    }
+}
+
+// Generates the test cases of the shard given in the options. The test cases
+// are numbered in the order they are generated and shard N of M gets the N'th
+// of M equal slices. Within a process, the slice is split again into tasks
+// that run on all cores. Every task walks all test categories with its own
+// generator and output buffer, but only formats its own test cases. The task
+// buffers are written in order, so concatenating the output of all shards
+// gives the same output as running without shards.
+auto RunTestCases(const Options &options, GenerateFunction generate) -> int
+{
+    uint64_t total = CountCases(options, generate);
+    uint64_t first = total * (options.shardIndex - 1) / options.shardCount;
+    uint64_t end = total * options.shardIndex / options.shardCount;
+
+    // The golden vector file has a single writer.
+    if (!options.binaryFile.empty()) return RunGolden(options, generate, first, end);
+
+    // The overrides are read once and shared by all tasks.
+    DataOverrides overrides{};
+    if (!options.overrideFile.empty() && !overrides.Read(options.overrideFile)) return 1;
+
+    unsigned threads = options.threads;
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+
+    uint64_t length = end - first;
+    uint64_t tasks = std::min<uint64_t>(threads * TasksPerWorker, length);
+    if (tasks == 0) return 0;
+
+    std::vector<std::unique_ptr<ArenaSink>> outputs;
+    for (uint64_t task = 0; task < tasks; task++) {
+        outputs.emplace_back(new ArenaSink{-1, TaskBufferSize});
+    }
+    RangeScheduler scheduler{threads};
+    scheduler.Reset(0, tasks);
+
+    std::vector<std::thread> workers;
+    for (unsigned w = 0; w < threads; w++) {
+        workers.emplace_back([&, w]() {
+            uint64_t task;
+            while (scheduler.Next(w, task)) {
+                TestCaseGen gen{*outputs[task]};
+                gen.SetRange(first + length * task / tasks, first + length * (task + 1) / tasks);
+                gen.SetMinimal(options.minimal);
+                gen.SetData(options.data);
+                gen.SetOverrides(&overrides);
+                generate(gen);
+            }
+        });
+    }
+    for (std::thread &worker: workers) {
+        worker.join();
+    }
+
+    ArenaSink out{STDOUT_FILENO};
+    for (const std::unique_ptr<ArenaSink> &output: outputs) {
+        out.Write(output->Data(), output->Size());
+        out.AddRecord(output->Records());
+    }
+    bool good = out.Flush();
+    if (options.stats) PrintStats(out);
+    return good ? 0 : 1;
+}
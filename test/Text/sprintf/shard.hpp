@@ -0,0 +1,11 @@
+#ifndef SHARD_HPP
+#define SHARD_HPP
+
+#include "options.hpp"
+#include "testcasegen.hpp"
+
+using GenerateFunction = auto (*)(TestCaseGen &gen) -> void;
+
+auto RunTestCases(const Options &options, GenerateFunction generate) -> int;
+
+#endif
@@ -0,0 +1,95 @@
+#include "sink.hpp"
+
+#include <cerrno>
+#include <charconv>
+#include <iostream>
+
+#include <unistd.h>
+
+OutputSink::OutputSink()
+    : bytes_(0)
+    , records_(0) { }
+
+ArenaSink::ArenaSink(int fd, size_t flushSize)
+    : fd_(fd)
+    , flushSize_(flushSize)
+    , buffer_(new char[flushSize + 4096])
+    , size_(0)
+    , capacity_(flushSize + 4096)
+    , good_(true) { }
+
+ArenaSink::~ArenaSink()
+{
+    Flush();
+}
+
+auto ArenaSink::Grow(size_t length) -> void
+{
+    size_t capacity = capacity_ * 2;
+    while (capacity - size_ < length) capacity *= 2;
+
+    std::unique_ptr<char[]> buffer{new char[capacity]};
+    std::memcpy(buffer.get(), buffer_.get(), size_);
+    buffer_ = std::move(buffer);
+    capacity_ = capacity;
+}
+
+auto ArenaSink::Write(const char *data, size_t length) -> void
+{
+    Append(data, length);
+    bytes_ += length;
+    if (fd_ >= 0 && size_ >= flushSize_) Flush();
+}
+
+auto ArenaSink::Flush() -> bool
+{
+    if (fd_ < 0) return good_;
+
+    const char *data = buffer_.get();
+    size_t remaining = size_;
+    while (remaining > 0) {
+        ssize_t written = write(fd_, data, remaining);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            good_ = false;
+            break;
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+    }
+    size_ = 0;
+    return good_;
+}
+
+auto ArenaSink::AppendRepeat(char c, size_t count) -> void
+{
+    if (capacity_ - size_ < count) Grow(count);
+    std::memset(buffer_.get() + size_, c, count);
+    size_ += count;
+}
+
+auto ArenaSink::AppendHex(uint64_t value, int width) -> void
+{
+    char hex[16];
+    auto result = std::to_chars(hex, hex + sizeof(hex), value, 16);
+    int length = static_cast<int>(result.ptr - hex);
+    if (length < width) AppendRepeat('0', width - length);
+    Append(hex, length);
+}
+
+auto ArenaSink::AppendDecimal(int64_t value) -> void
+{
+    char dec[24];
+    auto result = std::to_chars(dec, dec + sizeof(dec), value);
+    Append(dec, result.ptr - dec);
+}
+
+auto ArenaSink::EndLine() -> void
+{
+    Append('\n');
+}
+
+auto PrintStats(const OutputSink &sink) -> void
+{
+    std::cerr << sink.Records() << " records, " << sink.Bytes() << " bytes" << std::endl;
+}
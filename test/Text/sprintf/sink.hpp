@@ -0,0 +1,82 @@
+#ifndef SINK_HPP
+#define SINK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+// Destination of the generated output. Counts the bytes written and the
+// number of test cases (records) they contain.
+class OutputSink
+{
+public:
+    OutputSink();
+    virtual ~OutputSink() = default;
+
+    virtual auto Write(const char *data, size_t length) -> void = 0;
+    virtual auto Flush() -> bool = 0;
+
+    auto AddRecord(uint64_t count = 1) -> void { records_ += count; }
+    auto Bytes() const -> uint64_t { return bytes_; }
+    auto Records() const -> uint64_t { return records_; }
+
+protected:
+    uint64_t bytes_;
+    uint64_t records_;
+};
+
+// A growable buffer. If a file descriptor is given, the buffer is written to
+// it with write(2) each time it grows beyond the flush size. Without a file
+// descriptor, the buffer is kept in memory, to be copied to another sink.
+class ArenaSink : public OutputSink
+{
+public:
+    ArenaSink(int fd = -1, size_t flushSize = DefaultFlushSize);
+    ArenaSink(const ArenaSink &) = delete;
+    auto operator=(const ArenaSink &) -> ArenaSink & = delete;
+    ~ArenaSink() override;
+
+    auto Write(const char *data, size_t length) -> void override;
+    auto Flush() -> bool override;
+
+    auto Append(char c) -> void
+    {
+        if (size_ == capacity_) Grow(1);
+        buffer_[size_++] = c;
+    }
+
+    auto Append(const char *data, size_t length) -> void
+    {
+        if (capacity_ - size_ < length) Grow(length);
+        std::memcpy(buffer_.get() + size_, data, length);
+        size_ += length;
+    }
+
+    auto Append(const char *str) -> void { Append(str, std::strlen(str)); }
+    auto AppendRepeat(char c, size_t count) -> void;
+    auto AppendHex(uint64_t value, int width) -> void;
+    auto AppendDecimal(int64_t value) -> void;
+    auto EndLine() -> void;
+
+    auto Data() const -> const char * { return buffer_.get(); }
+    auto Size() const -> size_t { return size_; }
+    auto Clear() -> void { size_ = 0; bytes_ = 0; records_ = 0; }
+    auto Good() const -> bool { return good_; }
+
+    static constexpr size_t DefaultFlushSize = 1 << 20;
+
+private:
+    auto Grow(size_t length) -> void;
+
+    int fd_;
+    size_t flushSize_;
+    std::unique_ptr<char[]> buffer_;
+    size_t size_;
+    size_t capacity_;
+    bool good_;
+};
+
+auto PrintStats(const OutputSink &sink) -> void;
+
+#endif
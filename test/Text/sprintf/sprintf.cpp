@@ -1,3 +1,11 @@
+#include "delta.hpp"
+#include "digest.hpp"
+#include "exhaustive.hpp"
+#include "fuzz.hpp"
+#include "options.hpp"
+#include "replay.hpp"
+#include "rounding.hpp"
+#include "shard.hpp"
 #include "testcasegen.hpp"
 #include "testcaseblock.hpp"
 
@@ -5,6 +13,7 @@
 #include <limits>
 #include <string>
 
+auto GenerateTestCases(TestCaseGen &gen) -> void;
 auto TestChar(TestCaseGen &gen) -> void;
 auto TestString(TestCaseGen &gen) -> void;
 auto TestInteger(TestCaseGen &gen) -> void;
@@ -18,48 +27,90 @@ auto TestDoubleBinary(TestCaseGen &gen) -> void;
 auto TestFloatBinary(TestCaseGen &gen) -> void;
 auto TestDoubleBinaryA(TestCaseGen &gen) -> void;
 auto TestFloatBinaryA(TestCaseGen &gen) -> void;
+auto GenerateLongPrecision(TestCaseGen &gen) -> void;
+auto TestDoubleLong(TestCaseGen &gen, const std::string functionName, const std::string format) -> void;
+auto TestFloatLong(TestCaseGen &gen, const std::string functionName, const std::string format) -> void;
+auto GenerateRounding(TestCaseGen &gen) -> void;
+auto TestDoubleRounding(TestCaseGen &gen, const std::string functionName, RoundingFormat format, char specifier, int digits) -> void;
 
-auto main(void) -> int
+auto main(int argc, char *argv[]) -> int
 {
-    TestCaseGen testGen{};
-    TestChar(testGen);
-    std::cout << std::endl;
+    Options options{};
+    if (!ParseOptions(argc, argv, options)) {
+        Usage();
+        return 1;
+    }
+
+    switch (options.mode) {
+    case Mode::Float32All:
+        return RunFloat32All(options);
+    case Mode::Verify:
+        return RunVerify(options);
+    case Mode::Dump:
+        return RunDump(options);
+    case Mode::Fuzz:
+        return RunFuzz(options);
+    case Mode::Reduce:
+        return RunReduce(options);
+    case Mode::Delta:
+        return RunDelta(options, GenerateTestCases);
+    case Mode::Patch:
+        return RunPatch(options);
+    case Mode::Query:
+        return RunQuery(options);
+    case Mode::Digest:
+        return RunDigest(options, GenerateTestCases);
+    case Mode::LongPrecision:
+        return RunTestCases(options, GenerateLongPrecision);
+    case Mode::Rounding:
+        return RunTestCases(options, GenerateRounding);
+    default:
+        break;
+    }
 
-    TestString(testGen);
-    std::cout << std::endl;
+    return RunTestCases(options, GenerateTestCases);
+}
+
+auto GenerateTestCases(TestCaseGen &gen) -> void
+{
+    TestChar(gen);
+    gen.EmptyLine();
 
-    TestInteger(testGen);
-    std::cout << std::endl;
+    TestString(gen);
+    gen.EmptyLine();
 
-    TestUnsignedInteger(testGen);
-    std::cout << std::endl;
+    TestInteger(gen);
+    gen.EmptyLine();
 
-    TestHexadecimal(testGen);
-    std::cout << std::endl;
+    TestUnsignedInteger(gen);
+    gen.EmptyLine();
 
-    TestOctal(testGen);
-    std::cout << std::endl;
+    TestHexadecimal(gen);
+    gen.EmptyLine();
 
-    TestFixedDouble(testGen);
-    std::cout << std::endl;
+    TestOctal(gen);
+    gen.EmptyLine();
 
-    TestExponentDouble(testGen);
-    std::cout << std::endl;
+    TestFixedDouble(gen);
+    gen.EmptyLine();
 
-    TestGeneralDouble(testGen);
-    std::cout << std::endl;
+    TestExponentDouble(gen);
+    gen.EmptyLine();
 
-    TestDoubleBinary(testGen);
-    std::cout << std::endl;
+    TestGeneralDouble(gen);
+    gen.EmptyLine();
 
-    TestFloatBinary(testGen);
-    std::cout << std::endl;
+    TestDoubleBinary(gen);
+    gen.EmptyLine();
 
-    TestDoubleBinaryA(testGen);
-    std::cout << std::endl;
+    TestFloatBinary(gen);
+    gen.EmptyLine();
 
-    TestFloatBinaryA(testGen);
-    std::cout << std::endl;
+    TestDoubleBinaryA(gen);
+    gen.EmptyLine();
+
+    TestFloatBinaryA(gen);
+    gen.EmptyLine();
 }
 
 auto TestChar(TestCaseGen &gen) -> void
@@ -764,3 +815,82 @@ auto TestFloatBinaryA(TestCaseGen &gen) -> void
         gen.TestSPrintFSingle("%a", 0x007FFFFF | (i << 23));
     }
 }
+
+// The precisions are enough for the exact decimal expansion of every value: a
+// double has up to 767 significant digits and 1074 digits after the decimal
+// point, a float up to 112 significant digits and 149 digits after the decimal
+// point.
+auto GenerateLongPrecision(TestCaseGen &gen) -> void
+{
+    TestDoubleLong(gen, "DoubleLongExponent", "%.766e");
+    gen.EmptyLine();
+
+    TestDoubleLong(gen, "DoubleLongFixed", "%.1074f");
+    gen.EmptyLine();
+
+    TestFloatLong(gen, "FloatLongExponent", "%.111e");
+    gen.EmptyLine();
+
+    TestFloatLong(gen, "FloatLongFixed", "%.149f");
+    gen.EmptyLine();
+}
+
+auto TestDoubleLong(TestCaseGen &gen, const std::string functionName, const std::string format) -> void
+{
+    auto function_block = gen.Function(functionName);
+    auto multi_block = gen.TestMultiple();
+    gen.Comment("Smallest and largest subnormal");
+    gen.TestSPrintFDouble(format, 0x0000000000000001);
+    gen.TestSPrintFDouble(format, 0x000FFFFFFFFFFFFF);
+    gen.Comment("All possible exponents");
+    for (uint64_t i = 1; i < 2047; i++) {
+        gen.TestSPrintFDouble(format, i << 52);
+    }
+    for (uint64_t i = 1; i < 2047; i++) {
+        gen.TestSPrintFDouble(format, 0x000FFFFFFFFFFFFF | (i << 52));
+    }
+}
+
+auto TestFloatLong(TestCaseGen &gen, const std::string functionName, const std::string format) -> void
+{
+    auto function_block = gen.Function(functionName);
+    auto multi_block = gen.TestMultiple();
+    gen.Comment("Smallest and largest subnormal");
+    gen.TestSPrintFSingle(format, 0x00000001);
+    gen.TestSPrintFSingle(format, 0x007FFFFF);
+    gen.Comment("All possible exponents");
+    for (uint32_t i = 1; i < 255; i++) {
+        gen.TestSPrintFSingle(format, i << 23);
+    }
+    for (uint32_t i = 1; i < 255; i++) {
+        gen.TestSPrintFSingle(format, 0x007FFFFF | (i << 23));
+    }
+}
+
+auto GenerateRounding(TestCaseGen &gen) -> void
+{
+    TestDoubleRounding(gen, "DoubleRoundingExponent", RoundingFormat::Exponent, 'e', 0);
+    gen.EmptyLine();
+
+    TestDoubleRounding(gen, "DoubleRoundingGeneral", RoundingFormat::Exponent, 'g', 1);
+    gen.EmptyLine();
+
+    TestDoubleRounding(gen, "DoubleRoundingFixed", RoundingFormat::Fixed, 'f', 0);
+    gen.EmptyLine();
+}
+
+// The doubles nearest to the decimal rounding ties of each precision, where
+// the precision of the format is the rounding precision plus digits (%g counts
+// the first significant digit, %e doesn't).
+auto TestDoubleRounding(TestCaseGen &gen, const std::string functionName, RoundingFormat format, char specifier, int digits) -> void
+{
+    auto function_block = gen.Function(functionName);
+    auto multi_block = gen.TestMultiple();
+    for (int precision = 0; precision <= RoundingPrecisionMax; precision++) {
+        std::string formatString = "%." + std::to_string(precision + digits) + specifier;
+        gen.Comment("Precision " + std::to_string(precision + digits));
+        for (uint64_t bits: RoundingVectors(format, precision)) {
+            gen.TestSPrintFDouble(formatString, bits);
+        }
+    }
+}
@@ -0,0 +1,84 @@
+#include "stream.hpp"
+
+#include <cstring>
+
+const char StreamMagic[8] = { 'S', 'P', 'R', 'I', 'N', 'T', 'F', 'S' };
+
+namespace
+{
+    template <typename T>
+    auto AppendValue(ArenaSink &sink, T value) -> void
+    {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        sink.Append(bytes, sizeof(T));
+    }
+
+    template <typename T>
+    auto WriteValue(OutputSink &sink, T value) -> void
+    {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        sink.Write(bytes, sizeof(T));
+    }
+}
+
+auto WriteStreamHeader(OutputSink &sink) -> void
+{
+    sink.Write(StreamMagic, sizeof(StreamMagic));
+    WriteValue<uint32_t>(sink, StreamVersion);
+    WriteValue<uint32_t>(sink, 0);
+}
+
+// Appends a record to the batch and counts it. The strings are expected to be
+// shorter than 64kB.
+auto AppendStreamRecord(ArenaSink &batch, uint64_t id, const char *format, size_t formatLength,
+    const StreamArg *args, size_t count, const char *result, size_t resultLength) -> void
+{
+    AppendValue<uint64_t>(batch, id);
+    AppendValue<uint16_t>(batch, static_cast<uint16_t>(formatLength));
+    batch.Append(format, formatLength);
+
+    AppendValue<uint8_t>(batch, static_cast<uint8_t>(count));
+    for (size_t i = 0; i < count; i++) {
+        const StreamArg &arg = args[i];
+        AppendValue<uint8_t>(batch, static_cast<uint8_t>(arg.type));
+        switch (arg.type) {
+        case StreamArgType::Int32:
+        case StreamArgType::Single:
+            AppendValue<uint32_t>(batch, static_cast<uint32_t>(arg.value));
+            break;
+        case StreamArgType::Int64:
+        case StreamArgType::Double:
+            AppendValue<uint64_t>(batch, arg.value);
+            break;
+        case StreamArgType::Char:
+            AppendValue<uint16_t>(batch, static_cast<uint16_t>(arg.value));
+            break;
+        case StreamArgType::String:
+            AppendValue<uint16_t>(batch, static_cast<uint16_t>(arg.length));
+            batch.Append(arg.text, arg.length);
+            break;
+        }
+    }
+
+    AppendValue<uint16_t>(batch, static_cast<uint16_t>(resultLength));
+    batch.Append(result, resultLength);
+    batch.AddRecord();
+}
+
+auto WriteStreamBatch(OutputSink &sink, const ArenaSink &batch) -> void
+{
+    if (batch.Records() == 0) return;
+
+    WriteValue<uint32_t>(sink, static_cast<uint32_t>(batch.Records()));
+    WriteValue<uint32_t>(sink, static_cast<uint32_t>(batch.Size()));
+    sink.Write(batch.Data(), batch.Size());
+    sink.AddRecord(batch.Records());
+}
+
+auto WriteStreamEnd(OutputSink &sink) -> void
+{
+    WriteValue<uint32_t>(sink, 0);
+    WriteValue<uint32_t>(sink, 0);
+}
@@ -0,0 +1,56 @@
+#ifndef STREAM_HPP
+#define STREAM_HPP
+
+#include "sink.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+// Binary stream of test cases for the differential host in testdiff, which
+// formats each test case with the C# implementation and reports the
+// mismatches. All values are in the byte order of the host (little endian on
+// all supported platforms).
+//
+//   char magic[8], uint32_t version, uint32_t reserved
+//   batch[]                              Until a batch with no records.
+//     uint32_t records, uint32_t bytes   Followed by the records.
+//
+// A record is
+//
+//   uint64_t id                          The test case number or bit pattern.
+//   uint16_t length, char format[length]
+//   uint8_t count, argument[count]       The StreamArgType and its value.
+//   uint16_t length, char result[length]
+//
+// The value of an argument is 4 bytes for Int32 and Single, 8 bytes for Int64
+// and Double, 2 bytes for Char, and a uint16_t length and the characters for
+// String. Single and Double are the IEEE754 bit patterns.
+
+enum class StreamArgType : uint8_t
+{
+    Int32 = 1,
+    Int64 = 2,
+    Double = 3,
+    Single = 4,
+    Char = 5,
+    String = 6
+};
+
+struct StreamArg
+{
+    StreamArgType type;
+    uint64_t value;
+    const char *text;
+    size_t length;
+};
+
+extern const char StreamMagic[8];
+constexpr uint32_t StreamVersion = 1;
+
+auto WriteStreamHeader(OutputSink &sink) -> void;
+auto AppendStreamRecord(ArenaSink &batch, uint64_t id, const char *format, size_t formatLength,
+    const StreamArg *args, size_t count, const char *result, size_t resultLength) -> void;
+auto WriteStreamBatch(OutputSink &sink, const ArenaSink &batch) -> void;
+auto WriteStreamEnd(OutputSink &sink) -> void;
+
+#endif
@@ -0,0 +1,264 @@
+// Computes the multiplier tables of DoubleFormatter exactly with big integer
+// arithmetic, instead of the incremental doubling and halving of
+// docs/TableGen/ieee754_limit, and checks or regenerates them.
+//
+//   tablegen --verify FILE   Check the tables in DoubleFormatter.cs.
+//   tablegen --emit64        Print the 64-bit tables.
+//   tablegen --emit128       Print the 128-bit tables.
+//
+// For the biased binary exponent E of a double with the 53-bit integer
+// mantissa M (the value is M * 2^(E-1075)), DoubleFormatter multiplies 10*M
+// by MBT[E] and keeps the high 64 bits, so that the value is
+//
+//   M * 2^(E-1075) = (10*M * MBT[E] / 2^64) * 10^(ET[E]-1)
+//
+// and MBT[E] is the truncation of 2^(E-1011) * 10^-ET[E]. The 128-bit table
+// is the truncation of 2^(E-947) * 10^-ET128[E], for the smallest ET128[E]
+// such that the entry fits in 128 bits, to multiply M without the factor of
+// ten. As every entry is the truncated exact value, its error is less than one
+// unit of the last place, which is a relative error less than 2^-124 for the
+// 128-bit table, as each entry has at least 125 bits.
+
+#include "bigint.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr int Exponents = 2047;
+
+    // Column of the "// E=" comments, as in GenerateMbt.cs.
+    constexpr size_t CommentOffset = 90;
+
+    struct Entry
+    {
+        BigInt value;
+        int tens;
+    };
+
+    // The truncation of 2^binary * 10^decimal, and the error of the truncation
+    // in units of the last place, in the range [0, 1).
+    auto Exact(int binary, int decimal, double &error) -> BigInt
+    {
+        BigInt dividend = BigInt::Pow10(decimal > 0 ? decimal : 0);
+        dividend <<= binary > 0 ? binary : 0;
+        BigInt divisor = BigInt::Pow10(decimal < 0 ? -decimal : 0);
+        divisor <<= binary < 0 ? -binary : 0;
+
+        BigInt remainder;
+        BigInt quotient = BigInt::DivMod(dividend, divisor, remainder);
+
+        // The first 64 bits of the fraction are enough to report the error.
+        BigInt fraction;
+        remainder <<= 64;
+        error = std::ldexp(static_cast<double>(BigInt::DivMod(remainder, divisor, fraction).Bits64(0)), -64);
+        return quotient;
+    }
+
+    auto Entry64(int e, int tens, double &error) -> Entry
+    {
+        return { Exact(e - 1011, -tens, error), tens };
+    }
+
+    // The decimal exponent is the smallest for which the entry fits in 128
+    // bits, so the entry has at least 125 bits.
+    auto Entry128(int e, double &error) -> Entry
+    {
+        int binary = e - 947;
+        int tens = static_cast<int>(std::floor((binary - 128) * 0.30102999566398120));
+        BigInt value = Exact(binary, -tens, error);
+        while (value.BitLength() > 128) {
+            value = Exact(binary, -++tens, error);
+        }
+        return { value, tens };
+    }
+
+    // Reads the initializer of the C# array called name from the source.
+    auto ParseTable(const std::string &source, const std::string &name, std::vector<std::string> &values) -> bool
+    {
+        auto start = source.find(" " + name + " = new ");
+        if (start == std::string::npos) return false;
+        start = source.find('{', start);
+        auto end = source.find("};", start);
+        if (start == std::string::npos || end == std::string::npos) return false;
+
+        std::istringstream stream{source.substr(start + 1, end - start - 1)};
+        std::string line;
+        values.clear();
+        while (std::getline(stream, line)) {
+            auto comment = line.find("//");
+            if (comment != std::string::npos) line.erase(comment);
+
+            std::istringstream items{line};
+            std::string item;
+            while (std::getline(items, item, ',')) {
+                auto first = item.find_first_not_of(" \t\r");
+                if (first == std::string::npos) continue;
+                auto last = item.find_last_not_of(" \t\r");
+                values.push_back(item.substr(first, last - first + 1));
+            }
+        }
+        return true;
+    }
+
+    auto Verify(const std::string &fileName) -> int
+    {
+        std::ifstream file{fileName};
+        if (!file) {
+            std::cerr << "Couldn't open " << fileName << std::endl;
+            return 1;
+        }
+        std::stringstream source;
+        source << file.rdbuf();
+
+        std::vector<std::string> mbt;
+        std::vector<std::string> et;
+        if (!ParseTable(source.str(), "Formatter_MantissaBitsTable", mbt) ||
+            !ParseTable(source.str(), "Formatter_TensExponentTable", et)) {
+            std::cerr << fileName << ": tables not found" << std::endl;
+            return 1;
+        }
+        if (mbt.size() != Exponents || et.size() != Exponents) {
+            std::cerr << fileName << ": expected " << Exponents << " entries, found "
+                << mbt.size() << " and " << et.size() << std::endl;
+            return 1;
+        }
+
+        // Exponent 0 is for subnormals, which are converted with E=1.
+        int failed = 0;
+        int exact = 0;
+        double maxRelative = 0;
+        int maxRelativeE = 0;
+        for (int e = 1; e < Exponents; e++) {
+            double error;
+            Entry entry = Entry64(e, std::stoi(et[e]), error);
+            if (entry.value.ToString() != mbt[e]) {
+                std::cerr << "E=" << e << ": MBT=" << mbt[e] << ", expected " << entry.value.ToString()
+                    << " for ET=" << et[e] << std::endl;
+                failed++;
+                continue;
+            }
+            if (entry.value.BitLength() > 64) {
+                std::cerr << "E=" << e << ": entry doesn't fit in 64 bits" << std::endl;
+                failed++;
+                continue;
+            }
+
+            if (error == 0) exact++;
+            double relative = error / static_cast<double>(entry.value.Bits64(0));
+            if (relative > maxRelative) {
+                maxRelative = relative;
+                maxRelativeE = e;
+            }
+        }
+
+        std::cout << fileName << ": " << Exponents - 1 - failed << " of " << Exponents - 1
+            << " entries are the truncated exact value (" << exact << " without error)" << std::endl
+            << "Maximum relative error 2^" << std::log2(maxRelative) << " at E=" << maxRelativeE << std::endl;
+        return failed == 0 ? 0 : 1;
+    }
+
+    auto PrintTable(const std::string &type, const std::string &name,
+        const std::vector<std::string> &values, size_t group) -> void
+    {
+        std::cout << "        private static readonly " << type << "[] " << name
+            << " = new " << type << "[] {" << std::endl;
+        std::string line;
+        for (size_t i = 0; i < values.size(); i++) {
+            if (i % group == 0) line.assign(12, ' ');
+            line.append(values[i]);
+            if (i != values.size() - 1) line.append(", ");
+            if (i % group == group - 1 || i == values.size() - 1) {
+                line.append(line.size() < CommentOffset ? CommentOffset - line.size() : 1, ' ');
+                std::cout << line << "// E=" << i - i % group << std::endl;
+            }
+        }
+        std::cout << "        };" << std::endl << std::endl;
+    }
+
+    // The overflow check of MaxMbt.cs, which GenerateMbt.cs uses to choose
+    // the decimal exponent: the conversion of the largest mantissa with the
+    // multiplier must not overflow in DoubleFormatter.Convert.
+    auto Overflows(uint64_t mbt) -> bool
+    {
+        const uint64_t hi = 0x013FFFFF;
+        const uint64_t lo = 0xFFFFFFF6;
+        const int64_t SeventeenDigitsThreshold = 10000000000000000;
+        uint64_t hi2 = mbt >> 32;
+        uint64_t lo2 = mbt & 0xFFFFFFFF;
+
+        uint64_t a, b, mm;
+        if (__builtin_mul_overflow(hi, lo2, &a)) return true;
+        if (__builtin_mul_overflow(lo, hi2, &b)) return true;
+        if (__builtin_add_overflow(a, b, &mm)) return true;
+        if (__builtin_add_overflow(mm, (lo * lo2) >> 32, &mm)) return true;
+
+        uint64_t high;
+        if (__builtin_mul_overflow(hi, hi2, &high)) return true;
+        if (__builtin_add_overflow(high, mm >> 32, &high)) return true;
+        if (high > INT64_MAX) return true;
+        int64_t res = static_cast<int64_t>(high);
+        while (res < SeventeenDigitsThreshold) {
+            mm = (mm & 0xFFFFFFFF) * 10;
+            if (__builtin_mul_overflow(res, 10, &res)) return true;
+            if (__builtin_add_overflow(res, static_cast<int64_t>(mm >> 32), &res)) return true;
+        }
+        return false;
+    }
+
+    auto Emit64() -> int
+    {
+        // The decimal exponent of each entry is the one GenerateMbt.cs finds,
+        // the smallest for which the conversion doesn't overflow.
+        std::vector<std::string> mbt{"0"};
+        std::vector<std::string> et{"0"};
+        for (int e = 1; e < Exponents; e++) {
+            double error;
+            int tens = static_cast<int>(std::floor((e - 1011) * 0.30102999566398120)) - 19;
+            Entry entry = Entry64(e, tens, error);
+            while (entry.value.BitLength() > 64 || Overflows(entry.value.Bits64(0))) {
+                entry = Entry64(e, ++tens, error);
+            }
+            mbt.push_back(entry.value.ToString());
+            et.push_back(std::to_string(entry.tens));
+        }
+        PrintTable("ulong", "Formatter_MantissaBitsTable", mbt, 3);
+        PrintTable("int", "Formatter_TensExponentTable", et, 12);
+        return 0;
+    }
+
+    auto Emit128() -> int
+    {
+        std::vector<std::string> high{"0"};
+        std::vector<std::string> low{"0"};
+        std::vector<std::string> et{"0"};
+        for (int e = 1; e < Exponents; e++) {
+            double error;
+            Entry entry = Entry128(e, error);
+            high.push_back(std::to_string(entry.value.Bits64(64)));
+            low.push_back(std::to_string(entry.value.Bits64(0)));
+            et.push_back(std::to_string(entry.tens));
+        }
+        PrintTable("ulong", "Formatter_MantissaBitsTable128High", high, 3);
+        PrintTable("ulong", "Formatter_MantissaBitsTable128Low", low, 3);
+        PrintTable("int", "Formatter_TensExponentTable128", et, 12);
+        return 0;
+    }
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+    std::string mode = argc > 1 ? argv[1] : "";
+    if (mode == "--verify" && argc == 3) return Verify(argv[2]);
+    if (mode == "--emit64" && argc == 2) return Emit64();
+    if (mode == "--emit128" && argc == 2) return Emit128();
+
+    std::cerr << "Usage: tablegen --verify FILE | --emit64 | --emit128" << std::endl;
+    return 1;
+}
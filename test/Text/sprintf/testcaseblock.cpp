@@ -1,16 +1,14 @@
 #include "testcaseblock.hpp"
+#include "testcasegen.hpp"
 
-#include <iostream>
-
-TestCaseBlock::TestCaseBlock(int &offset, const std::string end_block)
-    : offset_(offset)
+TestCaseBlock::TestCaseBlock(TestCaseGen &gen, const std::string end_block)
+    : gen_(gen)
     , end_block_(std::move(end_block))
 {
-    offset += 4;
+    gen_.BeginBlock();
 }
 
 TestCaseBlock::~TestCaseBlock()
 {
-    offset_ -= 4;
-    std::cout << std::string(offset_, ' ') << end_block_ << std::endl;
+    gen_.EndBlock(end_block_);
 }
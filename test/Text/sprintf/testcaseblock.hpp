@@ -3,14 +3,16 @@
 
 #include <string>
 
+class TestCaseGen;
+
 class TestCaseBlock
 {
 public:
-    TestCaseBlock(int &offset, const std::string end_block);
+    TestCaseBlock(TestCaseGen &gen, const std::string end_block);
     ~TestCaseBlock();
 
 private:
-    int &offset_;
+    TestCaseGen &gen_;
     const std::string end_block_;
 };
 
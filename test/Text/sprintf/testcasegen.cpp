@@ -1,81 +1,323 @@
 #include "testcasegen.hpp"
 
+#include <algorithm>
 #include <cstdarg>
-#include <iomanip>
-#include <iostream>
+#include <cstring>
+#include <iterator>
 
-TestCaseGen::TestCaseGen()
-    : offset_(8) { }
+namespace
+{
+    // The test functions that have a fixture in the NUnit tests reading their
+    // section of the data file. The other functions are skipped with --data.
+    const std::string DataSections[] = {"DoubleBinary", "FloatBinary"};
+}
+
+TestCaseGen::TestCaseGen(OutputSink &sink)
+    : offset_(8)
+    , sink_(&sink)
+    , line_(-1, 256)
+    , golden_(nullptr)
+    , cases_(0)
+    , first_(0)
+    , end_(std::numeric_limits<uint64_t>::max())
+    , minimal_(false)
+    , data_(false)
+    , section_(false)
+    , overrides_(nullptr)
+    , result_(1024) { }
+
+TestCaseGen::TestCaseGen(GoldenWriter &golden)
+    : offset_(8)
+    , sink_(nullptr)
+    , line_(-1, 256)
+    , golden_(&golden)
+    , cases_(0)
+    , first_(0)
+    , end_(std::numeric_limits<uint64_t>::max())
+    , minimal_(false)
+    , data_(false)
+    , section_(false)
+    , overrides_(nullptr)
+    , result_(1024) { }
+
+auto TestCaseGen::SetRange(uint64_t first, uint64_t end) -> void
+{
+    first_ = first;
+    end_ = end;
+}
+
+auto TestCaseGen::NextCase() -> bool
+{
+    uint64_t index = cases_++;
+    return index >= first_ && index < end_;
+}
+
+auto TestCaseGen::Opening() const -> bool
+{
+    return !golden_ && cases_ >= first_ && cases_ < end_;
+}
+
+auto TestCaseGen::Closing() const -> bool
+{
+    return !golden_ && cases_ > first_ && cases_ <= end_;
+}
+
+auto TestCaseGen::BeginLine() -> void
+{
+    line_.AppendRepeat(' ', offset_);
+}
+
+auto TestCaseGen::EndLine() -> void
+{
+    line_.EndLine();
+    sink_->Write(line_.Data(), line_.Size());
+    line_.Clear();
+}
 
 auto TestCaseGen::Function(const std::string functionName) -> TestCaseBlock
 {
-    std::cout << std::string(offset_, ' ') << "[Test]" << std::endl;
-    std::cout << std::string(offset_, ' ') << "public void " << functionName << "()" << std::endl;
-    std::cout << std::string(offset_, ' ') << "{" << std::endl;
+    if (data_) {
+        section_ = std::find(std::begin(DataSections), std::end(DataSections), functionName) != std::end(DataSections);
+        if (section_ && Opening()) {
+            line_.Append('[');
+            line_.Append(functionName.data(), functionName.size());
+            if (!minimal_) line_.Append("Exhaustive");
+            line_.Append(']');
+            EndLine();
+        }
+        return TestCaseBlock{*this, ""};
+    }
 
-    TestCaseBlock block{offset_, "}"};
-    return block;
+    if (Opening()) {
+        BeginLine();
+        line_.Append("[Test]");
+        EndLine();
+        BeginLine();
+        line_.Append("public void ");
+        line_.Append(functionName.data(), functionName.size());
+        line_.Append("()");
+        EndLine();
+        BeginLine();
+        line_.Append('{');
+        EndLine();
+    }
+    return TestCaseBlock{*this, "}"};
 }
 
 auto TestCaseGen::TestMultiple() -> TestCaseBlock
 {
-    std::cout << std::string(offset_, ' ') << "Assert.Multiple(() => {" << std::endl;
-    TestCaseBlock block{offset_, "});"};
-    return block;
+    if (Opening() && !data_) {
+        BeginLine();
+        line_.Append("Assert.Multiple(() => {");
+        EndLine();
+    }
+    return TestCaseBlock{*this, "});"};
 }
 
-auto TestCaseGen::TestSPrintF(const std::string params, const std::string format...) -> void
+auto TestCaseGen::BeginBlock() -> void
+{
+    offset_ += 4;
+}
+
+auto TestCaseGen::EndBlock(const std::string &end_block) -> void
+{
+    offset_ -= 4;
+    if (Closing() && !data_) {
+        BeginLine();
+        line_.Append(end_block.data(), end_block.size());
+        EndLine();
+    }
+}
+
+auto TestCaseGen::BeginCase(const std::string &format) -> void
+{
+    BeginLine();
+    line_.Append("Assert.That(SPrintF(\"");
+    line_.Append(format.data(), format.size());
+    line_.Append('"');
+}
+
+auto TestCaseGen::BeginData(const std::string &format, const char *kind) -> void
+{
+    line_.Append(format.data(), format.size());
+    line_.Append('\t');
+    line_.Append(kind);
+    line_.Append("\t0x");
+}
+
+auto TestCaseGen::EndData(const char *result, size_t length) -> void
+{
+    const DataOverride *correction = overrides_ ? overrides_->Find(line_.Data(), line_.Size()) : nullptr;
+    line_.Append('\t');
+    if (correction) {
+        line_.Append(correction->result.data(), correction->result.size());
+        line_.Append("\t# ");
+        line_.Append(correction->note.data(), correction->note.size());
+    } else {
+        line_.Append(result, length);
+    }
+    EndLine();
+    sink_->AddRecord();
+}
+
+auto TestCaseGen::EndCase(const char *result, size_t length) -> void
+{
+    line_.Append("), Is.EqualTo(\"");
+    line_.Append(result, length);
+    line_.Append("\"));");
+    EndLine();
+    sink_->AddRecord();
+}
+
+auto TestCaseGen::FormatResult(const char *format, ...) -> int
 {
     va_list args;
     va_start(args, format);
+    int result = FormatResultV(format, args);
+    va_end(args);
+    return result;
+}
 
-    char buffer[1024];
-    int result = vsprintf(buffer, format.c_str(), args);
-    buffer[result] = 0;
+auto TestCaseGen::FormatResultV(const char *format, va_list args) -> int
+{
+    va_list retry;
+    va_copy(retry, args);
+    int result = vsnprintf(result_.data(), result_.size(), format, args);
+    if (result >= static_cast<int>(result_.size())) {
+        result_.resize(result + 1);
+        result = vsnprintf(result_.data(), result_.size(), format, retry);
+    }
+    va_end(retry);
+    if (result < 0) {
+        result_[0] = 0;
+        return 0;
+    }
+    return result;
+}
+
+auto TestCaseGen::TestSPrintF(const std::string params, const std::string format...) -> void
+{
+    if (!NextCase()) return;
+
+    // There is no binary representation of the arguments.
+    if (golden_ || data_) return;
+
+    va_list args;
+    va_start(args, format);
+    int result = FormatResultV(format.c_str(), args);
     va_end(args);
 
-    std::cout << std::string(offset_, ' ')
-        << "Assert.That(SPrintF(\"" << format << "\", " << params << "), "
-        << "Is.EqualTo(\"" << buffer << "\"));" << std::endl;
+    BeginCase(format);
+    line_.Append(", ");
+    line_.Append(params.data(), params.size());
+    EndCase(result_.data(), result);
 }
 
 auto TestCaseGen::TestSPrintFDouble(const std::string format, uint64_t binaryDouble) -> void
 {
+    if (!minimal_ && !NextCase()) return;
+
     // User provided direct 64-bit binary form of their double float, so they
     // can test the IEEE754 bit fields directly.
-    double value = *reinterpret_cast<double *>(&binaryDouble);
+    double value;
+    std::memcpy(&value, &binaryDouble, sizeof(value));
+
+    int result = FormatResult(format.c_str(), value);
+
+    if (minimal_) {
+        if (!coverage_.Add(format, GoldenKind::Double, binaryDouble, result_.data(), result) || !NextCase()) return;
+    }
+
+    if (golden_) {
+        golden_->Add(format, GoldenKind::Double, binaryDouble, result_.data(), result);
+        return;
+    }
 
-    char doubleValue[64];
-    int result = snprintf(doubleValue, 64, format.c_str(), value);
-    doubleValue[result] = 0;
+    if (data_) {
+        if (!section_) return;
+        BeginData(format, "Double");
+        line_.AppendHex(binaryDouble, 16);
+        EndData(result_.data(), result);
+        return;
+    }
 
-    std::ios_base::fmtflags f(std::cout.flags());
-    std::cout << std::string(offset_, ' ')
-        << "Assert.That(SPrintF(\"" << format << "\", "
-        << "UInt64ToDouble(0x" << std::setfill('0') << std::setw(16) << std::hex << binaryDouble << ")), "
-        << "Is.EqualTo(\"" << doubleValue << "\"));" << std::endl;
-    std::cout.flags(f);
+    BeginCase(format);
+    line_.Append(", UInt64ToDouble(0x");
+    line_.AppendHex(binaryDouble, 16);
+    line_.Append(')');
+    EndCase(result_.data(), result);
 }
 
 auto TestCaseGen::TestSPrintFSingle(const std::string format, uint32_t binaryFloat) -> void
 {
+    if (!minimal_ && !NextCase()) return;
+
     // User provided direct 32-bit binary form of their float, so they can test
     // the IEEE754 bit fields directly.
-    float value = *reinterpret_cast<float *>(&binaryFloat);
+    float value;
+    std::memcpy(&value, &binaryFloat, sizeof(value));
+
+    int result = FormatResult(format.c_str(), value);
+
+    if (minimal_) {
+        if (!coverage_.Add(format, GoldenKind::Single, binaryFloat, result_.data(), result) || !NextCase()) return;
+    }
+
+    if (golden_) {
+        golden_->Add(format, GoldenKind::Single, binaryFloat, result_.data(), result);
+        return;
+    }
 
-    char floatValue[64];
-    int result = snprintf(floatValue, 64, format.c_str(), value);
-    floatValue[result] = 0;
+    if (data_) {
+        if (!section_) return;
+        BeginData(format, "Single");
+        line_.AppendHex(binaryFloat, 8);
+        EndData(result_.data(), result);
+        return;
+    }
 
-    std::ios_base::fmtflags f(std::cout.flags());
-    std::cout << std::string(offset_, ' ')
-        << "Assert.That(SPrintF(\"" << format << "\", "
-        << "UInt32ToFloat(0x" << std::setfill('0') << std::setw(8) << std::hex << binaryFloat << ")), "
-        << "Is.EqualTo(\"" << floatValue << "\"));" << std::endl;
-    std::cout.flags(f);
+    BeginCase(format);
+    line_.Append(", UInt32ToFloat(0x");
+    line_.AppendHex(binaryFloat, 8);
+    line_.Append(')');
+    EndCase(result_.data(), result);
+}
+
+auto TestCaseGen::TestSPrintFResult(const std::string format, const std::string params, const char *result, size_t length) -> void
+{
+    if (!NextCase()) return;
+
+    // The result was already formatted by the caller, e.g. the fuzzer, which
+    // knows the types of the arguments.
+    if (golden_ || data_) return;
+
+    BeginCase(format);
+    if (!params.empty()) {
+        line_.Append(", ");
+        line_.Append(params.data(), params.size());
+    }
+    EndCase(result, length);
 }
 
 auto TestCaseGen::Comment(const std::string comment) -> void
 {
-    std::cout << std::string(offset_, ' ') << "// " << comment << std::endl;
+    if (Opening()) {
+        if (data_) {
+            if (!section_) return;
+            line_.Append("# ");
+            line_.Append(comment.data(), comment.size());
+            EndLine();
+            return;
+        }
+        BeginLine();
+        line_.Append("// ");
+        line_.Append(comment.data(), comment.size());
+        EndLine();
+    }
+}
+
+auto TestCaseGen::EmptyLine() -> void
+{
+    if (data_ && !section_) return;
+    if (Closing()) EndLine();
 }
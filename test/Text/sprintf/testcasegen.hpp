@@ -1,24 +1,93 @@
 #ifndef TESTCASEGEN_HPP
 #define TESTCASEGEN_HPP
 
+#include "coverage.hpp"
+#include "dataoverride.hpp"
+#include "golden.hpp"
+#include "sink.hpp"
 #include "testcaseblock.hpp"
 
+#include <cstdarg>
 #include <cstdint>
+#include <limits>
 #include <string>
+#include <vector>
 
 class TestCaseGen
 {
 public:
-    TestCaseGen();
+    TestCaseGen(OutputSink &sink);
+    TestCaseGen(GoldenWriter &golden);
     auto Function(const std::string functionName) -> TestCaseBlock;
     auto TestMultiple() -> TestCaseBlock;
     auto TestSPrintF(const std::string params, const std::string format...) -> void;
     auto TestSPrintFDouble(const std::string format, uint64_t binaryDouble) -> void;
     auto TestSPrintFSingle(const std::string format, uint32_t binaryFloat) -> void;
+    auto TestSPrintFResult(const std::string format, const std::string params, const char *result, size_t length) -> void;
     auto Comment(const std::string comment) -> void;
+    auto EmptyLine() -> void;
+
+    auto SetRange(uint64_t first, uint64_t end) -> void;
+    auto SetMinimal(bool minimal) -> void { minimal_ = minimal; }
+    auto SetData(bool data) -> void { data_ = data; }
+    auto SetOverrides(const DataOverrides *overrides) -> void { overrides_ = overrides; }
+    auto Cases() const -> uint64_t { return cases_; }
 
 private:
+    friend class TestCaseBlock;
+    auto BeginBlock() -> void;
+    auto EndBlock(const std::string &end_block) -> void;
+    auto NextCase() -> bool;
+    auto Opening() const -> bool;
+    auto Closing() const -> bool;
+    auto BeginLine() -> void;
+    auto EndLine() -> void;
+    auto BeginCase(const std::string &format) -> void;
+    auto BeginData(const std::string &format, const char *kind) -> void;
+    auto EndData(const char *result, size_t length) -> void;
+    auto EndCase(const char *result, size_t length) -> void;
+    auto FormatResult(const char *format, ...) -> int;
+    auto FormatResultV(const char *format, va_list args) -> int;
+
     int offset_;
+
+    // Each line is built in the line buffer and written to the sink in one
+    // piece.
+    OutputSink *sink_;
+    ArenaSink line_;
+
+    // When set, the test cases with a binary representation are written to
+    // the golden vector file, and no C# source is generated.
+    GoldenWriter *golden_;
+
+    // Only the test cases numbered [first_, end_) are generated. Lines that
+    // open a block belong to the test case that follows, lines that close a
+    // block belong to the test case before, so that the output of
+    // consecutive ranges concatenates to the output of the complete range.
+    uint64_t cases_;
+    uint64_t first_;
+    uint64_t end_;
+
+    // When set, only the first IEEE754 test case of each equivalence class is
+    // generated. The classes are found in every walk, also outside the range,
+    // so that the test cases are numbered the same in every shard.
+    bool minimal_;
+    Coverage coverage_;
+
+    // When set, each function with a fixture in the NUnit tests is a section
+    // of a data file, and each IEEE754 test case is one line of the format,
+    // argument kind, bits and result, tab separated. The section of the
+    // complete set has the suffix "Exhaustive", so that the minimal and the
+    // complete set can be in the same file. The test cases without a binary
+    // representation, and the functions without a fixture, are skipped. The
+    // results corrected by hand are taken from the overrides.
+    bool data_;
+    bool section_;
+    const DataOverrides *overrides_;
+
+    // The result of the test case. It grows to the longest result, so there
+    // is no limit on the precision or width, and is reused for all cases.
+    std::vector<char> result_;
 };
 
 #endif
@@ -0,0 +1,92 @@
+#include "transcript.hpp"
+#include "sink.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+const std::string CaseEnd{"\"));"};
+
+namespace
+{
+    const std::string CaseBegin{"Assert.That(SPrintF("};
+    const std::string CaseResult{"), Is.EqualTo(\""};
+    const std::string FunctionBegin{"public void "};
+}
+
+auto Fnv1a(const char *data, size_t length, uint64_t hash) -> uint64_t
+{
+    for (size_t i = 0; i < length; i++) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 0x100000001B3;
+    }
+    return hash;
+}
+
+auto ParseCase(const std::string &line, CaseLine &position) -> bool
+{
+    size_t begin = line.find_first_not_of(' ');
+    if (begin == std::string::npos || line.compare(begin, CaseBegin.size(), CaseBegin) != 0) return false;
+    if (line.size() < CaseEnd.size() ||
+        line.compare(line.size() - CaseEnd.size(), CaseEnd.size(), CaseEnd) != 0) return false;
+
+    // The result is last and may contain anything, so search from the end.
+    size_t result = line.rfind(CaseResult, line.size() - CaseEnd.size());
+    if (result == std::string::npos || result < begin + CaseBegin.size()) return false;
+
+    position.callBegin = begin + CaseBegin.size();
+    position.callEnd = result;
+    position.resultBegin = result + CaseResult.size();
+    position.resultEnd = line.size() - CaseEnd.size();
+    return true;
+}
+
+auto ParseFunction(const std::string &line, std::string &name) -> bool
+{
+    size_t begin = line.find_first_not_of(' ');
+    if (begin == std::string::npos || line.compare(begin, FunctionBegin.size(), FunctionBegin) != 0) return false;
+
+    begin += FunctionBegin.size();
+    size_t end = line.find('(', begin);
+    if (end == std::string::npos) return false;
+    name = line.substr(begin, end - begin);
+    return true;
+}
+
+auto ReadFile(const std::string &fileName, std::string &contents) -> bool
+{
+    std::ifstream file{fileName, std::ios::binary};
+    if (!file) {
+        std::cerr << "Couldn't open " << fileName << std::endl;
+        return false;
+    }
+    std::ostringstream stream;
+    stream << file.rdbuf();
+    contents = stream.str();
+    return true;
+}
+
+auto SplitLines(const std::string &text) -> std::vector<std::string>
+{
+    std::vector<std::string> lines;
+    size_t begin = 0;
+    while (begin < text.size()) {
+        size_t end = text.find('\n', begin);
+        if (end == std::string::npos) end = text.size();
+        lines.push_back(text.substr(begin, end - begin));
+        begin = end + 1;
+    }
+    return lines;
+}
+
+auto ReadTranscript(const Options &options, GenerateFunction generate, std::string &transcript) -> bool
+{
+    if (!options.inputFile.empty()) return ReadFile(options.inputFile, transcript);
+
+    ArenaSink output{-1};
+    TestCaseGen gen{output};
+    gen.SetMinimal(options.minimal);
+    generate(gen);
+    transcript.assign(output.Data(), output.Size());
+    return true;
+}
@@ -0,0 +1,47 @@
+#ifndef TRANSCRIPT_HPP
+#define TRANSCRIPT_HPP
+
+#include "options.hpp"
+#include "shard.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Reading the generated test cases (a transcript) as text. A test case is a
+// line
+//
+//   Assert.That(SPrintF(<call>), Is.EqualTo("<result>"));
+//
+// where the call is the format and the arguments with their exact bits.
+
+extern const std::string CaseEnd;
+
+// The positions of the call and the result in a line of a transcript.
+struct CaseLine
+{
+    size_t callBegin;
+    size_t callEnd;
+    size_t resultBegin;
+    size_t resultEnd;
+};
+
+constexpr uint64_t Fnv1aBasis = 0xCBF29CE484222325;
+
+// The FNV-1a hash of the data, continuing from the given hash.
+auto Fnv1a(const char *data, size_t length, uint64_t hash = Fnv1aBasis) -> uint64_t;
+
+auto ParseCase(const std::string &line, CaseLine &position) -> bool;
+
+// Gets the name of the test function, if the line declares one.
+auto ParseFunction(const std::string &line, std::string &name) -> bool;
+
+auto ReadFile(const std::string &fileName, std::string &contents) -> bool;
+auto SplitLines(const std::string &text) -> std::vector<std::string>;
+
+// Reads the transcript given with --transcript, or generates the test cases
+// of this toolchain.
+auto ReadTranscript(const Options &options, GenerateFunction generate, std::string &transcript) -> bool;
+
+#endif
@@ -1,10 +1,13 @@
-namespace RJCP.Core.Text
+﻿namespace RJCP.Core.Text
 {
     using BenchmarkDotNet.Attributes;
     using static StringUtilities;
 
+    [MemoryDiagnoser]
     public class SPrintFBenchmark
     {
+        private readonly char[] _buffer = new char[64];
+
         [Benchmark]
         public void FormatE_Double() => SPrintF("%e", 123456.789);
 
@@ -41,9 +44,30 @@ namespace RJCP.Core.Text
         [Benchmark]
         public void FormatG_Single_System() => _ = string.Format("{0:G}", 123456.789f);
 
+        [Benchmark]
+        public void FormatE_Double_Buffer() => SNPrintF(_buffer, "%e", 123456.789);
+
+        [Benchmark]
+        public void FormatE_Single_Buffer() => SNPrintF(_buffer, "%e", 123456.789f);
+
+        [Benchmark]
+        public void FormatF_Double_Buffer() => SNPrintF(_buffer, "%f", 123456.789);
+
+        [Benchmark]
+        public void FormatF_Single_Buffer() => SNPrintF(_buffer, "%f", 123456.789f);
+
+        [Benchmark]
+        public void FormatG_Double_Buffer() => SNPrintF(_buffer, "%g", 123456.789);
+
+        [Benchmark]
+        public void FormatG_Single_Buffer() => SNPrintF(_buffer, "%g", 123456.789f);
+
         [Benchmark]
         public void FormatD_Integer() => SPrintF("%d", 16384);
 
+        [Benchmark]
+        public void FormatD_Integer_Params() => SPrintF("%d", new object[] { 16384 });
+
         [Benchmark]
         public void FormatD_Integer_System() => _ = string.Format("{0}", 16384);
 
@@ -52,5 +76,19 @@ namespace RJCP.Core.Text
 
         [Benchmark]
         public void FormatU_Unsigned_System() => _ = string.Format("{0}", 16384);
+
+        [Benchmark]
+        public void FormatX_Hex() => SPrintF("%llx", 0xFEDCBA9876543210);
+
+        [Benchmark]
+        public void FormatX_Hex_System() => _ = string.Format("{0:x}", 0xFEDCBA9876543210);
+
+#if NET6_0_OR_GREATER
+        [Benchmark]
+        public void FormatD_Integer_Span() => TrySPrintF(_buffer, out _, "%d", 16384);
+
+        [Benchmark]
+        public void FormatF_Double_Span() => TrySPrintF(_buffer, out _, "%f", 123456.789);
+#endif
     }
 }
@@ -0,0 +1,56 @@
+﻿namespace RJCP.Core
+{
+    using System;
+    using System.IO;
+    using Text;
+
+    public static class Program
+    {
+        public static int Main(string[] args)
+        {
+            bool parallel = true;
+            bool predicate = false;
+            bool digest = false;
+            foreach (string arg in args) {
+                switch (arg) {
+                case "--sequential":
+                    parallel = false;
+                    break;
+                case "--predicate":
+                    predicate = true;
+                    break;
+                case "--digest":
+                    digest = true;
+                    break;
+                default:
+                    Usage();
+                    return 1;
+                }
+            }
+
+            if (predicate) return SPrintFDiff.RunPredicate(Console.In, Console.Out);
+            if (digest) return TranscriptDigest.Run(Console.In, Console.Out, parallel);
+
+            using (Stream input = new BufferedStream(Console.OpenStandardInput(), 1 << 20))
+            using (StreamWriter output = new(Console.OpenStandardOutput())) {
+                return SPrintFDiff.RunStream(input, output, Console.Error, parallel);
+            }
+        }
+
+        private static void Usage()
+        {
+            Console.Error.WriteLine("Usage: sprintf --fuzz N --stream | RJCP.Core.TextDiff [--sequential]");
+            Console.Error.WriteLine("       RJCP.Core.TextDiff --predicate");
+            Console.Error.WriteLine("       sprintf | RJCP.Core.TextDiff --digest [--sequential]");
+            Console.Error.WriteLine();
+            Console.Error.WriteLine("Reads the binary test case stream of sprintf on stdin, and prints the test cases");
+            Console.Error.WriteLine("where SPrintF differs from the C library. Exits with 2 if any differ.");
+            Console.Error.WriteLine();
+            Console.Error.WriteLine("  --sequential  Don't run the test cases of a batch in parallel.");
+            Console.Error.WriteLine("  --predicate   Read tab separated test cases of sprintf --fuzz instead, and");
+            Console.Error.WriteLine("                exit with 0 if any fails, for sprintf --reduce --predicate.");
+            Console.Error.WriteLine("  --digest      Read the test cases generated by sprintf instead, and print the");
+            Console.Error.WriteLine("                digests of the results of SPrintF, as sprintf --digest.");
+        }
+    }
+}
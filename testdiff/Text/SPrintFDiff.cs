@@ -0,0 +1,72 @@
+﻿namespace RJCP.Core.Text
+{
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Threading.Tasks;
+
+    /// <summary>
+    /// Compares the results of the C library with the results of SPrintF.
+    /// </summary>
+    internal static class SPrintFDiff
+    {
+        /// <summary>
+        /// Runs every test case of the binary stream and prints the test cases that fail.
+        /// </summary>
+        /// <param name="input">The binary stream from <c>sprintf --stream</c>.</param>
+        /// <param name="output">Gets the failing test cases, one per line.</param>
+        /// <param name="error">Gets the summary.</param>
+        /// <param name="parallel">Run the test cases of a batch on all cores.</param>
+        /// <returns>Zero if all test cases pass, two if any fails.</returns>
+        public static int RunStream(Stream input, TextWriter output, TextWriter error, bool parallel)
+        {
+            TestStreamReader reader = new(input);
+            List<TestRecord> batch = new();
+            long records = 0;
+            long mismatches = 0;
+            while (reader.ReadBatch(batch)) {
+                if (parallel) {
+                    Parallel.For(0, batch.Count, i => batch[i].Run());
+                } else {
+                    foreach (TestRecord record in batch) {
+                        record.Run();
+                    }
+                }
+
+                // The order of the output is the order of the input, regardless of the threads.
+                foreach (TestRecord record in batch) {
+                    if (record.Passed) continue;
+                    mismatches++;
+                    output.WriteLine(record.ToString());
+                }
+                records += batch.Count;
+            }
+
+            output.Flush();
+            error.WriteLine("{0} records, {1} mismatches", records, mismatches);
+            return mismatches == 0 ? 0 : 2;
+        }
+
+        /// <summary>
+        /// Runs the tab separated test cases, for use as the predicate of <c>sprintf --reduce</c>.
+        /// </summary>
+        /// <param name="input">The test cases, one per line.</param>
+        /// <param name="output">Gets the failing test cases, one per line.</param>
+        /// <returns>Zero if any test case fails, one if all pass.</returns>
+        public static int RunPredicate(TextReader input, TextWriter output)
+        {
+            bool failed = false;
+            string line;
+            while ((line = input.ReadLine()) is not null) {
+                if (line.Length == 0) continue;
+
+                TestRecord record = TestRecordParser.Parse(line);
+                record.Run();
+                if (!record.Passed) {
+                    failed = true;
+                    output.WriteLine(record.ToString());
+                }
+            }
+            return failed ? 0 : 1;
+        }
+    }
+}
@@ -0,0 +1,15 @@
+﻿namespace RJCP.Core.Text
+{
+    /// <summary>
+    /// The type of an argument in the binary test case stream written by <c>test/Text/sprintf</c>.
+    /// </summary>
+    internal enum StreamArgType : byte
+    {
+        Int32 = 1,
+        Int64 = 2,
+        Double = 3,
+        Single = 4,
+        Char = 5,
+        String = 6
+    }
+}
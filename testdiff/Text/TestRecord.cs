@@ -0,0 +1,85 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using System.Globalization;
+    using System.Text;
+
+    /// <summary>
+    /// A single test case, the format and arguments for SPrintF, and the result expected from the C library.
+    /// </summary>
+    internal sealed class TestRecord
+    {
+        public TestRecord(ulong id, string format, object[] args, string expected)
+        {
+            Id = id;
+            Format = format;
+            Args = args;
+            Expected = expected;
+        }
+
+        /// <summary>
+        /// The test case number, or the bit pattern of the value, as given by the generator.
+        /// </summary>
+        public ulong Id { get; }
+
+        public string Format { get; }
+
+        public object[] Args { get; }
+
+        public string Expected { get; }
+
+        /// <summary>
+        /// The result of SPrintF, or the exception it raised.
+        /// </summary>
+        public string Actual { get; private set; }
+
+        public bool Passed { get; private set; }
+
+        public void Run()
+        {
+            try {
+                Actual = StringUtilities.SPrintF(Format, Args);
+            } catch (Exception ex) {
+                Actual = string.Format("<{0}: {1}>", ex.GetType().Name, ex.Message);
+            }
+            Passed = string.Equals(Expected, Actual, StringComparison.Ordinal);
+        }
+
+        /// <summary>
+        /// Gets the arguments as C# source, in the same form as the generated NUnit test cases.
+        /// </summary>
+        public string ArgsToString()
+        {
+            StringBuilder sb = new();
+            foreach (object arg in Args) {
+                if (sb.Length > 0) sb.Append(", ");
+                switch (arg) {
+                case int vInt:
+                    sb.Append(vInt.ToString(CultureInfo.InvariantCulture));
+                    break;
+                case long vLong:
+                    sb.Append(vLong.ToString(CultureInfo.InvariantCulture)).Append('L');
+                    break;
+                case double vDouble:
+                    sb.AppendFormat("UInt64ToDouble(0x{0:x16})", BitConverter.DoubleToInt64Bits(vDouble));
+                    break;
+                case float vFloat:
+                    sb.AppendFormat("UInt32ToFloat(0x{0:x8})", BitConverter.ToUInt32(BitConverter.GetBytes(vFloat), 0));
+                    break;
+                case char vChar:
+                    sb.Append('\'').Append(vChar).Append('\'');
+                    break;
+                default:
+                    sb.Append('"').Append(arg).Append('"');
+                    break;
+                }
+            }
+            return sb.ToString();
+        }
+
+        public override string ToString()
+        {
+            return string.Format("{0}\t{1}\t{2}\t{3}\t{4}", Id, Format, ArgsToString(), Expected, Actual);
+        }
+    }
+}
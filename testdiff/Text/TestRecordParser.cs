@@ -0,0 +1,157 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Globalization;
+
+    /// <summary>
+    /// Parses a tab separated test case, as printed by <c>sprintf --fuzz</c> or by this program.
+    /// </summary>
+    /// <remarks>
+    /// The line is <c>id TAB format TAB arguments TAB expected</c>, where the arguments are in the C# syntax of the
+    /// generated test cases, e.g. <c>-5, 10L, UInt64ToDouble(0x3ff0000000000000), 'c', "str"</c>. Any further
+    /// columns are ignored. The arguments may also be the literals of the generated NUnit test cases, e.g.
+    /// <c>123.45</c>, <c>1e100</c>, <c>0x8000000000000000UL</c> or <c>Double.NaN</c>.
+    /// </remarks>
+    internal static class TestRecordParser
+    {
+        public static TestRecord Parse(string line)
+        {
+            if (line is null) throw new ArgumentNullException(nameof(line));
+
+            string[] columns = line.Split('\t');
+            if (columns.Length < 4) throw new FormatException("Expected at least four tab separated columns");
+
+            ulong id = ulong.Parse(columns[0], CultureInfo.InvariantCulture);
+            object[] args = ParseArgs(columns[2]);
+            return new TestRecord(id, columns[1], args, columns[3]);
+        }
+
+        /// <summary>
+        /// Parses the call of a generated NUnit test case, the format and the arguments of SPrintF.
+        /// </summary>
+        /// <param name="id">The identifier of the test case.</param>
+        /// <param name="call">The text between <c>SPrintF(</c> and <c>), Is.EqualTo(</c>.</param>
+        /// <param name="expected">The expected result.</param>
+        /// <returns>The test case.</returns>
+        public static TestRecord ParseCall(ulong id, string call, string expected)
+        {
+            if (call is null) throw new ArgumentNullException(nameof(call));
+            if (call.Length < 2 || call[0] != '"') throw new FormatException("Expected the format string");
+
+            int end = call.IndexOf("\", ", StringComparison.Ordinal);
+            if (end < 0) {
+                if (call[call.Length - 1] != '"') throw new FormatException("Unterminated format string");
+                return new TestRecord(id, call.Substring(1, call.Length - 2), Array.Empty<object>(), expected);
+            }
+            return new TestRecord(id, call.Substring(1, end - 1), ParseArgs(call.Substring(end + 3)), expected);
+        }
+
+        private static object[] ParseArgs(string args)
+        {
+            List<object> values = new();
+            int position = 0;
+            while (position < args.Length) {
+                if (values.Count > 0) {
+                    if (string.CompareOrdinal(args, position, ", ", 0, 2) != 0)
+                        throw new FormatException("Expected ', ' between arguments");
+                    position += 2;
+                }
+                values.Add(ParseArg(args, ref position));
+            }
+            return values.ToArray();
+        }
+
+        private static object ParseArg(string args, ref int position)
+        {
+            char c = args[position];
+            if (c == '\'') {
+                if (position + 2 >= args.Length || args[position + 2] != '\'')
+                    throw new FormatException("Invalid character argument");
+                position += 3;
+                return args[position - 2];
+            }
+
+            if (c == '"') {
+                int end = args.IndexOf('"', position + 1);
+                if (end < 0) throw new FormatException("Unterminated string argument");
+                string value = args.Substring(position + 1, end - position - 1);
+                position = end + 1;
+                return value;
+            }
+
+            if (StartsWith(args, position, "UInt64ToDouble(0x")) {
+                ulong bits = ParseHex(args, ref position, "UInt64ToDouble(0x".Length);
+                return BitConverter.Int64BitsToDouble(unchecked((long)bits));
+            }
+
+            if (StartsWith(args, position, "UInt32ToFloat(0x")) {
+                uint bits = (uint)ParseHex(args, ref position, "UInt32ToFloat(0x".Length);
+                return BitConverter.ToSingle(BitConverter.GetBytes(bits), 0);
+            }
+
+            if (StartsWith(args, position, "Double.")) {
+                int end = args.IndexOf(',', position);
+                if (end < 0) end = args.Length;
+                string name = args.Substring(position, end - position);
+                position = end;
+                switch (name) {
+                case "Double.NaN": return double.NaN;
+                case "Double.PositiveInfinity": return double.PositiveInfinity;
+                case "Double.NegativeInfinity": return double.NegativeInfinity;
+                default: throw new FormatException("Unknown constant " + name);
+                }
+            }
+
+            if (StartsWith(args, position, "0x")) {
+                int hexStart = position + 2;
+                position = hexStart;
+                while (position < args.Length && Uri.IsHexDigit(args[position])) position++;
+                ulong hex = ulong.Parse(args.Substring(hexStart, position - hexStart), NumberStyles.AllowHexSpecifier, CultureInfo.InvariantCulture);
+                if (StartsWith(args, position, "UL")) {
+                    position += 2;
+                    return hex;
+                }
+                if (hex <= int.MaxValue) return (int)hex;
+                return (uint)hex;
+            }
+
+            int start = position;
+            bool real = false;
+            if (c == '-') position++;
+            while (position < args.Length) {
+                char digit = args[position];
+                if (digit is '.' or 'e' or 'E') {
+                    real = true;
+                } else if (digit is '+' or '-') {
+                    if (args[position - 1] is not 'e' and not 'E') break;
+                } else if (digit is < '0' or > '9') {
+                    break;
+                }
+                position++;
+            }
+            string number = args.Substring(start, position - start);
+            if (real) return double.Parse(number, NumberStyles.Float, CultureInfo.InvariantCulture);
+            if (position < args.Length && args[position] == 'L') {
+                position++;
+                return long.Parse(number, NumberStyles.AllowLeadingSign, CultureInfo.InvariantCulture);
+            }
+            return int.Parse(number, NumberStyles.AllowLeadingSign, CultureInfo.InvariantCulture);
+        }
+
+        private static bool StartsWith(string args, int position, string prefix)
+        {
+            return string.CompareOrdinal(args, position, prefix, 0, prefix.Length) == 0;
+        }
+
+        private static ulong ParseHex(string args, ref int position, int prefixLength)
+        {
+            int start = position + prefixLength;
+            int end = args.IndexOf(')', start);
+            if (end < 0) throw new FormatException("Expected ')'");
+            ulong value = ulong.Parse(args.Substring(start, end - start), NumberStyles.AllowHexSpecifier, CultureInfo.InvariantCulture);
+            position = end + 1;
+            return value;
+        }
+    }
+}
@@ -0,0 +1,141 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Text;
+
+    /// <summary>
+    /// Reads the binary stream of test cases written by <c>sprintf --stream</c>.
+    /// </summary>
+    /// <remarks>
+    /// The stream is a header, followed by batches of records. Each batch starts with the number of records and the
+    /// number of bytes that follow. A batch with no records ends the stream. See <c>test/Text/sprintf/stream.hpp</c>
+    /// for the layout of a record. All values are little endian.
+    /// </remarks>
+    internal sealed class TestStreamReader
+    {
+        private const int HeaderLength = 16;
+        private const int BatchHeaderLength = 8;
+        private const int Version = 1;
+        private static readonly byte[] Magic = Encoding.ASCII.GetBytes("SPRINTFS");
+
+        private readonly Stream _stream;
+        private byte[] _buffer = new byte[65536];
+        private bool _header;
+
+        public TestStreamReader(Stream stream)
+        {
+            if (stream is null) throw new ArgumentNullException(nameof(stream));
+            if (!BitConverter.IsLittleEndian) throw new PlatformNotSupportedException("The stream is little endian");
+            _stream = stream;
+        }
+
+        /// <summary>
+        /// Reads the next batch of records.
+        /// </summary>
+        /// <param name="records">The list that is filled with the records of the batch.</param>
+        /// <returns><see langword="true"/> if a batch was read, <see langword="false"/> at the end of the stream.</returns>
+        /// <exception cref="InvalidDataException">The stream is corrupt.</exception>
+        public bool ReadBatch(List<TestRecord> records)
+        {
+            if (records is null) throw new ArgumentNullException(nameof(records));
+            records.Clear();
+
+            if (!_header) {
+                ReadHeader();
+                _header = true;
+            }
+
+            if (!ReadExactly(BatchHeaderLength)) return false;
+            int count = BitConverter.ToInt32(_buffer, 0);
+            int length = BitConverter.ToInt32(_buffer, 4);
+            if (count == 0) return false;
+            if (count < 0 || length < 0) throw new InvalidDataException("Invalid batch header");
+
+            if (_buffer.Length < length) _buffer = new byte[length];
+            if (!ReadExactly(length)) throw new InvalidDataException("Incomplete batch");
+
+            int position = 0;
+            for (int i = 0; i < count; i++) {
+                records.Add(ReadRecord(ref position, length));
+            }
+            if (position != length) throw new InvalidDataException("Batch length doesn't match its records");
+            return true;
+        }
+
+        private void ReadHeader()
+        {
+            if (!ReadExactly(HeaderLength)) throw new InvalidDataException("Missing stream header");
+            for (int i = 0; i < Magic.Length; i++) {
+                if (_buffer[i] != Magic[i]) throw new InvalidDataException("Not a test case stream");
+            }
+            if (BitConverter.ToInt32(_buffer, 8) != Version) throw new InvalidDataException("Unsupported stream version");
+        }
+
+        private bool ReadExactly(int length)
+        {
+            int offset = 0;
+            while (offset < length) {
+                int read = _stream.Read(_buffer, offset, length - offset);
+                if (read == 0) {
+                    if (offset == 0) return false;
+                    throw new InvalidDataException("Unexpected end of stream");
+                }
+                offset += read;
+            }
+            return true;
+        }
+
+        private TestRecord ReadRecord(ref int position, int length)
+        {
+            ulong id = BitConverter.ToUInt64(_buffer, Take(ref position, 8, length));
+            string format = ReadString(ref position, length);
+
+            int count = _buffer[Take(ref position, 1, length)];
+            object[] args = new object[count];
+            for (int i = 0; i < count; i++) {
+                StreamArgType type = (StreamArgType)_buffer[Take(ref position, 1, length)];
+                switch (type) {
+                case StreamArgType.Int32:
+                    args[i] = BitConverter.ToInt32(_buffer, Take(ref position, 4, length));
+                    break;
+                case StreamArgType.Int64:
+                    args[i] = BitConverter.ToInt64(_buffer, Take(ref position, 8, length));
+                    break;
+                case StreamArgType.Double:
+                    args[i] = BitConverter.ToDouble(_buffer, Take(ref position, 8, length));
+                    break;
+                case StreamArgType.Single:
+                    args[i] = BitConverter.ToSingle(_buffer, Take(ref position, 4, length));
+                    break;
+                case StreamArgType.Char:
+                    args[i] = (char)BitConverter.ToUInt16(_buffer, Take(ref position, 2, length));
+                    break;
+                case StreamArgType.String:
+                    args[i] = ReadString(ref position, length);
+                    break;
+                default:
+                    throw new InvalidDataException("Unknown argument type");
+                }
+            }
+
+            string expected = ReadString(ref position, length);
+            return new TestRecord(id, format, args, expected);
+        }
+
+        private string ReadString(ref int position, int length)
+        {
+            int stringLength = BitConverter.ToUInt16(_buffer, Take(ref position, 2, length));
+            return Encoding.UTF8.GetString(_buffer, Take(ref position, stringLength, length), stringLength);
+        }
+
+        private static int Take(ref int position, int count, int length)
+        {
+            int offset = position;
+            if (length - offset < count) throw new InvalidDataException("Record exceeds its batch");
+            position += count;
+            return offset;
+        }
+    }
+}
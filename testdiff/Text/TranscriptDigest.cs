@@ -0,0 +1,178 @@
+﻿namespace RJCP.Core.Text
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Globalization;
+    using System.IO;
+    using System.Text;
+    using System.Threading.Tasks;
+
+    /// <summary>
+    /// Computes the digest of the results of SPrintF for the test cases of a transcript, as <c>sprintf --digest</c>
+    /// does for the results of the C library.
+    /// </summary>
+    /// <remarks>
+    /// There is a digest for each test category (the test function) and for each band of binary exponents within the
+    /// category. The digest is the FNV-1a hash of <c>call TAB result LF</c> of the test cases in order, where the
+    /// call is the format and the arguments as in the transcript. See <c>test/Text/sprintf/digest.cpp</c>.
+    /// </remarks>
+    internal static class TranscriptDigest
+    {
+        private const string FunctionBegin = "public void ";
+        private const string CaseBegin = "Assert.That(SPrintF(";
+        private const string CaseResult = "), Is.EqualTo(\"";
+        private const string CaseEnd = "\"));";
+
+        private const ulong FnvBasis = 0xCBF29CE484222325;
+        private const ulong FnvPrime = 0x100000001B3;
+
+        private const int DoubleBandExponents = 64;
+        private const int SingleBandExponents = 8;
+
+        private sealed class Digest
+        {
+            public long Records { get; private set; }
+
+            public ulong Hash { get; private set; } = FnvBasis;
+
+            public void Add(byte[] record)
+            {
+                ulong hash = Hash;
+                foreach (byte b in record) {
+                    hash = (hash ^ b) * FnvPrime;
+                }
+                Hash = hash;
+                Records++;
+            }
+        }
+
+        private sealed class Category
+        {
+            public Category(string name)
+            {
+                Name = name;
+            }
+
+            public string Name { get; }
+
+            public Digest Digest { get; } = new();
+
+            public SortedDictionary<int, Digest> Bands { get; } = new();
+
+            public int BandExponents { get; set; }
+
+            public List<string> Calls { get; } = new();
+
+            public List<TestRecord> Records { get; } = new();
+        }
+
+        /// <summary>
+        /// Reads the transcript and prints the digests.
+        /// </summary>
+        /// <param name="input">The transcript, as generated by <c>sprintf</c>.</param>
+        /// <param name="output">Gets the digests, one per line.</param>
+        /// <param name="parallel">Run the test cases on all cores.</param>
+        /// <returns>Zero.</returns>
+        public static int Run(TextReader input, TextWriter output, bool parallel)
+        {
+            List<Category> categories = new();
+            List<TestRecord> records = new();
+            string line;
+            while ((line = input.ReadLine()) is not null) {
+                string trimmed = line.TrimStart(' ');
+                if (trimmed.StartsWith(FunctionBegin, StringComparison.Ordinal)) {
+                    int end = trimmed.IndexOf('(');
+                    if (end < 0) continue;
+                    categories.Add(new Category(trimmed.Substring(FunctionBegin.Length, end - FunctionBegin.Length)));
+                    continue;
+                }
+
+                if (categories.Count == 0 || !trimmed.StartsWith(CaseBegin, StringComparison.Ordinal) ||
+                    !trimmed.EndsWith(CaseEnd, StringComparison.Ordinal)) continue;
+
+                int result = trimmed.LastIndexOf(CaseResult, StringComparison.Ordinal);
+                if (result < CaseBegin.Length) continue;
+
+                string call = trimmed.Substring(CaseBegin.Length, result - CaseBegin.Length);
+                int resultBegin = result + CaseResult.Length;
+                string expected = trimmed.Substring(resultBegin, trimmed.Length - CaseEnd.Length - resultBegin);
+                TestRecord record = TestRecordParser.ParseCall((ulong)records.Count, call, expected);
+
+                Category category = categories[categories.Count - 1];
+                category.Calls.Add(call);
+                category.Records.Add(record);
+                records.Add(record);
+            }
+
+            if (parallel) {
+                Parallel.For(0, records.Count, i => records[i].Run());
+            } else {
+                foreach (TestRecord record in records) {
+                    record.Run();
+                }
+            }
+
+            foreach (Category category in categories) {
+                for (int i = 0; i < category.Records.Count; i++) {
+                    string call = category.Calls[i];
+                    byte[] record = Encoding.UTF8.GetBytes(call + "\t" + category.Records[i].Actual + "\n");
+                    category.Digest.Add(record);
+
+                    int band = Band(call, out int bandExponents);
+                    if (band < 0) continue;
+                    category.BandExponents = bandExponents;
+                    if (!category.Bands.TryGetValue(band, out Digest digest)) {
+                        digest = new Digest();
+                        category.Bands.Add(band, digest);
+                    }
+                    digest.Add(record);
+                }
+
+                WriteDigest(output, category.Name, "*", category.Digest);
+                foreach (var band in category.Bands) {
+                    string name = string.Format(CultureInfo.InvariantCulture, "E={0}-{1}",
+                        band.Key, band.Key + category.BandExponents - 1);
+                    WriteDigest(output, category.Name, name, band.Value);
+                }
+            }
+            output.Flush();
+            return 0;
+        }
+
+        private static int Band(string call, out int bandExponents)
+        {
+            const string DoublePrefix = "UInt64ToDouble(0x";
+            const string SinglePrefix = "UInt32ToFloat(0x";
+
+            int position = call.IndexOf(DoublePrefix, StringComparison.Ordinal);
+            if (position >= 0) {
+                ulong bits = ParseHex(call, position + DoublePrefix.Length);
+                bandExponents = DoubleBandExponents;
+                return (int)((bits >> 52) & 0x7FF) / bandExponents * bandExponents;
+            }
+
+            position = call.IndexOf(SinglePrefix, StringComparison.Ordinal);
+            if (position >= 0) {
+                ulong bits = ParseHex(call, position + SinglePrefix.Length);
+                bandExponents = SingleBandExponents;
+                return (int)((bits >> 23) & 0xFF) / bandExponents * bandExponents;
+            }
+
+            bandExponents = 0;
+            return -1;
+        }
+
+        private static ulong ParseHex(string call, int start)
+        {
+            int end = start;
+            while (end < call.Length && Uri.IsHexDigit(call[end])) end++;
+            return ulong.Parse(call.Substring(start, end - start), NumberStyles.AllowHexSpecifier, CultureInfo.InvariantCulture);
+        }
+
+        private static void WriteDigest(TextWriter output, string category, string band, Digest digest)
+        {
+            output.Write(string.Format(CultureInfo.InvariantCulture, "{0}\t{1}\t{2}\t{3:x16}\n",
+                category, band, digest.Records, digest.Hash));
+        }
+    }
+}